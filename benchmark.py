@@ -0,0 +1,192 @@
+'''
+Measures what including the generated header costs - time and peak memory
+of preprocessing, parsing and code generation of a translation unit which
+only includes the header. Full, lean (comment-less) and split headers are
+compared, for every available compiler in C and C++ mode.
+
+Headers are generated from the current yaml files into a temporary
+directory. With --baseline, the results are compared to results of
+a previous run (written by --json).
+'''
+from typing import Dict, List, Optional, Tuple
+
+import argparse
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+COMPILERS = [ 'gcc', 'clang' ]
+
+LANGUAGES = {
+    'c': [ '-x', 'c', '-std=c11' ],
+    'c++': [ '-x', 'c++', '-std=c++17' ],
+}
+
+PHASES = {
+    'preprocess': [ '-E', '-o', os.devnull ],
+    'parse': [ '-fsyntax-only' ],
+    'codegen': [ '-c', '-O2', '-o', os.devnull ],
+}
+
+#
+# Included header (relative to the output directory) of every configuration.
+#
+HEADERS = {
+    'full': 'full/ia32.h',
+    'lean': 'full/ia32_lean.h',
+    'split': 'split/ia32.h',
+    'split-vmx': 'split/ia32/vmx.h',
+    'split-paging': 'split/ia32/paging.h',
+}
+
+
+def generate_headers(directory: str) -> None:
+    root_directory = os.path.dirname(os.path.abspath(__file__))
+    main_path = os.path.join(root_directory, 'main.py')
+    input_path = os.path.join(root_directory, 'yaml', 'Intel', 'index.yml')
+
+    #
+    # Run in the temporary directory, so that caches of the generator
+    # end up there as well.
+    #
+    for args in [
+        [ '-o', os.path.join('full', 'ia32.h'), '--lean' ],
+        [ '-o', os.path.join('split', 'ia32.h'), '--split' ],
+    ]:
+        os.makedirs(os.path.join(directory, os.path.dirname(args[1])), exist_ok=True)
+        subprocess.run([ sys.executable, main_path, '-i', input_path ] + args, check=True,
+                       stderr=subprocess.DEVNULL, cwd=directory)
+
+
+def measure(command: List[str]) -> Tuple[float, int]:
+    '''
+    Returns wall time (in seconds) and peak RSS (in KiB) of the command.
+    '''
+    #
+    # Diagnostics go to a file - a pipe would block the compiler once its
+    # buffer is full, since nothing reads it before the process is reaped.
+    #
+    with tempfile.TemporaryFile() as stderr_file:
+        time_start = time.perf_counter()
+        process = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=stderr_file)
+        _, status, rusage = os.wait4(process.pid, 0)
+        elapsed = time.perf_counter() - time_start
+
+        #
+        # The process was already reaped by wait4.
+        #
+        process.returncode = status
+        stderr_file.seek(0)
+        stderr = stderr_file.read().decode(errors='replace')
+
+    if status != 0:
+        raise Exception(f'"{" ".join(command)}" failed:\n{stderr}')
+
+    return elapsed, rusage.ru_maxrss
+
+
+def header_stats(path: str) -> dict:
+    with open(path, encoding='utf-8') as f:
+        text = f.read()
+
+    return {
+        'bytes': len(text.encode('utf-8')),
+        'lines': text.count('\n'),
+        'macros': sum(1 for line in text.splitlines() if line.lstrip().startswith('#define')),
+    }
+
+
+def run(directory: str, repeat: int) -> Dict[str, dict]:
+    result = { }
+    source_path = os.path.join(directory, 'tu.c')
+
+    for header, header_path in HEADERS.items():
+        result[f'header/{header}'] = header_stats(os.path.join(directory, header_path))
+
+    for compiler in COMPILERS:
+        if not shutil.which(compiler):
+            print(f'{compiler} not found, skipped', file=sys.stderr)
+            continue
+
+        for language, language_args in LANGUAGES.items():
+            for header, header_path in HEADERS.items():
+                with open(source_path, 'w') as f:
+                    f.write(f'#include "{header_path}"\n')
+
+                for phase, phase_args in PHASES.items():
+                    command = [ compiler ] + language_args + phase_args + [
+                        '-I', directory, source_path
+                    ]
+
+                    samples = [ measure(command) for _ in range(repeat) ]
+
+                    result[f'{compiler}/{language}/{header}/{phase}'] = {
+                        'time': min(elapsed for elapsed, _ in samples),
+                        'rss': max(rss for _, rss in samples),
+                    }
+
+    return result
+
+
+def delta(value: float, baseline_value: Optional[float]) -> str:
+    if not baseline_value:
+        return ''
+
+    return f'{(value - baseline_value) / baseline_value * 100:+.1f}%'
+
+
+def print_results(result: Dict[str, dict], baseline: Dict[str, dict]) -> None:
+    print(f'{"Header":<40} {"Bytes":>10} {"":>8} {"Lines":>8} {"":>8} {"Macros":>8} {"":>8}')
+
+    for key, stats in result.items():
+        if key.startswith('header/'):
+            baseline_stats = baseline.get(key, { })
+            print(f'{key[len("header/"):]:<40} '
+                  f'{stats["bytes"]:>10} {delta(stats["bytes"], baseline_stats.get("bytes")):>8} '
+                  f'{stats["lines"]:>8} {delta(stats["lines"], baseline_stats.get("lines")):>8} '
+                  f'{stats["macros"]:>8} {delta(stats["macros"], baseline_stats.get("macros")):>8}')
+
+    print()
+    print(f'{"Compiler/language/header/phase":<40} {"Time [ms]":>10} {"":>8} {"RSS [MiB]":>10} {"":>8}')
+
+    for key, stats in result.items():
+        if not key.startswith('header/'):
+            baseline_stats = baseline.get(key, { })
+            print(f'{key:<40} '
+                  f'{stats["time"] * 1000:>10.1f} {delta(stats["time"], baseline_stats.get("time")):>8} '
+                  f'{stats["rss"] / 1024:>10.1f} {delta(stats["rss"], baseline_stats.get("rss")):>8}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Measures compile-time cost of the generated headers.')
+    parser.add_argument('-r', '--repeat', type=int, default=5, metavar='N',
+                        help='number of runs of every command, the fastest one is reported (default: %(default)s)')
+    parser.add_argument('--json', metavar='PATH',
+                        help='write results (JSON) into PATH')
+    parser.add_argument('--baseline', metavar='PATH',
+                        help='report deltas against results of a previous run')
+    args = parser.parse_args()
+
+    baseline = { }
+
+    if args.baseline:
+        with open(args.baseline, encoding='utf-8') as f:
+            baseline = json.load(f)
+
+    with tempfile.TemporaryDirectory() as directory:
+        generate_headers(directory)
+        result = run(directory, args.repeat)
+
+    print_results(result, baseline)
+
+    if args.json:
+        with open(args.json, 'w', encoding='utf-8') as f:
+            json.dump(result, f, indent=2)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,113 @@
+from typing import Dict, List, Optional
+
+import glob
+import hashlib
+import os
+import pickle
+
+from .doc import DocBase
+from .log import log
+
+
+class DocCache(object):
+    '''
+    Persistent on-disk snapshot of the parsed document tree.
+
+    The snapshot holds the complete DocBase tree (with all includes expanded
+    and all cached properties resolved) together with SHA-256 digests of
+    every YAML file which was used (or probed for, in case of missing
+    includes) while building it. The snapshot is used only when none of
+    these files changed, otherwise the tree is parsed again and the snapshot
+    is rewritten.
+    '''
+
+    VERSION = 1
+
+    def __init__(self, directory: str):
+        self.directory = directory
+
+    def load(self, path: str) -> Optional[List[DocBase]]:
+        try:
+            with open(self._snapshot_path(path), 'rb') as f:
+                snapshot = pickle.load(f)
+        except (OSError, EOFError, pickle.UnpicklingError, AttributeError, ImportError):
+            return None
+
+        for file_path, digest in snapshot['files'].items():
+            if self._file_digest(file_path) != digest:
+                return None
+
+        log(f'Parsing "{path}"...(snapshot)')
+
+        return snapshot['doc_list']
+
+    def store(self, path: str, doc_list: List[DocBase]) -> None:
+        #
+        # Store names, descriptions and bit ranges already computed.
+        #
+        for doc in doc_list:
+            doc.resolve()
+
+        snapshot = {
+            'files': self._dependencies(path, doc_list),
+            'doc_list': doc_list,
+        }
+
+        os.makedirs(self.directory, exist_ok=True)
+
+        #
+        # Write to temporary file first, so that concurrent runs
+        # never see partially written snapshot.
+        #
+        snapshot_path = self._snapshot_path(path)
+        snapshot_path_tmp = f'{snapshot_path}.{os.getpid()}.tmp'
+
+        with open(snapshot_path_tmp, 'wb') as f:
+            pickle.dump(snapshot, f, pickle.HIGHEST_PROTOCOL)
+
+        os.replace(snapshot_path_tmp, snapshot_path)
+
+    def _snapshot_path(self, path: str) -> str:
+        key = hashlib.sha256()
+        key.update(f'{self.VERSION}:{os.path.abspath(path)}'.encode('utf-8'))
+        key.update(self.generator_digest().encode('utf-8'))
+
+        return os.path.join(self.directory, f'{key.hexdigest()[:32]}.pickle')
+
+    def _dependencies(self, path: str, doc_list: List[DocBase]) -> Dict[str, Optional[str]]:
+        result = { path: self._file_digest(path) }
+
+        for root in doc_list:
+            for doc in root.walk():
+                for include in doc.include:
+                    #
+                    # Record every probed path - even those that do not exist,
+                    # so that creating a previously missing include invalidates
+                    # the snapshot as well.
+                    #
+                    for include_path in doc.include_paths(include):
+                        result[include_path] = self._file_digest(include_path)
+
+        return result
+
+    @staticmethod
+    def _file_digest(path: str) -> Optional[str]:
+        try:
+            with open(path, 'rb') as f:
+                return hashlib.sha256(f.read()).hexdigest()
+        except OSError:
+            return None
+
+    @staticmethod
+    def generator_digest() -> str:
+        #
+        # Pickled tree depends on the layout of Doc* classes - invalidate
+        # the snapshot whenever the generator itself changes.
+        #
+        digest = hashlib.sha256()
+
+        for file_path in sorted(glob.glob(os.path.join(os.path.dirname(__file__), '*.py'))):
+            with open(file_path, 'rb') as f:
+                digest.update(f.read())
+
+        return digest.hexdigest()
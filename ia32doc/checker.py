@@ -0,0 +1,99 @@
+from typing import List, Tuple
+
+import json
+
+from .doc import DocBase, DocBitfield, DocBitfieldField
+
+
+class DocBitfieldChecker(object):
+    '''
+    Validates layout of every DocBitfield in the tree.
+
+    Overlapping fields and fields exceeding Size of the bitfield are
+    rejected by DocLoader (with file and line) while the tree is loaded,
+    this checker reports only:
+      - out of order - field starts below the previous field (the processor
+                       expects fields sorted by their bits)
+    Gaps (bits not covered by any field) are not errors - they are emitted
+    as ReservedN members - but they are part of the coverage report.
+    '''
+
+    def __init__(self):
+        self.report = []
+        self.errors: List[str] = []
+
+    def check(self, doc_list: List[DocBase]) -> bool:
+        for root in doc_list:
+            for doc in root.walk():
+                if isinstance(doc, DocBitfield):
+                    self._check_bitfield(doc)
+
+        return not self.errors
+
+    def write_report(self, path: str) -> None:
+        with open(path, 'w', encoding='utf-8') as f:
+            json.dump({
+                'bitfields': self.report,
+                'errors': self.errors,
+            }, f, indent=2)
+
+    def _check_bitfield(self, doc: DocBitfield) -> None:
+        name = doc.alternative_name or doc.long_name
+        size = doc.size
+        covered_mask = 0
+        previous_field = None
+
+        out_of_order = []
+
+        for field in doc.fields:
+            if not isinstance(field, DocBitfieldField):
+                continue
+
+            bit_from, bit_to = field.bit
+
+            if previous_field and bit_from < previous_field.bit[0]:
+                out_of_order.append({
+                    'field': field.long_name,
+                    'previous_field': previous_field.long_name,
+                })
+                self._error(doc, f'{name}.{field.long_name}: defined after {previous_field.long_name}, '
+                                 f'but starts at lower bit ({bit_from})')
+
+            covered_mask |= ((1 << (bit_to - bit_from)) - 1) << bit_from
+            previous_field = field
+
+        size_mask = (1 << size) - 1
+
+        self.report.append({
+            'name': name,
+            'path': doc.origin_path,
+            'size': size,
+            'covered_mask': f'0x{covered_mask & size_mask:0{size // 4}X}',
+            'covered_bits': bin(covered_mask & size_mask).count('1'),
+            'gaps': [ [ bit_from, bit_to - 1 ] for bit_from, bit_to in self._mask_to_ranges(~covered_mask & size_mask) ],
+            'out_of_order': out_of_order,
+        })
+
+    def _error(self, doc: DocBase, message: str) -> None:
+        self.errors.append(f'{doc.origin_path}: {message}')
+
+    @staticmethod
+    def _mask_to_ranges(mask: int) -> List[Tuple[int, int]]:
+        '''
+        Returns list of half-open [bit_from, bit_to) ranges of set bits.
+        '''
+        result = []
+        bit = 0
+
+        while mask >> bit:
+            if (mask >> bit) & 1:
+                bit_from = bit
+
+                while (mask >> bit) & 1:
+                    bit += 1
+
+                result.append((bit_from, bit))
+            else:
+                bit += 1
+
+        return result
@@ -0,0 +1,380 @@
+from typing import Callable, List, NamedTuple
+
+import os
+
+from .doc import *
+from .log import log
+from .output import DocOutput, DocOutputBuffer
+from .processor import DocProcessor
+from .processor_ctx import DocProcessorContext
+
+
+class DocDecoderField(NamedTuple):
+    member: str
+    local: str
+    bit_from: int
+    flag: str
+    mask: str
+    is_flag: bool
+
+
+class DocDecoder(DocProcessor):
+    '''
+    Bulk decoder of page tables - helper library on top of the C header.
+    Whole table (512 raw entries) is decoded into columns (structure of
+    arrays): 1-bit fields into bitmaps (bit "i % 64" of element "i / 64"
+    belongs to entry "i"), wider fields into one element per entry.
+
+    Every table has scalar, AVX2 and AVX-512 variant of the decoder and
+    a dispatcher selecting the best one supported by the CPU (and the OS)
+    at runtime. Vector variants are compiled by the target attribute (or
+    by MSVC as they are), the sources don't need -mavx2/-mavx512f.
+
+    Bit positions are taken from the bitfields, therefore they always match
+    the header.
+    '''
+
+    #
+    # Tables and their decoded fields (long names - fields missing
+    # in the bitfield are skipped). LARGE_PAGE (PDPTE, PDE) tells 1GB/2MB
+    # pages from pointers to the next table - page frame number of a large
+    # page includes its PAT and reserved bits.
+    #
+    DECODE_TYPES = [ 'PML4E', 'PDPTE', 'PDE', 'PTE' ]
+    DECODE_FIELDS = [ 'PRESENT', 'WRITE', 'LARGE_PAGE', 'EXECUTE_DISABLE', 'PAGE_FRAME_NUMBER' ]
+
+    ENTRY_COUNT = 512
+
+    def __init__(self, include: str, output: DocOutput=None, ctx: DocProcessorContext=None):
+        super().__init__(output, ctx)
+        self.include = include
+
+    def generate(self, doc_list: List[DocBase], output_path: str) -> None:
+        log(f'Generating "{output_path}"...')
+
+        decode_list = [
+            doc for root in doc_list for doc in root.walk()
+            if isinstance(doc, DocBitfield) and doc.size == 64 and self._make_long_name(doc) in self.DECODE_TYPES
+        ]
+
+        decode_list.sort(key=lambda doc: self.DECODE_TYPES.index(self._make_long_name(doc)))
+
+        self.output = DocOutputBuffer()
+        self._print_prologue()
+
+        for doc in decode_list:
+            self._print_decoder(doc)
+
+        os.makedirs(os.path.dirname(output_path) or '.', exist_ok=True)
+
+        with open(output_path, 'w', encoding='utf-8') as f:
+            f.write(self.output.getvalue())
+
+    #
+    # Private methods.
+    # ================
+    #
+
+    def _print_prologue(self) -> None:
+        if self.ctx.group_comments:
+            self.print(f'/** @file */')
+
+        self.print(f'#pragma once')
+        self.print(f'#include "{self.include}"')
+        self.print(f'')
+        self._print_define('IA32_DECODE_ENTRY_COUNT', f'{self.ENTRY_COUNT}')
+        self._print_define('IA32_DECODE_BITMAP_SIZE', f'({self.ENTRY_COUNT} / 64)')
+        self.print(f'')
+        self._print_define('IA32_DECODE_SCALAR', '0')
+        self._print_define('IA32_DECODE_AVX2', '1')
+        self._print_define('IA32_DECODE_AVX512', '2')
+        self.print(f'')
+        self.print(f'#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)')
+        self.print(f'#  define IA32_DECODE_X86')
+        self.print(f'#  include <immintrin.h>')
+        self.print(f'#  if defined(_MSC_VER) && !defined(__clang__)')
+        self.print(f'#    include <intrin.h>')
+        self.print(f'#    define IA32_DECODE_TARGET(name)')
+        self.print(f'#  else')
+        self.print(f'#    define IA32_DECODE_TARGET(name) __attribute__((target(name)))')
+        self.print(f'#  endif')
+        self.print(f'#endif')
+        self.print(f'')
+
+        if self.ctx.definition_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Returns the widest decoder supported by the CPU and the OS (IA32_DECODE_*).')
+            self.print(f' *')
+            self.print(f' * @remarks Threads racing the first call detect the same value - the cached level is read and')
+            self.print(f' *          written atomically (relaxed __atomic builtins, aligned volatile long on MSVC).')
+            self.print(f' */')
+
+        self.print(f'static inline int ia32_decode_level(void)')
+        self.print(f'{{')
+
+        with self.indent:
+            self.print(f'#if defined(_MSC_VER) && !defined(__clang__)')
+            self.print(f'static volatile long level = -1;')
+            self.print(f'int result = (int)level;')
+            self.print(f'#else')
+            self.print(f'static int level = -1;')
+            self.print(f'int result = __atomic_load_n(&level, __ATOMIC_RELAXED);')
+            self.print(f'#endif')
+            self.print(f'')
+            self.print(f'if (result < 0)')
+            self.print(f'{{')
+
+            with self.indent:
+                self.print(f'#if defined(IA32_DECODE_X86) && defined(_MSC_VER) && !defined(__clang__)')
+                self.print(f'int info[4];')
+                self.print(f'{self._make_size_type(64)} xcr0 = 0;')
+                self.print(f'')
+                self.print(f'__cpuid(info, 1);')
+                self.print(f'')
+                self.print(f'if ((info[2] & (1 << 27)) && (info[2] & (1 << 28)))')
+                self.print(f'{{')
+
+                with self.indent:
+                    self.print(f'xcr0 = _xgetbv(0);')
+
+                self.print(f'}}')
+                self.print(f'')
+                self.print(f'__cpuidex(info, 7, 0);')
+                self.print(f'')
+                self.print(f'if ((xcr0 & 0xE6) == 0xE6 && (info[1] & (1 << 16)))')
+
+                with self.indent:
+                    self.print(f'result = IA32_DECODE_AVX512;')
+
+                self.print(f'else if ((xcr0 & 0x06) == 0x06 && (info[1] & (1 << 5)))')
+
+                with self.indent:
+                    self.print(f'result = IA32_DECODE_AVX2;')
+
+                self.print(f'else')
+
+                with self.indent:
+                    self.print(f'result = IA32_DECODE_SCALAR;')
+
+                self.print(f'#elif defined(IA32_DECODE_X86)')
+                self.print(f'__builtin_cpu_init();')
+                self.print(f'')
+                self.print(f'if (__builtin_cpu_supports("avx512f"))')
+
+                with self.indent:
+                    self.print(f'result = IA32_DECODE_AVX512;')
+
+                self.print(f'else if (__builtin_cpu_supports("avx2"))')
+
+                with self.indent:
+                    self.print(f'result = IA32_DECODE_AVX2;')
+
+                self.print(f'else')
+
+                with self.indent:
+                    self.print(f'result = IA32_DECODE_SCALAR;')
+
+                self.print(f'#else')
+                self.print(f'result = IA32_DECODE_SCALAR;')
+                self.print(f'#endif')
+                self.print(f'')
+                self.print(f'#if defined(_MSC_VER) && !defined(__clang__)')
+                self.print(f'level = result;')
+                self.print(f'#else')
+                self.print(f'__atomic_store_n(&level, result, __ATOMIC_RELAXED);')
+                self.print(f'#endif')
+
+            self.print(f'}}')
+            self.print(f'')
+            self.print(f'return result;')
+
+        self.print(f'}}')
+        self.print(f'')
+
+    def _print_decoder(self, doc: DocBitfield) -> None:
+        name = self._make_long_name(doc)
+        columns_name = f'{name}_COLUMNS'
+        function_name = f'ia32_decode_{name.lower()}'
+        field_list = self._make_decoder_fields(doc)
+        size_type = self._make_size_type(64)
+
+        if self.ctx.typedef_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Columns of the decoded {name} table.')
+            self.print(f' */')
+
+        self.print(f'typedef struct')
+        self.print(f'{{')
+
+        with self.indent:
+            for field in field_list:
+                count = 'IA32_DECODE_BITMAP_SIZE' if field.is_flag else 'IA32_DECODE_ENTRY_COUNT'
+                self.print(f'{size_type} {field.member}[{count}];')
+
+        self.print(f'}} {columns_name};')
+        self.print(f'')
+
+        self._print_decoder_variant(function_name, columns_name, 'scalar', field_list, 1, self._print_scalar_body)
+
+        self.print(f'#ifdef IA32_DECODE_X86')
+        self.print(f'')
+        self.print(f'IA32_DECODE_TARGET("avx2")')
+        self._print_decoder_variant(function_name, columns_name, 'avx2', field_list, 4, self._print_avx2_body)
+        self.print(f'IA32_DECODE_TARGET("avx512f")')
+        self._print_decoder_variant(function_name, columns_name, 'avx512', field_list, 8, self._print_avx512_body)
+        self.print(f'#endif')
+        self.print(f'')
+
+        #
+        # Dispatcher.
+        #
+        if self.ctx.definition_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Decodes {self.ENTRY_COUNT} entries of {name} table into columns - by the widest '
+                       f'decoder supported by the CPU.')
+            self.print(f' */')
+
+        self.print(f'static inline void {function_name}(const {size_type}* entries, {columns_name}* columns)')
+        self.print(f'{{')
+
+        with self.indent:
+            self.print(f'#ifdef IA32_DECODE_X86')
+            self.print(f'switch (ia32_decode_level())')
+            self.print(f'{{')
+
+            with self.indent:
+                self.print(f'case IA32_DECODE_AVX512:')
+
+                with self.indent:
+                    self.print(f'{function_name}_avx512(entries, columns);')
+                    self.print(f'return;')
+
+                self.print(f'')
+                self.print(f'case IA32_DECODE_AVX2:')
+
+                with self.indent:
+                    self.print(f'{function_name}_avx2(entries, columns);')
+                    self.print(f'return;')
+
+            self.print(f'}}')
+            self.print(f'#endif')
+            self.print(f'')
+            self.print(f'{function_name}_scalar(entries, columns);')
+
+        self.print(f'}}')
+        self.print(f'')
+
+    def _print_decoder_variant(self, function_name: str, columns_name: str, variant: str,
+                               field_list: List[DocDecoderField], step: int,
+                               print_body: Callable[[List[DocDecoderField]], None]) -> None:
+        '''
+        Prints decoder of one variant - "print_body" decodes "step" entries
+        starting at "entries + i + j" (and collects bits of 1-bit fields).
+        '''
+        size_type = self._make_size_type(64)
+        index_type = self._make_size_type(32)
+
+        self.print(f'static inline void {function_name}_{variant}(const {size_type}* entries, {columns_name}* columns)')
+        self.print(f'{{')
+
+        with self.indent:
+            self.print(f'{index_type} i;')
+            self.print(f'{index_type} j;')
+            self.print(f'')
+            self.print(f'for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i += 64)')
+            self.print(f'{{')
+
+            with self.indent:
+                for field in field_list:
+                    if field.is_flag:
+                        self.print(f'{size_type} {field.local} = 0;')
+
+                self.print(f'')
+                self.print(f'for (j = 0; j < 64; j += {step})')
+                self.print(f'{{')
+
+                with self.indent:
+                    print_body(field_list)
+
+                self.print(f'}}')
+                self.print(f'')
+
+                for field in field_list:
+                    if field.is_flag:
+                        self.print(f'columns->{field.member}[i / 64] = {field.local};')
+
+            self.print(f'}}')
+
+        self.print(f'}}')
+        self.print(f'')
+
+    def _print_scalar_body(self, field_list: List[DocDecoderField]) -> None:
+        self.print(f'{self._make_size_type(64)} entry = entries[i + j];')
+        self.print(f'')
+
+        for field in field_list:
+            if field.is_flag:
+                self.print(f'{field.local} |= ((entry >> {field.bit_from}) & 0x01) << j;')
+            else:
+                self.print(f'columns->{field.member}[i + j] = (entry >> {field.bit_from}) & {field.mask};')
+
+    def _print_avx2_body(self, field_list: List[DocDecoderField]) -> None:
+        self.print(f'__m256i entry = _mm256_loadu_si256((const __m256i*)(entries + i + j));')
+        self.print(f'')
+
+        for field in field_list:
+            if field.is_flag:
+                #
+                # Shift the bit into the sign bit of every lane - movemask
+                # collects sign bits of all 4 lanes at once.
+                #
+                if field.bit_from == 63:
+                    lanes = 'entry'
+                else:
+                    lanes = f'_mm256_slli_epi64(entry, {63 - field.bit_from})'
+
+                self.print(f'{field.local} |= ({self._make_size_type(64)})'
+                           f'_mm256_movemask_pd(_mm256_castsi256_pd({lanes})) << j;')
+            else:
+                self.print(f'_mm256_storeu_si256((__m256i*)(columns->{field.member} + i + j),')
+                self.print(f'                    _mm256_and_si256(_mm256_srli_epi64(entry, {field.bit_from}), '
+                           f'_mm256_set1_epi64x((long long){field.mask})));')
+
+    def _print_avx512_body(self, field_list: List[DocDecoderField]) -> None:
+        self.print(f'__m512i entry = _mm512_loadu_si512((const void*)(entries + i + j));')
+        self.print(f'')
+
+        for field in field_list:
+            if field.is_flag:
+                self.print(f'{field.local} |= ({self._make_size_type(64)})_mm512_test_epi64_mask(entry, '
+                           f'_mm512_set1_epi64((long long){field.flag})) << j;')
+            else:
+                #
+                # Zero-masking shift (with all lanes enabled) is the same
+                # instruction, but unlike _mm512_srli_epi64 it does not trip
+                # -Wuninitialized of G++ 12 in its own header.
+                #
+                self.print(f'_mm512_storeu_si512((void*)(columns->{field.member} + i + j),')
+                self.print(f'                    _mm512_and_si512(_mm512_maskz_srli_epi64(0xFF, entry, {field.bit_from}), '
+                           f'_mm512_set1_epi64((long long){field.mask})));')
+
+    def _make_decoder_fields(self, doc: DocBitfield) -> List[DocDecoderField]:
+        result = []
+
+        for field in doc.fields:
+            if not isinstance(field, DocBitfieldField) or field.long_name not in self.DECODE_FIELDS:
+                continue
+
+            bit_from, bit_to = field.bit
+            constants = dict(self._make_bitfield_field_definitions(doc, field)[0])
+
+            result.append(DocDecoderField(
+                member=self._fix_case(self._make_long_name(field)),
+                local=self._make_long_name(field).lower(),
+                bit_from=bit_from,
+                flag=constants['_FLAG'],
+                mask=constants['_MASK'],
+                is_flag=bit_to - bit_from == 1,
+            ))
+
+        return result
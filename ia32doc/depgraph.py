@@ -0,0 +1,82 @@
+from typing import Dict, Iterable, List
+
+import hashlib
+import os
+
+from .doc import DocBase
+
+
+class DocDependencyGraph(object):
+    '''
+    Graph of YAML files connected by their "Include:" edges.
+
+    Every vertex is a path of YAML file, every edge points from the file
+    containing "Include:" to the file it resolved to.
+    '''
+
+    def __init__(self, doc_list: List[DocBase]):
+        self.edges: Dict[str, List[str]] = { }
+        self._file_digest_cache: Dict[str, str] = { }
+
+        for root in doc_list:
+            for doc in root.walk():
+                for include in doc.include:
+                    for include_path in doc.include_paths(include):
+                        if os.path.isfile(include_path):
+                            self._add_edge(doc.path, include_path)
+                            break
+
+    def closure(self, paths: Iterable[str]) -> List[str]:
+        result = set()
+        pending = list(paths)
+
+        while pending:
+            path = pending.pop()
+
+            if path not in result:
+                result.add(path)
+                pending.extend(self.edges.get(path, []))
+
+        return sorted(result)
+
+    def sources(self, doc: DocBase) -> List[str]:
+        result = set(self.closure(d.origin_path for d in doc.walk()))
+
+        #
+        # Output of the subtree depends also on its ancestors
+        # (eg. ChildrenNameWithPrefix), but not on their other children.
+        #
+        parent = doc.parent
+
+        while parent:
+            result.add(parent.origin_path)
+            parent = parent.parent
+
+        return sorted(result)
+
+    def digest(self, doc: DocBase) -> str:
+        '''
+        Returns digest of all YAML files the subtree of "doc" (and its
+        ancestors) was built from, together with identity of the document
+        (one file holds many documents).
+        '''
+        digest = hashlib.sha256()
+        digest.update(f'{doc.type}:{doc.long_name}\n'.encode('utf-8'))
+
+        for path in self.sources(doc):
+            digest.update(f'{path}:{self.file_digest(path)}\n'.encode('utf-8'))
+
+        return digest.hexdigest()
+
+    def file_digest(self, path: str) -> str:
+        if path not in self._file_digest_cache:
+            with open(path, 'rb') as f:
+                self._file_digest_cache[path] = hashlib.sha256(f.read()).hexdigest()
+
+        return self._file_digest_cache[path]
+
+    def _add_edge(self, path_from: str, path_to: str) -> None:
+        edges = self.edges.setdefault(path_from, [])
+
+        if path_to not in edges:
+            edges.append(path_to)
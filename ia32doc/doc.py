@@ -1,9 +1,8 @@
 from __future__ import annotations
-from typing import List, Tuple
+from typing import Iterator, List, Tuple
 
 import os
 import re
-import yaml
 
 from .log import log
 
@@ -35,7 +34,17 @@ int_types_ms2 = {
     64 : 'ULONGLONG',
 }
 
-int_types = int_types_ms
+#
+# Integer types selectable by DocProcessorContext.int_types.
+#
+DOC_INT_TYPES = {
+    'c': int_types_c,
+    'cstdint': int_types_cstdint,
+    'ms': int_types_ms,
+    'ms2': int_types_ms2,
+}
+
+DOC_INT_SIZES = sorted(int_types_c)
 
 DOC_VALID_TYPES = [
     'Group',
@@ -58,11 +67,76 @@ PDPTE with such an address causes a general-protection fault.
 MAXPHYADDR = 48
 
 
+def parse_bit_range(bit) -> Tuple[int, int]:
+    '''
+    Returns half-open range [bit_from, bit_to) of the "Bit" value (N or N-M).
+    '''
+    if isinstance(bit, int):
+        return bit, bit + 1
+
+    if 'MAXPHYADDR' in bit:
+        bit = bit.replace('(MAXPHYADDR-1)', f'{MAXPHYADDR - 1}')
+
+    bit_from, bit_to = list(map(int, bit.split('-')))
+    return bit_from, bit_to + 1
+
+
+class cached_property(object):
+    '''
+    Property which is computed only once per object; the result is stored in
+    the instance dictionary (and therefore also pickled with the object).
+    Use DocBase.invalidate() to drop stored results.
+    '''
+
+    def __init__(self, func):
+        self.func = func
+        self.__doc__ = func.__doc__
+
+    def __set_name__(self, owner, name):
+        self.name = name
+
+    def __get__(self, instance, owner=None):
+        if instance is None:
+            return self
+
+        result = instance.__dict__[self.name] = self.func(instance)
+        return result
+
+
 class Doc(object):
     doc_cache = { }
 
+    #
+    # Optional persistent cache of the whole parsed tree (see DocCache).
+    #
+    ir_cache = None
+
     @staticmethod
     def parse(path: str, parent: DocBase=None) -> List[DocBase]:
+        if not parent and Doc.ir_cache:
+            doc_list = Doc.ir_cache.load(path)
+
+            if doc_list is None:
+                doc_list = Doc._parse(path, parent)
+                Doc.ir_cache.store(path, doc_list)
+
+            return doc_list
+
+        return Doc._parse(path, parent)
+
+    @staticmethod
+    def invalidate(path_list: List[str]) -> None:
+        '''
+        Drops cached content of modified files; the next parse loads them again.
+        '''
+        path_list = [ os.path.abspath(path) for path in path_list ]
+
+        for path in list(Doc.doc_cache):
+            if os.path.abspath(path) in path_list:
+                del Doc.doc_cache[path]
+
+    @staticmethod
+    def _parse(path: str, parent: DocBase=None) -> List[DocBase]:
         log_message = f'Parsing "{path}"...'
         #if not parent else \
         #f'Parsing "{path}" (included from "{parent.path}")...'
@@ -73,8 +147,13 @@ class Doc(object):
 
             doc_list = Doc.doc_cache[path]
         else:
+            #
+            # Imported here - the loader itself depends on this module.
+            #
+            from .loader import DocLoader
+
             log(log_message)
-            doc_list = yaml.load(open(path, encoding='utf-8').read())
+            doc_list = DocLoader.load(path, parent.type if parent else None)
 
             for doc in doc_list:
                 doc['Path'] = path
@@ -85,23 +164,44 @@ class Doc(object):
 
     @staticmethod
     def map_class(doc: dict, parent: DocBase=None) -> DocBase:
-        doc_base = DocBase(doc, parent)
+        #
+        # Resolve the type first, so that the subtree (including all
+        # its includes) is constructed only once.
+        #
+        doc_type = Doc.resolve_type(doc, parent)
 
-        if doc_base.type == 'Group':
-            #log(f'Processing group "{doc_base.short_name_standalone}"')
+        if doc_type == 'Group':
             return DocGroup(doc, parent)
-        elif doc_base.type == 'Definition':
+        elif doc_type == 'Definition':
             return DocDefinition(doc, parent)
-        elif doc_base.type == 'Struct':
+        elif doc_type == 'Struct':
             return DocStruct(doc, parent)
-        elif doc_base.type == 'StructField':
+        elif doc_type == 'StructField':
             return DocStructField(doc, parent)
-        elif doc_base.type == 'Bitfield':
+        elif doc_type == 'Bitfield':
             return DocBitfield(doc, parent)
-        elif doc_base.type == 'BitfieldField':
+        elif doc_type == 'BitfieldField':
             return DocBitfieldField(doc, parent)
         else:
-            return doc_base
+            return DocBase(doc, parent)
+
+    @staticmethod
+    def resolve_type(doc: dict, parent: DocBase=None) -> str:
+        if 'Type' not in doc:
+            if parent:
+                if parent.type == 'Struct':
+                    doc['Type'] = 'StructField'
+                elif parent.type == 'Bitfield':
+                    doc['Type'] = 'BitfieldField'
+                else:
+                    doc['Type'] = 'Definition'
+            else:
+                doc['Type'] = 'Definition'
+
+        if doc['Type'] in DOC_VALID_TYPES:
+            return doc['Type']
+        else:
+            raise Exception('Invalid type')
 
 
 class DocBase(object):
@@ -119,26 +219,26 @@ class DocBase(object):
 
         self._do_include()
 
-    @property
+    @cached_property
     def short_name(self) -> str:
         return self._fix_name(self.short_name_raw)
 
-    @property
+    @cached_property
     def long_name(self) -> str:
         return self._fix_name(self.long_name_raw)
 
-    @property
+    @cached_property
     def alternative_name(self) -> str:
         if 'AlternativeName' in self._doc:
             return self._make_name(self._doc['AlternativeName'])
 
         return ''
 
-    @property
+    @cached_property
     def short_name_raw(self) -> str:
         return self._make_name(self.short_name_standalone)
 
-    @property
+    @cached_property
     def short_name_standalone(self) -> str:
         if 'ShortName' in self._doc:
             return self._doc['ShortName']
@@ -151,11 +251,11 @@ class DocBase(object):
         else:
             raise Exception('Field missing: short_name')
 
-    @property
+    @cached_property
     def long_name_raw(self) -> str:
         return self._make_name(self.long_name_standalone)
 
-    @property
+    @cached_property
     def long_name_standalone(self) -> str:
         if 'LongName' in self._doc:
             return self._doc['LongName']
@@ -168,7 +268,7 @@ class DocBase(object):
         else:
             raise Exception('Field missing: long_name')
 
-    @property
+    @cached_property
     def short_description(self) -> str:
         if 'ShortDescription' in self._doc:
             result = self._doc['ShortDescription']
@@ -179,7 +279,7 @@ class DocBase(object):
 
         return self._fix_description(result)
 
-    @property
+    @cached_property
     def long_description(self) -> str:
         if 'LongDescription' in self._doc:
             result = self._doc['LongDescription']
@@ -190,7 +290,7 @@ class DocBase(object):
 
         return self._fix_description(result)
 
-    @property
+    @cached_property
     def children_name_with_prefix(self) -> str:
         if 'ChildrenNameWithPrefix' in self._doc:
             if self._doc['ChildrenNameWithPrefix'] != '$':
@@ -199,7 +299,7 @@ class DocBase(object):
                 return self.short_name
         return ''
 
-    @property
+    @cached_property
     def children_name_with_postfix(self) -> str:
         if 'ChildrenNameWithPostfix' in self._doc:
             if self._doc['ChildrenNameWithPostfix'] != '$':
@@ -232,23 +332,9 @@ class DocBase(object):
             return self._doc['Tag']
         return ''
 
-    @property
+    @cached_property
     def type(self) -> str:
-        if 'Type' not in self._doc:
-            if self._parent:
-                if self._parent.type == 'Struct':
-                    self._doc['Type'] = 'StructField'
-                elif self._parent.type == 'Bitfield':
-                    self._doc['Type'] = 'BitfieldField'
-                else:
-                    self._doc['Type'] = 'Definition'
-            else:
-                self._doc['Type'] = 'Definition'
-
-        if 'Type' in self._doc and self._doc['Type'] in DOC_VALID_TYPES:
-            return self._doc['Type']
-        else:
-            raise Exception('Invalid type')
+        return Doc.resolve_type(self._doc, self._parent)
 
     @property
     def alternative_type(self) -> str:
@@ -256,7 +342,7 @@ class DocBase(object):
             return self._doc['AlternativeType']
         return self.type
 
-    @property
+    @cached_property
     def remarks(self) -> str:
         if 'Remarks' in self._doc:
             return self._fix_description(self._doc['Remarks'])
@@ -286,6 +372,73 @@ class DocBase(object):
     def path(self) -> str:
         return self._doc['Path']
 
+    @cached_property
+    def origin_path(self) -> str:
+        #
+        # Only top-level documents of each YAML file have the "Path",
+        # nested documents inherit it.
+        #
+        doc = self
+
+        while 'Path' not in doc._doc:
+            doc = doc._parent
+
+        return doc.path
+
+    @property
+    def parent(self) -> DocBase:
+        return self._parent
+
+    def update(self, key: str, value) -> None:
+        self._doc[key] = value
+
+        #
+        # Names of all descendants depend on their ancestors.
+        #
+        self.invalidate()
+
+    def invalidate(self) -> None:
+        for doc in self.walk():
+            for name in doc._cached_property_names():
+                doc.__dict__.pop(name, None)
+
+    def resolve(self) -> None:
+        '''
+        Eagerly computes all cached properties of the whole subtree.
+        '''
+        for doc in self.walk():
+            for name in doc._cached_property_names():
+                try:
+                    getattr(doc, name)
+                except Exception:
+                    #
+                    # Leave invalid properties unresolved - they will
+                    # raise again if (and when) they are accessed.
+                    #
+                    pass
+
+    def walk(self) -> Iterator[DocBase]:
+        yield self
+
+        for field in self._fields:
+            yield from field.walk()
+
+    def include_paths(self, include: str) -> List[str]:
+        return [
+            os.path.join(os.path.dirname(self.path), include + '.yml'),
+            os.path.join(os.path.dirname(self.path), include, 'index.yml'),
+        ]
+
+    @classmethod
+    def _cached_property_names(cls) -> List[str]:
+        if '_cached_property_name_list' not in cls.__dict__:
+            cls._cached_property_name_list = [
+                name for klass in cls.__mro__ for name, value in vars(klass).items()
+                if isinstance(value, cached_property)
+            ]
+
+        return cls._cached_property_name_list
+
     def _make_name(self, name: str) -> str:
         if 'NameWithPostfix' not in self._doc and self.type in ['Definition', 'Group', 'Struct', 'Bitfield']:
             parent = self._parent
@@ -303,15 +456,12 @@ class DocBase(object):
 
     def _do_include(self) -> None:
         for include in self._include:
-            file_path = os.path.join(os.path.dirname(self.path), include + '.yml')
-            dir_path = os.path.join(os.path.dirname(self.path), include, 'index.yml')
+            doc_list = []
 
-            if os.path.isfile(file_path):
-                doc_list = Doc.parse(file_path, self)
-            elif os.path.isfile(dir_path):
-                doc_list = Doc.parse(dir_path, self)
-            else:
-                doc_list = []
+            for include_path in self.include_paths(include):
+                if os.path.isfile(include_path):
+                    doc_list = Doc.parse(include_path, self)
+                    break
 
             for doc in doc_list:
                 self._fields.append(doc)
@@ -381,10 +531,6 @@ class DocStructField(DocBase):
     def size(self) -> int:
         return self._doc['Size']
 
-    @property
-    def size_type(self) -> str:
-        return int_types[self.size]
-
 
 class DocBitfield(DocBase):
     def __init__(self, doc: dict, parent: DocBase=None):
@@ -408,35 +554,13 @@ class DocBitfield(DocBase):
     def size(self) -> int:
         return self.size_max
 
-    @property
-    def size_type_min(self) -> str:
-        return int_types[self.size_min]
-
-    @property
-    def size_type_max(self) -> str:
-        return int_types[self.size_max]
-
-    @property
-    def size_type(self) -> str:
-        return int_types[self.size]
-
 
 class DocBitfieldField(DocBase):
     def __init__(self, doc: dict, parent: DocBase=None):
         super().__init__(doc, parent)
 
-    @property
+    @cached_property
     def bit(self) -> Tuple[int, int]:
-        if isinstance(self._doc['Bit'], int):
-            bit_from, bit_to = self._doc['Bit'], self._doc['Bit'] + 1
-        else:
-            doc_bit = self._doc['Bit']
-            if 'MAXPHYADDR' in doc_bit:
-                doc_bit = doc_bit.replace('(MAXPHYADDR-1)', f'{MAXPHYADDR - 1}')
-
-            bit_from, bit_to = list(map(int, doc_bit.split('-')))
-            bit_to += 1
-
-        return bit_from, bit_to
+        return parse_bit_range(self._doc['Bit'])
 
 
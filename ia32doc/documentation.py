@@ -0,0 +1,137 @@
+from typing import Callable, List, Tuple
+
+import json
+
+from .doc import *
+from .log import log
+from .output import DocOutput, DocOutputBuffer
+from .processor import DocProcessor
+from .processor_ctx import DocProcessorContext
+
+
+class DocDocumentation(DocProcessor):
+    '''
+    Documentation-only artifact - collects descriptions of every emitted
+    identifier (groups, definitions, typedefs, fields and their macros)
+    into JSON, for IDEs and tools using the comment-less header.
+
+    Identifiers are made by DocProcessor itself, therefore they match the
+    header emitted with the same DocProcessorContext. Printed text is
+    thrown away.
+    '''
+
+    def __init__(self, output: DocOutput=None, ctx: DocProcessorContext=None):
+        super().__init__(output, ctx)
+        self.entries: List[dict] = []
+        self._group_stack: List[str] = []
+        self._typedef_stack: List[str] = []
+
+    def generate(self, doc_list: List[DocBase], output_path: str) -> None:
+        log(f'Generating "{output_path}"...')
+
+        self.entries = []
+        self.output = DocOutputBuffer()
+        self.process(doc_list)
+
+        with open(output_path, 'w', encoding='utf-8') as f:
+            json.dump({ 'entries': self.entries }, f, indent=2)
+
+    def process_group(self, doc: DocBase) -> None:
+        group_id = self._make_short_name(doc, True)
+        self._add_entry('group', group_id, doc)
+
+        self._group_stack.append(group_id)
+        super().process_group(doc)
+        self._group_stack.pop()
+
+    def process_definition(self, doc: DocDefinition) -> None:
+        if self.ctx.definitions:
+            self._add_entry('define', self._make_long_name(doc), doc)
+
+        super().process_definition(doc)
+
+    def process_bitfield(self, doc: DocBitfield) -> None:
+        self._process_typedef('union', doc, super().process_bitfield)
+
+    def process_bitfield_field(
+            self, doc: DocBitfield, field: DocBitfieldField, bit_position: int, reserved_count: int
+            ) -> Tuple[int, int]:
+        bit_from, bit_to = field.bit
+        entry = self._add_entry('field', self._fix_case(self._make_long_name(field)), field)
+        entry['bits'] = [ bit_from, bit_to - 1 ]
+
+        if self.ctx.bitfield_field_with_definitions:
+            definition_prefix = f'{self._make_long_name(doc)}_{self._make_long_name(field)}'
+            constant_list, function_list = self._make_bitfield_field_definitions(doc, field)
+
+            entry['macros'] = [ f'{definition_prefix}{suffix}' for suffix, _ in constant_list ] + \
+                              [ f'{definition_prefix}{suffix}' for suffix, _, _ in function_list ]
+
+        return super().process_bitfield_field(doc, field, bit_position, reserved_count)
+
+    def process_struct(self, doc: DocStruct) -> None:
+        self._process_typedef('struct', doc, super().process_struct)
+
+    def process_struct_field(self, doc: DocStructField) -> None:
+        if self.ctx.typedefs:
+            self._add_entry('field', self._fix_case(self._make_long_name(doc)), doc)
+
+        super().process_struct_field(doc)
+
+    #
+    # Private methods.
+    # ================
+    #
+
+    def _process_typedef(self, kind: str, doc: DocBase, process: Callable) -> None:
+        if not self.ctx.typedefs:
+            process(doc)
+            return
+
+        #
+        # Nested unions/structs are members of the enclosing typedef.
+        #
+        if self._typedef_stack:
+            name = self._fix_case(self._make_long_name(doc, standalone=True))
+        else:
+            name = self._make_long_name(doc)
+
+        self._add_entry(kind, name, doc)
+
+        self._typedef_stack.append(name)
+        process(doc)
+        self._typedef_stack.pop()
+
+    def _add_entry(self, kind: str, name: str, doc: DocBase) -> dict:
+        entry = {
+            'kind': kind,
+            'name': name,
+        }
+
+        if self._typedef_stack:
+            entry['parent'] = '.'.join(self._typedef_stack)
+
+        if self._group_stack:
+            entry['group'] = self._group_stack[-1]
+
+        for key, value in [
+            ('brief', doc.short_description),
+            ('details', doc.long_description),
+            ('access', doc.access),
+            ('note', doc.note),
+            ('remarks', doc.remarks),
+            ('see_also', doc.see_also),
+            ('reference', doc.reference),
+        ]:
+            if value:
+                entry[key] = self._fix_value(value)
+
+        self.entries.append(entry)
+        return entry
+
+    @classmethod
+    def _fix_value(cls, value):
+        if isinstance(value, list):
+            return [ cls._fix_text(str(item)).rstrip() for item in value ]
+
+        return cls._fix_text(str(value)).rstrip()
@@ -0,0 +1,594 @@
+from typing import Callable, Dict, List, Optional, Set, Tuple, Union
+
+from concurrent.futures import ProcessPoolExecutor
+import hashlib
+import json
+import multiprocessing
+import os
+import re
+
+from .cache import DocCache
+from .depgraph import DocDependencyGraph
+from .doc import DocBase
+from .log import log
+from .output import DocOutputBuffer
+from .processor_base import DocProcessorBase
+
+
+class DocGeneratorOutput(object):
+    '''
+    Single output file being generated - list of its parts (plain strings
+    and fragments) and the state of the previous run.
+    '''
+
+    def __init__(self, path: str, config_digest: str):
+        self.path = path
+        self.config_digest = config_digest
+        self.parts: List[Union[str, dict]] = []
+        self.fragments: Dict[str, dict] = { }
+        self.emitted_count = 0
+        self.previous_output: Optional[str] = None
+        self.previous_fragments: Dict[str, dict] = { }
+
+    def getvalue(self, record_offsets: bool=False) -> str:
+        '''
+        Returns text of the output. Offsets of fragments are recorded (and
+        their texts dropped) only once the output is final.
+        '''
+        result = [ ]
+        result_length = 0
+
+        for part in self.parts:
+            if isinstance(part, str):
+                text = part
+            elif record_offsets:
+                text = part.pop('text')
+                part['offset'] = result_length
+                part['length'] = len(text)
+            else:
+                text = part['text']
+
+            result.append(text)
+            result_length += len(text)
+
+        return ''.join(result)
+
+
+class DocGenerator(object):
+    '''
+    Emits output of the processor into a file, split into fragments - groups
+    are expanded recursively and every other document (definition, bitfield,
+    struct, ...) becomes one fragment.
+
+    Subtrees of the top-level documents (CONTROL_REGISTERS, CPUID, ...) are
+    emitted concurrently by a process pool; the output is assembled in fixed
+    order, therefore it does not depend on the number of jobs.
+
+    When a manifest of the previous run is available, only fragments whose
+    source YAML files changed are re-emitted. Everything else is spliced from
+    the existing output file. The output file is not touched at all when its
+    content did not change.
+    '''
+
+    MANIFEST_VERSION = 2
+
+    _COMMENT_RE = re.compile(r'/\*.*?\*/', re.S)
+    _DIRECTIVE_RE = re.compile(r'^\s*#\s*(\w+)')
+
+    #
+    # Patterns of identifiers defined by the output - macros and typedefs.
+    #
+    _DEFINITION_RE_LIST = [
+        re.compile(r'^\s*#\s*define\s+(\w+)', re.M),
+        re.compile(r'^}\s*(\w+);', re.M),
+    ]
+
+    def __init__(self, processor: DocProcessorBase, manifest_directory: str=None, jobs: int=None):
+        self.processor = processor
+        self.manifest_directory = manifest_directory
+        self.jobs = jobs or os.cpu_count() or 1
+
+        #
+        # Fragments (of all outputs) waiting for emission, grouped into tasks.
+        #
+        self._pending: Dict[tuple, List[Tuple[dict, DocBase]]] = { }
+
+    def generate(self, doc_list: List[DocBase], output_path: str) -> None:
+        graph = DocDependencyGraph(doc_list)
+        output = self._begin_output(output_path)
+
+        output.parts.append(self._emit(self.processor, self.processor.process_prologue))
+        self._plan(output, doc_list, graph)
+        output.parts.append(self._emit(self.processor, self.processor.process_epilogue, doc_list))
+
+        self._emit_pending()
+        self._check_definitions([ output ])
+        self._write_output(output)
+
+    def _begin_output(self, output_path: str) -> DocGeneratorOutput:
+        output = DocGeneratorOutput(output_path, self._config_digest())
+        output.previous_output, output.previous_fragments = self._load_manifest(output_path, output.config_digest)
+
+        return output
+
+    def _write_output(self, output: DocGeneratorOutput) -> None:
+        #
+        # Concatenate all parts in their original order.
+        #
+        text = output.getvalue(record_offsets=True)
+
+        if text == output.previous_output:
+            log(f'Generating "{output.path}"...(unchanged)')
+        else:
+            log(f'Generating "{output.path}"...({output.emitted_count}/{len(output.fragments)} fragments)')
+
+            os.makedirs(os.path.dirname(output.path) or '.', exist_ok=True)
+
+            with open(output.path, 'w', encoding='utf-8') as f:
+                f.write(text)
+
+        self._store_manifest(output.path, output.config_digest, text, output.fragments)
+
+    def _check_definitions(self, output_list: List[DocGeneratorOutput]) -> None:
+        '''
+        Fails when any identifier is defined more than once - even identical
+        redefinitions break -Werror and unity builds.
+        '''
+        locations: Dict[str, List[str]] = { }
+
+        for output in output_list:
+            text = self._strip_conditionals(self._COMMENT_RE.sub(' ', output.getvalue()))
+
+            for definition_re in self._DEFINITION_RE_LIST:
+                for name in definition_re.findall(text):
+                    locations.setdefault(name, []).append(output.path)
+
+        collisions = [
+            f'{name} ({", ".join(path_list)})'
+            for name, path_list in locations.items() if len(path_list) > 1
+        ]
+
+        if collisions:
+            raise Exception(f'Identifiers defined more than once: {", ".join(collisions)}')
+
+    @classmethod
+    def _strip_conditionals(cls, text: str) -> str:
+        '''
+        Drops everything between #if/#ifdef/#ifndef and the matching #endif -
+        alternatives (eg. IA32_STATIC_ASSERT for C and C++) are not collisions.
+        '''
+        result = []
+        depth = 0
+
+        for line in text.splitlines():
+            directive = cls._DIRECTIVE_RE.match(line)
+
+            if directive and directive.group(1).startswith('if'):
+                depth += 1
+            elif directive and directive.group(1) == 'endif':
+                depth -= 1
+            elif depth == 0:
+                result.append(line)
+
+        return '\n'.join(result)
+
+    def _plan(self, output: DocGeneratorOutput, doc_list: List[DocBase], graph: DocDependencyGraph,
+              task_id: tuple=None) -> None:
+        for doc in doc_list:
+            #
+            # Every subtree directly under the top-level documents
+            # (CONTROL_REGISTERS, CPUID, ...) is emitted as one task.
+            #
+            doc_task_id = task_id
+
+            if doc_task_id is None and doc.parent:
+                doc_task_id = (output.path, len(output.parts))
+
+            if doc.type == 'Group':
+                output.parts.append(self._emit(self.processor, self.processor.process_group_begin, doc))
+                self._plan(output, doc.fields, graph, doc_task_id)
+                output.parts.append(self._emit(self.processor, self.processor.process_group_end, doc))
+                continue
+
+            fragment_id = self._fragment_id(output, doc)
+            fragment_digest = graph.digest(doc)
+            previous_fragment = output.previous_fragments.get(fragment_id)
+
+            fragment = { 'digest': fragment_digest }
+            output.fragments[fragment_id] = fragment
+            output.parts.append(fragment)
+
+            if previous_fragment and previous_fragment['digest'] == fragment_digest:
+                offset = previous_fragment['offset']
+                fragment['text'] = output.previous_output[offset:offset + previous_fragment['length']]
+            else:
+                pending_task_id = (output.path, len(output.parts)) if doc_task_id is None else doc_task_id
+                self._pending.setdefault(pending_task_id, []).append((fragment, doc))
+                output.emitted_count += 1
+
+    def _fragment_id(self, output: DocGeneratorOutput, doc: DocBase) -> str:
+        '''
+        Returns identity of the fragment - path of the document in the tree.
+        Position of the fragment can't be used, it changes whenever any
+        document before it is added or removed.
+        '''
+        path = [ ]
+        parent = doc
+
+        while parent:
+            path.append(f'{parent.type}:{parent.long_name}')
+            parent = parent.parent
+
+        fragment_id = '/'.join(reversed(path))
+
+        #
+        # Documents of the same name under the same parent are told apart
+        # by their order.
+        #
+        if fragment_id in output.fragments:
+            index = 1
+
+            while f'{fragment_id}#{index}' in output.fragments:
+                index += 1
+
+            fragment_id = f'{fragment_id}#{index}'
+
+        return fragment_id
+
+    def _emit_pending(self) -> None:
+        task_list = list(self._pending.values())
+        self._pending = { }
+        jobs = min(self.jobs, len(task_list))
+
+        if jobs <= 1:
+            result_list = [ self._emit_fragments(self.processor, task) for task in task_list ]
+        else:
+            with ProcessPoolExecutor(max_workers=jobs, mp_context=self._mp_context(),
+                                     initializer=_worker_init, initargs=(self.processor, task_list)) as executor:
+                result_list = list(executor.map(_worker_emit, range(len(task_list))))
+
+        for task, result in zip(task_list, result_list):
+            for (fragment, _), text in zip(task, result):
+                fragment['text'] = text
+
+    @staticmethod
+    def _emit_fragments(processor: DocProcessorBase, task: List[Tuple[dict, DocBase]]) -> List[str]:
+        processor.reset()
+        return [ DocGenerator._emit(processor, processor.process, [ doc ]) for _, doc in task ]
+
+    @staticmethod
+    def _mp_context():
+        #
+        # Prefer "fork" - workers then inherit the whole document tree
+        # instead of receiving its pickled copy.
+        #
+        if 'fork' in multiprocessing.get_all_start_methods():
+            return multiprocessing.get_context('fork')
+
+        return multiprocessing.get_context()
+
+    @staticmethod
+    def _emit(processor: DocProcessorBase, method: Callable, *args) -> str:
+        output = processor.output
+        processor.output = DocOutputBuffer()
+
+        try:
+            method(*args)
+            return processor.output.getvalue()
+        finally:
+            processor.output = output
+
+    def _config_digest(self) -> str:
+        #
+        # Fragments depend on the generator itself and its configuration.
+        #
+        digest = hashlib.sha256()
+        digest.update(f'{self.MANIFEST_VERSION}:{DocCache.generator_digest()}\n'.encode('utf-8'))
+        digest.update(f'{type(self).__name__}:{type(self.processor).__name__}:{sorted(vars(self.processor.ctx.ctx).items())}\n'.encode('utf-8'))
+
+        return digest.hexdigest()
+
+    def _manifest_path(self, output_path: str) -> Optional[str]:
+        if not self.manifest_directory:
+            return None
+
+        key = hashlib.sha256(os.path.abspath(output_path).encode('utf-8')).hexdigest()
+        return os.path.join(self.manifest_directory, f'{key[:32]}.json')
+
+    def _load_manifest(self, output_path: str, config_digest: str) -> Tuple[Optional[str], Dict[str, dict]]:
+        try:
+            with open(output_path, encoding='utf-8') as f:
+                previous_output = f.read()
+        except OSError:
+            return None, { }
+
+        manifest_path = self._manifest_path(output_path)
+
+        if not manifest_path:
+            return previous_output, { }
+
+        try:
+            with open(manifest_path, encoding='utf-8') as f:
+                manifest = json.load(f)
+        except (OSError, ValueError):
+            return previous_output, { }
+
+        #
+        # Do not reuse anything if the configuration changed or if the output
+        # file was modified by someone else since the last run.
+        #
+        if manifest.get('config_digest') != config_digest or \
+           manifest.get('output_digest') != self._text_digest(previous_output):
+            return previous_output, { }
+
+        return previous_output, manifest['fragments']
+
+    def _store_manifest(self, output_path: str, config_digest: str, output: str, fragments: Dict[str, dict]) -> None:
+        manifest_path = self._manifest_path(output_path)
+
+        if not manifest_path:
+            return
+
+        manifest = {
+            'config_digest': config_digest,
+            'output_digest': self._text_digest(output),
+            'fragments': fragments,
+        }
+
+        os.makedirs(self.manifest_directory, exist_ok=True)
+
+        with open(manifest_path, 'w', encoding='utf-8') as f:
+            json.dump(manifest, f, indent=2)
+
+    @staticmethod
+    def _text_digest(text: str) -> str:
+        return hashlib.sha256(text.encode('utf-8')).hexdigest()
+
+
+class DocSplitGenerator(DocGenerator):
+    '''
+    Emits one header per subsystem (every child of the top-level groups -
+    CONTROL_REGISTERS, CPUID, ...) into a directory named after the output
+    file, eg. "out/ia32.h" -> "out/ia32/cpuid.h", plus a header with integer
+    types. The output file itself becomes an umbrella header including all
+    of them.
+
+    Headers include each other only when one uses an identifier (macro or
+    typedef) defined by the other.
+    '''
+
+    TYPES_NAME = 'types'
+    EXTENSION = '.h'
+
+    _IDENTIFIER_RE = re.compile(r'\b[A-Za-z_]\w*\b')
+
+    def generate(self, doc_list: List[DocBase], output_path: str) -> None:
+        graph = DocDependencyGraph(doc_list)
+        directory = os.path.splitext(output_path)[0]
+
+        types_output = self._begin_output(os.path.join(directory, f'{self.TYPES_NAME}{self.EXTENSION}'))
+        types_output.parts.append(self._emit_prologue(directory, self.TYPES_NAME, [ ]))
+
+        output_list: List[Tuple[str, DocGeneratorOutput]] = [ ]
+
+        for root in doc_list:
+            if root.type == 'Group':
+                for doc in root.fields:
+                    output_list.append(self._plan_header(root, doc, directory, graph))
+            else:
+                output_list.append(self._plan_header(None, root, directory, graph))
+
+        name_list = [ name for name, _ in output_list ]
+
+        if len(set(name_list)) != len(name_list) or self.TYPES_NAME in name_list:
+            raise Exception('Duplicate header names')
+
+        self._emit_pending()
+
+        self._check_definitions([ output for _, output in output_list ])
+
+        #
+        # Now when all headers are emitted, their includes can be resolved.
+        #
+        symbols = { name: self._scan_symbols(output.getvalue()) for name, output in output_list }
+
+        dependency_map: Dict[str, List[str]] = { }
+
+        for name, output in output_list:
+            _, used = symbols[name]
+            dependency_list = [ self.TYPES_NAME ] + [
+                other_name for other_name in name_list
+                if other_name != name and symbols[other_name][0] & used
+            ]
+
+            dependency_map[name] = dependency_list
+            output.parts[0] = self._emit_prologue(directory, name, dependency_list)
+
+        umbrella_output = self._begin_output(output_path)
+        umbrella_output.parts.append(self._emit_prologue(directory, None, self._umbrella_list(name_list, dependency_map)))
+
+        for root in doc_list:
+            if root.type == 'Group':
+                umbrella_output.parts.append(self._emit(self.processor, self.processor.process_group_begin, root))
+                umbrella_output.parts.append(self._emit(self.processor, self.processor.process_group_end, root))
+
+        for output in [ types_output ] + [ output for _, output in output_list ] + [ umbrella_output ]:
+            self._write_output(output)
+
+    def _emit_prologue(self, directory: str, name: Optional[str], dependency_list: List[str]) -> str:
+        '''
+        Emits prologue of the header "name" (None for the umbrella header)
+        depending on headers in "dependency_list".
+        '''
+        if name == self.TYPES_NAME:
+            return self._emit(self.processor, self.processor.process_prologue)
+
+        if name is None:
+            include_list = [ f'{os.path.basename(directory)}/{name}{self.EXTENSION}' for name in dependency_list ]
+        else:
+            include_list = [ f'{name}{self.EXTENSION}' for name in dependency_list ]
+
+        return self._emit(self.processor, self.processor.process_prologue, include_list)
+
+    def _umbrella_list(self, name_list: List[str], dependency_map: Dict[str, List[str]]) -> List[str]:
+        '''
+        Returns headers included by the umbrella header (in the order of
+        the yaml files).
+        '''
+        return name_list
+
+    def _plan_header(self, root: Optional[DocBase], doc: DocBase, directory: str,
+                     graph: DocDependencyGraph) -> Tuple[str, DocGeneratorOutput]:
+        name = self._header_name(root, doc)
+        output = self._begin_output(os.path.join(directory, f'{name}{self.EXTENSION}'))
+
+        #
+        # Prologue (with includes) is emitted at the end.
+        #
+        output.parts.append('')
+
+        if root:
+            output.parts.append(self._emit(self.processor, self.processor.process_group_begin, root, True))
+
+        self._plan(output, [ doc ], graph)
+
+        if root:
+            output.parts.append(self._emit(self.processor, self.processor.process_group_end, root, True))
+
+        return name, output
+
+    @staticmethod
+    def _header_name(root: Optional[DocBase], doc: DocBase) -> str:
+        #
+        # Prefer name of the included YAML file (ControlRegisters/index.yml,
+        # APIC.yml, ...), documents defined directly in the root file are
+        # named after themselves.
+        #
+        if root and doc.origin_path != root.origin_path:
+            file_name = os.path.basename(doc.origin_path)
+
+            if file_name == 'index.yml':
+                name = os.path.basename(os.path.dirname(doc.origin_path))
+            else:
+                name = os.path.splitext(file_name)[0]
+        else:
+            name = doc.long_name
+
+        return re.sub(r'(?<=[a-z0-9])(?=[A-Z])', '_', name).lower()
+
+    @classmethod
+    def _scan_symbols(cls, text: str) -> Tuple[Set[str], Set[str]]:
+        '''
+        Returns identifiers defined and used by the text.
+        '''
+        text = cls._COMMENT_RE.sub(' ', text)
+
+        defined = set()
+
+        for definition_re in cls._DEFINITION_RE_LIST:
+            defined.update(definition_re.findall(text))
+
+        used = set(cls._IDENTIFIER_RE.findall(text)) - defined
+
+        return defined, used
+
+
+class DocModuleGenerator(DocSplitGenerator):
+    '''
+    Emits C++20 module (see DocModuleProcessor) named after the output file,
+    eg. "out/ia32.cppm" -> "ia32". Every subsystem is a module partition
+    ("out/ia32/cpuid.cppm" -> "ia32:cpuid"), integer types are in partition
+    "ia32:types". The output file itself is the primary module interface
+    unit, which re-exports all partitions in the order they have to be
+    built (also listed in "out/ia32/build_order.txt").
+    '''
+
+    EXTENSION = '.cppm'
+
+    _DEFINITION_RE_LIST = [
+        re.compile(r'^export inline constexpr auto\s+(\w+)', re.M),
+        re.compile(r'^export constexpr [\w ]+?\s(\w+)\(', re.M),
+        re.compile(r'^}\s*(\w+);', re.M),
+    ]
+
+    BUILD_ORDER_NAME = 'build_order.txt'
+
+    def generate(self, doc_list: List[DocBase], output_path: str) -> None:
+        super().generate(doc_list, output_path)
+
+        #
+        # Partitions can be compiled only after the partitions they import
+        # (GCC doesn't scan module dependencies by itself) - the order is
+        # written next to them, one path (relative to the primary interface)
+        # per line.
+        #
+        directory = os.path.splitext(output_path)[0]
+        build_order_path = os.path.join(directory, self.BUILD_ORDER_NAME)
+        build_order = ''.join(
+            f'{os.path.basename(directory)}/{name}{self.EXTENSION}\n'
+            for name in [ self.TYPES_NAME ] + self._partition_order
+        ) + f'{os.path.basename(output_path)}\n'
+
+        log(f'Generating "{build_order_path}"...')
+
+        with open(build_order_path, 'w', encoding='utf-8') as f:
+            f.write(build_order)
+
+    def _umbrella_list(self, name_list: List[str], dependency_map: Dict[str, List[str]]) -> List[str]:
+        '''
+        Returns partitions sorted by their dependencies - every partition
+        follows all partitions it imports.
+        '''
+        result: List[str] = [ ]
+        visiting: Set[str] = set()
+
+        def visit(name: str) -> None:
+            if name in result or name == self.TYPES_NAME:
+                return
+
+            if name in visiting:
+                raise Exception(f'Partitions import each other: {name}')
+
+            visiting.add(name)
+
+            for dependency in dependency_map[name]:
+                visit(dependency)
+
+            visiting.discard(name)
+            result.append(name)
+
+        for name in name_list:
+            visit(name)
+
+        self._partition_order = result
+        return result
+
+    def _emit_prologue(self, directory: str, name: Optional[str], dependency_list: List[str]) -> str:
+        module_name = os.path.basename(directory)
+
+        if name == self.TYPES_NAME:
+            return self._emit(self.processor, self.processor.process_module_types, module_name, name)
+
+        if name is None:
+            dependency_list = [ self.TYPES_NAME ] + dependency_list
+
+        return self._emit(self.processor, self.processor.process_module_prologue, module_name, name, dependency_list)
+
+
+#
+# Process pool workers.
+# =====================
+#
+
+_worker_processor = None
+_worker_task_list = None
+
+
+def _worker_init(processor: DocProcessorBase, task_list: List[List[Tuple[dict, DocBase]]]) -> None:
+    global _worker_processor, _worker_task_list
+    _worker_processor = processor
+    _worker_task_list = task_list
+
+
+def _worker_emit(task_index: int) -> List[str]:
+    return DocGenerator._emit_fragments(_worker_processor, _worker_task_list[task_index])
@@ -0,0 +1,298 @@
+from typing import Dict, List, Optional, Set
+
+import os
+import re
+import yaml
+
+from .doc import DOC_INT_SIZES, DOC_VALID_TYPES, parse_bit_range
+
+#
+# Use libyaml-backed loader when available.
+#
+try:
+    from yaml import CSafeLoader as _Loader
+except ImportError:
+    from yaml import SafeLoader as _Loader
+
+DOC_TEMPLATE_PATH = os.path.join(os.path.dirname(__file__), '..', 'yaml', 'template.yml')
+
+#
+# Allowed types of values (by default, every value must be a string).
+#
+DOC_SCHEMA_VALUE_TYPES = {
+    'Bit': ('int', 'str'),
+    'Size': ('int', 'list'),
+    'Value': ('int', 'str'),
+    'Fields': ('list',),
+    'Include': ('list',),
+    'SeeAlso': ('str', 'list'),
+    'Reference': ('str', 'list'),
+    'ChildrenNameWithPrefix': ('str', 'int'),
+    'ChildrenNameWithPostfix': ('str', 'int'),
+    'Category': ('str', 'null'),
+}
+
+#
+# Template sections with keys specific to the type of the object.
+#
+DOC_SCHEMA_TYPE_SECTIONS = {
+    'Definition': 'DefinitionField',
+    'StructField': 'StructField',
+    'BitfieldField': 'BitfieldField',
+}
+
+
+class DocSchemaError(Exception):
+    pass
+
+
+class DocSchema(object):
+    '''
+    Schema of the yaml files, derived from the keys of yaml/template.yml.
+    '''
+
+    def __init__(self, template_path: str=DOC_TEMPLATE_PATH):
+        self.sections: Dict[str, Set[str]] = { }
+
+        section = None
+
+        with open(template_path, encoding='utf-8') as f:
+            for line in f:
+                match = re.match(r'^(\s*-?\s*)([A-Za-z]\w*):', line)
+
+                if not match:
+                    continue
+
+                indent, key = match.groups()
+
+                if not indent:
+                    section = self.sections.setdefault(key, set())
+                elif section is not None:
+                    section.add(key)
+
+                    #
+                    # Short*/Long* keys can be used in their common form,
+                    # eg. ShortName + LongName = Name.
+                    #
+                    if 'Short' in key:
+                        section.add(key.replace('Short', '', 1))
+
+    def keys(self, doc_type: str) -> Set[str]:
+        result = set(self.sections['YamlObject'])
+
+        if doc_type in DOC_SCHEMA_TYPE_SECTIONS:
+            result |= self.sections[DOC_SCHEMA_TYPE_SECTIONS[doc_type]]
+
+        return result
+
+
+class DocLoader(_Loader):
+    '''
+    Loader which validates every document against DocSchema while the file
+    is being loaded. Errors point to the file and line of the offending node.
+    '''
+
+    schema = None
+
+    def __init__(self, stream, path: str, parent_type: str=None):
+        super().__init__(stream)
+
+        if not DocLoader.schema:
+            DocLoader.schema = DocSchema()
+
+        self.path = path
+        self.parent_type = parent_type
+        self.errors: List[str] = []
+
+    def construct_document(self, node: yaml.Node):
+        self._validate_list(node, self.parent_type)
+
+        if self.errors:
+            raise DocSchemaError('\n'.join(self.errors))
+
+        return super().construct_document(node)
+
+    @staticmethod
+    def load(path: str, parent_type: str=None) -> List[dict]:
+        with open(path, encoding='utf-8') as f:
+            loader = DocLoader(f, path, parent_type)
+
+            try:
+                return loader.get_single_data()
+            except yaml.MarkedYAMLError as e:
+                #
+                # Syntax errors are reported the same way as schema errors.
+                #
+                mark = e.problem_mark or e.context_mark
+                line = f'{mark.line + 1}:' if mark else ''
+                raise DocSchemaError(f'{path}:{line} {e.problem or e.context}') from e
+            finally:
+                loader.dispose()
+
+    #
+    # Validation.
+    # ===========
+    #
+
+    def _error(self, node: yaml.Node, message: str) -> None:
+        self.errors.append(f'{self.path}:{node.start_mark.line + 1}: {message}')
+
+    def _validate_list(self, node: yaml.Node, parent_type: Optional[str], parent_size: Optional[int]=None) -> None:
+        if not isinstance(node, yaml.SequenceNode):
+            self._error(node, 'expected list of objects')
+            return
+
+        bit_mask = 0
+        bit_mask_owner = { }
+
+        for item in node.value:
+            if not isinstance(item, yaml.MappingNode):
+                self._error(item, 'expected object')
+                continue
+
+            bit_range = self._validate_object(item, parent_type, parent_size)
+
+            #
+            # Check for overlapping bit ranges of sibling fields.
+            #
+            if bit_range:
+                bit_from, bit_to = bit_range
+                item_mask = ((1 << (bit_to - bit_from)) - 1) << bit_from
+
+                if bit_mask & item_mask:
+                    overlapping_line = min(line for bit, line in bit_mask_owner.items() if item_mask & (1 << bit))
+                    self._error(item, f'bits {bit_from}-{bit_to - 1} overlap with field at line {overlapping_line}')
+
+                for bit in range(bit_from, bit_to):
+                    bit_mask_owner.setdefault(bit, item.start_mark.line + 1)
+
+                bit_mask |= item_mask
+
+    def _validate_object(self, node: yaml.MappingNode, parent_type: Optional[str], parent_size: Optional[int]):
+        values = { }
+        key_nodes = { }
+
+        for key_node, value_node in node.value:
+            key = key_node.value
+
+            if key in values:
+                self._error(key_node, f'duplicate key "{key}"')
+
+            values[key] = value_node
+            key_nodes[key] = key_node
+
+        #
+        # Resolve type (see Doc.resolve_type).
+        #
+        if 'Type' in values:
+            doc_type = values['Type'].value
+
+            if doc_type not in DOC_VALID_TYPES:
+                self._error(values['Type'], f'invalid type "{doc_type}"')
+                return None
+        elif parent_type == 'Struct':
+            doc_type = 'StructField'
+        elif parent_type == 'Bitfield':
+            doc_type = 'BitfieldField'
+        else:
+            doc_type = 'Definition'
+
+        #
+        # Check keys and types of their values.
+        #
+        allowed_keys = self.schema.keys(doc_type)
+
+        for key, value_node in values.items():
+            if key not in allowed_keys:
+                self._error(key_nodes[key], f'unknown key "{key}" in {doc_type}')
+                continue
+
+            value_type = self._node_type(value_node)
+            allowed_types = DOC_SCHEMA_VALUE_TYPES.get(key, ('str',))
+
+            if value_type not in allowed_types:
+                self._error(value_node, f'"{key}" must be {" or ".join(allowed_types)}, not {value_type}')
+
+            if value_type == 'list' and key != 'Fields':
+                for item in value_node.value:
+                    if key != 'Size' and self._node_type(item) != 'str':
+                        self._error(item, f'"{key}" must contain only strings')
+
+        #
+        # Check required keys.
+        #
+        if not ({ 'Name', 'ShortName', 'NameWithPostfix' } & values.keys()) or \
+           not ({ 'Name', 'LongName', 'NameWithPostfix' } & values.keys()):
+            self._error(node, f'{doc_type} has no name')
+
+        size = None
+
+        if doc_type in [ 'Bitfield', 'StructField' ]:
+            size = self._validate_size(node, values.get('Size'), doc_type)
+
+        bit_range = None
+
+        if doc_type == 'BitfieldField' or (doc_type == 'StructField' and 'Bit' in values):
+            bit_range = self._validate_bit(node, values.get('Bit'), parent_size)
+
+        if 'Fields' in values and self._node_type(values['Fields']) == 'list':
+            self._validate_list(values['Fields'], doc_type, size if doc_type == 'Bitfield' else None)
+
+        return bit_range
+
+    def _validate_size(self, node: yaml.MappingNode, value_node: Optional[yaml.Node], doc_type: str) -> Optional[int]:
+        if value_node is None:
+            self._error(node, f'{doc_type} has no "Size"')
+            return None
+
+        if isinstance(value_node, yaml.SequenceNode):
+            size_list = [ self._node_int(item) for item in value_node.value ]
+        else:
+            size_list = [ self._node_int(value_node) ]
+
+        if not size_list or len(size_list) > 2 or any(size not in DOC_INT_SIZES for size in size_list):
+            self._error(value_node, f'"Size" must be one of {DOC_INT_SIZES} (or [min, max] pair of them)')
+            return None
+
+        return max(size_list)
+
+    def _validate_bit(self, node: yaml.MappingNode, value_node: Optional[yaml.Node], parent_size: Optional[int]):
+        if value_node is None:
+            self._error(node, 'BitfieldField has no "Bit"')
+            return None
+
+        bit = self._node_int(value_node)
+
+        if bit is None:
+            bit = value_node.value
+
+            if not re.fullmatch(r'\d+-(\d+|\(MAXPHYADDR-1\))', bit):
+                self._error(value_node, f'invalid bit range "{bit}" (expected N or N-M)')
+                return None
+
+        bit_from, bit_to = parse_bit_range(bit)
+
+        if bit_from >= bit_to:
+            self._error(value_node, f'invalid bit range "{bit}" (N must not be greater than M)')
+            return None
+
+        if parent_size and bit_to > parent_size:
+            self._error(value_node, f'bit range "{bit}" exceeds size of the bitfield ({parent_size} bits)')
+            return None
+
+        return bit_from, bit_to
+
+    @staticmethod
+    def _node_type(node: yaml.Node) -> str:
+        if isinstance(node, yaml.SequenceNode):
+            return 'list'
+        elif isinstance(node, yaml.MappingNode):
+            return 'dict'
+
+        return node.tag.rsplit(':', 1)[-1]
+
+    def _node_int(self, node: yaml.Node) -> Optional[int]:
+        if isinstance(node, yaml.ScalarNode) and node.tag == 'tag:yaml.org,2002:int':
+            return self.construct_yaml_int(node)
+
+        return None
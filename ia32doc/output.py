@@ -0,0 +1,28 @@
+from typing import List
+
+
+class DocOutput(object):
+    '''
+    Output sink of the processor - receives already formatted lines.
+    '''
+
+    def write_line(self, line: str) -> None:
+        raise NotImplementedError
+
+
+class DocOutputBuffer(DocOutput):
+    '''
+    In-memory output sink. Lines are joined only once, in getvalue().
+    '''
+
+    def __init__(self):
+        self._lines: List[str] = []
+
+    def write_line(self, line: str) -> None:
+        self._lines.append(line)
+
+    def getvalue(self) -> str:
+        if not self._lines:
+            return ''
+
+        return '\n'.join(self._lines) + '\n'
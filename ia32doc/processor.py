@@ -1,5 +1,7 @@
 from .doc import *
+from .output import DocOutput
 from .processor_base import DocProcessorBase
+from .processor_ctx import DocProcessorContext
 from .text_wrapper import wrap
 
 
@@ -9,13 +11,58 @@ class DocProcessor(DocProcessorBase):
     # ===============
     #
 
-    def __init__(self):
-        super().__init__()
+    def __init__(self, output: DocOutput=None, ctx: DocProcessorContext=None):
+        super().__init__(output, ctx)
         self._align_const = 60
         self._typedef_nesting = 0
 
+    def process_prologue(self, include_list: List[str]=None) -> None:
+        if self.ctx.group_comments:
+            self.print(f'/** @file */')
+
+        self.print(f'#pragma once')
+
+        #
+        # Split headers include the header with integer types (and other
+        # headers they depend on) instead of defining them.
+        #
+        if include_list is not None:
+            for include in include_list:
+                self.print(f'#include "{include}"')
+
+        elif self._needs_int_types():
+            if self.ctx.int_types == 'cstdint':
+                self.print(f'#include <stdint.h>')
+            elif self.ctx.int_types != 'c':
+                for size, int_type in DOC_INT_TYPES[self.ctx.int_types].items():
+                    self.print(f'typedef {int_types_c[size]:<20}{int_type};')
+
+            if self.ctx.typedefs and self.ctx.typedef_assertions:
+                self._print_static_assert_definition()
+
+        self.print(f'')
+
     def process_group(self, doc: DocBase) -> None:
+        self.process_group_begin(doc)
+        self.process(doc.fields)
+        self.process_group_end(doc)
+
+    def process_group_begin(self, doc: DocBase, continued: bool=False) -> None:
+        if not self.ctx.group_comments:
+            return
+
         group_id = self._make_short_name(doc, True)
+
+        #
+        # Group defined in another header.
+        #
+        if continued:
+            self.print(f'/**')
+            self.print(f' * @addtogroup {group_id}')
+            self.print(f' * @{{')
+            self.print(f' */')
+            return
+
         group_name = self._make_multiline_comment(self._make_short_description(doc), '          ')
 
         if doc.long_description:
@@ -33,7 +80,9 @@ class DocProcessor(DocProcessorBase):
         self.print(f' * @{{')
         self.print(f' */')
 
-        self.process(doc.fields)
+    def process_group_end(self, doc: DocBase, continued: bool=False) -> None:
+        if not self.ctx.group_comments:
+            return
 
         self.print(f'/**')
         self.print(f' * @}}')
@@ -42,6 +91,10 @@ class DocProcessor(DocProcessorBase):
         self.print(f'')
 
     def process_definition(self, doc: DocDefinition) -> None:
+        if not self.ctx.definitions:
+            self.process(doc.fields)
+            return
+
         definition_name = self._make_long_name(doc)
         definition_description_printed = False
 
@@ -56,9 +109,9 @@ class DocProcessor(DocProcessorBase):
             definition_description_printed = True
 
         if isinstance(doc.value, int):
-            self.print(f'#define {definition_name:<{self._align_const}} 0x{doc.value:08X}')
+            self._print_define(definition_name, f'0x{doc.value:08X}')
         else:
-            self.print(f'#define {definition_name:<{self._align_const}} {doc.value}')
+            self._print_define(definition_name, f'{doc.value}')
 
         if self.ctx.definition_new_line:
             if definition_description_printed:
@@ -67,15 +120,19 @@ class DocProcessor(DocProcessorBase):
         self.process(doc.fields)
 
     def process_bitfield(self, doc: DocBitfield) -> None:
+        if not self.ctx.typedefs:
+            for field in doc.fields:
+                if isinstance(field, DocBitfieldField):
+                    self.process_bitfield_field(doc, field, 0, 0)
+
+            self.process(doc.fields)
+            return
+
         self._typedef_nesting += 1
 
         self._print_doc(doc)
 
-        if self._typedef_nesting == 1:
-            self.print(f'typedef union')
-        else:
-            self.print(f'union')
-
+        self._print_typedef_begin('union', doc)
         self.print(f'{{')
 
         with self.indent:
@@ -99,15 +156,15 @@ class DocProcessor(DocProcessorBase):
             # Print "Flags" member.
             #
             if doc.size_min != doc.size_max:
-                self.print(f'{doc.size_type_min} Flags{doc.size_min};')
-                self.print(f'{doc.size_type_max} Flags{doc.size_max};')
+                self.print(f'{self._make_size_type(doc.size_min)} Flags{doc.size_min};')
+                self.print(f'{self._make_size_type(doc.size_max)} Flags{doc.size_max};')
             else:
-                self.print(f'{doc.size_type} Flags;')
+                self.print(f'{self._make_size_type(doc.size)} Flags;')
+
+        self._print_typedef_end(doc)
 
         if self._typedef_nesting == 1:
-            self.print(f'}} {self._make_long_name(doc)};')
-        else:
-            self.print(f'}} {self._fix_case(self._make_long_name(doc, standalone=True))};')
+            self._print_layout_assert(doc)
 
         self.print(f'')
 
@@ -120,6 +177,12 @@ class DocProcessor(DocProcessorBase):
             ) -> Tuple[int, int]:
         bit_from, bit_to = field.bit
 
+        if not self.ctx.typedefs:
+            self._print_bitfield_field_definitions(doc, field)
+            return bit_to, reserved_count
+
+        size_type = self._make_size_type(doc.size)
+
         #
         # Handle "Reserved" fields.
         #
@@ -128,54 +191,18 @@ class DocProcessor(DocProcessorBase):
 
             bit_length = bit_from - bit_position
             field_long_name = f'Reserved{reserved_count}'
-            self.print(f'{doc.size_type} {self._fix_case(field_long_name):<{self._align}}: {bit_length};')
+            self.print(f'{size_type} {self._fix_case(field_long_name):<{self._align}}: {bit_length};')
             bit_position = bit_from
 
         #
         # Print bit-field.
         #
         bit_length = bit_to - bit_position
-        if self.ctx.bitfield_field_comments and field.long_description:
-            if bit_position > 0:
-                self.print(f'')
-
-            if field.short_description == field.long_description:
-                field_description = self._make_multiline_comment(self._make_long_description(field))
-
-                self.print(f'/**')
-                self.print(f' * {field_description}')
-                self.print(f' */')
-            else:
-                field_short_description = self._make_multiline_comment(self._make_short_description(field), '@brief ')
-                field_long_description = self._make_multiline_comment(self._make_long_description(field))
-                field_access = f' <b>({field.access})</b>' if field.access else ''
-
-                self.print(f'/**')
-                self.print(f' * {field_short_description}{field_access}')
-                self.print(f' *')
-                self.print(f' * {field_long_description}')
-                self._print_details(field)
-                self.print(f' */')
-
-        self.print(f'{doc.size_type} {self._fix_case(self._make_long_name(field)):<{self._align}}: {bit_length};')
+        self._print_bitfield_field_doc(field, bit_position > 0)
 
-        #
-        # Print definitions for fields.
-        #
-        if self.ctx.bitfield_field_with_definitions:
-            bit_shift = bit_to - bit_from
-            macro_arg_name = '_'
-
-            definition_bit = f'{self._make_long_name(doc)}_{self._make_long_name(field)}_BIT'
-            self.print(f'#define {definition_bit:<{self._align_const}} {bit_from}')
-
-            # _SIZE/_MASK?
-            definition_size = f'{self._make_long_name(doc)}_{self._make_long_name(field)}_MASK'
-            self.print(f'#define {definition_size:<{self._align_const}} 0x{((1 << bit_shift) - 1):02X}')
+        self.print(f'{size_type} {self._fix_case(self._make_long_name(field)):<{self._align}}: {bit_length};')
 
-            definition = f'{self._make_long_name(doc)}_{self._make_long_name(field)}({macro_arg_name})'
-            self.print(f'#define {definition:<{self._align_const}} ((({macro_arg_name}) >> {bit_from}) '
-                       f'& 0x{((1 << bit_shift) - 1):02X})')
+        self._print_bitfield_field_definitions(doc, field)
 
         bit_position = bit_to
 
@@ -184,18 +211,26 @@ class DocProcessor(DocProcessorBase):
         return bit_position, reserved_count
 
     def process_struct(self, doc: DocStruct) -> None:
+        if not self.ctx.typedefs:
+            #
+            # Only definitions of nested bitfields and fields are printed.
+            #
+            for field in doc.fields:
+                if isinstance(field, DocStructField):
+                    self.process(field.fields)
+                else:
+                    self.process([ field ])
+
+            return
+
         self._typedef_nesting += 1
 
         self._print_doc(doc)
 
         if doc.tag == 'Packed':
-            self.print(f'#include <pshpack1.h>')
-
-        if self._typedef_nesting == 1:
-            self.print(f'typedef struct')
-        else:
-            self.print(f'struct')
+            self._print_pack_begin()
 
+        self._print_typedef_begin('struct', doc)
         self.print(f'{{')
 
         with self.indent:
@@ -213,13 +248,13 @@ class DocProcessor(DocProcessorBase):
 
                 field_number += 1
 
-        if self._typedef_nesting == 1:
-            self.print(f'}} {self._make_long_name(doc)};')
-        else:
-            self.print(f'}} {self._fix_case(self._make_long_name(doc, standalone=True))};')
+        self._print_typedef_end(doc)
 
         if doc.tag == 'Packed':
-            self.print(f'#include <poppack.h>')
+            self._print_pack_end()
+
+        if self._typedef_nesting == 1:
+            self._print_layout_assert(doc)
 
         self.print(f'')
 
@@ -228,7 +263,7 @@ class DocProcessor(DocProcessorBase):
         self._typedef_nesting -= 1
 
     def process_struct_field(self, doc: DocStructField) -> None:
-        self.print(f'{doc.size_type} {self._fix_case(self._make_long_name(doc))};')
+        self.print(f'{self._make_size_type(doc.size)} {self._fix_case(self._make_long_name(doc))};')
 
         if doc.fields:
             self.print(f'')
@@ -243,7 +278,7 @@ class DocProcessor(DocProcessorBase):
         return ''.join(e.title() for e in text.split('_'))
 
     def _print_doc(self, doc: DocBase) -> None:
-        if doc.short_description:
+        if self.ctx.typedef_comments and doc.short_description:
             doc_brief = self._make_multiline_comment(self._make_short_description(doc), '@brief ')
 
             self.print(f'/**')
@@ -257,6 +292,154 @@ class DocProcessor(DocProcessorBase):
 
             self.print(f' */')
 
+    def _needs_int_types(self) -> bool:
+        #
+        # Integer types are needed only by typedefs.
+        #
+        return self.ctx.typedefs
+
+    def _print_bitfield_field_doc(self, field: DocBitfieldField, new_line: bool) -> None:
+        if not self.ctx.bitfield_field_comments or not field.long_description:
+            return
+
+        if new_line:
+            self.print(f'')
+
+        if field.short_description == field.long_description:
+            field_description = self._make_multiline_comment(self._make_long_description(field))
+
+            self.print(f'/**')
+            self.print(f' * {field_description}')
+            self.print(f' */')
+        else:
+            field_short_description = self._make_multiline_comment(self._make_short_description(field), '@brief ')
+            field_long_description = self._make_multiline_comment(self._make_long_description(field))
+            field_access = f' <b>({field.access})</b>' if field.access else ''
+
+            self.print(f'/**')
+            self.print(f' * {field_short_description}{field_access}')
+            self.print(f' *')
+            self.print(f' * {field_long_description}')
+            self._print_details(field)
+            self.print(f' */')
+
+    def _print_bitfield_field_definitions(self, doc: DocBitfield, field: DocBitfieldField) -> None:
+        if not self.ctx.bitfield_field_with_definitions:
+            return
+
+        definition_prefix = f'{self._make_long_name(doc)}_{self._make_long_name(field)}'
+        constant_list, function_list = self._make_bitfield_field_definitions(doc, field)
+
+        for suffix, value in constant_list:
+            self._print_define(f'{definition_prefix}{suffix}', value)
+
+        for suffix, arg_name_list, expression in function_list:
+            self._print_define_function(f'{definition_prefix}{suffix}', arg_name_list, expression)
+
+    def _make_bitfield_field_definitions(
+            self, doc: DocBitfield, field: DocBitfieldField
+            ) -> Tuple[List[Tuple[str, str]], List[Tuple[str, List[str], str]]]:
+        '''
+        Returns constants (name suffix, value) and functions (name suffix,
+        argument names, expression) describing the field.
+        '''
+        bit_from, bit_to = field.bit
+        bit_shift = bit_to - bit_from
+        arg_name = '_'
+        value_arg_name = 'value'
+
+        #
+        # Masks are unsigned (shifting a signed int into its sign bit is
+        # undefined) and they must not be truncated to 32 bits (eg. by ~)
+        # when the register is 64-bit wide.
+        #
+        literal_suffix = 'ULL' if doc.size > 32 else 'U'
+        mask = f'0x{((1 << bit_shift) - 1):02X}{literal_suffix}'
+        flag = f'0x{(((1 << bit_shift) - 1) << bit_from):02X}{literal_suffix}'
+
+        # _SIZE/_MASK?
+        constant_list = [
+            ('_BIT', f'{bit_from}'),
+            ('_FLAG', flag),
+            ('_MASK', mask),
+        ]
+
+        function_list = [
+            ('', [ arg_name ], f'((({arg_name}) >> {bit_from}) & {mask})'),
+        ]
+
+        if self.ctx.bitfield_field_with_helpers:
+            function_list += [
+                ('_SET', [ arg_name, value_arg_name ],
+                 f'((({arg_name}) & ~{flag}) | ((({value_arg_name}) & {mask}) << {bit_from}))'),
+                ('_CLEAR', [ arg_name ],
+                 f'(({arg_name}) & ~{flag})'),
+            ]
+
+        return constant_list, function_list
+
+    def _print_define(self, name: str, value: str) -> None:
+        self.print(f'#define {name:<{self._align_const}} {value}')
+
+    def _print_define_function(self, name: str, arg_name_list: List[str], expression: str) -> None:
+        definition = f'{name}({", ".join(arg_name_list)})'
+        self.print(f'#define {definition:<{self._align_const}} {expression}')
+
+    def _print_pack_begin(self) -> None:
+        #
+        # Understood by MSVC, GCC, Clang and ICC alike.
+        #
+        self.print(f'#pragma pack(push, 1)')
+
+    def _print_pack_end(self) -> None:
+        self.print(f'#pragma pack(pop)')
+
+    def _print_static_assert_definition(self) -> None:
+        #
+        # static_assert is not available in C before C11 - the checks
+        # are skipped there (unless the user provides the macro). The macro
+        # includes the semicolon, an empty statement is not allowed outside
+        # of functions.
+        #
+        definition = 'IA32_STATIC_ASSERT(expression, message)'
+
+        self.print(f'')
+
+        if self.ctx.definition_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Compile-time assertion - empty when the compiler does not support it.')
+            self.print(f' */')
+
+        self.print(f'#ifndef IA32_STATIC_ASSERT')
+        self.print(f'#  if defined(__cplusplus) && (__cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1600))')
+        self.print(f'#    define {definition:<{self._align_const - 4}} static_assert(expression, message);')
+        self.print(f'#  elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L')
+        self.print(f'#    define {definition:<{self._align_const - 4}} _Static_assert(expression, message);')
+        self.print(f'#  else')
+        self.print(f'#    define {definition}')
+        self.print(f'#  endif')
+        self.print(f'#endif')
+
+    def _print_layout_assert(self, doc: DocBase) -> None:
+        if not self.ctx.typedef_assertions:
+            return
+
+        name = self._make_long_name(doc)
+        size, alignment = self._make_layout(doc)
+        size_aligned = self._align_up(size, alignment)
+
+        if size == size_aligned:
+            self._print_assert(f'sizeof({name}) == {size}', f'Size of {name}')
+        else:
+            #
+            # Trailing padding depends on the ABI (eg. UINT64 is aligned
+            # to 4 bytes on i386 System V).
+            #
+            self._print_assert(f'sizeof({name}) >= {size} && sizeof({name}) <= {size_aligned}', f'Size of {name}')
+
+    def _print_assert(self, expression: str, message: str) -> None:
+        self.print(f'IA32_STATIC_ASSERT({expression}, "{message}")')
+
     def _print_details(self, doc: DocBase) -> None:
         if doc.note or doc.remarks or doc.see_also or doc.reference:
             self.print(f' *')
@@ -277,7 +460,11 @@ class DocProcessor(DocProcessorBase):
                 self.print(f' * @see {doc.see_also}')
 
         if doc.reference:
-            self.print(f' * @see {doc.reference} (reference)')
+            if isinstance(doc.reference, list):
+                for reference in doc.reference:
+                    self.print(f' * @see {reference} (reference)')
+            else:
+                self.print(f' * @see {doc.reference} (reference)')
 
     def _make_short_name(self, doc: DocBase, raw: bool=False, standalone: bool=False) -> str:
         if self.ctx.prefer_alternative_names and doc.alternative_name:
@@ -296,15 +483,101 @@ class DocProcessor(DocProcessorBase):
         if self.ctx.prefer_alternative_names and doc.alternative_name:
             result = doc.alternative_name
         else:
+            enclosing = self._find_enclosing_typedef(doc)
+
             if raw:
                 result = doc.long_name_raw
             elif standalone:
                 result = doc.long_name_standalone
+            elif enclosing:
+                #
+                # Nested bitfields/structs (eg. EAX of every CPUID leaf) are
+                # qualified by their typedef, so that definitions of their
+                # fields are unique (CPUID_EAX_04_EAX_..., CPUID_EAX_05_EAX_...).
+                #
+                result = f'{self._make_long_name(enclosing)}_{doc.long_name_standalone}'
             else:
                 result = doc.long_name
 
         return result
 
+    def _find_enclosing_typedef(self, doc: DocBase) -> DocBase:
+        if doc.type not in [ 'Struct', 'Bitfield' ]:
+            return None
+
+        parent = doc.parent
+
+        while parent and parent.type in [ 'StructField', 'BitfieldField' ]:
+            parent = parent.parent
+
+        if parent and parent.type in [ 'Struct', 'Bitfield' ]:
+            return parent
+
+        return None
+
+    def _make_member_path(self, doc: DocBase) -> Tuple[DocBase, List[str]]:
+        '''
+        Returns top-level typedef of the (possibly nested) typedef and names
+        of the members leading from it to the typedef, eg. CPUID_EAX_01 and
+        [ "CpuidVersionInformation" ].
+        '''
+        member_list = []
+
+        while self._find_enclosing_typedef(doc):
+            member_list.insert(0, self._fix_case(self._make_long_name(doc, standalone=True)))
+            doc = self._find_enclosing_typedef(doc)
+
+        return doc, member_list
+
+    def _make_layout(self, doc: DocBase) -> Tuple[int, int]:
+        '''
+        Returns expected size (without trailing padding) and alignment of the
+        typedef in bytes - every member is aligned to its size, unless the
+        struct is packed.
+        '''
+        if isinstance(doc, DocBitfield):
+            return doc.size_max // 8, doc.size_max // 8
+
+        if isinstance(doc, DocStructField):
+            return doc.size // 8, doc.size // 8
+
+        offset = 0
+        alignment = 1
+
+        for field in doc.fields:
+            field_size, field_alignment = self._make_layout(field)
+            field_size = self._align_up(field_size, field_alignment)
+
+            if doc.tag == 'Packed':
+                field_alignment = 1
+
+            offset = self._align_up(offset, field_alignment) + field_size
+            alignment = max(alignment, field_alignment)
+
+        return offset, alignment
+
+    @staticmethod
+    def _align_up(value: int, alignment: int) -> int:
+        return (value + alignment - 1) // alignment * alignment
+
+    def _print_typedef_begin(self, kind: str, doc: DocBase) -> None:
+        if self._typedef_nesting == 1:
+            self.print(f'{self._make_typedef(kind)}')
+        else:
+            self.print(f'{kind}')
+
+    def _print_typedef_end(self, doc: DocBase) -> None:
+        if self._typedef_nesting == 1:
+            self.print(f'}} {self._make_long_name(doc)};')
+        else:
+            self.print(f'}} {self._fix_case(self._make_long_name(doc, standalone=True))};')
+
+    def _make_typedef(self, kind: str) -> str:
+        return f'typedef {kind}'
+
+    def _make_size_type(self, size: int) -> str:
+        return DOC_INT_TYPES[self.ctx.int_types][size]
+
     def _make_short_description(self, doc: DocBase) -> str:
         return doc.short_description.rstrip().rstrip('.')
 
@@ -0,0 +1,205 @@
+from .doc import *
+from .processor import DocProcessor
+
+#
+# Field names which can't be used as names of builder methods as they are
+# (eg. "INT" field of interrupt command register).
+#
+CPP_KEYWORDS = {
+    'alignas', 'alignof', 'and', 'and_eq', 'asm', 'auto', 'bitand', 'bitor', 'bool', 'break', 'case', 'catch',
+    'char', 'class', 'compl', 'const', 'constexpr', 'const_cast', 'continue', 'decltype', 'default', 'delete',
+    'do', 'double', 'dynamic_cast', 'else', 'enum', 'explicit', 'export', 'extern', 'false', 'float', 'for',
+    'friend', 'goto', 'if', 'inline', 'int', 'long', 'mutable', 'namespace', 'new', 'noexcept', 'not', 'not_eq',
+    'nullptr', 'operator', 'or', 'or_eq', 'private', 'protected', 'public', 'register', 'reinterpret_cast',
+    'return', 'short', 'signed', 'sizeof', 'static', 'static_assert', 'static_cast', 'struct', 'switch',
+    'template', 'this', 'thread_local', 'throw', 'true', 'try', 'typedef', 'typeid', 'typename', 'union',
+    'unsigned', 'using', 'virtual', 'void', 'volatile', 'wchar_t', 'while', 'xor', 'xor_eq',
+}
+
+
+class DocAccessorProcessor(DocProcessor):
+    '''
+    Emits C++ header without bitfields - every bitfield is a struct wrapping
+    single integer with inline accessors of its fields, eg.:
+
+        struct CR0
+        {
+          UINT64 Flags;
+
+          constexpr UINT64 get_protection_enable() const { ... }
+          void set_protection_enable(UINT64 value) { ... }
+          ...
+        };
+
+    Accessors are plain shifts and masks - unlike bitfields, their layout
+    is not implementation-defined and the compiler is never forced into
+    bit-by-bit read-modify-write sequences.
+
+    Volatile entries (eg. live page tables) are accessed by copying "Flags"
+    - exactly one load and one store, no matter how many fields change:
+
+        PTE pte = { entry->Flags };
+        pte.set_write(0);
+        pte.set_execute_disable(1);
+        entry->Flags = pte.Flags;
+
+    Several fields are updated at once by a builder - all writes are folded
+    into one mask and one value (constant, when the arguments are constant),
+    applied by a single and-or:
+
+        PTE pte = PTE::with().present(1).write(1).page_frame_number(pfn);
+        entry.apply(PTE::with().write(0).execute_disable(1));
+
+    Builder methods are named after the fields, C++ keywords get trailing
+    underscore (eg. int_()).
+
+    Structs are named (not typedefs of unnamed structs) - C++20 does not
+    allow member functions in classes named only by a typedef.
+    '''
+
+    def process_bitfield(self, doc: DocBitfield) -> None:
+        if not self.ctx.typedefs:
+            super().process_bitfield(doc)
+            return
+
+        self._typedef_nesting += 1
+
+        self._print_doc(doc)
+        self._print_typedef_begin('struct', doc)
+        self.print(f'{{')
+
+        with self.indent:
+            #
+            # Register with variable size (eg. 32-bit and 64-bit variant)
+            # is always stored in its widest type.
+            #
+            self.print(f'{self._make_size_type(doc.size_max)} Flags;')
+
+            bit_position = 0
+            reserved_count = 0
+
+            for field in doc.fields:
+                if isinstance(field, DocBitfieldField):
+                    bit_position, reserved_count = self.process_bitfield_field(
+                        doc, field, bit_position, reserved_count
+                        )
+
+            self._print_builder(doc)
+
+        self._print_typedef_end(doc)
+
+        if self._typedef_nesting == 1:
+            self._print_layout_assert(doc)
+
+        self.print(f'')
+
+        self._typedef_nesting -= 1
+
+        self.process(doc.fields)
+
+    def process_bitfield_field(
+            self, doc: DocBitfield, field: DocBitfieldField, bit_position: int, reserved_count: int
+            ) -> Tuple[int, int]:
+        bit_from, bit_to = field.bit
+
+        if not self.ctx.typedefs:
+            return super().process_bitfield_field(doc, field, bit_position, reserved_count)
+
+        #
+        # Reserved bits have no accessors - they are only preserved
+        # by the setters.
+        #
+        if bit_from > bit_position:
+            reserved_count += 1
+
+        size_type = self._make_size_type(doc.size_max)
+        accessor_name = self._make_long_name(field).lower()
+        constants = dict(self._make_bitfield_field_definitions(doc, field)[0])
+        flag, mask = constants['_FLAG'], constants['_MASK']
+
+        self._print_bitfield_field_doc(field, True)
+
+        if not self.ctx.bitfield_field_comments or not field.long_description:
+            self.print(f'')
+
+        self.print(f'constexpr {size_type} get_{accessor_name}() const '
+                   f'{{ return (Flags >> {bit_from}) & {mask}; }}')
+        self.print(f'void set_{accessor_name}({size_type} value) '
+                   f'{{ Flags = (Flags & ~{flag}) | ((value & {mask}) << {bit_from}); }}')
+
+        self._print_bitfield_field_definitions(doc, field)
+
+        return bit_to, reserved_count
+
+    #
+    # Private methods.
+    # ================
+    #
+
+    def _print_builder(self, doc: DocBitfield) -> None:
+        size_type = self._make_size_type(doc.size_max)
+        name = self._make_accessor_type_name(doc)
+
+        self.print(f'')
+
+        if self.ctx.typedef_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Fields written by the chain of calls - see with() and apply().')
+            self.print(f' */')
+
+        self.print(f'struct Builder')
+        self.print(f'{{')
+
+        with self.indent:
+            self.print(f'{size_type} Mask;')
+            self.print(f'{size_type} Value;')
+            self.print(f'')
+
+            for field in doc.fields:
+                if not isinstance(field, DocBitfieldField):
+                    continue
+
+                bit_from = field.bit[0]
+                method_name = self._make_long_name(field).lower()
+                constants = dict(self._make_bitfield_field_definitions(doc, field)[0])
+                flag, mask = constants['_FLAG'], constants['_MASK']
+
+                if method_name in CPP_KEYWORDS:
+                    method_name += '_'
+
+                builder_mask = f'Mask | {flag}'
+                builder_value = f'(Value & ~{flag}) | ((value & {mask}) << {bit_from})'
+
+                #
+                # Operands narrower than int are promoted - the result must be
+                # converted back explicitly in the braced initializer.
+                #
+                if doc.size_max < 32:
+                    builder_mask = f'static_cast<{size_type}>({builder_mask})'
+                    builder_value = f'static_cast<{size_type}>({builder_value})'
+
+                self.print(f'constexpr Builder {method_name}({size_type} value) const '
+                           f'{{ return {{ {builder_mask}, {builder_value} }}; }}')
+
+            self.print(f'')
+            self.print(f'constexpr operator {name}() const {{ return {{ Value }}; }}')
+
+        self.print(f'}};')
+        self.print(f'')
+        self.print(f'static constexpr Builder with() {{ return {{ 0, 0 }}; }}')
+        self.print(f'void apply(Builder builder) {{ Flags = (Flags & ~builder.Mask) | builder.Value; }}')
+
+    def _make_accessor_type_name(self, doc: DocBase) -> str:
+        if self._typedef_nesting == 1:
+            return self._make_long_name(doc)
+        else:
+            return self._make_long_name(doc, standalone=True)
+
+    def _print_typedef_begin(self, kind: str, doc: DocBase) -> None:
+        self.print(f'{kind} {self._make_accessor_type_name(doc)}')
+
+    def _print_typedef_end(self, doc: DocBase) -> None:
+        if self._typedef_nesting == 1:
+            self.print(f'}};')
+        else:
+            self.print(f'}} {self._fix_case(self._make_long_name(doc, standalone=True))};')
@@ -1,5 +1,6 @@
 from .doc import *
-from .processor_ctx import DocProcessorContextStack
+from .output import DocOutput, DocOutputBuffer
+from .processor_ctx import DocProcessorContext, DocProcessorContextStack
 
 
 class DocIndent(object):
@@ -16,7 +17,7 @@ class DocIndent(object):
         return ' ' * self.indent
 
     def __call__(self, text, indent_only=True):
-        indent = ' ' * (self.indent - text) \
+        indent = ' ' * (self.indent - len(text)) \
                  if len(text) < self.indent \
                  else ' '
 
@@ -24,36 +25,64 @@ class DocIndent(object):
 
 
 class DocProcessorBase(object):
-    def __init__(self):
+    #
+    # Single translation table for all Unicode characters
+    # which should not appear in the output.
+    #
+    _FIX_TEXT_TABLE = str.maketrans({
+        '“': '"',
+        '”': '"',
+        '—': '-',
+        '–': '-',
+        '®': '(R)',
+        '’': '\'',
+        '•': '*',
+        '≥': '>=',
+        '™': '(TM)',
+        '←': '<-',
+    })
+
+    _DIRECTIVE_RE = re.compile(r'(#\w*)\s*(.*)')
+
+    def __init__(self, output: DocOutput=None, ctx: DocProcessorContext=None):
         self.indent = DocIndent()
-        self.ctx = DocProcessorContextStack()
+        self.ctx = DocProcessorContextStack(ctx)
+        self.output = output or DocOutputBuffer()
         self.last_new_line_count = 0
 
     def print(self, text: str) -> None:
+        write_line = self.output.write_line
+
         if text:
             for line in text.splitlines():
                 if line:
                     if line.startswith('#') and self.ctx.definition_no_indent and self.indent.indent > 0:
-                        keyword = re.match(r'(#\w*)\s*(.*)', line).group(1)
-                        line = re.sub(r'(#\w*)\s*(.*)', rf'\1{self.indent(keyword)}\2', line)
-                        print(f'{self._fix_text(line)}')
+                        keyword, rest = self._DIRECTIVE_RE.match(line).groups()
+                        write_line(self._fix_text(f'{keyword}{self.indent(keyword)}{rest}'.rstrip()))
                     else:
-                        print(f'{self.indent}{self._fix_text(line)}')
+                        write_line(f'{self.indent}{self._fix_text(line)}')
 
                     self.last_new_line_count = 0
                 else:
                     #
                     # Empty line? Just print new line.
                     #
-                    print()
+                    write_line('')
                     self.last_new_line_count += 1
         else:
             #
             # Empty text? Just print new line.
             #
-            print()
+            write_line('')
             self.last_new_line_count += 1
 
+    def reset(self) -> None:
+        '''
+        Drops state kept between documents - called before every
+        independently emitted part of the output.
+        '''
+        pass
+
     def process(self, doc_list: List[DocBase]) -> None:
         for doc in doc_list:
             if doc.type == 'Group':
@@ -65,9 +94,25 @@ class DocProcessorBase(object):
             elif isinstance(doc, DocBitfield):
                 self.process_bitfield(doc)
 
+    def process_prologue(self, include_list: List[str]=None) -> None:
+        pass
+
+    def process_epilogue(self, doc_list: List[DocBase]) -> None:
+        '''
+        Called after all documents of the output (only by DocGenerator),
+        with the whole tree - for declarations gathered from all of them.
+        '''
+        pass
+
     def process_group(self, doc: DocBase) -> None:
         pass
 
+    def process_group_begin(self, doc: DocBase, continued: bool=False) -> None:
+        pass
+
+    def process_group_end(self, doc: DocBase, continued: bool=False) -> None:
+        pass
+
     def process_definition(self, doc: DocDefinition) -> None:
         pass
 
@@ -84,17 +129,6 @@ class DocProcessorBase(object):
     def process_struct_field(self, doc: DocStructField) -> None:
         pass
 
-    @staticmethod
-    def _fix_text(text: str) -> str:
-        text = text.replace('“', '"')
-        text = text.replace('”', '"')
-        text = text.replace('—', '-')
-        text = text.replace('–', '-')
-        text = text.replace('®', '(R)')
-        text = text.replace('’', '\'')
-        text = text.replace('•', '*')
-        text = text.replace('≥', '>=')
-        text = text.replace('™', '(TM)')
-        text = text.replace('←', '<-')
-
-        return text
+    @classmethod
+    def _fix_text(cls, text: str) -> str:
+        return text.translate(cls._FIX_TEXT_TABLE)
@@ -0,0 +1,137 @@
+from typing import Callable, Dict, Tuple
+
+from .doc import *
+from .output import DocOutput
+from .processor import DocProcessor
+from .processor_ctx import DocProcessorContext
+
+
+class DocCppProcessor(DocProcessor):
+    '''
+    Emits C++ header - definitions of bitfield fields (_BIT, _FLAG, _MASK and
+    the functions) are not macros, but enum constants and constexpr
+    functions in a namespace of their bitfield, eg.:
+
+        CR0_PROTECTION_ENABLE_BIT   -> CR0_FIELDS::PROTECTION_ENABLE_BIT
+        CR0_PROTECTION_ENABLE(_)    -> CR0_FIELDS::PROTECTION_ENABLE_GET(_)
+
+    The extracting function has "_GET" suffix - names of some fields match
+    names of (still macro) definitions, eg. MEMORY_TYPE_WRITE_BACK.
+
+    Namespaces of nested bitfields are nested in the namespace of their
+    typedef and named after their member, eg.:
+
+        CPUID_EAX_01_FIELDS::CPUID_FEATURE_INFORMATION_ECX::SSE3_BIT
+
+    Namespaces can't be declared inside of the unions/structs, therefore all
+    namespaces of a typedef are emitted right after it.
+    '''
+
+    NAMESPACE_SUFFIX = 'FIELDS'
+
+    def __init__(self, output: DocOutput=None, ctx: DocProcessorContext=None):
+        super().__init__(output, ctx)
+
+        #
+        # Names of the enclosing bitfields/structs (outermost first).
+        #
+        self._scope: List[str] = []
+
+        #
+        # Namespace path -> constant/function name -> value/(arguments, expression).
+        #
+        self._deferred_constants: Dict[Tuple[str, ...], Dict[str, str]] = { }
+        self._deferred_functions: Dict[Tuple[str, ...], Dict[str, tuple]] = { }
+
+    def reset(self) -> None:
+        self._scope = []
+        self._deferred_constants = { }
+        self._deferred_functions = { }
+
+    def process_bitfield(self, doc: DocBitfield) -> None:
+        self._process_scope(doc, super().process_bitfield)
+
+    def process_struct(self, doc: DocStruct) -> None:
+        self._process_scope(doc, super().process_struct)
+
+    #
+    # Private methods.
+    # ================
+    #
+
+    def _process_scope(self, doc: DocBase, process: Callable) -> None:
+        if self._scope:
+            self._scope.append(self._make_long_name(doc, standalone=True))
+        else:
+            self._scope.append(f'{self._make_long_name(doc)}_{self.NAMESPACE_SUFFIX}')
+
+        process(doc)
+        self._scope.pop()
+
+        if not self._scope:
+            self._print_deferred()
+
+    def _needs_int_types(self) -> bool:
+        return self.ctx.typedefs or self.ctx.bitfield_field_with_definitions
+
+    def _print_bitfield_field_definitions(self, doc: DocBitfield, field: DocBitfieldField) -> None:
+        if not self.ctx.bitfield_field_with_definitions:
+            return
+
+        field_name = self._make_long_name(field)
+        namespace = tuple(self._scope)
+        constant_list, function_list = self._make_bitfield_field_definitions(doc, field)
+
+        constants = self._deferred_constants.setdefault(namespace, { })
+        functions = self._deferred_functions.setdefault(namespace, { })
+
+        for suffix, value in constant_list:
+            self._defer(namespace, constants, f'{field_name}{suffix}', value)
+
+        for suffix, arg_name_list, expression in function_list:
+            self._defer(namespace, functions, f'{field_name}{suffix or "_GET"}', (tuple(arg_name_list), expression))
+
+    def _print_deferred(self) -> None:
+        for namespace, constants in self._deferred_constants.items():
+            self._print_namespace(namespace, constants, self._deferred_functions[namespace])
+
+        self.reset()
+
+    def _print_namespace(self, namespace: Tuple[str, ...], constants: Dict[str, str],
+                         functions: Dict[str, tuple]) -> None:
+        if namespace:
+            self.print(f'namespace {namespace[0]}')
+            self.print(f'{{')
+
+            with self.indent:
+                self._print_namespace(namespace[1:], constants, functions)
+
+            self.print(f'}}')
+
+            if len(namespace) == 1:
+                self.print(f'')
+
+            return
+
+        size_type = self._make_size_type(64)
+
+        self.print(f'enum : {size_type}')
+        self.print(f'{{')
+
+        with self.indent:
+            for name, value in constants.items():
+                self.print(f'{name:<{self._align_const}} = {value},')
+
+        self.print(f'}};')
+        self.print(f'')
+
+        for name, (arg_name_list, expression) in functions.items():
+            arg_list = ', '.join(f'{size_type} {arg_name}' for arg_name in arg_name_list)
+            self.print(f'constexpr {size_type} {name}({arg_list}) {{ return {expression}; }}')
+
+    @staticmethod
+    def _defer(namespace: Tuple[str, ...], definitions: dict, name: str, value) -> None:
+        if definitions.get(name, value) != value:
+            raise Exception(f'Conflicting definitions of {"::".join(namespace)}::{name}')
+
+        definitions[name] = value
@@ -1,16 +1,30 @@
 class DocProcessorContext(object):
     def __init__(self,
+                 int_types: str='ms',
+                 definitions: bool=True,
                  definition_comments: bool=True,
                  definition_new_line: bool=True,
                  definition_no_indent: bool=True,
+                 typedefs: bool=True,
+                 typedef_comments: bool=True,
+                 typedef_assertions: bool=True,
+                 group_comments: bool=True,
                  bitfield_field_comments: bool=True,
                  bitfield_field_with_definitions: bool=True,
+                 bitfield_field_with_helpers: bool=True,
                  prefer_alternative_names: bool=True):
+        self.int_types = int_types
+        self.definitions = definitions
         self.definition_comments = definition_comments
         self.definition_new_line = definition_new_line
         self.definition_no_indent = definition_no_indent
+        self.typedefs = typedefs
+        self.typedef_comments = typedef_comments
+        self.typedef_assertions = typedef_assertions
+        self.group_comments = group_comments
         self.bitfield_field_comments = bitfield_field_comments
         self.bitfield_field_with_definitions = bitfield_field_with_definitions
+        self.bitfield_field_with_helpers = bitfield_field_with_helpers
         self.prefer_alternative_names = prefer_alternative_names
 
 
@@ -28,13 +42,20 @@ class DocProcessorContextStackPush(object):
 
 
 class DocProcessorContextStack(object):
-    def __init__(self):
-        self.ctx = DocProcessorContext()
+    def __init__(self, ctx: DocProcessorContext=None):
+        self.ctx = ctx or DocProcessorContext()
         self.ctx_stack = []
 
     def push(self, new_ctx) -> DocProcessorContextStackPush:
         return DocProcessorContextStackPush(self, new_ctx)
 
     def __getattr__(self, item):
+        #
+        # Do not recurse when "ctx" itself is not set yet
+        # (eg. while unpickling in a worker process).
+        #
+        if item == 'ctx':
+            raise AttributeError(item)
+
         return getattr(self.ctx, item)
 
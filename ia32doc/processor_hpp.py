@@ -0,0 +1,277 @@
+from typing import Dict, Optional
+
+from .doc import *
+from .output import DocOutput
+from .processor import DocProcessor
+from .processor_accessor import CPP_KEYWORDS
+from .processor_ctx import DocProcessorContext
+
+
+class DocHppProcessor(DocProcessor):
+    '''
+    Emits C++20 header with strongly typed counterparts of the C header in
+    namespace "ia32" - it can be included together with the C header.
+
+    Every bitfield (including the nested ones, eg. CPUID_EAX_01_EAX) is
+    a literal class with constexpr accessors; setters return modified copy,
+    therefore whole register images can be computed at compile time:
+
+        constexpr auto cr0 = ia32::CR0().with_protection_enable(1).with_paging_enable(1);
+        static_assert(cr0.flags() == 0x80000001);
+
+    Unsigned integers of the same size and the matching C union (the C
+    header is included) are converted by std::bit_cast - other types
+    (including other registers) are rejected:
+
+        auto pte = ia32::PTE::from(raw);
+
+    Addresses of MSRs and encodings of VMCS fields are scoped enums, MSRs
+    with described layout are bound to their class and VMCS fields to the
+    type of their width:
+
+        ia32::MsrType<ia32::Msr::Ia32FeatureControl>    -> IA32_FEATURE_CONTROL_REGISTER
+        ia32::VmcsFieldType<ia32::VmcsField::VmcsGuestCr0>  -> UINT64
+
+    Enums are built from the whole tree - they are emitted by the epilogue.
+    '''
+
+    #
+    # Groups holding definitions of the enums (name of the group -> name
+    # and underlying type of the enum).
+    #
+    ENUM_GROUPS = {
+        'MODEL_SPECIFIC_REGISTERS': ('Msr', 32),
+        'VMCS': ('VmcsField', 32),
+    }
+
+    NAMESPACE = 'ia32'
+
+    def __init__(self, include: str=None, output: DocOutput=None, ctx: DocProcessorContext=None):
+        super().__init__(output, ctx)
+        self.include = include
+
+    def process_prologue(self, include_list: List[str]=None) -> None:
+        if include_list is not None:
+            raise Exception('C++ header is emitted only by DocGenerator')
+
+        if self.ctx.group_comments:
+            self.print(f'/** @file */')
+
+        self.print(f'#pragma once')
+        self.print(f'#include <bit>')
+        self.print(f'#include <concepts>')
+        self.print(f'#include <type_traits>')
+
+        #
+        # C unions are the only other types the classes are converted from.
+        #
+        if self.include:
+            self.print(f'#include "{self.include}"')
+        elif self.ctx.int_types == 'cstdint':
+            self.print(f'#include <stdint.h>')
+        elif self.ctx.int_types != 'c':
+            for size, int_type in DOC_INT_TYPES[self.ctx.int_types].items():
+                self.print(f'typedef {int_types_c[size]:<20}{int_type};')
+
+        self.print(f'')
+        self.print(f'namespace {self.NAMESPACE}')
+        self.print(f'{{')
+        self.print(f'')
+
+    def process_epilogue(self, doc_list: List[DocBase]) -> None:
+        enums: Dict[str, List[DocDefinition]] = { name: [] for name in self.ENUM_GROUPS }
+
+        for root in doc_list:
+            for doc in root.walk():
+                group_name = self._find_enum_group(doc)
+
+                if group_name:
+                    enums[group_name].append(doc)
+
+        for group_name, definition_list in enums.items():
+            if definition_list:
+                self._print_enum(group_name, definition_list)
+
+        if enums['MODEL_SPECIFIC_REGISTERS']:
+            self._print_msr_types(enums['MODEL_SPECIFIC_REGISTERS'])
+
+        if enums['VMCS']:
+            self._print_vmcs_field_types()
+
+        self.print(f'}}')
+
+    def process_group(self, doc: DocBase) -> None:
+        self.process(doc.fields)
+
+    def process_group_begin(self, doc: DocBase, continued: bool=False) -> None:
+        pass
+
+    def process_group_end(self, doc: DocBase, continued: bool=False) -> None:
+        pass
+
+    def process_definition(self, doc: DocDefinition) -> None:
+        self.process(doc.fields)
+
+    def process_struct(self, doc: DocStruct) -> None:
+        #
+        # Structs are not registers - only their bitfields are emitted.
+        #
+        for field in doc.fields:
+            if isinstance(field, DocStructField):
+                self.process(field.fields)
+            else:
+                self.process([ field ])
+
+    def process_bitfield(self, doc: DocBitfield) -> None:
+        name = self._make_long_name(doc)
+        size_type = self._make_size_type(doc.size_max)
+
+        self._print_doc(doc)
+        self.print(f'class {name}')
+        self.print(f'{{')
+        self.print(f'public:')
+
+        with self.indent:
+            self.print(f'constexpr {name}() = default;')
+            self.print(f'constexpr explicit {name}({size_type} flags) : Flags(flags) {{ }}')
+            self.print(f'')
+            self.print(f'template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof({size_type})) || '
+                       f'std::same_as<T, {self._make_c_type(doc)}>')
+            self.print(f'static constexpr {name} from(const T& raw) {{ return std::bit_cast<{name}>(raw); }}')
+            self.print(f'')
+            self.print(f'constexpr {size_type} flags() const {{ return Flags; }}')
+            self.print(f'friend constexpr bool operator==(const {name}&, const {name}&) = default;')
+
+            for field in doc.fields:
+                if isinstance(field, DocBitfieldField):
+                    self.process_bitfield_field(doc, field, 0, 0)
+
+        self.print(f'')
+        self.print(f'private:')
+
+        with self.indent:
+            self.print(f'{size_type} Flags = 0;')
+
+        self.print(f'}};')
+        self._print_layout_assert(doc)
+        self.print(f'')
+
+        self.process(doc.fields)
+
+    def _make_c_type(self, doc: DocBitfield) -> str:
+        '''
+        Returns C union of the bitfield (nested unions have no name of their
+        own, eg. decltype(::CPUID_EAX_01::CpuidVersionInformation)).
+        '''
+        typedef, member_list = self._make_member_path(doc)
+        result = f'::{self._make_long_name(typedef)}'
+
+        for member in member_list:
+            result = f'decltype({result}::{member})'
+
+        return result
+
+    def process_bitfield_field(
+            self, doc: DocBitfield, field: DocBitfieldField, bit_position: int, reserved_count: int
+            ) -> Tuple[int, int]:
+        bit_from, bit_to = field.bit
+
+        name = self._make_long_name(doc)
+        size_type = self._make_size_type(doc.size_max)
+        accessor_name = self._make_long_name(field).lower()
+        constants = dict(self._make_bitfield_field_definitions(doc, field)[0])
+        flag, mask = constants['_FLAG'], constants['_MASK']
+
+        if accessor_name in CPP_KEYWORDS:
+            accessor_name += '_'
+
+        self._print_bitfield_field_doc(field, True)
+
+        if not self.ctx.bitfield_field_comments or not field.long_description:
+            self.print(f'')
+
+        self.print(f'constexpr {size_type} {accessor_name}() const '
+                   f'{{ return (Flags >> {bit_from}) & {mask}; }}')
+        self.print(f'constexpr {name} with_{accessor_name.rstrip("_")}({size_type} value) const '
+                   f'{{ return {name}((Flags & ~{flag}) | ((value & {mask}) << {bit_from})); }}')
+
+        return bit_to, reserved_count
+
+    #
+    # Private methods.
+    # ================
+    #
+
+    def _find_enum_group(self, doc: DocBase) -> Optional[str]:
+        '''
+        Returns name of the enum group containing the definition (only
+        through other groups - not values of bitfield fields, etc.).
+        '''
+        if not isinstance(doc, DocDefinition) or not isinstance(doc.value, int):
+            return None
+
+        parent = doc.parent
+
+        while parent and parent.type == 'Group':
+            if parent.long_name in self.ENUM_GROUPS:
+                return parent.long_name
+
+            parent = parent.parent
+
+        return None
+
+    def _print_enum(self, group_name: str, doc_list: List[DocDefinition]) -> None:
+        enum_name, enum_size = self.ENUM_GROUPS[group_name]
+
+        self.print(f'enum class {enum_name} : {self._make_size_type(enum_size)}')
+        self.print(f'{{')
+
+        with self.indent:
+            for doc in doc_list:
+                self.print(f'{self._fix_case(self._make_long_name(doc)):<{self._align}} = 0x{doc.value:08X},')
+
+        self.print(f'}};')
+        self.print(f'')
+
+    def _print_msr_types(self, doc_list: List[DocDefinition]) -> None:
+        if self.ctx.typedef_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Type of the MSR - class of its register, when its layout is described.')
+            self.print(f' */')
+
+        self.print(f'template <Msr Register>')
+        self.print(f'struct MsrTraits {{ using Type = {self._make_size_type(64)}; }};')
+        self.print(f'')
+
+        for doc in doc_list:
+            for field in doc.fields:
+                if isinstance(field, DocBitfield):
+                    self.print(f'template <> struct MsrTraits<Msr::{self._fix_case(self._make_long_name(doc))}> '
+                               f'{{ using Type = {self._make_long_name(field)}; }};')
+                    break
+
+        self.print(f'')
+        self.print(f'template <Msr Register>')
+        self.print(f'using MsrType = typename MsrTraits<Register>::Type;')
+        self.print(f'')
+
+    def _print_vmcs_field_types(self) -> None:
+        width = f'((static_cast<{self._make_size_type(32)}>(Field) >> 13) & 3)'
+
+        if self.ctx.typedef_comments:
+            self.print(f'/**')
+            self.print(f' * @brief Type of the VMCS field - by its width (bits 13-14 of the encoding: 16-bit, 64-bit,')
+            self.print(f' *        32-bit or natural-width).')
+            self.print(f' */')
+
+        self.print(f'template <VmcsField Field>')
+        self.print(f'using VmcsFieldType =')
+
+        with self.indent:
+            self.print(f'std::conditional_t<{width} == 0, {self._make_size_type(16)},')
+            self.print(f'std::conditional_t<{width} == 2, {self._make_size_type(32)}, {self._make_size_type(64)}>>;')
+
+        self.print(f'')
+
+    def _print_assert(self, expression: str, message: str) -> None:
+        self.print(f'static_assert({expression}, "{message}");')
@@ -0,0 +1,116 @@
+from .doc import *
+from .output import DocOutput
+from .processor import DocProcessor
+from .processor_ctx import DocProcessorContext
+
+
+class DocModuleProcessor(DocProcessor):
+    '''
+    Emits C++20 module interface units (see DocModuleGenerator) instead of
+    a header. Typedefs are exported as they are, macros become exported
+    constexpr variables and functions.
+
+    Constants can't be declared inside of the unions/structs, therefore all
+    constants found inside of a typedef are emitted right after it.
+    '''
+
+    def __init__(self, output: DocOutput=None, ctx: DocProcessorContext=None):
+        super().__init__(output, ctx)
+        self._deferred_lines: List[str] = []
+
+    def reset(self) -> None:
+        self._deferred_lines = []
+
+    def process_prologue(self, include_list: List[str]=None) -> None:
+        raise Exception('Modules are emitted only by DocModuleGenerator')
+
+    def process_module_prologue(self, module_name: str, partition: str=None, import_list: List[str]=None) -> None:
+        if self.ctx.group_comments:
+            self.print(f'/** @file */')
+
+        self._print_global_module_fragment()
+
+        if partition:
+            self.print(f'export module {module_name}:{partition};')
+        else:
+            self.print(f'export module {module_name};')
+
+        #
+        # Primary interface re-exports all partitions.
+        #
+        for module_import in import_list or []:
+            if partition:
+                self.print(f'import :{module_import};')
+            else:
+                self.print(f'export import :{module_import};')
+
+        self.print(f'')
+
+    def process_module_types(self, module_name: str, partition: str) -> None:
+        if self.ctx.group_comments:
+            self.print(f'/** @file */')
+
+        self._print_global_module_fragment()
+        self.print(f'export module {module_name}:{partition};')
+
+        if self.ctx.int_types == 'cstdint':
+            for int_type in DOC_INT_TYPES[self.ctx.int_types].values():
+                self.print(f'export using ::{int_type};')
+        elif self.ctx.int_types != 'c':
+            for size, int_type in DOC_INT_TYPES[self.ctx.int_types].items():
+                self.print(f'export typedef {int_types_c[size]:<20}{int_type};')
+
+        self.print(f'')
+
+    def process_bitfield(self, doc: DocBitfield) -> None:
+        super().process_bitfield(doc)
+        self._print_deferred()
+
+    def process_struct(self, doc: DocStruct) -> None:
+        super().process_struct(doc)
+        self._print_deferred()
+
+    #
+    # Private methods.
+    # ================
+    #
+
+    def _make_typedef(self, kind: str) -> str:
+        return f'export typedef {kind}'
+
+    def _print_define(self, name: str, value: str) -> None:
+        self._print_or_defer(f'export inline constexpr auto {name:<{self._align_const}} = {value};')
+
+    def _print_define_function(self, name: str, arg_name_list: List[str], expression: str) -> None:
+        arg_type = self._make_size_type(64)
+        arg_list = ', '.join(f'{arg_type} {arg_name}' for arg_name in arg_name_list)
+        self._print_or_defer(f'export constexpr {arg_type} {name}({arg_list}) '
+                             f'{{ return {expression}; }}')
+
+    def _print_global_module_fragment(self) -> None:
+        #
+        # Types from <stdint.h> belong to the global module - every unit
+        # using them has to include the header.
+        #
+        if self.ctx.int_types == 'cstdint':
+            self.print(f'module;')
+            self.print(f'#include <stdint.h>')
+
+    def _print_assert(self, expression: str, message: str) -> None:
+        self.print(f'static_assert({expression}, "{message}");')
+
+    def _print_or_defer(self, line: str) -> None:
+        if self._typedef_nesting > 0:
+            self._deferred_lines.append(line)
+        else:
+            self.print(line)
+
+    def _print_deferred(self) -> None:
+        if self._typedef_nesting > 0 or not self._deferred_lines:
+            return
+
+        for line in self._deferred_lines:
+            self.print(line)
+
+        self.print(f'')
+        self._deferred_lines = []
@@ -0,0 +1,118 @@
+from typing import Callable, Dict, List
+
+import functools
+import json
+import time
+
+from .log import log
+from .output import DocOutputBuffer
+
+
+class DocProfiler(object):
+    '''
+    Collects wall time, call count and number of emitted bytes of the
+    instrumented functions ("phases").
+
+    Phases nest (eg. tree construction includes include resolution, which
+    includes YAML loading), therefore both total time (including nested
+    phases) and self time (excluding them) are reported. Emitted bytes are
+    attributed to the innermost phase only.
+
+    Functions are instrumented by replacing them on their owner (class or
+    module), nothing is patched unless the profiler is created.
+    '''
+
+    def __init__(self):
+        self.phases: Dict[str, dict] = { }
+        self._stack: List[dict] = []
+        self._bytes = 0
+        self._time_start = time.perf_counter()
+
+        #
+        # Count every line written into the output buffers.
+        #
+        write_line = DocOutputBuffer.write_line
+
+        def counting_write_line(output: DocOutputBuffer, line: str) -> None:
+            self._bytes += len(line) + 1
+            write_line(output, line)
+
+        DocOutputBuffer.write_line = counting_write_line
+
+    def instrument(self, owner, name: str, phase: str) -> None:
+        descriptor = vars(owner).get(name) if isinstance(owner, type) else None
+        is_static = isinstance(descriptor, staticmethod)
+        function = getattr(owner, name)
+
+        wrapper = self._wrap(function, phase)
+        setattr(owner, name, staticmethod(wrapper) if is_static else wrapper)
+
+    def report(self) -> dict:
+        return {
+            'total_time': time.perf_counter() - self._time_start,
+            'total_bytes': self._bytes,
+            'phases': self.phases,
+        }
+
+    def print_table(self) -> None:
+        report = self.report()
+
+        log(f'{"Phase":<40} {"Calls":>8} {"Total [ms]":>12} {"Self [ms]":>12} {"Bytes":>10}')
+        log(f'{"-" * 40} {"-" * 8} {"-" * 12} {"-" * 12} {"-" * 10}')
+
+        for phase, stats in sorted(self.phases.items(), key=lambda item: -item[1]['self_time']):
+            log(f'{phase:<40} {stats["calls"]:>8} {stats["total_time"] * 1000:>12.2f} '
+                f'{stats["self_time"] * 1000:>12.2f} {stats["bytes"]:>10}')
+
+        log(f'{"-" * 40} {"-" * 8} {"-" * 12} {"-" * 12} {"-" * 10}')
+        log(f'{"(total)":<40} {"":>8} {report["total_time"] * 1000:>12.2f} {"":>12} {report["total_bytes"]:>10}')
+
+    def write_json(self, path: str) -> None:
+        with open(path, 'w', encoding='utf-8') as f:
+            json.dump(self.report(), f, indent=2)
+
+    def _wrap(self, function: Callable, phase: str) -> Callable:
+        stats = self.phases.setdefault(phase, {
+            'calls': 0,
+            'total_time': 0.0,
+            'self_time': 0.0,
+            'bytes': 0,
+        })
+
+        @functools.wraps(function)
+        def wrapper(*args, **kwargs):
+            #
+            # Recursive calls (eg. Doc.map_class) must not count
+            # into the total time more than once.
+            #
+            frame = {
+                'stats': stats,
+                'recursive': any(item['stats'] is stats for item in self._stack),
+                'nested_time': 0.0,
+                'nested_bytes': 0,
+            }
+
+            self._stack.append(frame)
+            bytes_start = self._bytes
+            time_start = time.perf_counter()
+
+            try:
+                return function(*args, **kwargs)
+            finally:
+                elapsed = time.perf_counter() - time_start
+                emitted = self._bytes - bytes_start
+
+                self._stack.pop()
+
+                stats['calls'] += 1
+                stats['self_time'] += elapsed - frame['nested_time']
+                stats['bytes'] += emitted - frame['nested_bytes']
+
+                if not frame['recursive']:
+                    stats['total_time'] += elapsed
+
+                if self._stack:
+                    self._stack[-1]['nested_time'] += elapsed
+                    self._stack[-1]['nested_bytes'] += emitted
+
+        return wrapper
@@ -0,0 +1,113 @@
+from typing import Iterable, List, Optional, Set
+
+import copy
+import yaml
+
+from .doc import DocBase
+
+#
+# Only these documents can be selected - fields are always emitted
+# together with their bitfield/struct.
+#
+DOC_SUBSET_SELECTABLE_TYPES = [ 'Group', 'Definition', 'Struct', 'Bitfield' ]
+DOC_SUBSET_ENCLOSING_TYPES = [ 'Struct', 'StructField', 'Bitfield', 'BitfieldField' ]
+
+
+class DocSubset(object):
+    '''
+    Allow-list of documents to emit, eg. only PAGING_64, EPT, VMCS and a few
+    MSRs. Names are matched against short, long and alternative names of
+    groups, definitions, structs and bitfields.
+
+    Selected document is emitted with its whole subtree - including all YAML
+    files pulled in by "Include:" anywhere below it. Its ancestors are kept
+    (they affect names of their descendants and hold the group hierarchy),
+    but their other children are dropped.
+    '''
+
+    def __init__(self, name_list: Iterable[str]=None):
+        self.name_list: List[str] = []
+
+        for name in name_list or []:
+            self.add(name)
+
+    def add(self, name: str) -> None:
+        if name not in self.name_list:
+            self.name_list.append(name)
+
+    def load(self, path: str) -> None:
+        '''
+        Adds names from the manifest - YAML list of names.
+        '''
+        with open(path, encoding='utf-8') as f:
+            name_list = yaml.safe_load(f) or []
+
+        if not isinstance(name_list, list) or not all(isinstance(name, str) for name in name_list):
+            raise Exception(f'"{path}": subset manifest must be a list of names')
+
+        for name in name_list:
+            self.add(name)
+
+    def apply(self, doc_list: List[DocBase]) -> List[DocBase]:
+        '''
+        Returns copy of the tree with only the selected documents (and their
+        ancestors). The original tree is not modified.
+        '''
+        selected: Set[int] = set()
+        kept: Set[int] = set()
+        found: Set[str] = set()
+
+        for root in doc_list:
+            for doc in root.walk():
+                if doc.type not in DOC_SUBSET_SELECTABLE_TYPES:
+                    continue
+
+                matched = { doc.short_name, doc.long_name, doc.alternative_name } & set(self.name_list)
+
+                if not matched:
+                    continue
+
+                found |= matched
+
+                #
+                # Nested bitfields/structs are emitted only as part
+                # of the outermost one.
+                #
+                while doc.parent and doc.parent.type in DOC_SUBSET_ENCLOSING_TYPES:
+                    doc = doc.parent
+
+                selected.add(id(doc))
+                parent = doc
+
+                while parent and id(parent) not in kept:
+                    kept.add(id(parent))
+                    parent = parent.parent
+
+        missing = [ name for name in self.name_list if name not in found ]
+
+        if missing:
+            raise Exception(f'Unknown names in subset: {", ".join(missing)}')
+
+        return [
+            result for result in (self._copy(doc, selected, kept) for doc in doc_list)
+            if result is not None
+        ]
+
+    def _copy(self, doc: DocBase, selected: Set[int], kept: Set[int]) -> Optional[DocBase]:
+        if id(doc) in selected:
+            return doc
+
+        if id(doc) not in kept:
+            return None
+
+        #
+        # Shallow copy shares the YAML dictionary and the parent, therefore
+        # all names stay the same - only the list of children differs.
+        #
+        result = copy.copy(doc)
+        result._fields = [
+            field for field in (self._copy(field, selected, kept) for field in doc.fields)
+            if field is not None
+        ]
+
+        return result
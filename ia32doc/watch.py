@@ -0,0 +1,167 @@
+from typing import Dict, List, Set
+
+import ctypes
+import ctypes.util
+import os
+import select
+import struct
+import time
+
+#
+# See <sys/inotify.h>.
+#
+IN_CLOSE_WRITE = 0x00000008
+IN_MOVED_FROM  = 0x00000040
+IN_MOVED_TO    = 0x00000080
+IN_CREATE      = 0x00000100
+IN_DELETE      = 0x00000200
+IN_ISDIR       = 0x40000000
+
+IN_WATCH_MASK = IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_CREATE | IN_DELETE
+
+INOTIFY_EVENT = struct.Struct('iIII')
+
+
+class DocWatcher(object):
+    '''
+    Waits for changes of yaml files in the directories (recursively).
+    '''
+
+    #
+    # Editors usually emit several events per save - collect them all.
+    #
+    SETTLE_TIME = 0.05
+
+    @staticmethod
+    def create(directory_list: List[str]) -> 'DocWatcher':
+        try:
+            return DocInotifyWatcher(directory_list)
+        except OSError:
+            return DocPollingWatcher(directory_list)
+
+    def wait(self) -> Set[str]:
+        raise NotImplementedError
+
+    def close(self) -> None:
+        pass
+
+    @staticmethod
+    def _is_yaml(path: str) -> bool:
+        return path.endswith('.yml')
+
+
+class DocInotifyWatcher(DocWatcher):
+    def __init__(self, directory_list: List[str]):
+        libc_name = ctypes.util.find_library('c')
+
+        if not libc_name:
+            raise OSError('libc not found')
+
+        self._libc = ctypes.CDLL(libc_name, use_errno=True)
+
+        if not hasattr(self._libc, 'inotify_init1'):
+            raise OSError('inotify not supported')
+
+        self._fd = self._libc.inotify_init1(os.O_CLOEXEC)
+
+        if self._fd < 0:
+            raise OSError(ctypes.get_errno(), 'inotify_init1 failed')
+
+        self._watches: Dict[int, str] = { }
+
+        #
+        # Directory watched twice (eg. nested in another one) has
+        # the same watch descriptor.
+        #
+        for directory in directory_list:
+            for dir_path, _, _ in os.walk(directory):
+                self._add_watch(dir_path)
+
+    def wait(self) -> Set[str]:
+        result = set()
+        timeout = None
+
+        while True:
+            readable, _, _ = select.select([ self._fd ], [], [], timeout)
+
+            if not readable:
+                if result:
+                    return result
+
+                continue
+
+            buffer = os.read(self._fd, 64 * 1024)
+            offset = 0
+
+            while offset < len(buffer):
+                wd, mask, _, name_length = INOTIFY_EVENT.unpack_from(buffer, offset)
+                offset += INOTIFY_EVENT.size
+                name = buffer[offset:offset + name_length].rstrip(b'\0').decode()
+                offset += name_length
+
+                if wd not in self._watches:
+                    continue
+
+                path = os.path.join(self._watches[wd], name)
+
+                if mask & IN_ISDIR:
+                    if mask & (IN_CREATE | IN_MOVED_TO):
+                        self._add_watch(path)
+                elif self._is_yaml(path):
+                    result.add(path)
+
+            timeout = self.SETTLE_TIME
+
+    def close(self) -> None:
+        os.close(self._fd)
+
+    def _add_watch(self, path: str) -> None:
+        wd = self._libc.inotify_add_watch(self._fd, path.encode(), IN_WATCH_MASK)
+
+        if wd < 0:
+            raise OSError(ctypes.get_errno(), f'inotify_add_watch("{path}") failed')
+
+        self._watches[wd] = path
+
+
+class DocPollingWatcher(DocWatcher):
+    '''
+    Fallback for systems without inotify - compares modification times.
+    '''
+
+    POLL_INTERVAL = 0.5
+
+    def __init__(self, directory_list: List[str]):
+        self._directory_list = directory_list
+        self._mtimes = self._scan()
+
+    def wait(self) -> Set[str]:
+        while True:
+            time.sleep(self.POLL_INTERVAL)
+
+            mtimes = self._scan()
+            result = {
+                path for path in mtimes.keys() | self._mtimes.keys()
+                if mtimes.get(path) != self._mtimes.get(path)
+            }
+
+            self._mtimes = mtimes
+
+            if result:
+                return result
+
+    def _scan(self) -> Dict[str, float]:
+        result = { }
+
+        for directory in self._directory_list:
+            for dir_path, _, file_names in os.walk(directory):
+                for file_name in file_names:
+                    path = os.path.join(dir_path, file_name)
+
+                    if self._is_yaml(path):
+                        try:
+                            result[path] = os.stat(path).st_mtime_ns
+                        except OSError:
+                            pass
+
+        return result
@@ -1,27 +1,373 @@
-from contextlib import redirect_stdout
+from typing import List, Tuple, Union
 
-from ia32doc.doc import Doc
+import argparse
+import functools
+import inspect
+import os
+import sys
+import time
+import yaml
+
+from ia32doc.cache import DocCache
+from ia32doc.decoder import DocDecoder
+from ia32doc.checker import DocBitfieldChecker
+from ia32doc.doc import DOC_INT_TYPES, Doc, DocBase
+from ia32doc.documentation import DocDocumentation
+from ia32doc.generator import DocGenerator, DocModuleGenerator, DocSplitGenerator
+from ia32doc.loader import DOC_TEMPLATE_PATH, DocLoader, DocSchemaError
+from ia32doc.log import log
 from ia32doc.processor import DocProcessor
+from ia32doc.processor_accessor import DocAccessorProcessor
+from ia32doc.processor_cpp import DocCppProcessor
+from ia32doc.processor_ctx import DocProcessorContext
+from ia32doc.processor_hpp import DocHppProcessor
+from ia32doc.processor_module import DocModuleProcessor
+from ia32doc.profiler import DocProfiler
+from ia32doc.subset import DocSubset
+import ia32doc.processor
+from ia32doc.watch import DocWatcher
+
+
+#
+# Output paths and generators (or other producers of the output) writing them.
+#
+GeneratorList = List[Tuple[str, Union[DocGenerator, DocDocumentation, DocDecoder]]]
+
+#
+# Predefined configurations for --variant (on top of the command-line options).
+#
+VARIANTS = {
+    'default': { },
+    'no-comments': {
+        'definition_comments': False,
+        'typedef_comments': False,
+        'group_comments': False,
+        'bitfield_field_comments': False,
+    },
+    'cstdint': {
+        'int_types': 'cstdint',
+    },
+    'macros': {
+        'typedefs': False,
+    },
+    'typedefs': {
+        'definitions': False,
+        'bitfield_field_with_definitions': False,
+    },
+}
+
+#
+# Boolean options of DocProcessorContext, exposed as --no-* switches (or as
+# --* switches, when they are disabled by default).
+#
+CONTEXT_FLAGS = [
+    name for name, parameter in inspect.signature(DocProcessorContext).parameters.items()
+    if isinstance(parameter.default, bool)
+]
+
+
+def parse_args() -> argparse.Namespace:
+    parser = argparse.ArgumentParser(description='Generates C header from the yaml definitions.')
+    parser.add_argument('-i', '--input', metavar='PATH', default='yaml/Intel/index.yml',
+                        help='root yaml file (default: %(default)s)')
+    parser.add_argument('-o', '--output', metavar='PATH',
+                        help='output header (default: out/ia32.h, out/ia32_cpp.h with --cpp, '
+                             'out/ia32_accessors.hpp with --accessors, out/ia32.cppm with --module)')
+    parser.add_argument('--variant', metavar='NAME=PATH', action='append', default=[],
+                        help=f'emit predefined variant into PATH instead of --output, can be repeated; '
+                             f'NAME is one of: {", ".join(VARIANTS)}')
+    parser.add_argument('--split', action='store_true',
+                        help='emit one header per subsystem into directory named after the output '
+                             '(eg. out/ia32/cpuid.h), the output itself only includes them')
+    parser.add_argument('--module', action='store_true',
+                        help='emit C++20 module with one partition per subsystem (eg. ia32:cpuid in '
+                             'out/ia32/cpuid.cppm) instead of a header')
+    parser.add_argument('--cpp', action='store_true',
+                        help='emit C++ header (default: out/ia32_cpp.h) with definitions of bitfield fields as enum '
+                             'constants and constexpr functions in per-bitfield namespaces (eg. CR0_FIELDS) '
+                             'instead of macros')
+    parser.add_argument('--accessors', action='store_true',
+                        help='emit C++ header (default: out/ia32_accessors.hpp) with bitfields replaced by structs '
+                             'wrapping single integer with get_<field>()/set_<field>() methods')
+    parser.add_argument('--hpp', action='store_true',
+                        help='emit also C++20 header (eg. out/ia32.hpp) with constexpr classes of all bitfields '
+                             'and scoped enums of MSRs and VMCS fields in namespace ia32')
+    parser.add_argument('--decoder', action='store_true',
+                        help='emit also bulk decoder of page tables (eg. out/ia32_decode.h) - PML4E/PDPTE/PDE/PTE '
+                             'tables into columns by AVX-512, AVX2 or scalar code selected at runtime')
+    parser.add_argument('--lean', action='store_true',
+                        help='emit also comment-less header (eg. out/ia32_lean.h) and documentation of all '
+                             'identifiers (eg. out/ia32.json)')
+    parser.add_argument('--subset', metavar='PATH',
+                        help='emit only groups, definitions, structs and bitfields named in PATH (YAML list), '
+                             'together with everything they include')
+    parser.add_argument('--select', metavar='NAME', action='append', default=[],
+                        help='emit only NAME (and everything it includes), can be repeated; combined with --subset')
+    parser.add_argument('--int-types', choices=sorted(DOC_INT_TYPES), default='ms',
+                        help='names of integer types (default: %(default)s)')
+
+    for name, parameter in inspect.signature(DocProcessorContext).parameters.items():
+        if name not in CONTEXT_FLAGS:
+            continue
+
+        if parameter.default:
+            parser.add_argument(f'--no-{name.replace("_", "-")}', dest=name, action='store_false',
+                                help=f'disable DocProcessorContext.{name}')
+        else:
+            parser.add_argument(f'--{name.replace("_", "-")}', dest=name, action='store_true',
+                                help=f'enable DocProcessorContext.{name}')
+
+    parser.add_argument('-j', '--jobs', type=int, metavar='N',
+                        help='number of worker processes (default: number of CPUs)')
+    parser.add_argument('--coverage-report', metavar='PATH',
+                        help='write bit coverage report of all bitfields (JSON) into PATH')
+    parser.add_argument('--watch', action='store_true',
+                        help='keep running and regenerate the output whenever yaml files change')
+    parser.add_argument('--profile', action='store_true',
+                        help='print wall time, call count and emitted bytes of every phase; '
+                             'caches and worker processes are disabled')
+    parser.add_argument('--profile-json', metavar='PATH',
+                        help='write the profile (JSON) into PATH, implies --profile')
+
+    args = parser.parse_args()
+
+    if args.cpp and args.module:
+        parser.error('--cpp cannot be combined with --module')
+
+    if args.accessors and (args.cpp or args.module):
+        parser.error('--accessors cannot be combined with --cpp or --module')
+
+    if args.accessors and args.hpp:
+        parser.error('--accessors cannot be combined with --hpp')
+
+    if args.decoder and args.module:
+        parser.error('--decoder cannot be combined with --module')
+
+    if not args.output:
+        if args.module:
+            args.output = 'out/ia32.cppm'
+        elif args.cpp:
+            args.output = 'out/ia32_cpp.h'
+        elif args.accessors:
+            args.output = 'out/ia32_accessors.hpp'
+        else:
+            args.output = 'out/ia32.h'
+
+    if args.profile_json:
+        args.profile = True
+
+    if args.profile and args.watch:
+        parser.error('--profile cannot be combined with --watch')
+
+    for variant in args.variant:
+        name, _, path = variant.partition('=')
+
+        if name not in VARIANTS or not path:
+            parser.error(f'invalid variant "{variant}"')
+
+    return args
+
+
+def make_generators(args: argparse.Namespace) -> GeneratorList:
+    ctx_args = { name: getattr(args, name) for name in CONTEXT_FLAGS }
+    ctx_args['int_types'] = args.int_types
+
+    if args.variant:
+        variant_list = [ variant.partition('=')[::2] for variant in args.variant ]
+    else:
+        variant_list = [ ('default', args.output) ]
+
+    if args.module:
+        generator_class, processor_class = DocModuleGenerator, DocModuleProcessor
+    else:
+        generator_class = DocSplitGenerator if args.split else DocGenerator
+
+        if args.cpp:
+            processor_class = DocCppProcessor
+        elif args.accessors:
+            processor_class = DocAccessorProcessor
+        else:
+            processor_class = DocProcessor
+
+    def make_generator(ctx: DocProcessorContext, generator_class: type=generator_class,
+                       processor_class: type=processor_class) -> DocGenerator:
+        if args.profile:
+            #
+            # Everything is generated from scratch in this process.
+            #
+            return generator_class(processor_class(ctx=ctx), None, 1)
+
+        return generator_class(processor_class(ctx=ctx), '.cache', args.jobs)
+
+    result = []
+
+    for name, path in variant_list:
+        ctx = DocProcessorContext(**{ **ctx_args, **VARIANTS[name] })
+        result.append((path, make_generator(ctx)))
+
+        if args.lean:
+            #
+            # Lean header has the same declarations, its documentation
+            # is moved into the JSON.
+            #
+            path_base, path_extension = os.path.splitext(path)
+            lean_ctx = DocProcessorContext(**{ **ctx_args, **VARIANTS[name], **VARIANTS['no-comments'] })
+
+            result.append((f'{path_base}_lean{path_extension}', make_generator(lean_ctx)))
+            result.append((f'{path_base}.json', DocDocumentation(ctx=ctx)))
+
+        if args.hpp:
+            #
+            # Typed header is always monolithic - its enums are gathered
+            # from the whole tree.
+            #
+            path_base, _ = os.path.splitext(path)
+            hpp_processor_class = functools.partial(DocHppProcessor, os.path.basename(path))
+            result.append((f'{path_base}.hpp', make_generator(ctx, DocGenerator, hpp_processor_class)))
+
+        if args.decoder:
+            path_base, _ = os.path.splitext(path)
+            result.append((f'{path_base}_decode.h', DocDecoder(os.path.basename(path), ctx=ctx)))
+
+    return result
+
+
+def make_profiler() -> DocProfiler:
+    profiler = DocProfiler()
+
+    profiler.instrument(DocLoader, 'load', 'yaml load')
+    profiler.instrument(Doc, 'map_class', 'tree construction')
+    profiler.instrument(DocBase, '_do_include', 'include resolution')
+    profiler.instrument(ia32doc.processor, 'wrap', 'text_wrapper.wrap')
+
+    for name in dir(DocProcessor):
+        if name.startswith('process'):
+            profiler.instrument(DocProcessor, name, f'DocProcessor.{name}')
+
+    return profiler
+
+
+def generate(args: argparse.Namespace, generator_list: GeneratorList) -> bool:
+    doc_list = Doc.parse(args.input)
+
+    checker = DocBitfieldChecker()
+    checker_result = checker.check(doc_list)
+
+    if args.coverage_report:
+        checker.write_report(args.coverage_report)
+
+    if not checker_result:
+        for error in checker.errors:
+            log(error)
+
+        return False
+
+    if args.subset or args.select:
+        subset = DocSubset(args.select)
+
+        if args.subset:
+            subset.load(args.subset)
+
+        try:
+            doc_list = subset.apply(doc_list)
+        except Exception as e:
+            log(str(e))
+            return False
+
+    #
+    # The tree is parsed only once for all variants.
+    #
+    for output_path, generator in generator_list:
+        generator.generate(doc_list, output_path)
+
+    return True
+
+
+def watch(args: argparse.Namespace, generator_list: GeneratorList) -> None:
+    #
+    # Parsed files stay in Doc.doc_cache between rebuilds - only modified
+    # files are loaded again and only fragments built from them are emitted
+    # again. The on-disk snapshot would be rewritten after every change,
+    # therefore it is not used at all.
+    #
+    Doc.ir_cache = None
+
+    #
+    # Included files are next to (or below) the root file, the schema
+    # is watched as well.
+    #
+    template_path = os.path.abspath(DOC_TEMPLATE_PATH)
+    directory_list = [ os.path.dirname(args.input) or '.', os.path.dirname(template_path) ]
+    watcher = DocWatcher.create(directory_list)
+
+    log(f'Watching "{directory_list[0]}" for changes...')
+
+    try:
+        #
+        # The tree of the first run might have been loaded from the snapshot,
+        # which leaves Doc.doc_cache empty - fill it now, not after the first
+        # change.
+        #
+        if not Doc.doc_cache:
+            try:
+                Doc.parse(args.input)
+            except (DocSchemaError, yaml.YAMLError):
+                pass
+
+        while True:
+            path_list = watcher.wait()
+
+            if any(os.path.abspath(path) == template_path for path in path_list):
+                DocLoader.schema = None
+                Doc.doc_cache.clear()
+            else:
+                Doc.invalidate(path_list)
+
+            time_start = time.perf_counter()
+
+            #
+            # Nothing stops the watcher - errors in yaml files (schema,
+            # syntax, bit layout) or in the output (colliding identifiers)
+            # are fixed by the next change.
+            #
+            try:
+                generate(args, generator_list)
+            except Exception as e:
+                log(str(e))
+
+            log(f'Done in {time.perf_counter() - time_start:.3f}s')
+    except KeyboardInterrupt:
+        pass
+    finally:
+        watcher.close()
 
 
 def main():
-    processor = DocProcessor()
-
-    doc_list = Doc.parse('yaml/Intel/index.yml')
-    #doc_list = Doc.parse('yaml/Intel/CPUID/index.yml')
-    #doc_list = Doc.parse('yaml/Intel/VMX/index.yml')
-
-    with open('out/ia32.h', 'w') as f:
-        with redirect_stdout(f):
-            print(f'/** @file */')
-            print(f'#pragma once')
-            print(f'typedef unsigned char       UINT8;')
-            print(f'typedef unsigned short      UINT16;')
-            print(f'typedef unsigned int        UINT32;')
-            print(f'typedef unsigned long long  UINT64;')
-            print(f'')
-
-            processor.process(doc_list)
+    args = parse_args()
+    generator_list = make_generators(args)
+    profiler = make_profiler() if args.profile else None
+
+    if not args.profile:
+        Doc.ir_cache = DocCache('.cache')
+
+    try:
+        result = generate(args, generator_list)
+    except (DocSchemaError, yaml.YAMLError) as e:
+        log(str(e))
+        result = False
+
+    if profiler:
+        profiler.print_table()
+
+        if args.profile_json:
+            profiler.write_json(args.profile_json)
+
+    if not result:
+        if not args.watch:
+            sys.exit(1)
+
+    if args.watch:
+        watch(args, generator_list)
 
 
 if __name__ == '__main__':
@@ -0,0 +1,12805 @@
+/** @file */
+#pragma once
+#include <bit>
+#include <concepts>
+#include <type_traits>
+#include "ia32.h"
+
+namespace ia32
+{
+
+class CR0
+{
+public:
+  constexpr CR0() = default;
+  constexpr explicit CR0(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::CR0>
+  static constexpr CR0 from(const T& raw) { return std::bit_cast<CR0>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const CR0&, const CR0&) = default;
+
+  /**
+   * @brief Protection Enable
+   *
+   * Enables protected mode when set; enables real-address mode when clear. This flag does not enable paging directly. It
+   * only enables segment-level protection. To enable paging, both the PE and PG flags must be set.
+   *
+   * @see Vol3A[9.9(Mode Switching)]
+   */
+  constexpr UINT64 protection_enable() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr CR0 with_protection_enable(UINT64 value) const { return CR0((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * @brief Monitor Coprocessor
+   *
+   * Controls the interaction of the WAIT (or FWAIT) instruction with the TS flag (bit 3 of CR0). If the MP flag is set, a
+   * WAIT instruction generates a device-not-available exception (\#NM) if the TS flag is also set. If the MP flag is clear,
+   * the WAIT instruction ignores the setting of the TS flag.
+   */
+  constexpr UINT64 monitor_coprocessor() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr CR0 with_monitor_coprocessor(UINT64 value) const { return CR0((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * @brief FPU Emulation
+   *
+   * Indicates that the processor does not have an internal or external x87 FPU when set; indicates an x87 FPU is present
+   * when clear. This flag also affects the execution of MMX/SSE/SSE2/SSE3/SSSE3/SSE4 instructions.
+   * When the EM flag is set, execution of an x87 FPU instruction generates a device-not-available exception (\#NM). This
+   * flag must be set when the processor does not have an internal x87 FPU or is not connected to an external math
+   * coprocessor. Setting this flag forces all floating-point instructions to be handled by software emulation.
+   * Also, when the EM flag is set, execution of an MMX instruction causes an invalid-opcode exception (\#UD) to be
+   * generated. Thus, if an IA-32 or Intel 64 processor incorporates MMX technology, the EM flag must be set to 0 to enable
+   * execution of MMX instructions. Similarly for SSE/SSE2/SSE3/SSSE3/SSE4 extensions, when the EM flag is set, execution of
+   * most SSE/SSE2/SSE3/SSSE3/SSE4 instructions causes an invalid opcode exception (\#UD) to be generated. If an IA-32 or
+   * Intel 64 processor incorporates the SSE/SSE2/SSE3/SSSE3/SSE4 extensions, the EM flag must be set to 0 to enable
+   * execution of these extensions. SSE/SSE2/SSE3/SSSE3/SSE4 instructions not affected by the EM flag include: PAUSE,
+   * PREFETCHh, SFENCE, LFENCE, MFENCE, MOVNTI, CLFLUSH, CRC32, and POPCNT.
+   */
+  constexpr UINT64 emulate_fpu() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr CR0 with_emulate_fpu(UINT64 value) const { return CR0((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * @brief Task Switched
+   *
+   * Allows the saving of the x87 FPU/MMX/SSE/SSE2/SSE3/SSSE3/SSE4 context on a task switch to be delayed until an x87
+   * FPU/MMX/SSE/SSE2/SSE3/SSSE3/SSE4 instruction is actually executed by the new task. The processor sets this flag on every
+   * task switch and tests it when executing x87 FPU/MMX/SSE/SSE2/SSE3/SSSE3/SSE4 instructions.
+   * - If the TS flag is set and the EM flag (bit 2 of CR0) is clear, a device-not-available exception (\#NM) is raised prior
+   * to the execution of any x87 FPU/MMX/SSE/SSE2/SSE3/SSSE3/SSE4 instruction; with the exception of PAUSE, PREFETCHh,
+   * SFENCE, LFENCE, MFENCE, MOVNTI, CLFLUSH, CRC32, and POPCNT.
+   * - If the TS flag is set and the MP flag (bit 1 of CR0) and EM flag are clear, an \#NM exception is not raised prior to
+   * the execution of an x87 FPU WAIT/FWAIT instruction.
+   * - If the EM flag is set, the setting of the TS flag has no effect on the execution of x87
+   * FPU/MMX/SSE/SSE2/SSE3/SSSE3/SSE4 instructions.
+   *   The processor does not automatically save the context of the x87 FPU, XMM, and MXCSR registers on a task switch.
+   *   Instead, it sets the TS flag, which causes the processor to raise an \#NM exception whenever it encounters an x87
+   *   FPU/MMX/SSE/SSE2/SSE3/SSSE3/SSE4 instruction in the instruction stream for the new task (with the exception of the
+   *   instructions listed above).
+   *   The fault handler for the \#NM exception can then be used to clear the TS flag (with the CLTS instruction) and save
+   *   the context of the x87 FPU, XMM, and MXCSR registers. If the task never encounters an x87
+   *   FPU/MMX/SSE/SSE2/SSE3/SSSE3/SSE4 instruction, the x87 FPU/MMX/SSE/SSE2/SSE3/SSSE3/SSE4 context is never saved.
+   */
+  constexpr UINT64 task_switched() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr CR0 with_task_switched(UINT64 value) const { return CR0((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * @brief Extension Type
+   *
+   * Reserved in the Pentium 4, Intel Xeon, P6 family, and Pentium processors. In the Pentium 4, Intel Xeon, and P6 family
+   * processors, this flag is hardcoded to 1. In the Intel386 and Intel486 processors, this flag indicates support of Intel
+   * 387 DX math coprocessor instructions when set.
+   */
+  constexpr UINT64 extension_type() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr CR0 with_extension_type(UINT64 value) const { return CR0((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * @brief Numeric Error
+   *
+   * Enables the native (internal) mechanism for reporting x87 FPU errors when set; enables the PC-style x87 FPU error
+   * reporting mechanism when clear. When the NE flag is clear and the IGNNE\# input is asserted, x87 FPU errors are ignored.
+   * When the NE flag is clear and the IGNNE\# input is deasserted, an unmasked x87 FPU error causes the processor to assert
+   * the FERR\# pin to generate an external interrupt and to stop instruction execution immediately before executing the next
+   * waiting floating-point instruction or WAIT/FWAIT instruction.
+   * The FERR\# pin is intended to drive an input to an external interrupt controller (the FERR\# pin emulates the ERROR\#
+   * pin of the Intel 287 and Intel 387 DX math coprocessors). The NE flag, IGNNE\# pin, and FERR\# pin are used with
+   * external logic to implement PC-style error reporting. Using FERR\# and IGNNE\# to handle floating-point exceptions is
+   * deprecated by modern operating systems; this non-native approach also limits newer processors to operate with one
+   * logical processor active.
+   *
+   * @see Vol1[8.7(Handling x87 FPU Exceptions in Software)]
+   * @see Vol1[A.1(APPENDIX A | EFLAGS Cross-Reference)]
+   */
+  constexpr UINT64 numeric_error() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr CR0 with_numeric_error(UINT64 value) const { return CR0((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * @brief Write Protect
+   *
+   * When set, inhibits supervisor-level procedures from writing into readonly pages; when clear, allows supervisor-level
+   * procedures to write into read-only pages (regardless of the U/S bit setting). This flag facilitates implementation of
+   * the copy-onwrite method of creating a new process (forking) used by operating systems such as UNIX.
+   *
+   * @see Vol3A[4.1.3(Paging-Mode Modifiers)]
+   * @see Vol3A[4.6(ACCESS RIGHTS)]
+   */
+  constexpr UINT64 write_protect() const { return (Flags >> 16) & 0x01ULL; }
+  constexpr CR0 with_write_protect(UINT64 value) const { return CR0((Flags & ~0x10000ULL) | ((value & 0x01ULL) << 16)); }
+
+  /**
+   * @brief Alignment Mask
+   *
+   * Enables automatic alignment checking when set; disables alignment checking when clear. Alignment checking is performed
+   * only when the AM flag is set, the AC flag in the EFLAGS register is set, CPL is 3, and the processor is operating in
+   * either protected or virtual-8086 mode.
+   */
+  constexpr UINT64 alignment_mask() const { return (Flags >> 18) & 0x01ULL; }
+  constexpr CR0 with_alignment_mask(UINT64 value) const { return CR0((Flags & ~0x40000ULL) | ((value & 0x01ULL) << 18)); }
+
+  /**
+   * @brief Not Write-through
+   *
+   * When the NW and CD flags are clear, write-back (for Pentium 4, Intel Xeon, P6 family, and Pentium processors) or
+   * write-through (for Intel486 processors) is enabled for writes that hit the cache and invalidation cycles are enabled.
+   */
+  constexpr UINT64 not_write_through() const { return (Flags >> 29) & 0x01ULL; }
+  constexpr CR0 with_not_write_through(UINT64 value) const { return CR0((Flags & ~0x20000000ULL) | ((value & 0x01ULL) << 29)); }
+
+  /**
+   * @brief Cache Disable
+   *
+   * When the CD and NW flags are clear, caching of memory locations for the whole of physical memory in the processor's
+   * internal (and external) caches is enabled. When the CD flag is set, caching is restricted. To prevent the processor from
+   * accessing and updating its caches, the CD flag must be set and the caches must be invalidated so that no cache hits can
+   * occur.
+   *
+   * @see Vol3A[11.5.3(Preventing Caching)]
+   * @see Vol3A[11.5(CACHE CONTROL)]
+   */
+  constexpr UINT64 cache_disable() const { return (Flags >> 30) & 0x01ULL; }
+  constexpr CR0 with_cache_disable(UINT64 value) const { return CR0((Flags & ~0x40000000ULL) | ((value & 0x01ULL) << 30)); }
+
+  /**
+   * @brief Paging Enable
+   *
+   * Enables paging when set; disables paging when clear. When paging is disabled, all linear addresses are treated as
+   * physical addresses. The PG flag has no effect if the PE flag (bit 0 of register CR0) is not also set; setting the PG
+   * flag when the PE flag is clear causes a general-protection exception (\#GP).
+   * On Intel 64 processors, enabling and disabling IA-32e mode operation also requires modifying CR0.PG.
+   *
+   * @see Vol3A[4(PAGING)]
+   */
+  constexpr UINT64 paging_enable() const { return (Flags >> 31) & 0x01ULL; }
+  constexpr CR0 with_paging_enable(UINT64 value) const { return CR0((Flags & ~0x80000000ULL) | ((value & 0x01ULL) << 31)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(CR0) == 8, "Size of CR0");
+
+class CR3
+{
+public:
+  constexpr CR3() = default;
+  constexpr explicit CR3(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::CR3>
+  static constexpr CR3 from(const T& raw) { return std::bit_cast<CR3>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const CR3&, const CR3&) = default;
+
+  /**
+   * @brief Page-level Write-Through
+   *
+   * Controls the memory type used to access the first paging structure of the current paging-structure hierarchy. This bit
+   * is not used if paging is disabled, with PAE paging, or with 4-level paging if CR4.PCIDE=1.
+   *
+   * @see Vol3A[4.9(PAGING AND MEMORY TYPING)]
+   */
+  constexpr UINT64 page_level_write_through() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr CR3 with_page_level_write_through(UINT64 value) const { return CR3((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * @brief Page-level Cache Disable
+   *
+   * Controls the memory type used to access the first paging structure of the current paging-structure hierarchy. This bit
+   * is not used if paging is disabled, with PAE paging, or with 4-level paging2 if CR4.PCIDE=1.
+   *
+   * @see Vol3A[4.9(PAGING AND MEMORY TYPING)]
+   */
+  constexpr UINT64 page_level_cache_disable() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr CR3 with_page_level_cache_disable(UINT64 value) const { return CR3((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * @brief Address of page directory
+   *
+   * Physical address of the 4-KByte aligned page directory (32-bit paging) or PML4 table (64-bit paging) used for
+   * linear-address translation.
+   *
+   * @see Vol3A[4.3(32-BIT PAGING)]
+   * @see Vol3A[4.5(4-LEVEL PAGING)]
+   */
+  constexpr UINT64 address_of_page_directory() const { return (Flags >> 12) & 0xFFFFFFFFFULL; }
+  constexpr CR3 with_address_of_page_directory(UINT64 value) const { return CR3((Flags & ~0xFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFULL) << 12)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(CR3) == 8, "Size of CR3");
+
+class CR4
+{
+public:
+  constexpr CR4() = default;
+  constexpr explicit CR4(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::CR4>
+  static constexpr CR4 from(const T& raw) { return std::bit_cast<CR4>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const CR4&, const CR4&) = default;
+
+  /**
+   * @brief Virtual-8086 Mode Extensions
+   *
+   * Enables interrupt- and exception-handling extensions in virtual-8086 mode when set; disables the extensions when clear.
+   * Use of the virtual mode extensions can improve the performance of virtual-8086 applications by eliminating the overhead
+   * of calling the virtual- 8086 monitor to handle interrupts and exceptions that occur while executing an 8086 program and,
+   * instead, redirecting the interrupts and exceptions back to the 8086 program's handlers. It also provides hardware
+   * support for a virtual interrupt flag (VIF) to improve reliability of running 8086 programs in multitasking and
+   * multiple-processor environments.
+   *
+   * @see Vol3B[20.3(INTERRUPT AND EXCEPTION HANDLING IN VIRTUAL-8086 MODE)]
+   */
+  constexpr UINT64 virtual_mode_extensions() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr CR4 with_virtual_mode_extensions(UINT64 value) const { return CR4((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * @brief Protected-Mode Virtual Interrupts
+   *
+   * Enables hardware support for a virtual interrupt flag (VIF) in protected mode when set; disables the VIF flag in
+   * protected mode when clear.
+   *
+   * @see Vol3B[20.4(PROTECTED-MODE VIRTUAL INTERRUPTS)]
+   */
+  constexpr UINT64 protected_mode_virtual_interrupts() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr CR4 with_protected_mode_virtual_interrupts(UINT64 value) const { return CR4((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * @brief Time Stamp Disable
+   *
+   * Restricts the execution of the RDTSC instruction to procedures running at privilege level 0 when set; allows RDTSC
+   * instruction to be executed at any privilege level when clear. This bit also applies to the RDTSCP instruction if
+   * supported (if CPUID.80000001H:EDX[27] = 1).
+   */
+  constexpr UINT64 timestamp_disable() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr CR4 with_timestamp_disable(UINT64 value) const { return CR4((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * @brief Debugging Extensions
+   *
+   * References to debug registers DR4 and DR5 cause an undefined opcode (\#UD) exception to be generated when set; when
+   * clear, processor aliases references to registers DR4 and DR5 for compatibility with software written to run on earlier
+   * IA-32 processors.
+   *
+   * @see Vol3B[17.2.2(Debug Registers DR4 and DR5)]
+   */
+  constexpr UINT64 debugging_extensions() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr CR4 with_debugging_extensions(UINT64 value) const { return CR4((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * @brief Page Size Extensions
+   *
+   * Enables 4-MByte pages with 32-bit paging when set; restricts 32-bit paging to pages of 4 KBytes when clear.
+   *
+   * @see Vol3A[4.3(32-BIT PAGING)]
+   */
+  constexpr UINT64 page_size_extensions() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr CR4 with_page_size_extensions(UINT64 value) const { return CR4((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * @brief Physical Address Extension
+   *
+   * When set, enables paging to produce physical addresses with more than 32 bits. When clear, restricts physical addresses
+   * to 32 bits. PAE must be set before entering IA-32e mode.
+   *
+   * @see Vol3A[4(PAGING)]
+   */
+  constexpr UINT64 physical_address_extension() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr CR4 with_physical_address_extension(UINT64 value) const { return CR4((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * @brief Machine-Check Enable
+   *
+   * Enables the machine-check exception when set; disables the machine-check exception when clear.
+   *
+   * @see Vol3B[15(MACHINE-CHECK ARCHITECTURE)]
+   */
+  constexpr UINT64 machine_check_enable() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr CR4 with_machine_check_enable(UINT64 value) const { return CR4((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * @brief Page Global Enable
+   *
+   * (Introduced in the P6 family processors.) Enables the global page feature when set; disables the global page feature
+   * when clear. The global page feature allows frequently used or shared pages to be marked as global to all users (done
+   * with the global flag, bit 8, in a page-directory or page-table entry). Global pages are not flushed from the
+   * translation-lookaside buffer (TLB) on a task switch or a write to register CR3. When enabling the global page feature,
+   * paging must be enabled (by setting the PG flag in control register CR0) before the PGE flag is set. Reversing this
+   * sequence may affect program correctness, and processor performance will be impacted.
+   *
+   * @see Vol3A[4.10(CACHING TRANSLATION INFORMATION)]
+   */
+  constexpr UINT64 page_global_enable() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr CR4 with_page_global_enable(UINT64 value) const { return CR4((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * @brief Performance-Monitoring Counter Enable
+   *
+   * Enables execution of the RDPMC instruction for programs or procedures running at any protection level when set; RDPMC
+   * instruction can be executed only at protection level 0 when clear.
+   */
+  constexpr UINT64 performance_monitoring_counter_enable() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr CR4 with_performance_monitoring_counter_enable(UINT64 value) const { return CR4((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * @brief Operating System Support for FXSAVE and FXRSTOR instructions
+   *
+   * When set, this flag:
+   * -# indicates to software that the operating system supports the use of the FXSAVE and FXRSTOR instructions,
+   * -# enables the FXSAVE and FXRSTOR instructions to save and restore the contents of the XMM and MXCSR registers along
+   * with the contents of the x87 FPU and MMX registers, and
+   * -# enables the processor to execute SSE/SSE2/SSE3/SSSE3/SSE4 instructions, with the exception of the PAUSE, PREFETCHh,
+   * SFENCE, LFENCE, MFENCE, MOVNTI, CLFLUSH, CRC32, and POPCNT.
+   * If this flag is clear, the FXSAVE and FXRSTOR instructions will save and restore the contents of the x87 FPU and MMX
+   * registers, but they may not save and restore the contents of the XMM and MXCSR registers. Also, the processor will
+   * generate an invalid opcode exception (\#UD) if it attempts to execute any SSE/SSE2/SSE3 instruction, with the exception
+   * of PAUSE, PREFETCHh, SFENCE, LFENCE, MFENCE, MOVNTI, CLFLUSH, CRC32, and POPCNT. The operating system or executive must
+   * explicitly set this flag.
+   *
+   * @remarks CPUID feature flag FXSR indicates availability of the FXSAVE/FXRSTOR instructions. The OSFXSR bit provides
+   *          operating system software with a means of enabling FXSAVE/FXRSTOR to save/restore the contents of the X87 FPU, XMM and
+   *          MXCSR registers. Consequently OSFXSR bit indicates that the operating system provides context switch support for
+   *          SSE/SSE2/SSE3/SSSE3/SSE4.
+   */
+  constexpr UINT64 os_fxsave_fxrstor_support() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr CR4 with_os_fxsave_fxrstor_support(UINT64 value) const { return CR4((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * @brief Operating System Support for Unmasked SIMD Floating-Point Exceptions
+   *
+   * Operating System Support for Unmasked SIMD Floating-Point Exceptions - When set, indicates that the operating system
+   * supports the handling of unmasked SIMD floating-point exceptions through an exception handler that is invoked when a
+   * SIMD floating-point exception (\#XM) is generated. SIMD floating-point exceptions are only generated by
+   * SSE/SSE2/SSE3/SSE4.1 SIMD floatingpoint instructions.
+   * The operating system or executive must explicitly set this flag. If this flag is not set, the processor will generate an
+   * invalid opcode exception (\#UD) whenever it detects an unmasked SIMD floating-point exception.
+   */
+  constexpr UINT64 os_xmm_exception_support() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr CR4 with_os_xmm_exception_support(UINT64 value) const { return CR4((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * @brief User-Mode Instruction Prevention
+   *
+   * When set, the following instructions cannot be executed if CPL > 0: SGDT, SIDT, SLDT, SMSW, and STR. An attempt at such
+   * execution causes a generalprotection exception (\#GP).
+   */
+  constexpr UINT64 usermode_instruction_prevention() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr CR4 with_usermode_instruction_prevention(UINT64 value) const { return CR4((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+  /**
+   * @brief VMX-Enable
+   *
+   * Enables VMX operation when set.
+   *
+   * @see Vol3C[23(INTRODUCTION TO VIRTUAL MACHINE EXTENSIONS)]
+   */
+  constexpr UINT64 vmx_enable() const { return (Flags >> 13) & 0x01ULL; }
+  constexpr CR4 with_vmx_enable(UINT64 value) const { return CR4((Flags & ~0x2000ULL) | ((value & 0x01ULL) << 13)); }
+
+  /**
+   * @brief SMX-Enable
+   *
+   * Enables SMX operation when set.
+   *
+   * @see Vol2[6(SAFER MODE EXTENSIONS REFERENCE)]
+   */
+  constexpr UINT64 smx_enable() const { return (Flags >> 14) & 0x01ULL; }
+  constexpr CR4 with_smx_enable(UINT64 value) const { return CR4((Flags & ~0x4000ULL) | ((value & 0x01ULL) << 14)); }
+
+  /**
+   * @brief FSGSBASE-Enable
+   *
+   * Enables the instructions RDFSBASE, RDGSBASE, WRFSBASE, and WRGSBASE.
+   */
+  constexpr UINT64 fsgsbase_enable() const { return (Flags >> 16) & 0x01ULL; }
+  constexpr CR4 with_fsgsbase_enable(UINT64 value) const { return CR4((Flags & ~0x10000ULL) | ((value & 0x01ULL) << 16)); }
+
+  /**
+   * @brief PCID-Enable
+   *
+   * Enables process-context identifiers (PCIDs) when set. Can be set only in IA-32e mode (if IA32_EFER.LMA = 1).
+   *
+   * @see Vol3A[4.10.1(Process-Context Identifiers (PCIDs))]
+   */
+  constexpr UINT64 pcid_enable() const { return (Flags >> 17) & 0x01ULL; }
+  constexpr CR4 with_pcid_enable(UINT64 value) const { return CR4((Flags & ~0x20000ULL) | ((value & 0x01ULL) << 17)); }
+
+  /**
+   * @brief XSAVE and Processor Extended States-Enable
+   *
+   * When set, this flag:
+   * -# indicates (via CPUID.01H:ECX.OSXSAVE[bit 27]) that the operating system supports the use of the XGETBV, XSAVE and
+   * XRSTOR instructions by general software;
+   * -# enables the XSAVE and XRSTOR instructions to save and restore the x87 FPU state (including MMX registers), the SSE
+   * state (XMM registers and MXCSR), along with other processor extended states enabled in XCR0;
+   * -# enables the processor to execute XGETBV and XSETBV instructions in order to read and write XCR0.
+   *
+   * @see Vol3A[2.6(EXTENDED CONTROL REGISTERS (INCLUDING XCR0))]
+   * @see Vol3A[13(SYSTEM PROGRAMMING FOR INSTRUCTION SET EXTENSIONS AND PROCESSOR EXTENDED)]
+   */
+  constexpr UINT64 os_xsave() const { return (Flags >> 18) & 0x01ULL; }
+  constexpr CR4 with_os_xsave(UINT64 value) const { return CR4((Flags & ~0x40000ULL) | ((value & 0x01ULL) << 18)); }
+
+  /**
+   * @brief SMEP-Enable
+   *
+   * Enables supervisor-mode execution prevention (SMEP) when set.
+   *
+   * @see Vol3A[4.6(ACCESS RIGHTS)]
+   */
+  constexpr UINT64 smep_enable() const { return (Flags >> 20) & 0x01ULL; }
+  constexpr CR4 with_smep_enable(UINT64 value) const { return CR4((Flags & ~0x100000ULL) | ((value & 0x01ULL) << 20)); }
+
+  /**
+   * @brief SMAP-Enable
+   *
+   * Enables supervisor-mode access prevention (SMAP) when set.
+   *
+   * @see Vol3A[4.6(ACCESS RIGHTS)]
+   */
+  constexpr UINT64 smap_enable() const { return (Flags >> 21) & 0x01ULL; }
+  constexpr CR4 with_smap_enable(UINT64 value) const { return CR4((Flags & ~0x200000ULL) | ((value & 0x01ULL) << 21)); }
+
+  /**
+   * @brief Protection-Key-Enable
+   *
+   * Enables 4-level paging to associate each linear address with a protection key. The PKRU register specifies, for each
+   * protection key, whether user-mode linear addresses with that protection key can be read or written. This bit also
+   * enables access to the PKRU register using the RDPKRU and WRPKRU instructions.
+   */
+  constexpr UINT64 protection_key_enable() const { return (Flags >> 22) & 0x01ULL; }
+  constexpr CR4 with_protection_key_enable(UINT64 value) const { return CR4((Flags & ~0x400000ULL) | ((value & 0x01ULL) << 22)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(CR4) == 8, "Size of CR4");
+
+class CR8
+{
+public:
+  constexpr CR8() = default;
+  constexpr explicit CR8(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::CR8>
+  static constexpr CR8 from(const T& raw) { return std::bit_cast<CR8>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const CR8&, const CR8&) = default;
+
+  /**
+   * @brief Task Priority Level
+   *
+   * This sets the threshold value corresponding to the highestpriority interrupt to be blocked. A value of 0 means all
+   * interrupts are enabled. This field is available in 64- bit mode. A value of 15 means all interrupts will be disabled.
+   */
+  constexpr UINT64 task_priority_level() const { return (Flags >> 0) & 0x0FULL; }
+  constexpr CR8 with_task_priority_level(UINT64 value) const { return CR8((Flags & ~0x0FULL) | ((value & 0x0FULL) << 0)); }
+
+  /**
+   * @brief Reserved
+   *
+   * Reserved and must be written with zeros. Failure to do this causes a general-protection exception.
+   */
+  constexpr UINT64 reserved() const { return (Flags >> 4) & 0xFFFFFFFFFFFFFFFULL; }
+  constexpr CR8 with_reserved(UINT64 value) const { return CR8((Flags & ~0xFFFFFFFFFFFFFFF0ULL) | ((value & 0xFFFFFFFFFFFFFFFULL) << 4)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(CR8) == 8, "Size of CR8");
+
+/**
+ * @brief When CPUID executes with EAX set to 01H, version information is returned in EAX
+ */
+class CPUID_VERSION_INFORMATION
+{
+public:
+  constexpr CPUID_VERSION_INFORMATION() = default;
+  constexpr explicit CPUID_VERSION_INFORMATION(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_01::CpuidVersionInformation)>
+  static constexpr CPUID_VERSION_INFORMATION from(const T& raw) { return std::bit_cast<CPUID_VERSION_INFORMATION>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_VERSION_INFORMATION&, const CPUID_VERSION_INFORMATION&) = default;
+
+  constexpr UINT32 stepping_id() const { return (Flags >> 0) & 0x0FU; }
+  constexpr CPUID_VERSION_INFORMATION with_stepping_id(UINT32 value) const { return CPUID_VERSION_INFORMATION((Flags & ~0x0FU) | ((value & 0x0FU) << 0)); }
+
+  constexpr UINT32 model() const { return (Flags >> 4) & 0x0FU; }
+  constexpr CPUID_VERSION_INFORMATION with_model(UINT32 value) const { return CPUID_VERSION_INFORMATION((Flags & ~0xF0U) | ((value & 0x0FU) << 4)); }
+
+  constexpr UINT32 family_id() const { return (Flags >> 8) & 0x0FU; }
+  constexpr CPUID_VERSION_INFORMATION with_family_id(UINT32 value) const { return CPUID_VERSION_INFORMATION((Flags & ~0xF00U) | ((value & 0x0FU) << 8)); }
+
+  /**
+   * - 0 - Original OEM Processor
+   * - 1 - Intel OverDrive(R) Processor
+   * - 2 - Dual processor (not applicable to Intel486 processors)
+   * - 3 - Intel reserved
+   */
+  constexpr UINT32 processor_type() const { return (Flags >> 12) & 0x03U; }
+  constexpr CPUID_VERSION_INFORMATION with_processor_type(UINT32 value) const { return CPUID_VERSION_INFORMATION((Flags & ~0x3000U) | ((value & 0x03U) << 12)); }
+
+  /**
+   * The Extended Model ID needs to be examined only when the Family ID is 06H or 0FH.
+   */
+  constexpr UINT32 extended_model_id() const { return (Flags >> 16) & 0x0FU; }
+  constexpr CPUID_VERSION_INFORMATION with_extended_model_id(UINT32 value) const { return CPUID_VERSION_INFORMATION((Flags & ~0xF0000U) | ((value & 0x0FU) << 16)); }
+
+  /**
+   * The Extended Family ID needs to be examined only when the Family ID is 0FH.
+   */
+  constexpr UINT32 extended_family_id() const { return (Flags >> 20) & 0xFFU; }
+  constexpr CPUID_VERSION_INFORMATION with_extended_family_id(UINT32 value) const { return CPUID_VERSION_INFORMATION((Flags & ~0xFF00000U) | ((value & 0xFFU) << 20)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_VERSION_INFORMATION) == 4, "Size of CPUID_VERSION_INFORMATION");
+
+/**
+ * @brief When CPUID executes with EAX set to 01H, feature information is returned in ECX and EDX
+ */
+class CPUID_FEATURE_INFORMATION_ECX
+{
+public:
+  constexpr CPUID_FEATURE_INFORMATION_ECX() = default;
+  constexpr explicit CPUID_FEATURE_INFORMATION_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_01::CpuidFeatureInformationEcx)>
+  static constexpr CPUID_FEATURE_INFORMATION_ECX from(const T& raw) { return std::bit_cast<CPUID_FEATURE_INFORMATION_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_FEATURE_INFORMATION_ECX&, const CPUID_FEATURE_INFORMATION_ECX&) = default;
+
+  /**
+   * @brief Streaming SIMD Extensions 3 (SSE3)
+   *
+   * A value of 1 indicates the processor supports this technology.
+   */
+  constexpr UINT32 streaming_simd_extensions_3() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_streaming_simd_extensions_3(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * @brief PCLMULQDQ instruction
+   *
+   * A value of 1 indicates the processor supports the PCLMULQDQ instruction.
+   */
+  constexpr UINT32 pclmulqdq_instruction() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_pclmulqdq_instruction(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * @brief 64-bit DS Area
+   *
+   * A value of 1 indicates the processor supports DS area using 64-bit layout.
+   */
+  constexpr UINT32 ds_area_64bit_layout() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_ds_area_64bit_layout(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * @brief MONITOR/MWAIT instruction
+   *
+   * A value of 1 indicates the processor supports this feature.
+   */
+  constexpr UINT32 monitor_mwait_instruction() const { return (Flags >> 3) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_monitor_mwait_instruction(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+  /**
+   * @brief CPL Qualified Debug Store
+   *
+   * A value of 1 indicates the processor supports the extensions to the Debug Store feature to allow for branch message
+   * storage qualified by CPL.
+   */
+  constexpr UINT32 cpl_qualified_debug_store() const { return (Flags >> 4) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_cpl_qualified_debug_store(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x10U) | ((value & 0x01U) << 4)); }
+
+  /**
+   * @brief Virtual Machine Extensions
+   *
+   * A value of 1 indicates that the processor supports this technology.
+   */
+  constexpr UINT32 virtual_machine_extensions() const { return (Flags >> 5) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_virtual_machine_extensions(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x20U) | ((value & 0x01U) << 5)); }
+
+  /**
+   * @brief Safer Mode Extensions
+   *
+   * A value of 1 indicates that the processor supports this technology.
+   *
+   * @see Vol2[6(SAFER MODE EXTENSIONS REFERENCE)]
+   */
+  constexpr UINT32 safer_mode_extensions() const { return (Flags >> 6) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_safer_mode_extensions(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x40U) | ((value & 0x01U) << 6)); }
+
+  /**
+   * @brief Enhanced Intel SpeedStep(R) technology
+   *
+   * A value of 1 indicates that the processor supports this technology.
+   */
+  constexpr UINT32 enhanced_intel_speedstep_technology() const { return (Flags >> 7) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_enhanced_intel_speedstep_technology(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x80U) | ((value & 0x01U) << 7)); }
+
+  /**
+   * @brief Thermal Monitor 2
+   *
+   * A value of 1 indicates whether the processor supports this technology.
+   */
+  constexpr UINT32 thermal_monitor_2() const { return (Flags >> 8) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_thermal_monitor_2(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+  /**
+   * @brief Supplemental Streaming SIMD Extensions 3 (SSSE3)
+   *
+   * A value of 1 indicates the presence of the Supplemental Streaming SIMD Extensions 3 (SSSE3). A value of 0 indicates the
+   * instruction extensions are not present in the processor.
+   */
+  constexpr UINT32 supplemental_streaming_simd_extensions_3() const { return (Flags >> 9) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_supplemental_streaming_simd_extensions_3(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x200U) | ((value & 0x01U) << 9)); }
+
+  /**
+   * @brief L1 Context ID
+   *
+   * A value of 1 indicates the L1 data cache mode can be set to either adaptive mode or shared mode. A value of 0 indicates
+   * this feature is not supported. See definition of the IA32_MISC_ENABLE MSR Bit 24 (L1 Data Cache Context Mode) for
+   * details.
+   */
+  constexpr UINT32 l1_context_id() const { return (Flags >> 10) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_l1_context_id(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x400U) | ((value & 0x01U) << 10)); }
+
+  /**
+   * @brief IA32_DEBUG_INTERFACE MSR for silicon debug
+   *
+   * A value of 1 indicates the processor supports IA32_DEBUG_INTERFACE MSR for silicon debug.
+   */
+  constexpr UINT32 silicon_debug() const { return (Flags >> 11) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_silicon_debug(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x800U) | ((value & 0x01U) << 11)); }
+
+  /**
+   * @brief FMA extensions using YMM state
+   *
+   * A value of 1 indicates the processor supports FMA (Fused Multiple Add) extensions using YMM state.
+   */
+  constexpr UINT32 fma_extensions() const { return (Flags >> 12) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_fma_extensions(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x1000U) | ((value & 0x01U) << 12)); }
+
+  /**
+   * @brief CMPXCHG16B instruction
+   *
+   * A value of 1 indicates that the feature is available.
+   */
+  constexpr UINT32 cmpxchg16b_instruction() const { return (Flags >> 13) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_cmpxchg16b_instruction(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x2000U) | ((value & 0x01U) << 13)); }
+
+  /**
+   * @brief xTPR Update Control
+   *
+   * A value of 1 indicates that the processor supports changing IA32_MISC_ENABLE[bit 23].
+   */
+  constexpr UINT32 xtpr_update_control() const { return (Flags >> 14) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_xtpr_update_control(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x4000U) | ((value & 0x01U) << 14)); }
+
+  /**
+   * @brief Perfmon and Debug Capability
+   *
+   * A value of 1 indicates the processor supports the performance and debug feature indication MSR IA32_PERF_CAPABILITIES.
+   */
+  constexpr UINT32 perfmon_and_debug_capability() const { return (Flags >> 15) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_perfmon_and_debug_capability(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x8000U) | ((value & 0x01U) << 15)); }
+
+  /**
+   * @brief Process-context identifiers
+   *
+   * A value of 1 indicates that the processor supports PCIDs and that software may set CR4.PCIDE to 1.
+   */
+  constexpr UINT32 process_context_identifiers() const { return (Flags >> 17) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_process_context_identifiers(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x20000U) | ((value & 0x01U) << 17)); }
+
+  /**
+   * @brief Direct Cache Access
+   *
+   * A value of 1 indicates the processor supports the ability to prefetch data from a memory mapped device (Direct Cache
+   * Access).
+   */
+  constexpr UINT32 direct_cache_access() const { return (Flags >> 18) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_direct_cache_access(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x40000U) | ((value & 0x01U) << 18)); }
+
+  /**
+   * @brief SSE4.1 support
+   *
+   * A value of 1 indicates that the processor supports SSE4.1.
+   */
+  constexpr UINT32 sse41_support() const { return (Flags >> 19) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_sse41_support(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x80000U) | ((value & 0x01U) << 19)); }
+
+  /**
+   * @brief SSE4.2 support
+   *
+   * A value of 1 indicates that the processor supports SSE4.2.
+   */
+  constexpr UINT32 sse42_support() const { return (Flags >> 20) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_sse42_support(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x100000U) | ((value & 0x01U) << 20)); }
+
+  /**
+   * @brief x2APIC support
+   *
+   * A value of 1 indicates that the processor supports x2APIC feature.
+   */
+  constexpr UINT32 x2apic_support() const { return (Flags >> 21) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_x2apic_support(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x200000U) | ((value & 0x01U) << 21)); }
+
+  /**
+   * @brief MOVBE instruction
+   *
+   * A value of 1 indicates that the processor supports MOVBE instruction.
+   */
+  constexpr UINT32 movbe_instruction() const { return (Flags >> 22) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_movbe_instruction(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x400000U) | ((value & 0x01U) << 22)); }
+
+  /**
+   * @brief POPCNT instruction
+   *
+   * A value of 1 indicates that the processor supports the POPCNT instruction.
+   */
+  constexpr UINT32 popcnt_instruction() const { return (Flags >> 23) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_popcnt_instruction(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x800000U) | ((value & 0x01U) << 23)); }
+
+  /**
+   * @brief TSC Deadline
+   *
+   * A value of 1 indicates that the processor's local APIC timer supports one-shot operation using a TSC deadline value.
+   */
+  constexpr UINT32 tsc_deadline() const { return (Flags >> 24) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_tsc_deadline(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x1000000U) | ((value & 0x01U) << 24)); }
+
+  /**
+   * @brief AESNI instruction extensions
+   *
+   * A value of 1 indicates that the processor supports the AESNI instruction extensions.
+   */
+  constexpr UINT32 aesni_instruction_extensions() const { return (Flags >> 25) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_aesni_instruction_extensions(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x2000000U) | ((value & 0x01U) << 25)); }
+
+  /**
+   * @brief XSAVE/XRSTOR instruction extensions
+   *
+   * A value of 1 indicates that the processor supports the XSAVE/XRSTOR processor extended states feature, the XSETBV/XGETBV
+   * instructions, and XCR0.
+   */
+  constexpr UINT32 xsave_xrstor_instruction() const { return (Flags >> 26) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_xsave_xrstor_instruction(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x4000000U) | ((value & 0x01U) << 26)); }
+
+  /**
+   * @brief CR4.OSXSAVE[bit 18] set
+   *
+   * A value of 1 indicates that the OS has set CR4.OSXSAVE[bit 18] to enable XSETBV/XGETBV instructions to access XCR0 and
+   * to support processor extended state management using XSAVE/XRSTOR.
+   */
+  constexpr UINT32 osx_save() const { return (Flags >> 27) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_osx_save(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x8000000U) | ((value & 0x01U) << 27)); }
+
+  /**
+   * @brief AVX instruction extensions support
+   *
+   * A value of 1 indicates the processor supports the AVX instruction extensions.
+   */
+  constexpr UINT32 avx_support() const { return (Flags >> 28) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_avx_support(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x10000000U) | ((value & 0x01U) << 28)); }
+
+  /**
+   * @brief 16-bit floating-point conversion instructions support
+   *
+   * A value of 1 indicates that processor supports 16-bit floating-point conversion instructions.
+   */
+  constexpr UINT32 half_precision_conversion_instructions() const { return (Flags >> 29) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_half_precision_conversion_instructions(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x20000000U) | ((value & 0x01U) << 29)); }
+
+  /**
+   * @brief RDRAND instruction support
+   *
+   * A value of 1 indicates that processor supports RDRAND instruction.
+   */
+  constexpr UINT32 rdrand_instruction() const { return (Flags >> 30) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_ECX with_rdrand_instruction(UINT32 value) const { return CPUID_FEATURE_INFORMATION_ECX((Flags & ~0x40000000U) | ((value & 0x01U) << 30)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_FEATURE_INFORMATION_ECX) == 4, "Size of CPUID_FEATURE_INFORMATION_ECX");
+
+/**
+ * @brief When CPUID executes with EAX set to 01H, feature information is returned in ECX and EDX
+ */
+class CPUID_FEATURE_INFORMATION_EDX
+{
+public:
+  constexpr CPUID_FEATURE_INFORMATION_EDX() = default;
+  constexpr explicit CPUID_FEATURE_INFORMATION_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_01::CpuidFeatureInformationEdx)>
+  static constexpr CPUID_FEATURE_INFORMATION_EDX from(const T& raw) { return std::bit_cast<CPUID_FEATURE_INFORMATION_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_FEATURE_INFORMATION_EDX&, const CPUID_FEATURE_INFORMATION_EDX&) = default;
+
+  /**
+   * @brief Floating Point Unit On-Chip
+   *
+   * The processor contains an x87 FPU.
+   */
+  constexpr UINT32 floating_point_unit_on_chip() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_floating_point_unit_on_chip(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * @brief Virtual 8086 Mode Enhancements
+   *
+   * Virtual 8086 mode enhancements, including CR4.VME for controlling the feature, CR4.PVI for protected mode virtual
+   * interrupts, software interrupt indirection, expansion of the TSS with the software indirection bitmap, and EFLAGS.VIF
+   * and EFLAGS.VIP flags.
+   */
+  constexpr UINT32 virtual_8086_mode_enhancements() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_virtual_8086_mode_enhancements(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * @brief Debugging Extensions
+   *
+   * Support for I/O breakpoints, including CR4.DE for controlling the feature, and optional trapping of accesses to DR4 and
+   * DR5.
+   */
+  constexpr UINT32 debugging_extensions() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_debugging_extensions(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * @brief Page Size Extension
+   *
+   * Large pages of size 4 MByte are supported, including CR4.PSE for controlling the feature, the defined dirty bit in PDE
+   * (Page Directory Entries), optional reserved bit trapping in CR3, PDEs, and PTEs.
+   */
+  constexpr UINT32 page_size_extension() const { return (Flags >> 3) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_page_size_extension(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+  /**
+   * @brief Time Stamp Counter
+   *
+   * The RDTSC instruction is supported, including CR4.TSD for controlling privilege.
+   */
+  constexpr UINT32 timestamp_counter() const { return (Flags >> 4) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_timestamp_counter(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x10U) | ((value & 0x01U) << 4)); }
+
+  /**
+   * @brief Model Specific Registers RDMSR and WRMSR Instructions
+   *
+   * The RDMSR and WRMSR instructions are supported. Some of the MSRs are implementation dependent.
+   */
+  constexpr UINT32 rdmsr_wrmsr_instructions() const { return (Flags >> 5) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_rdmsr_wrmsr_instructions(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x20U) | ((value & 0x01U) << 5)); }
+
+  /**
+   * @brief Physical Address Extension
+   *
+   * Physical addresses greater than 32 bits are supported: extended page table entry formats, an extra level in the page
+   * translation tables is defined, 2-MByte pages are supported instead of 4 Mbyte pages if PAE bit is 1.
+   */
+  constexpr UINT32 physical_address_extension() const { return (Flags >> 6) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_physical_address_extension(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x40U) | ((value & 0x01U) << 6)); }
+
+  /**
+   * @brief Machine Check Exception
+   *
+   * Exception 18 is defined for Machine Checks, including CR4.MCE for controlling the feature. This feature does not define
+   * the model-specific implementations of machine-check error logging, reporting, and processor shutdowns. Machine Check
+   * exception handlers may have to depend on processor version to do model specific processing of the exception, or test for
+   * the presence of the Machine Check feature.
+   */
+  constexpr UINT32 machine_check_exception() const { return (Flags >> 7) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_machine_check_exception(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x80U) | ((value & 0x01U) << 7)); }
+
+  /**
+   * @brief CMPXCHG8B Instruction
+   *
+   * The compare-and-exchange 8 bytes (64 bits) instruction is supported (implicitly locked and atomic).
+   */
+  constexpr UINT32 cmpxchg8b() const { return (Flags >> 8) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_cmpxchg8b(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+  /**
+   * @brief APIC On-Chip
+   *
+   * The processor contains an Advanced Programmable Interrupt Controller (APIC), responding to memory mapped commands in the
+   * physical address range FFFE0000H to FFFE0FFFH (by default - some processors permit the APIC to be relocated).
+   */
+  constexpr UINT32 apic_on_chip() const { return (Flags >> 9) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_apic_on_chip(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x200U) | ((value & 0x01U) << 9)); }
+
+  /**
+   * @brief SYSENTER and SYSEXIT Instructions
+   *
+   * The SYSENTER and SYSEXIT and associated MSRs are supported.
+   */
+  constexpr UINT32 sysenter_sysexit_instructions() const { return (Flags >> 11) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_sysenter_sysexit_instructions(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x800U) | ((value & 0x01U) << 11)); }
+
+  /**
+   * @brief Memory Type Range Registers
+   *
+   * MTRRs are supported. The MTRRcap MSR contains feature bits that describe what memory types are supported, how many
+   * variable MTRRs are supported, and whether fixed MTRRs are supported.
+   */
+  constexpr UINT32 memory_type_range_registers() const { return (Flags >> 12) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_memory_type_range_registers(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x1000U) | ((value & 0x01U) << 12)); }
+
+  /**
+   * @brief Page Global Bit
+   *
+   * The global bit is supported in paging-structure entries that map a page, indicating TLB entries that are common to
+   * different processes and need not be flushed. The CR4.PGE bit controls this feature.
+   */
+  constexpr UINT32 page_global_bit() const { return (Flags >> 13) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_page_global_bit(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x2000U) | ((value & 0x01U) << 13)); }
+
+  /**
+   * @brief Machine Check Architecture
+   *
+   * A value of 1 indicates the Machine Check Architecture of reporting machine errors is supported. The MCG_CAP MSR contains
+   * feature bits describing how many banks of error reporting MSRs are supported.
+   */
+  constexpr UINT32 machine_check_architecture() const { return (Flags >> 14) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_machine_check_architecture(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x4000U) | ((value & 0x01U) << 14)); }
+
+  /**
+   * @brief Conditional Move Instructions
+   *
+   * The conditional move instruction CMOV is supported. In addition, if x87 FPU is present as indicated by the CPUID.FPU
+   * feature bit, then the FCOMI and FCMOV instructions are supported
+   */
+  constexpr UINT32 conditional_move_instructions() const { return (Flags >> 15) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_conditional_move_instructions(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x8000U) | ((value & 0x01U) << 15)); }
+
+  /**
+   * @brief Page Attribute Table
+   *
+   * Page Attribute Table is supported. This feature augments the Memory Type Range Registers (MTRRs), allowing an operating
+   * system to specify attributes of memory accessed through a linear address on a 4KB granularity.
+   */
+  constexpr UINT32 page_attribute_table() const { return (Flags >> 16) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_page_attribute_table(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x10000U) | ((value & 0x01U) << 16)); }
+
+  /**
+   * @brief 36-Bit Page Size Extension
+   *
+   * 4-MByte pages addressing physical memory beyond 4 GBytes are supported with 32-bit paging. This feature indicates that
+   * upper bits of the physical address of a 4-MByte page are encoded in bits 20:13 of the page-directory entry. Such
+   * physical addresses are limited by MAXPHYADDR and may be up to 40 bits in size.
+   */
+  constexpr UINT32 page_size_extension_36bit() const { return (Flags >> 17) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_page_size_extension_36bit(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x20000U) | ((value & 0x01U) << 17)); }
+
+  /**
+   * @brief Processor Serial Number
+   *
+   * The processor supports the 96-bit processor identification number feature and the feature is enabled.
+   */
+  constexpr UINT32 processor_serial_number() const { return (Flags >> 18) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_processor_serial_number(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x40000U) | ((value & 0x01U) << 18)); }
+
+  /**
+   * @brief CLFLUSH Instruction
+   *
+   * CLFLUSH Instruction is supported.
+   */
+  constexpr UINT32 clflush() const { return (Flags >> 19) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_clflush(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x80000U) | ((value & 0x01U) << 19)); }
+
+  /**
+   * @brief Debug Store
+   *
+   * The processor supports the ability to write debug information into a memory resident buffer. This feature is used by the
+   * branch trace store (BTS) and processor event-based sampling (PEBS) facilities.
+   *
+   * @see Vol3C[23(INTRODUCTION TO VIRTUAL MACHINE EXTENSIONS)]
+   */
+  constexpr UINT32 debug_store() const { return (Flags >> 21) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_debug_store(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x200000U) | ((value & 0x01U) << 21)); }
+
+  /**
+   * @brief Thermal Monitor and Software Controlled Clock Facilities
+   *
+   * The processor implements internal MSRs that allow processor temperature to be monitored and processor performance to be
+   * modulated in predefined duty cycles under software control.
+   */
+  constexpr UINT32 thermal_control_msrs_for_acpi() const { return (Flags >> 22) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_thermal_control_msrs_for_acpi(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x400000U) | ((value & 0x01U) << 22)); }
+
+  /**
+   * @brief Intel MMX Technology
+   *
+   * The processor supports the Intel MMX technology.
+   */
+  constexpr UINT32 mmx_support() const { return (Flags >> 23) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_mmx_support(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x800000U) | ((value & 0x01U) << 23)); }
+
+  /**
+   * @brief FXSAVE and FXRSTOR Instructions
+   *
+   * The FXSAVE and FXRSTOR instructions are supported for fast save and restore of the floating point context. Presence of
+   * this bit also indicates that CR4.OSFXSR is available for an operating system to indicate that it supports the FXSAVE and
+   * FXRSTOR instructions.
+   */
+  constexpr UINT32 fxsave_fxrstor_instructions() const { return (Flags >> 24) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_fxsave_fxrstor_instructions(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x1000000U) | ((value & 0x01U) << 24)); }
+
+  /**
+   * @brief SSE extensions support
+   *
+   * The processor supports the SSE extensions.
+   */
+  constexpr UINT32 sse_support() const { return (Flags >> 25) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_sse_support(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x2000000U) | ((value & 0x01U) << 25)); }
+
+  /**
+   * @brief SSE2 extensions support
+   *
+   * The processor supports the SSE2 extensions.
+   */
+  constexpr UINT32 sse2_support() const { return (Flags >> 26) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_sse2_support(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x4000000U) | ((value & 0x01U) << 26)); }
+
+  /**
+   * @brief Self Snoop
+   *
+   * The processor supports the management of conflicting memory types by performing a snoop of its own cache structure for
+   * transactions issued to the bus.
+   */
+  constexpr UINT32 self_snoop() const { return (Flags >> 27) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_self_snoop(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x8000000U) | ((value & 0x01U) << 27)); }
+
+  /**
+   * @brief Max APIC IDs reserved field is Valid
+   *
+   * A value of 0 for HTT indicates there is only a single logical processor in the package and software should assume only a
+   * single APIC ID is reserved. A value of 1 for HTT indicates the value in CPUID.1.EBX[23:16] (the Maximum number of
+   * addressable IDs for logical processors in this package) is valid for the package.
+   */
+  constexpr UINT32 hyper_threading_technology() const { return (Flags >> 28) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_hyper_threading_technology(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x10000000U) | ((value & 0x01U) << 28)); }
+
+  /**
+   * @brief Thermal Monitor
+   *
+   * The processor implements the thermal monitor automatic thermal control circuitry (TCC).
+   */
+  constexpr UINT32 thermal_monitor() const { return (Flags >> 29) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_thermal_monitor(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x20000000U) | ((value & 0x01U) << 29)); }
+
+  /**
+   * @brief Pending Break Enable
+   *
+   * The processor supports the use of the FERR\#/PBE\# pin when the processor is in the stop-clock state (STPCLK\# is
+   * asserted) to signal the processor that an interrupt is pending and that the processor should return to normal operation
+   * to handle the interrupt. Bit 10 (PBE enable) in the IA32_MISC_ENABLE MSR enables this capability.
+   */
+  constexpr UINT32 pending_break_enable() const { return (Flags >> 31) & 0x01U; }
+  constexpr CPUID_FEATURE_INFORMATION_EDX with_pending_break_enable(UINT32 value) const { return CPUID_FEATURE_INFORMATION_EDX((Flags & ~0x80000000U) | ((value & 0x01U) << 31)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_FEATURE_INFORMATION_EDX) == 4, "Size of CPUID_FEATURE_INFORMATION_EDX");
+
+class CPUID_EAX_04_EAX
+{
+public:
+  constexpr CPUID_EAX_04_EAX() = default;
+  constexpr explicit CPUID_EAX_04_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_04::Eax)>
+  static constexpr CPUID_EAX_04_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_04_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_04_EAX&, const CPUID_EAX_04_EAX&) = default;
+
+  /**
+   * - 0 = Null - No more caches. - 1 = Data Cache. - 2 = Instruction Cache. - 3 = Unified Cache. - 4-31 = Reserved.
+   */
+  constexpr UINT32 cache_type_field() const { return (Flags >> 0) & 0x1FU; }
+  constexpr CPUID_EAX_04_EAX with_cache_type_field(UINT32 value) const { return CPUID_EAX_04_EAX((Flags & ~0x1FU) | ((value & 0x1FU) << 0)); }
+
+  /**
+   * Cache Level (starts at 1).
+   */
+  constexpr UINT32 cache_level() const { return (Flags >> 5) & 0x07U; }
+  constexpr CPUID_EAX_04_EAX with_cache_level(UINT32 value) const { return CPUID_EAX_04_EAX((Flags & ~0xE0U) | ((value & 0x07U) << 5)); }
+
+  /**
+   * Self Initializing cache level (does not need SW initialization).
+   */
+  constexpr UINT32 self_initializing_cache_level() const { return (Flags >> 8) & 0x01U; }
+  constexpr CPUID_EAX_04_EAX with_self_initializing_cache_level(UINT32 value) const { return CPUID_EAX_04_EAX((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+  /**
+   * Fully Associative cache.
+   */
+  constexpr UINT32 fully_associative_cache() const { return (Flags >> 9) & 0x01U; }
+  constexpr CPUID_EAX_04_EAX with_fully_associative_cache(UINT32 value) const { return CPUID_EAX_04_EAX((Flags & ~0x200U) | ((value & 0x01U) << 9)); }
+
+  /**
+   * Maximum number of addressable IDs for logical processors sharing this cache.
+   */
+  constexpr UINT32 max_addressable_ids_for_logical_processors_sharing_this_cache() const { return (Flags >> 14) & 0xFFFU; }
+  constexpr CPUID_EAX_04_EAX with_max_addressable_ids_for_logical_processors_sharing_this_cache(UINT32 value) const { return CPUID_EAX_04_EAX((Flags & ~0x3FFC000U) | ((value & 0xFFFU) << 14)); }
+
+  /**
+   * Maximum number of addressable IDs for processor cores in the physical package.
+   */
+  constexpr UINT32 max_addressable_ids_for_processor_cores_in_physical_package() const { return (Flags >> 26) & 0x3FU; }
+  constexpr CPUID_EAX_04_EAX with_max_addressable_ids_for_processor_cores_in_physical_package(UINT32 value) const { return CPUID_EAX_04_EAX((Flags & ~0xFC000000U) | ((value & 0x3FU) << 26)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_04_EAX) == 4, "Size of CPUID_EAX_04_EAX");
+
+class CPUID_EAX_04_EBX
+{
+public:
+  constexpr CPUID_EAX_04_EBX() = default;
+  constexpr explicit CPUID_EAX_04_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_04::Ebx)>
+  static constexpr CPUID_EAX_04_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_04_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_04_EBX&, const CPUID_EAX_04_EBX&) = default;
+
+  /**
+   * System Coherency Line Size.
+   */
+  constexpr UINT32 system_coherency_line_size() const { return (Flags >> 0) & 0xFFFU; }
+  constexpr CPUID_EAX_04_EBX with_system_coherency_line_size(UINT32 value) const { return CPUID_EAX_04_EBX((Flags & ~0xFFFU) | ((value & 0xFFFU) << 0)); }
+
+  /**
+   * Physical Line partitions.
+   */
+  constexpr UINT32 physical_line_partitions() const { return (Flags >> 12) & 0x3FFU; }
+  constexpr CPUID_EAX_04_EBX with_physical_line_partitions(UINT32 value) const { return CPUID_EAX_04_EBX((Flags & ~0x3FF000U) | ((value & 0x3FFU) << 12)); }
+
+  /**
+   * Ways of associativity.
+   */
+  constexpr UINT32 ways_of_associativity() const { return (Flags >> 22) & 0x3FFU; }
+  constexpr CPUID_EAX_04_EBX with_ways_of_associativity(UINT32 value) const { return CPUID_EAX_04_EBX((Flags & ~0xFFC00000U) | ((value & 0x3FFU) << 22)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_04_EBX) == 4, "Size of CPUID_EAX_04_EBX");
+
+class CPUID_EAX_04_ECX
+{
+public:
+  constexpr CPUID_EAX_04_ECX() = default;
+  constexpr explicit CPUID_EAX_04_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_04::Ecx)>
+  static constexpr CPUID_EAX_04_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_04_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_04_ECX&, const CPUID_EAX_04_ECX&) = default;
+
+  /**
+   * Number of Sets.
+   */
+  constexpr UINT32 number_of_sets() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_04_ECX with_number_of_sets(UINT32 value) const { return CPUID_EAX_04_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_04_ECX) == 4, "Size of CPUID_EAX_04_ECX");
+
+class CPUID_EAX_04_EDX
+{
+public:
+  constexpr CPUID_EAX_04_EDX() = default;
+  constexpr explicit CPUID_EAX_04_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_04::Edx)>
+  static constexpr CPUID_EAX_04_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_04_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_04_EDX&, const CPUID_EAX_04_EDX&) = default;
+
+  /**
+   * @brief Write-Back Invalidate/Invalidate
+   *
+   * - 0 = WBINVD/INVD from threads sharing this cache acts upon lower level caches for threads sharing this cache.
+   * - 1 = WBINVD/INVD is not guaranteed to act upon lower level caches of non-originating threads sharing this cache.
+   */
+  constexpr UINT32 write_back_invalidate() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_04_EDX with_write_back_invalidate(UINT32 value) const { return CPUID_EAX_04_EDX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * @brief Cache Inclusiveness
+   *
+   * - 0 = Cache is not inclusive of lower cache levels.
+   * - 1 = Cache is inclusive of lower cache levels.
+   */
+  constexpr UINT32 cache_inclusiveness() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_04_EDX with_cache_inclusiveness(UINT32 value) const { return CPUID_EAX_04_EDX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * @brief Complex Cache Indexing
+   *
+   * - 0 = Direct mapped cache.
+   * - 1 = A complex function is used to index the cache, potentially using all address bits.
+   */
+  constexpr UINT32 complex_cache_indexing() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_04_EDX with_complex_cache_indexing(UINT32 value) const { return CPUID_EAX_04_EDX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_04_EDX) == 4, "Size of CPUID_EAX_04_EDX");
+
+class CPUID_EAX_05_EAX
+{
+public:
+  constexpr CPUID_EAX_05_EAX() = default;
+  constexpr explicit CPUID_EAX_05_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_05::Eax)>
+  static constexpr CPUID_EAX_05_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_05_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_05_EAX&, const CPUID_EAX_05_EAX&) = default;
+
+  /**
+   * Smallest monitor-line size in bytes (default is processor's monitor granularity).
+   */
+  constexpr UINT32 smallest_monitor_line_size() const { return (Flags >> 0) & 0xFFFFU; }
+  constexpr CPUID_EAX_05_EAX with_smallest_monitor_line_size(UINT32 value) const { return CPUID_EAX_05_EAX((Flags & ~0xFFFFU) | ((value & 0xFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_05_EAX) == 4, "Size of CPUID_EAX_05_EAX");
+
+class CPUID_EAX_05_EBX
+{
+public:
+  constexpr CPUID_EAX_05_EBX() = default;
+  constexpr explicit CPUID_EAX_05_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_05::Ebx)>
+  static constexpr CPUID_EAX_05_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_05_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_05_EBX&, const CPUID_EAX_05_EBX&) = default;
+
+  /**
+   * Largest monitor-line size in bytes (default is processor's monitor granularity).
+   */
+  constexpr UINT32 largest_monitor_line_size() const { return (Flags >> 0) & 0xFFFFU; }
+  constexpr CPUID_EAX_05_EBX with_largest_monitor_line_size(UINT32 value) const { return CPUID_EAX_05_EBX((Flags & ~0xFFFFU) | ((value & 0xFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_05_EBX) == 4, "Size of CPUID_EAX_05_EBX");
+
+class CPUID_EAX_05_ECX
+{
+public:
+  constexpr CPUID_EAX_05_ECX() = default;
+  constexpr explicit CPUID_EAX_05_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_05::Ecx)>
+  static constexpr CPUID_EAX_05_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_05_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_05_ECX&, const CPUID_EAX_05_ECX&) = default;
+
+  /**
+   * Enumeration of Monitor-Mwait extensions (beyond EAX and EBX registers) supported.
+   */
+  constexpr UINT32 enumeration_of_monitor_mwait_extensions() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_05_ECX with_enumeration_of_monitor_mwait_extensions(UINT32 value) const { return CPUID_EAX_05_ECX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * Supports treating interrupts as break-event for MWAIT, even when interrupts disabled.
+   */
+  constexpr UINT32 supports_treating_interrupts_as_break_event_for_mwait() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_05_ECX with_supports_treating_interrupts_as_break_event_for_mwait(UINT32 value) const { return CPUID_EAX_05_ECX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_05_ECX) == 4, "Size of CPUID_EAX_05_ECX");
+
+class CPUID_EAX_05_EDX
+{
+public:
+  constexpr CPUID_EAX_05_EDX() = default;
+  constexpr explicit CPUID_EAX_05_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_05::Edx)>
+  static constexpr CPUID_EAX_05_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_05_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_05_EDX&, const CPUID_EAX_05_EDX&) = default;
+
+  /**
+   * Number of C0 sub C-states supported using MWAIT.
+   */
+  constexpr UINT32 number_of_c0_sub_c_states() const { return (Flags >> 0) & 0x0FU; }
+  constexpr CPUID_EAX_05_EDX with_number_of_c0_sub_c_states(UINT32 value) const { return CPUID_EAX_05_EDX((Flags & ~0x0FU) | ((value & 0x0FU) << 0)); }
+
+  /**
+   * Number of C1 sub C-states supported using MWAIT.
+   */
+  constexpr UINT32 number_of_c1_sub_c_states() const { return (Flags >> 4) & 0x0FU; }
+  constexpr CPUID_EAX_05_EDX with_number_of_c1_sub_c_states(UINT32 value) const { return CPUID_EAX_05_EDX((Flags & ~0xF0U) | ((value & 0x0FU) << 4)); }
+
+  /**
+   * Number of C2 sub C-states supported using MWAIT.
+   */
+  constexpr UINT32 number_of_c2_sub_c_states() const { return (Flags >> 8) & 0x0FU; }
+  constexpr CPUID_EAX_05_EDX with_number_of_c2_sub_c_states(UINT32 value) const { return CPUID_EAX_05_EDX((Flags & ~0xF00U) | ((value & 0x0FU) << 8)); }
+
+  /**
+   * Number of C3 sub C-states supported using MWAIT.
+   */
+  constexpr UINT32 number_of_c3_sub_c_states() const { return (Flags >> 12) & 0x0FU; }
+  constexpr CPUID_EAX_05_EDX with_number_of_c3_sub_c_states(UINT32 value) const { return CPUID_EAX_05_EDX((Flags & ~0xF000U) | ((value & 0x0FU) << 12)); }
+
+  /**
+   * Number of C4 sub C-states supported using MWAIT.
+   */
+  constexpr UINT32 number_of_c4_sub_c_states() const { return (Flags >> 16) & 0x0FU; }
+  constexpr CPUID_EAX_05_EDX with_number_of_c4_sub_c_states(UINT32 value) const { return CPUID_EAX_05_EDX((Flags & ~0xF0000U) | ((value & 0x0FU) << 16)); }
+
+  /**
+   * Number of C5 sub C-states supported using MWAIT.
+   */
+  constexpr UINT32 number_of_c5_sub_c_states() const { return (Flags >> 20) & 0x0FU; }
+  constexpr CPUID_EAX_05_EDX with_number_of_c5_sub_c_states(UINT32 value) const { return CPUID_EAX_05_EDX((Flags & ~0xF00000U) | ((value & 0x0FU) << 20)); }
+
+  /**
+   * Number of C6 sub C-states supported using MWAIT.
+   */
+  constexpr UINT32 number_of_c6_sub_c_states() const { return (Flags >> 24) & 0x0FU; }
+  constexpr CPUID_EAX_05_EDX with_number_of_c6_sub_c_states(UINT32 value) const { return CPUID_EAX_05_EDX((Flags & ~0xF000000U) | ((value & 0x0FU) << 24)); }
+
+  /**
+   * Number of C7 sub C-states supported using MWAIT.
+   */
+  constexpr UINT32 number_of_c7_sub_c_states() const { return (Flags >> 28) & 0x0FU; }
+  constexpr CPUID_EAX_05_EDX with_number_of_c7_sub_c_states(UINT32 value) const { return CPUID_EAX_05_EDX((Flags & ~0xF0000000U) | ((value & 0x0FU) << 28)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_05_EDX) == 4, "Size of CPUID_EAX_05_EDX");
+
+class CPUID_EAX_06_EAX
+{
+public:
+  constexpr CPUID_EAX_06_EAX() = default;
+  constexpr explicit CPUID_EAX_06_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_06::Eax)>
+  static constexpr CPUID_EAX_06_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_06_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_06_EAX&, const CPUID_EAX_06_EAX&) = default;
+
+  /**
+   * Digital temperature sensor is supported if set.
+   */
+  constexpr UINT32 temperature_sensor_supported() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_temperature_sensor_supported(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * Intel Turbo Boost Technology available (see description of IA32_MISC_ENABLE[38]).
+   */
+  constexpr UINT32 intel_turbo_boost_technology_available() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_intel_turbo_boost_technology_available(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * ARAT. APIC-Timer-always-running feature is supported if set.
+   */
+  constexpr UINT32 apic_timer_always_running() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_apic_timer_always_running(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * PLN. Power limit notification controls are supported if set.
+   */
+  constexpr UINT32 power_limit_notification() const { return (Flags >> 4) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_power_limit_notification(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x10U) | ((value & 0x01U) << 4)); }
+
+  /**
+   * ECMD. Clock modulation duty cycle extension is supported if set.
+   */
+  constexpr UINT32 clock_modulation_duty() const { return (Flags >> 5) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_clock_modulation_duty(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x20U) | ((value & 0x01U) << 5)); }
+
+  /**
+   * PTM. Package thermal management is supported if set.
+   */
+  constexpr UINT32 package_thermal_management() const { return (Flags >> 6) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_package_thermal_management(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x40U) | ((value & 0x01U) << 6)); }
+
+  /**
+   * HWP. HWP base registers (IA32_PM_ENABLE[bit 0], IA32_HWP_CAPABILITIES, IA32_HWP_REQUEST, IA32_HWP_STATUS) are supported
+   * if set.
+   */
+  constexpr UINT32 hwp_base_registers() const { return (Flags >> 7) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_hwp_base_registers(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x80U) | ((value & 0x01U) << 7)); }
+
+  /**
+   * HWP_Notification. IA32_HWP_INTERRUPT MSR is supported if set.
+   */
+  constexpr UINT32 hwp_notification() const { return (Flags >> 8) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_hwp_notification(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+  /**
+   * HWP_Activity_Window. IA32_HWP_REQUEST[bits 41:32] is supported if set.
+   */
+  constexpr UINT32 hwp_activity_window() const { return (Flags >> 9) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_hwp_activity_window(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x200U) | ((value & 0x01U) << 9)); }
+
+  /**
+   * HWP_Energy_Performance_Preference. IA32_HWP_REQUEST[bits 31:24] is supported if set.
+   */
+  constexpr UINT32 hwp_energy_performance_preference() const { return (Flags >> 10) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_hwp_energy_performance_preference(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x400U) | ((value & 0x01U) << 10)); }
+
+  /**
+   * HWP_Package_Level_Request. IA32_HWP_REQUEST_PKG MSR is supported if set.
+   */
+  constexpr UINT32 hwp_package_level_request() const { return (Flags >> 11) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_hwp_package_level_request(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x800U) | ((value & 0x01U) << 11)); }
+
+  /**
+   * HDC. HDC base registers IA32_PKG_HDC_CTL, IA32_PM_CTL1, IA32_THREAD_STALL MSRs are supported if set.
+   */
+  constexpr UINT32 hdc() const { return (Flags >> 13) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_hdc(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x2000U) | ((value & 0x01U) << 13)); }
+
+  /**
+   * Intel(R) Turbo Boost Max Technology 3.0 available.
+   */
+  constexpr UINT32 intel_turbo_boost_max_technology_3_available() const { return (Flags >> 14) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_intel_turbo_boost_max_technology_3_available(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x4000U) | ((value & 0x01U) << 14)); }
+
+  /**
+   * HWP Capabilities. Highest Performance change is supported if set.
+   */
+  constexpr UINT32 hwp_capabilities() const { return (Flags >> 15) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_hwp_capabilities(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x8000U) | ((value & 0x01U) << 15)); }
+
+  /**
+   * HWP PECI override is supported if set.
+   */
+  constexpr UINT32 hwp_peci_override() const { return (Flags >> 16) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_hwp_peci_override(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x10000U) | ((value & 0x01U) << 16)); }
+
+  /**
+   * Flexible HWP is supported if set.
+   */
+  constexpr UINT32 flexible_hwp() const { return (Flags >> 17) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_flexible_hwp(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x20000U) | ((value & 0x01U) << 17)); }
+
+  /**
+   * Fast access mode for the IA32_HWP_REQUEST MSR is supported if set.
+   */
+  constexpr UINT32 fast_access_mode_for_hwp_request_msr() const { return (Flags >> 18) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_fast_access_mode_for_hwp_request_msr(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x40000U) | ((value & 0x01U) << 18)); }
+
+  /**
+   * Ignoring Idle Logical Processor HWP request is supported if set.
+   */
+  constexpr UINT32 ignoring_idle_logical_processor_hwp_request() const { return (Flags >> 20) & 0x01U; }
+  constexpr CPUID_EAX_06_EAX with_ignoring_idle_logical_processor_hwp_request(UINT32 value) const { return CPUID_EAX_06_EAX((Flags & ~0x100000U) | ((value & 0x01U) << 20)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_06_EAX) == 4, "Size of CPUID_EAX_06_EAX");
+
+class CPUID_EAX_06_EBX
+{
+public:
+  constexpr CPUID_EAX_06_EBX() = default;
+  constexpr explicit CPUID_EAX_06_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_06::Ebx)>
+  static constexpr CPUID_EAX_06_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_06_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_06_EBX&, const CPUID_EAX_06_EBX&) = default;
+
+  /**
+   * Number of Interrupt Thresholds in Digital Thermal Sensor.
+   */
+  constexpr UINT32 number_of_interrupt_thresholds_in_thermal_sensor() const { return (Flags >> 0) & 0x0FU; }
+  constexpr CPUID_EAX_06_EBX with_number_of_interrupt_thresholds_in_thermal_sensor(UINT32 value) const { return CPUID_EAX_06_EBX((Flags & ~0x0FU) | ((value & 0x0FU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_06_EBX) == 4, "Size of CPUID_EAX_06_EBX");
+
+class CPUID_EAX_06_ECX
+{
+public:
+  constexpr CPUID_EAX_06_ECX() = default;
+  constexpr explicit CPUID_EAX_06_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_06::Ecx)>
+  static constexpr CPUID_EAX_06_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_06_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_06_ECX&, const CPUID_EAX_06_ECX&) = default;
+
+  /**
+   * Hardware Coordination Feedback Capability (Presence of IA32_MPERF and IA32_APERF). The capability to provide a measure
+   * of delivered processor performance (since last reset of the counters), as a percentage of the expected processor
+   * performance when running at the TSC frequency.
+   */
+  constexpr UINT32 hardware_coordination_feedback_capability() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_06_ECX with_hardware_coordination_feedback_capability(UINT32 value) const { return CPUID_EAX_06_ECX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * The processor supports performance-energy bias preference if CPUID.06H:ECX.SETBH[bit 3] is set and it also implies the
+   * presence of a new architectural MSR called IA32_ENERGY_PERF_BIAS (1B0H).
+   */
+  constexpr UINT32 performance_energy_bias_preference() const { return (Flags >> 3) & 0x01U; }
+  constexpr CPUID_EAX_06_ECX with_performance_energy_bias_preference(UINT32 value) const { return CPUID_EAX_06_ECX((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_06_ECX) == 4, "Size of CPUID_EAX_06_ECX");
+
+class CPUID_EAX_06_EDX
+{
+public:
+  constexpr CPUID_EAX_06_EDX() = default;
+  constexpr explicit CPUID_EAX_06_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_06::Edx)>
+  static constexpr CPUID_EAX_06_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_06_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_06_EDX&, const CPUID_EAX_06_EDX&) = default;
+
+  /**
+   * EDX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_06_EDX with_reserved(UINT32 value) const { return CPUID_EAX_06_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_06_EDX) == 4, "Size of CPUID_EAX_06_EDX");
+
+class CPUID_EAX_07_EAX
+{
+public:
+  constexpr CPUID_EAX_07_EAX() = default;
+  constexpr explicit CPUID_EAX_07_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_07::Eax)>
+  static constexpr CPUID_EAX_07_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_07_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_07_EAX&, const CPUID_EAX_07_EAX&) = default;
+
+  /**
+   * Reports the maximum input value for supported leaf 7 sub-leaves.
+   */
+  constexpr UINT32 number_of_sub_leaves() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_07_EAX with_number_of_sub_leaves(UINT32 value) const { return CPUID_EAX_07_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_07_EAX) == 4, "Size of CPUID_EAX_07_EAX");
+
+class CPUID_EAX_07_EBX
+{
+public:
+  constexpr CPUID_EAX_07_EBX() = default;
+  constexpr explicit CPUID_EAX_07_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_07::Ebx)>
+  static constexpr CPUID_EAX_07_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_07_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_07_EBX&, const CPUID_EAX_07_EBX&) = default;
+
+  /**
+   * Supports RDFSBASE/RDGSBASE/WRFSBASE/WRGSBASE if 1.
+   */
+  constexpr UINT32 fsgsbase() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_fsgsbase(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * IA32_TSC_ADJUST MSR is supported if 1.
+   */
+  constexpr UINT32 ia32_tsc_adjust_msr() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_ia32_tsc_adjust_msr(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * Supports Intel(R) Software Guard Extensions (Intel(R) SGX Extensions) if 1.
+   */
+  constexpr UINT32 sgx() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_sgx(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * BMI1.
+   */
+  constexpr UINT32 bmi1() const { return (Flags >> 3) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_bmi1(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+  /**
+   * HLE.
+   */
+  constexpr UINT32 hle() const { return (Flags >> 4) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_hle(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x10U) | ((value & 0x01U) << 4)); }
+
+  /**
+   * AVX2.
+   */
+  constexpr UINT32 avx2() const { return (Flags >> 5) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_avx2(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x20U) | ((value & 0x01U) << 5)); }
+
+  /**
+   * x87 FPU Data Pointer updated only on x87 exceptions if 1.
+   */
+  constexpr UINT32 fdp_excptn_only() const { return (Flags >> 6) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_fdp_excptn_only(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x40U) | ((value & 0x01U) << 6)); }
+
+  /**
+   * Supports Supervisor-Mode Execution Prevention if 1.
+   */
+  constexpr UINT32 smep() const { return (Flags >> 7) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_smep(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x80U) | ((value & 0x01U) << 7)); }
+
+  /**
+   * BMI2.
+   */
+  constexpr UINT32 bmi2() const { return (Flags >> 8) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_bmi2(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+  /**
+   * Supports Enhanced REP MOVSB/STOSB if 1.
+   */
+  constexpr UINT32 enhanced_rep_movsb_stosb() const { return (Flags >> 9) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_enhanced_rep_movsb_stosb(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x200U) | ((value & 0x01U) << 9)); }
+
+  /**
+   * If 1, supports INVPCID instruction for system software that manages process-context identifiers.
+   */
+  constexpr UINT32 invpcid() const { return (Flags >> 10) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_invpcid(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x400U) | ((value & 0x01U) << 10)); }
+
+  /**
+   * RTM.
+   */
+  constexpr UINT32 rtm() const { return (Flags >> 11) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_rtm(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x800U) | ((value & 0x01U) << 11)); }
+
+  /**
+   * Supports Intel(R) Resource Director Technology (Intel(R) RDT) Monitoring capability if 1.
+   */
+  constexpr UINT32 rdt_m() const { return (Flags >> 12) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_rdt_m(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x1000U) | ((value & 0x01U) << 12)); }
+
+  /**
+   * Deprecates FPU CS and FPU DS values if 1.
+   */
+  constexpr UINT32 deprecates() const { return (Flags >> 13) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_deprecates(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x2000U) | ((value & 0x01U) << 13)); }
+
+  /**
+   * Supports Intel(R) Memory Protection Extensions if 1.
+   */
+  constexpr UINT32 mpx() const { return (Flags >> 14) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_mpx(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x4000U) | ((value & 0x01U) << 14)); }
+
+  /**
+   * Supports Intel(R) Resource Director Technology (Intel(R) RDT) Allocation capability if 1.
+   */
+  constexpr UINT32 rdt() const { return (Flags >> 15) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_rdt(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x8000U) | ((value & 0x01U) << 15)); }
+
+  /**
+   * AVX512F.
+   */
+  constexpr UINT32 avx512f() const { return (Flags >> 16) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_avx512f(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x10000U) | ((value & 0x01U) << 16)); }
+
+  /**
+   * AVX512DQ.
+   */
+  constexpr UINT32 avx512dq() const { return (Flags >> 17) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_avx512dq(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x20000U) | ((value & 0x01U) << 17)); }
+
+  /**
+   * RDSEED.
+   */
+  constexpr UINT32 rdseed() const { return (Flags >> 18) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_rdseed(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x40000U) | ((value & 0x01U) << 18)); }
+
+  /**
+   * ADX.
+   */
+  constexpr UINT32 adx() const { return (Flags >> 19) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_adx(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x80000U) | ((value & 0x01U) << 19)); }
+
+  /**
+   * Supports Supervisor-Mode Access Prevention (and the CLAC/STAC instructions) if 1.
+   */
+  constexpr UINT32 smap() const { return (Flags >> 20) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_smap(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x100000U) | ((value & 0x01U) << 20)); }
+
+  /**
+   * AVX512_IFMA.
+   */
+  constexpr UINT32 avx512_ifma() const { return (Flags >> 21) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_avx512_ifma(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x200000U) | ((value & 0x01U) << 21)); }
+
+  /**
+   * CLFLUSHOPT.
+   */
+  constexpr UINT32 clflushopt() const { return (Flags >> 23) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_clflushopt(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x800000U) | ((value & 0x01U) << 23)); }
+
+  /**
+   * CLWB.
+   */
+  constexpr UINT32 clwb() const { return (Flags >> 24) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_clwb(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x1000000U) | ((value & 0x01U) << 24)); }
+
+  /**
+   * Intel Processor Trace.
+   */
+  constexpr UINT32 intel() const { return (Flags >> 25) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_intel(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x2000000U) | ((value & 0x01U) << 25)); }
+
+  /**
+   * (Intel(R) Xeon Phi(TM) only).
+   */
+  constexpr UINT32 avx512pf() const { return (Flags >> 26) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_avx512pf(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x4000000U) | ((value & 0x01U) << 26)); }
+
+  /**
+   * (Intel(R) Xeon Phi(TM) only).
+   */
+  constexpr UINT32 avx512er() const { return (Flags >> 27) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_avx512er(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x8000000U) | ((value & 0x01U) << 27)); }
+
+  /**
+   * AVX512CD.
+   */
+  constexpr UINT32 avx512cd() const { return (Flags >> 28) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_avx512cd(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x10000000U) | ((value & 0x01U) << 28)); }
+
+  /**
+   * Supports Intel(R) Secure Hash Algorithm Extensions (Intel(R) SHA Extensions) if 1.
+   */
+  constexpr UINT32 sha() const { return (Flags >> 29) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_sha(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x20000000U) | ((value & 0x01U) << 29)); }
+
+  /**
+   * AVX512BW.
+   */
+  constexpr UINT32 avx512bw() const { return (Flags >> 30) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_avx512bw(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x40000000U) | ((value & 0x01U) << 30)); }
+
+  /**
+   * AVX512VL.
+   */
+  constexpr UINT32 avx512vl() const { return (Flags >> 31) & 0x01U; }
+  constexpr CPUID_EAX_07_EBX with_avx512vl(UINT32 value) const { return CPUID_EAX_07_EBX((Flags & ~0x80000000U) | ((value & 0x01U) << 31)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_07_EBX) == 4, "Size of CPUID_EAX_07_EBX");
+
+class CPUID_EAX_07_ECX
+{
+public:
+  constexpr CPUID_EAX_07_ECX() = default;
+  constexpr explicit CPUID_EAX_07_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_07::Ecx)>
+  static constexpr CPUID_EAX_07_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_07_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_07_ECX&, const CPUID_EAX_07_ECX&) = default;
+
+  /**
+   * (Intel(R) Xeon Phi(TM) only).
+   */
+  constexpr UINT32 prefetchwt1() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_07_ECX with_prefetchwt1(UINT32 value) const { return CPUID_EAX_07_ECX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * AVX512_VBMI.
+   */
+  constexpr UINT32 avx512_vbmi() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_07_ECX with_avx512_vbmi(UINT32 value) const { return CPUID_EAX_07_ECX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * Supports user-mode instruction prevention if 1.
+   */
+  constexpr UINT32 umip() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_07_ECX with_umip(UINT32 value) const { return CPUID_EAX_07_ECX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * Supports protection keys for user-mode pages if 1.
+   */
+  constexpr UINT32 pku() const { return (Flags >> 3) & 0x01U; }
+  constexpr CPUID_EAX_07_ECX with_pku(UINT32 value) const { return CPUID_EAX_07_ECX((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+  /**
+   * If 1, OS has set CR4.PKE to enable protection keys (and the RDPKRU/WRPKRU instructions).
+   */
+  constexpr UINT32 ospke() const { return (Flags >> 4) & 0x01U; }
+  constexpr CPUID_EAX_07_ECX with_ospke(UINT32 value) const { return CPUID_EAX_07_ECX((Flags & ~0x10U) | ((value & 0x01U) << 4)); }
+
+  /**
+   * The value of MAWAU used by the BNDLDX and BNDSTX instructions in 64-bit mode.
+   */
+  constexpr UINT32 mawau() const { return (Flags >> 17) & 0x1FU; }
+  constexpr CPUID_EAX_07_ECX with_mawau(UINT32 value) const { return CPUID_EAX_07_ECX((Flags & ~0x3E0000U) | ((value & 0x1FU) << 17)); }
+
+  /**
+   * RDPID and IA32_TSC_AUX are available if 1.
+   */
+  constexpr UINT32 rdpid() const { return (Flags >> 22) & 0x01U; }
+  constexpr CPUID_EAX_07_ECX with_rdpid(UINT32 value) const { return CPUID_EAX_07_ECX((Flags & ~0x400000U) | ((value & 0x01U) << 22)); }
+
+  /**
+   * Supports SGX Launch Configuration if 1.
+   */
+  constexpr UINT32 sgx_lc() const { return (Flags >> 30) & 0x01U; }
+  constexpr CPUID_EAX_07_ECX with_sgx_lc(UINT32 value) const { return CPUID_EAX_07_ECX((Flags & ~0x40000000U) | ((value & 0x01U) << 30)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_07_ECX) == 4, "Size of CPUID_EAX_07_ECX");
+
+class CPUID_EAX_07_EDX
+{
+public:
+  constexpr CPUID_EAX_07_EDX() = default;
+  constexpr explicit CPUID_EAX_07_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_07::Edx)>
+  static constexpr CPUID_EAX_07_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_07_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_07_EDX&, const CPUID_EAX_07_EDX&) = default;
+
+  /**
+   * EDX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_07_EDX with_reserved(UINT32 value) const { return CPUID_EAX_07_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_07_EDX) == 4, "Size of CPUID_EAX_07_EDX");
+
+class CPUID_EAX_09_EAX
+{
+public:
+  constexpr CPUID_EAX_09_EAX() = default;
+  constexpr explicit CPUID_EAX_09_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_09::Eax)>
+  static constexpr CPUID_EAX_09_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_09_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_09_EAX&, const CPUID_EAX_09_EAX&) = default;
+
+  /**
+   * Value of bits [31:0] of IA32_PLATFORM_DCA_CAP MSR (address 1F8H).
+   */
+  constexpr UINT32 ia32_platform_dca_cap() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_09_EAX with_ia32_platform_dca_cap(UINT32 value) const { return CPUID_EAX_09_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_09_EAX) == 4, "Size of CPUID_EAX_09_EAX");
+
+class CPUID_EAX_09_EBX
+{
+public:
+  constexpr CPUID_EAX_09_EBX() = default;
+  constexpr explicit CPUID_EAX_09_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_09::Ebx)>
+  static constexpr CPUID_EAX_09_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_09_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_09_EBX&, const CPUID_EAX_09_EBX&) = default;
+
+  /**
+   * EBX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_09_EBX with_reserved(UINT32 value) const { return CPUID_EAX_09_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_09_EBX) == 4, "Size of CPUID_EAX_09_EBX");
+
+class CPUID_EAX_09_ECX
+{
+public:
+  constexpr CPUID_EAX_09_ECX() = default;
+  constexpr explicit CPUID_EAX_09_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_09::Ecx)>
+  static constexpr CPUID_EAX_09_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_09_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_09_ECX&, const CPUID_EAX_09_ECX&) = default;
+
+  /**
+   * ECX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_09_ECX with_reserved(UINT32 value) const { return CPUID_EAX_09_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_09_ECX) == 4, "Size of CPUID_EAX_09_ECX");
+
+class CPUID_EAX_09_EDX
+{
+public:
+  constexpr CPUID_EAX_09_EDX() = default;
+  constexpr explicit CPUID_EAX_09_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_09::Edx)>
+  static constexpr CPUID_EAX_09_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_09_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_09_EDX&, const CPUID_EAX_09_EDX&) = default;
+
+  /**
+   * EDX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_09_EDX with_reserved(UINT32 value) const { return CPUID_EAX_09_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_09_EDX) == 4, "Size of CPUID_EAX_09_EDX");
+
+class CPUID_EAX_0A_EAX
+{
+public:
+  constexpr CPUID_EAX_0A_EAX() = default;
+  constexpr explicit CPUID_EAX_0A_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0A::Eax)>
+  static constexpr CPUID_EAX_0A_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_0A_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0A_EAX&, const CPUID_EAX_0A_EAX&) = default;
+
+  /**
+   * Version ID of architectural performance monitoring.
+   */
+  constexpr UINT32 version_id_of_architectural_performance_monitoring() const { return (Flags >> 0) & 0xFFU; }
+  constexpr CPUID_EAX_0A_EAX with_version_id_of_architectural_performance_monitoring(UINT32 value) const { return CPUID_EAX_0A_EAX((Flags & ~0xFFU) | ((value & 0xFFU) << 0)); }
+
+  /**
+   * Number of general-purpose performance monitoring counter per logical processor.
+   */
+  constexpr UINT32 number_of_performance_monitoring_counter_per_logical_processor() const { return (Flags >> 8) & 0xFFU; }
+  constexpr CPUID_EAX_0A_EAX with_number_of_performance_monitoring_counter_per_logical_processor(UINT32 value) const { return CPUID_EAX_0A_EAX((Flags & ~0xFF00U) | ((value & 0xFFU) << 8)); }
+
+  /**
+   * Bit width of general-purpose, performance monitoring counter.
+   */
+  constexpr UINT32 bit_width_of_performance_monitoring_counter() const { return (Flags >> 16) & 0xFFU; }
+  constexpr CPUID_EAX_0A_EAX with_bit_width_of_performance_monitoring_counter(UINT32 value) const { return CPUID_EAX_0A_EAX((Flags & ~0xFF0000U) | ((value & 0xFFU) << 16)); }
+
+  /**
+   * Length of EBX bit vector to enumerate architectural performance monitoring events.
+   */
+  constexpr UINT32 ebx_bit_vector_length() const { return (Flags >> 24) & 0xFFU; }
+  constexpr CPUID_EAX_0A_EAX with_ebx_bit_vector_length(UINT32 value) const { return CPUID_EAX_0A_EAX((Flags & ~0xFF000000U) | ((value & 0xFFU) << 24)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0A_EAX) == 4, "Size of CPUID_EAX_0A_EAX");
+
+class CPUID_EAX_0A_EBX
+{
+public:
+  constexpr CPUID_EAX_0A_EBX() = default;
+  constexpr explicit CPUID_EAX_0A_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0A::Ebx)>
+  static constexpr CPUID_EAX_0A_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_0A_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0A_EBX&, const CPUID_EAX_0A_EBX&) = default;
+
+  /**
+   * Core cycle event not available if 1.
+   */
+  constexpr UINT32 core_cycle_event_not_available() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_0A_EBX with_core_cycle_event_not_available(UINT32 value) const { return CPUID_EAX_0A_EBX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * Instruction retired event not available if 1.
+   */
+  constexpr UINT32 instruction_retired_event_not_available() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_0A_EBX with_instruction_retired_event_not_available(UINT32 value) const { return CPUID_EAX_0A_EBX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * Reference cycles event not available if 1.
+   */
+  constexpr UINT32 reference_cycles_event_not_available() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_0A_EBX with_reference_cycles_event_not_available(UINT32 value) const { return CPUID_EAX_0A_EBX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * Last-level cache reference event not available if 1.
+   */
+  constexpr UINT32 last_level_cache_reference_event_not_available() const { return (Flags >> 3) & 0x01U; }
+  constexpr CPUID_EAX_0A_EBX with_last_level_cache_reference_event_not_available(UINT32 value) const { return CPUID_EAX_0A_EBX((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+  /**
+   * Last-level cache misses event not available if 1.
+   */
+  constexpr UINT32 last_level_cache_misses_event_not_available() const { return (Flags >> 4) & 0x01U; }
+  constexpr CPUID_EAX_0A_EBX with_last_level_cache_misses_event_not_available(UINT32 value) const { return CPUID_EAX_0A_EBX((Flags & ~0x10U) | ((value & 0x01U) << 4)); }
+
+  /**
+   * Branch instruction retired event not available if 1.
+   */
+  constexpr UINT32 branch_instruction_retired_event_not_available() const { return (Flags >> 5) & 0x01U; }
+  constexpr CPUID_EAX_0A_EBX with_branch_instruction_retired_event_not_available(UINT32 value) const { return CPUID_EAX_0A_EBX((Flags & ~0x20U) | ((value & 0x01U) << 5)); }
+
+  /**
+   * Branch mispredict retired event not available if 1.
+   */
+  constexpr UINT32 branch_mispredict_retired_event_not_available() const { return (Flags >> 6) & 0x01U; }
+  constexpr CPUID_EAX_0A_EBX with_branch_mispredict_retired_event_not_available(UINT32 value) const { return CPUID_EAX_0A_EBX((Flags & ~0x40U) | ((value & 0x01U) << 6)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0A_EBX) == 4, "Size of CPUID_EAX_0A_EBX");
+
+class CPUID_EAX_0A_ECX
+{
+public:
+  constexpr CPUID_EAX_0A_ECX() = default;
+  constexpr explicit CPUID_EAX_0A_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0A::Ecx)>
+  static constexpr CPUID_EAX_0A_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_0A_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0A_ECX&, const CPUID_EAX_0A_ECX&) = default;
+
+  /**
+   * ECX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0A_ECX with_reserved(UINT32 value) const { return CPUID_EAX_0A_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0A_ECX) == 4, "Size of CPUID_EAX_0A_ECX");
+
+class CPUID_EAX_0A_EDX
+{
+public:
+  constexpr CPUID_EAX_0A_EDX() = default;
+  constexpr explicit CPUID_EAX_0A_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0A::Edx)>
+  static constexpr CPUID_EAX_0A_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_0A_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0A_EDX&, const CPUID_EAX_0A_EDX&) = default;
+
+  /**
+   * Number of fixed-function performance counters (if Version ID > 1).
+   */
+  constexpr UINT32 number_of_fixed_function_performance_counters() const { return (Flags >> 0) & 0x1FU; }
+  constexpr CPUID_EAX_0A_EDX with_number_of_fixed_function_performance_counters(UINT32 value) const { return CPUID_EAX_0A_EDX((Flags & ~0x1FU) | ((value & 0x1FU) << 0)); }
+
+  /**
+   * Bit width of fixed-function performance counters (if Version ID > 1).
+   */
+  constexpr UINT32 bit_width_of_fixed_function_performance_counters() const { return (Flags >> 5) & 0xFFU; }
+  constexpr CPUID_EAX_0A_EDX with_bit_width_of_fixed_function_performance_counters(UINT32 value) const { return CPUID_EAX_0A_EDX((Flags & ~0x1FE0U) | ((value & 0xFFU) << 5)); }
+
+  /**
+   * AnyThread deprecation.
+   */
+  constexpr UINT32 any_thread_deprecation() const { return (Flags >> 15) & 0x01U; }
+  constexpr CPUID_EAX_0A_EDX with_any_thread_deprecation(UINT32 value) const { return CPUID_EAX_0A_EDX((Flags & ~0x8000U) | ((value & 0x01U) << 15)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0A_EDX) == 4, "Size of CPUID_EAX_0A_EDX");
+
+class CPUID_EAX_0B_EAX
+{
+public:
+  constexpr CPUID_EAX_0B_EAX() = default;
+  constexpr explicit CPUID_EAX_0B_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0B::Eax)>
+  static constexpr CPUID_EAX_0B_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_0B_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0B_EAX&, const CPUID_EAX_0B_EAX&) = default;
+
+  /**
+   * Number of bits to shift right on x2APIC ID to get a unique topology ID of the next level type. All logical processors
+   * with the same next level ID share current level.
+   */
+  constexpr UINT32 x2apic_id_to_unique_topology_id_shift() const { return (Flags >> 0) & 0x1FU; }
+  constexpr CPUID_EAX_0B_EAX with_x2apic_id_to_unique_topology_id_shift(UINT32 value) const { return CPUID_EAX_0B_EAX((Flags & ~0x1FU) | ((value & 0x1FU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0B_EAX) == 4, "Size of CPUID_EAX_0B_EAX");
+
+class CPUID_EAX_0B_EBX
+{
+public:
+  constexpr CPUID_EAX_0B_EBX() = default;
+  constexpr explicit CPUID_EAX_0B_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0B::Ebx)>
+  static constexpr CPUID_EAX_0B_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_0B_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0B_EBX&, const CPUID_EAX_0B_EBX&) = default;
+
+  /**
+   * Number of logical processors at this level type. The number reflects configuration as shipped by Intel.
+   */
+  constexpr UINT32 number_of_logical_processors_at_this_level_type() const { return (Flags >> 0) & 0xFFFFU; }
+  constexpr CPUID_EAX_0B_EBX with_number_of_logical_processors_at_this_level_type(UINT32 value) const { return CPUID_EAX_0B_EBX((Flags & ~0xFFFFU) | ((value & 0xFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0B_EBX) == 4, "Size of CPUID_EAX_0B_EBX");
+
+class CPUID_EAX_0B_ECX
+{
+public:
+  constexpr CPUID_EAX_0B_ECX() = default;
+  constexpr explicit CPUID_EAX_0B_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0B::Ecx)>
+  static constexpr CPUID_EAX_0B_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_0B_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0B_ECX&, const CPUID_EAX_0B_ECX&) = default;
+
+  /**
+   * Level number. Same value in ECX input.
+   */
+  constexpr UINT32 level_number() const { return (Flags >> 0) & 0xFFU; }
+  constexpr CPUID_EAX_0B_ECX with_level_number(UINT32 value) const { return CPUID_EAX_0B_ECX((Flags & ~0xFFU) | ((value & 0xFFU) << 0)); }
+
+  /**
+   * Level type.
+   */
+  constexpr UINT32 level_type() const { return (Flags >> 8) & 0xFFU; }
+  constexpr CPUID_EAX_0B_ECX with_level_type(UINT32 value) const { return CPUID_EAX_0B_ECX((Flags & ~0xFF00U) | ((value & 0xFFU) << 8)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0B_ECX) == 4, "Size of CPUID_EAX_0B_ECX");
+
+class CPUID_EAX_0B_EDX
+{
+public:
+  constexpr CPUID_EAX_0B_EDX() = default;
+  constexpr explicit CPUID_EAX_0B_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0B::Edx)>
+  static constexpr CPUID_EAX_0B_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_0B_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0B_EDX&, const CPUID_EAX_0B_EDX&) = default;
+
+  /**
+   * x2APIC ID the current logical processor.
+   */
+  constexpr UINT32 x2apic_id() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0B_EDX with_x2apic_id(UINT32 value) const { return CPUID_EAX_0B_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0B_EDX) == 4, "Size of CPUID_EAX_0B_EDX");
+
+/**
+ * @brief Reports the supported bits of the lower 32 bits of XCR0. XCR0[n] can be set to 1 only if EAX[n] is 1
+ */
+class CPUID_EAX_0D_ECX_00_EAX
+{
+public:
+  constexpr CPUID_EAX_0D_ECX_00_EAX() = default;
+  constexpr explicit CPUID_EAX_0D_ECX_00_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0D_ECX_00::Eax)>
+  static constexpr CPUID_EAX_0D_ECX_00_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_0D_ECX_00_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0D_ECX_00_EAX&, const CPUID_EAX_0D_ECX_00_EAX&) = default;
+
+  /**
+   * x87 state.
+   */
+  constexpr UINT32 x87_state() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_00_EAX with_x87_state(UINT32 value) const { return CPUID_EAX_0D_ECX_00_EAX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * SSE state.
+   */
+  constexpr UINT32 sse_state() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_00_EAX with_sse_state(UINT32 value) const { return CPUID_EAX_0D_ECX_00_EAX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * AVX state.
+   */
+  constexpr UINT32 avx_state() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_00_EAX with_avx_state(UINT32 value) const { return CPUID_EAX_0D_ECX_00_EAX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * MPX state.
+   */
+  constexpr UINT32 mpx_state() const { return (Flags >> 3) & 0x03U; }
+  constexpr CPUID_EAX_0D_ECX_00_EAX with_mpx_state(UINT32 value) const { return CPUID_EAX_0D_ECX_00_EAX((Flags & ~0x18U) | ((value & 0x03U) << 3)); }
+
+  /**
+   * AVX-512 state.
+   */
+  constexpr UINT32 avx_512_state() const { return (Flags >> 5) & 0x07U; }
+  constexpr CPUID_EAX_0D_ECX_00_EAX with_avx_512_state(UINT32 value) const { return CPUID_EAX_0D_ECX_00_EAX((Flags & ~0xE0U) | ((value & 0x07U) << 5)); }
+
+  /**
+   * Used for IA32_XSS.
+   */
+  constexpr UINT32 used_for_ia32_xss_1() const { return (Flags >> 8) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_00_EAX with_used_for_ia32_xss_1(UINT32 value) const { return CPUID_EAX_0D_ECX_00_EAX((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+  /**
+   * PKRU state.
+   */
+  constexpr UINT32 pkru_state() const { return (Flags >> 9) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_00_EAX with_pkru_state(UINT32 value) const { return CPUID_EAX_0D_ECX_00_EAX((Flags & ~0x200U) | ((value & 0x01U) << 9)); }
+
+  /**
+   * Used for IA32_XSS.
+   */
+  constexpr UINT32 used_for_ia32_xss_2() const { return (Flags >> 13) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_00_EAX with_used_for_ia32_xss_2(UINT32 value) const { return CPUID_EAX_0D_ECX_00_EAX((Flags & ~0x2000U) | ((value & 0x01U) << 13)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0D_ECX_00_EAX) == 4, "Size of CPUID_EAX_0D_ECX_00_EAX");
+
+class CPUID_EAX_0D_ECX_00_EBX
+{
+public:
+  constexpr CPUID_EAX_0D_ECX_00_EBX() = default;
+  constexpr explicit CPUID_EAX_0D_ECX_00_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0D_ECX_00::Ebx)>
+  static constexpr CPUID_EAX_0D_ECX_00_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_0D_ECX_00_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0D_ECX_00_EBX&, const CPUID_EAX_0D_ECX_00_EBX&) = default;
+
+  /**
+   * Maximum size (bytes, from the beginning of the XSAVE/XRSTOR save area) required by enabled features in XCR0. May be
+   * different than ECX if some features at the end of the XSAVE save area are not enabled.
+   */
+  constexpr UINT32 max_size_required_by_enabled_features_in_xcr0() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0D_ECX_00_EBX with_max_size_required_by_enabled_features_in_xcr0(UINT32 value) const { return CPUID_EAX_0D_ECX_00_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0D_ECX_00_EBX) == 4, "Size of CPUID_EAX_0D_ECX_00_EBX");
+
+class CPUID_EAX_0D_ECX_00_ECX
+{
+public:
+  constexpr CPUID_EAX_0D_ECX_00_ECX() = default;
+  constexpr explicit CPUID_EAX_0D_ECX_00_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0D_ECX_00::Ecx)>
+  static constexpr CPUID_EAX_0D_ECX_00_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_0D_ECX_00_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0D_ECX_00_ECX&, const CPUID_EAX_0D_ECX_00_ECX&) = default;
+
+  /**
+   * Maximum size (bytes, from the beginning of the XSAVE/XRSTOR save area) of the XSAVE/XRSTOR save area required by all
+   * supported features in the processor, i.e., all the valid bit fields in XCR0.
+   */
+  constexpr UINT32 max_size_of_xsave_xrstor_save_area() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0D_ECX_00_ECX with_max_size_of_xsave_xrstor_save_area(UINT32 value) const { return CPUID_EAX_0D_ECX_00_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0D_ECX_00_ECX) == 4, "Size of CPUID_EAX_0D_ECX_00_ECX");
+
+class CPUID_EAX_0D_ECX_00_EDX
+{
+public:
+  constexpr CPUID_EAX_0D_ECX_00_EDX() = default;
+  constexpr explicit CPUID_EAX_0D_ECX_00_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0D_ECX_00::Edx)>
+  static constexpr CPUID_EAX_0D_ECX_00_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_0D_ECX_00_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0D_ECX_00_EDX&, const CPUID_EAX_0D_ECX_00_EDX&) = default;
+
+  /**
+   * Reports the supported bits of the upper 32 bits of XCR0. XCR0[n+32] can be set to 1 only if EDX[n] is 1.
+   */
+  constexpr UINT32 xcr0_supported_bits() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0D_ECX_00_EDX with_xcr0_supported_bits(UINT32 value) const { return CPUID_EAX_0D_ECX_00_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0D_ECX_00_EDX) == 4, "Size of CPUID_EAX_0D_ECX_00_EDX");
+
+class CPUID_EAX_0D_ECX_01_EAX
+{
+public:
+  constexpr CPUID_EAX_0D_ECX_01_EAX() = default;
+  constexpr explicit CPUID_EAX_0D_ECX_01_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0D_ECX_01::Eax)>
+  static constexpr CPUID_EAX_0D_ECX_01_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_0D_ECX_01_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0D_ECX_01_EAX&, const CPUID_EAX_0D_ECX_01_EAX&) = default;
+
+  /**
+   * Supports XSAVEC and the compacted form of XRSTOR if set.
+   */
+  constexpr UINT32 supports_xsavec_and_compacted_xrstor() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_01_EAX with_supports_xsavec_and_compacted_xrstor(UINT32 value) const { return CPUID_EAX_0D_ECX_01_EAX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * Supports XGETBV with ECX = 1 if set.
+   */
+  constexpr UINT32 supports_xgetbv_with_ecx_1() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_01_EAX with_supports_xgetbv_with_ecx_1(UINT32 value) const { return CPUID_EAX_0D_ECX_01_EAX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * Supports XSAVES/XRSTORS and IA32_XSS if set.
+   */
+  constexpr UINT32 supports_xsave_xrstor_and_ia32_xss() const { return (Flags >> 3) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_01_EAX with_supports_xsave_xrstor_and_ia32_xss(UINT32 value) const { return CPUID_EAX_0D_ECX_01_EAX((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0D_ECX_01_EAX) == 4, "Size of CPUID_EAX_0D_ECX_01_EAX");
+
+class CPUID_EAX_0D_ECX_01_EBX
+{
+public:
+  constexpr CPUID_EAX_0D_ECX_01_EBX() = default;
+  constexpr explicit CPUID_EAX_0D_ECX_01_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0D_ECX_01::Ebx)>
+  static constexpr CPUID_EAX_0D_ECX_01_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_0D_ECX_01_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0D_ECX_01_EBX&, const CPUID_EAX_0D_ECX_01_EBX&) = default;
+
+  /**
+   * The size in bytes of the XSAVE area containing all states enabled by XCRO | IA32_XSS.
+   */
+  constexpr UINT32 size_of_xsave_aread() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0D_ECX_01_EBX with_size_of_xsave_aread(UINT32 value) const { return CPUID_EAX_0D_ECX_01_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0D_ECX_01_EBX) == 4, "Size of CPUID_EAX_0D_ECX_01_EBX");
+
+class CPUID_EAX_0D_ECX_01_ECX
+{
+public:
+  constexpr CPUID_EAX_0D_ECX_01_ECX() = default;
+  constexpr explicit CPUID_EAX_0D_ECX_01_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0D_ECX_01::Ecx)>
+  static constexpr CPUID_EAX_0D_ECX_01_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_0D_ECX_01_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0D_ECX_01_ECX&, const CPUID_EAX_0D_ECX_01_ECX&) = default;
+
+  /**
+   * Used for XCR0.
+   */
+  constexpr UINT32 used_for_xcr0_1() const { return (Flags >> 0) & 0xFFU; }
+  constexpr CPUID_EAX_0D_ECX_01_ECX with_used_for_xcr0_1(UINT32 value) const { return CPUID_EAX_0D_ECX_01_ECX((Flags & ~0xFFU) | ((value & 0xFFU) << 0)); }
+
+  /**
+   * PT state.
+   */
+  constexpr UINT32 pt_state() const { return (Flags >> 8) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_01_ECX with_pt_state(UINT32 value) const { return CPUID_EAX_0D_ECX_01_ECX((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+  /**
+   * Used for XCR0.
+   */
+  constexpr UINT32 used_for_xcr0_2() const { return (Flags >> 9) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_01_ECX with_used_for_xcr0_2(UINT32 value) const { return CPUID_EAX_0D_ECX_01_ECX((Flags & ~0x200U) | ((value & 0x01U) << 9)); }
+
+  /**
+   * HWP state.
+   */
+  constexpr UINT32 hwp_state() const { return (Flags >> 13) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_01_ECX with_hwp_state(UINT32 value) const { return CPUID_EAX_0D_ECX_01_ECX((Flags & ~0x2000U) | ((value & 0x01U) << 13)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0D_ECX_01_ECX) == 4, "Size of CPUID_EAX_0D_ECX_01_ECX");
+
+class CPUID_EAX_0D_ECX_01_EDX
+{
+public:
+  constexpr CPUID_EAX_0D_ECX_01_EDX() = default;
+  constexpr explicit CPUID_EAX_0D_ECX_01_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0D_ECX_01::Edx)>
+  static constexpr CPUID_EAX_0D_ECX_01_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_0D_ECX_01_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0D_ECX_01_EDX&, const CPUID_EAX_0D_ECX_01_EDX&) = default;
+
+  /**
+   * EDX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0D_ECX_01_EDX with_reserved(UINT32 value) const { return CPUID_EAX_0D_ECX_01_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0D_ECX_01_EDX) == 4, "Size of CPUID_EAX_0D_ECX_01_EDX");
+
+class CPUID_EAX_0D_ECX_N_EAX
+{
+public:
+  constexpr CPUID_EAX_0D_ECX_N_EAX() = default;
+  constexpr explicit CPUID_EAX_0D_ECX_N_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0D_ECX_N::Eax)>
+  static constexpr CPUID_EAX_0D_ECX_N_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_0D_ECX_N_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0D_ECX_N_EAX&, const CPUID_EAX_0D_ECX_N_EAX&) = default;
+
+  /**
+   * The size in bytes (from the offset specified in EBX) of the save area for an extended state feature associated with a
+   * valid sub-leaf index, n.
+   */
+  constexpr UINT32 ia32_platform_dca_cap() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0D_ECX_N_EAX with_ia32_platform_dca_cap(UINT32 value) const { return CPUID_EAX_0D_ECX_N_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0D_ECX_N_EAX) == 4, "Size of CPUID_EAX_0D_ECX_N_EAX");
+
+class CPUID_EAX_0D_ECX_N_EBX
+{
+public:
+  constexpr CPUID_EAX_0D_ECX_N_EBX() = default;
+  constexpr explicit CPUID_EAX_0D_ECX_N_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0D_ECX_N::Ebx)>
+  static constexpr CPUID_EAX_0D_ECX_N_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_0D_ECX_N_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0D_ECX_N_EBX&, const CPUID_EAX_0D_ECX_N_EBX&) = default;
+
+  /**
+   * The offset in bytes of this extended state component's save area from the beginning of the XSAVE/XRSTOR area.
+   * This field reports 0 if the sub-leaf index, n, does not map to a valid bit in the XCR0 register.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0D_ECX_N_EBX with_reserved(UINT32 value) const { return CPUID_EAX_0D_ECX_N_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0D_ECX_N_EBX) == 4, "Size of CPUID_EAX_0D_ECX_N_EBX");
+
+class CPUID_EAX_0D_ECX_N_ECX
+{
+public:
+  constexpr CPUID_EAX_0D_ECX_N_ECX() = default;
+  constexpr explicit CPUID_EAX_0D_ECX_N_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0D_ECX_N::Ecx)>
+  static constexpr CPUID_EAX_0D_ECX_N_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_0D_ECX_N_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0D_ECX_N_ECX&, const CPUID_EAX_0D_ECX_N_ECX&) = default;
+
+  /**
+   * Is set if the bit n (corresponding to the sub-leaf index) is supported in the IA32_XSS MSR; it is clear if bit n is
+   * instead supported in XCR0.
+   */
+  constexpr UINT32 ecx_2() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_N_ECX with_ecx_2(UINT32 value) const { return CPUID_EAX_0D_ECX_N_ECX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * Is set if, when the compacted format of an XSAVE area is used, this extended state component located on the next 64-byte
+   * boundary following the preceding state component (otherwise, it is located immediately following the preceding state
+   * component).
+   */
+  constexpr UINT32 ecx_1() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_0D_ECX_N_ECX with_ecx_1(UINT32 value) const { return CPUID_EAX_0D_ECX_N_ECX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0D_ECX_N_ECX) == 4, "Size of CPUID_EAX_0D_ECX_N_ECX");
+
+class CPUID_EAX_0D_ECX_N_EDX
+{
+public:
+  constexpr CPUID_EAX_0D_ECX_N_EDX() = default;
+  constexpr explicit CPUID_EAX_0D_ECX_N_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0D_ECX_N::Edx)>
+  static constexpr CPUID_EAX_0D_ECX_N_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_0D_ECX_N_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0D_ECX_N_EDX&, const CPUID_EAX_0D_ECX_N_EDX&) = default;
+
+  /**
+   * This field reports 0 if the sub-leaf index, n, is invalid; otherwise it is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0D_ECX_N_EDX with_reserved(UINT32 value) const { return CPUID_EAX_0D_ECX_N_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0D_ECX_N_EDX) == 4, "Size of CPUID_EAX_0D_ECX_N_EDX");
+
+class CPUID_EAX_0F_ECX_00_EAX
+{
+public:
+  constexpr CPUID_EAX_0F_ECX_00_EAX() = default;
+  constexpr explicit CPUID_EAX_0F_ECX_00_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0F_ECX_00::Eax)>
+  static constexpr CPUID_EAX_0F_ECX_00_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_0F_ECX_00_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0F_ECX_00_EAX&, const CPUID_EAX_0F_ECX_00_EAX&) = default;
+
+  /**
+   * EAX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0F_ECX_00_EAX with_reserved(UINT32 value) const { return CPUID_EAX_0F_ECX_00_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0F_ECX_00_EAX) == 4, "Size of CPUID_EAX_0F_ECX_00_EAX");
+
+class CPUID_EAX_0F_ECX_00_EBX
+{
+public:
+  constexpr CPUID_EAX_0F_ECX_00_EBX() = default;
+  constexpr explicit CPUID_EAX_0F_ECX_00_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0F_ECX_00::Ebx)>
+  static constexpr CPUID_EAX_0F_ECX_00_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_0F_ECX_00_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0F_ECX_00_EBX&, const CPUID_EAX_0F_ECX_00_EBX&) = default;
+
+  /**
+   * Maximum range (zero-based) of RMID within this physical processor of all types.
+   */
+  constexpr UINT32 rmid_max_range() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0F_ECX_00_EBX with_rmid_max_range(UINT32 value) const { return CPUID_EAX_0F_ECX_00_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0F_ECX_00_EBX) == 4, "Size of CPUID_EAX_0F_ECX_00_EBX");
+
+class CPUID_EAX_0F_ECX_00_ECX
+{
+public:
+  constexpr CPUID_EAX_0F_ECX_00_ECX() = default;
+  constexpr explicit CPUID_EAX_0F_ECX_00_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0F_ECX_00::Ecx)>
+  static constexpr CPUID_EAX_0F_ECX_00_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_0F_ECX_00_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0F_ECX_00_ECX&, const CPUID_EAX_0F_ECX_00_ECX&) = default;
+
+  /**
+   * ECX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0F_ECX_00_ECX with_reserved(UINT32 value) const { return CPUID_EAX_0F_ECX_00_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0F_ECX_00_ECX) == 4, "Size of CPUID_EAX_0F_ECX_00_ECX");
+
+class CPUID_EAX_0F_ECX_00_EDX
+{
+public:
+  constexpr CPUID_EAX_0F_ECX_00_EDX() = default;
+  constexpr explicit CPUID_EAX_0F_ECX_00_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0F_ECX_00::Edx)>
+  static constexpr CPUID_EAX_0F_ECX_00_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_0F_ECX_00_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0F_ECX_00_EDX&, const CPUID_EAX_0F_ECX_00_EDX&) = default;
+
+  /**
+   * Supports L3 Cache Intel RDT Monitoring if 1.
+   */
+  constexpr UINT32 supports_l3_cache_intel_rdt_monitoring() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_0F_ECX_00_EDX with_supports_l3_cache_intel_rdt_monitoring(UINT32 value) const { return CPUID_EAX_0F_ECX_00_EDX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0F_ECX_00_EDX) == 4, "Size of CPUID_EAX_0F_ECX_00_EDX");
+
+class CPUID_EAX_0F_ECX_01_EAX
+{
+public:
+  constexpr CPUID_EAX_0F_ECX_01_EAX() = default;
+  constexpr explicit CPUID_EAX_0F_ECX_01_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0F_ECX_01::Eax)>
+  static constexpr CPUID_EAX_0F_ECX_01_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_0F_ECX_01_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0F_ECX_01_EAX&, const CPUID_EAX_0F_ECX_01_EAX&) = default;
+
+  /**
+   * EAX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0F_ECX_01_EAX with_reserved(UINT32 value) const { return CPUID_EAX_0F_ECX_01_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0F_ECX_01_EAX) == 4, "Size of CPUID_EAX_0F_ECX_01_EAX");
+
+class CPUID_EAX_0F_ECX_01_EBX
+{
+public:
+  constexpr CPUID_EAX_0F_ECX_01_EBX() = default;
+  constexpr explicit CPUID_EAX_0F_ECX_01_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0F_ECX_01::Ebx)>
+  static constexpr CPUID_EAX_0F_ECX_01_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_0F_ECX_01_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0F_ECX_01_EBX&, const CPUID_EAX_0F_ECX_01_EBX&) = default;
+
+  /**
+   * Conversion factor from reported IA32_QM_CTR value to occupancy metric (bytes).
+   */
+  constexpr UINT32 conversion_factor() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0F_ECX_01_EBX with_conversion_factor(UINT32 value) const { return CPUID_EAX_0F_ECX_01_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0F_ECX_01_EBX) == 4, "Size of CPUID_EAX_0F_ECX_01_EBX");
+
+class CPUID_EAX_0F_ECX_01_ECX
+{
+public:
+  constexpr CPUID_EAX_0F_ECX_01_ECX() = default;
+  constexpr explicit CPUID_EAX_0F_ECX_01_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0F_ECX_01::Ecx)>
+  static constexpr CPUID_EAX_0F_ECX_01_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_0F_ECX_01_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0F_ECX_01_ECX&, const CPUID_EAX_0F_ECX_01_ECX&) = default;
+
+  /**
+   * Maximum range (zero-based) of RMID within this physical processor of all types.
+   */
+  constexpr UINT32 rmid_max_range() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_0F_ECX_01_ECX with_rmid_max_range(UINT32 value) const { return CPUID_EAX_0F_ECX_01_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0F_ECX_01_ECX) == 4, "Size of CPUID_EAX_0F_ECX_01_ECX");
+
+class CPUID_EAX_0F_ECX_01_EDX
+{
+public:
+  constexpr CPUID_EAX_0F_ECX_01_EDX() = default;
+  constexpr explicit CPUID_EAX_0F_ECX_01_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_0F_ECX_01::Edx)>
+  static constexpr CPUID_EAX_0F_ECX_01_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_0F_ECX_01_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_0F_ECX_01_EDX&, const CPUID_EAX_0F_ECX_01_EDX&) = default;
+
+  /**
+   * Supports L3 occupancy monitoring if 1.
+   */
+  constexpr UINT32 supports_l3_occupancy_monitoring() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_0F_ECX_01_EDX with_supports_l3_occupancy_monitoring(UINT32 value) const { return CPUID_EAX_0F_ECX_01_EDX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * Supports L3 Total Bandwidth monitoring if 1.
+   */
+  constexpr UINT32 supports_l3_total_bandwidth_monitoring() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_0F_ECX_01_EDX with_supports_l3_total_bandwidth_monitoring(UINT32 value) const { return CPUID_EAX_0F_ECX_01_EDX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * Supports L3 Local Bandwidth monitoring if 1.
+   */
+  constexpr UINT32 supports_l3_local_bandwidth_monitoring() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_0F_ECX_01_EDX with_supports_l3_local_bandwidth_monitoring(UINT32 value) const { return CPUID_EAX_0F_ECX_01_EDX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_0F_ECX_01_EDX) == 4, "Size of CPUID_EAX_0F_ECX_01_EDX");
+
+class CPUID_EAX_10_ECX_00_EAX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_00_EAX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_00_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_00::Eax)>
+  static constexpr CPUID_EAX_10_ECX_00_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_00_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_00_EAX&, const CPUID_EAX_10_ECX_00_EAX&) = default;
+
+  /**
+   * Value of bits [31:0] of IA32_PLATFORM_DCA_CAP MSR (address 1F8H).
+   */
+  constexpr UINT32 ia32_platform_dca_cap() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_10_ECX_00_EAX with_ia32_platform_dca_cap(UINT32 value) const { return CPUID_EAX_10_ECX_00_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_00_EAX) == 4, "Size of CPUID_EAX_10_ECX_00_EAX");
+
+class CPUID_EAX_10_ECX_00_EBX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_00_EBX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_00_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_00::Ebx)>
+  static constexpr CPUID_EAX_10_ECX_00_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_00_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_00_EBX&, const CPUID_EAX_10_ECX_00_EBX&) = default;
+
+  /**
+   * Supports L3 Cache Allocation Technology if 1.
+   */
+  constexpr UINT32 supports_l3_cache_allocation_technology() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_10_ECX_00_EBX with_supports_l3_cache_allocation_technology(UINT32 value) const { return CPUID_EAX_10_ECX_00_EBX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * Supports L2 Cache Allocation Technology if 1.
+   */
+  constexpr UINT32 supports_l2_cache_allocation_technology() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_10_ECX_00_EBX with_supports_l2_cache_allocation_technology(UINT32 value) const { return CPUID_EAX_10_ECX_00_EBX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * Supports Memory Bandwidth Allocation if 1.
+   */
+  constexpr UINT32 supports_memory_bandwidth_allocation() const { return (Flags >> 3) & 0x01U; }
+  constexpr CPUID_EAX_10_ECX_00_EBX with_supports_memory_bandwidth_allocation(UINT32 value) const { return CPUID_EAX_10_ECX_00_EBX((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_00_EBX) == 4, "Size of CPUID_EAX_10_ECX_00_EBX");
+
+class CPUID_EAX_10_ECX_00_ECX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_00_ECX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_00_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_00::Ecx)>
+  static constexpr CPUID_EAX_10_ECX_00_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_00_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_00_ECX&, const CPUID_EAX_10_ECX_00_ECX&) = default;
+
+  /**
+   * ECX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_10_ECX_00_ECX with_reserved(UINT32 value) const { return CPUID_EAX_10_ECX_00_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_00_ECX) == 4, "Size of CPUID_EAX_10_ECX_00_ECX");
+
+class CPUID_EAX_10_ECX_00_EDX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_00_EDX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_00_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_00::Edx)>
+  static constexpr CPUID_EAX_10_ECX_00_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_00_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_00_EDX&, const CPUID_EAX_10_ECX_00_EDX&) = default;
+
+  /**
+   * EDX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_10_ECX_00_EDX with_reserved(UINT32 value) const { return CPUID_EAX_10_ECX_00_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_00_EDX) == 4, "Size of CPUID_EAX_10_ECX_00_EDX");
+
+class CPUID_EAX_10_ECX_01_EAX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_01_EAX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_01_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_01::Eax)>
+  static constexpr CPUID_EAX_10_ECX_01_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_01_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_01_EAX&, const CPUID_EAX_10_ECX_01_EAX&) = default;
+
+  /**
+   * Length of the capacity bit mask for the corresponding ResID using minus-one notation.
+   */
+  constexpr UINT32 length_of_capacity_bit_mask() const { return (Flags >> 0) & 0x1FU; }
+  constexpr CPUID_EAX_10_ECX_01_EAX with_length_of_capacity_bit_mask(UINT32 value) const { return CPUID_EAX_10_ECX_01_EAX((Flags & ~0x1FU) | ((value & 0x1FU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_01_EAX) == 4, "Size of CPUID_EAX_10_ECX_01_EAX");
+
+class CPUID_EAX_10_ECX_01_EBX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_01_EBX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_01_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_01::Ebx)>
+  static constexpr CPUID_EAX_10_ECX_01_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_01_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_01_EBX&, const CPUID_EAX_10_ECX_01_EBX&) = default;
+
+  /**
+   * Bit-granular map of isolation/contention of allocation units.
+   */
+  constexpr UINT32 ebx_0() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_10_ECX_01_EBX with_ebx_0(UINT32 value) const { return CPUID_EAX_10_ECX_01_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_01_EBX) == 4, "Size of CPUID_EAX_10_ECX_01_EBX");
+
+class CPUID_EAX_10_ECX_01_ECX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_01_ECX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_01_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_01::Ecx)>
+  static constexpr CPUID_EAX_10_ECX_01_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_01_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_01_ECX&, const CPUID_EAX_10_ECX_01_ECX&) = default;
+
+  /**
+   * Code and Data Prioritization Technology supported if 1.
+   */
+  constexpr UINT32 code_and_data_priorization_technology_supported() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_10_ECX_01_ECX with_code_and_data_priorization_technology_supported(UINT32 value) const { return CPUID_EAX_10_ECX_01_ECX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_01_ECX) == 4, "Size of CPUID_EAX_10_ECX_01_ECX");
+
+class CPUID_EAX_10_ECX_01_EDX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_01_EDX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_01_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_01::Edx)>
+  static constexpr CPUID_EAX_10_ECX_01_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_01_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_01_EDX&, const CPUID_EAX_10_ECX_01_EDX&) = default;
+
+  /**
+   * Highest COS number supported for this ResID.
+   */
+  constexpr UINT32 highest_cos_number_supported() const { return (Flags >> 0) & 0xFFFFU; }
+  constexpr CPUID_EAX_10_ECX_01_EDX with_highest_cos_number_supported(UINT32 value) const { return CPUID_EAX_10_ECX_01_EDX((Flags & ~0xFFFFU) | ((value & 0xFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_01_EDX) == 4, "Size of CPUID_EAX_10_ECX_01_EDX");
+
+class CPUID_EAX_10_ECX_02_EAX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_02_EAX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_02_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_02::Eax)>
+  static constexpr CPUID_EAX_10_ECX_02_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_02_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_02_EAX&, const CPUID_EAX_10_ECX_02_EAX&) = default;
+
+  /**
+   * Length of the capacity bit mask for the corresponding ResID using minus-one notation.
+   */
+  constexpr UINT32 length_of_capacity_bit_mask() const { return (Flags >> 0) & 0x1FU; }
+  constexpr CPUID_EAX_10_ECX_02_EAX with_length_of_capacity_bit_mask(UINT32 value) const { return CPUID_EAX_10_ECX_02_EAX((Flags & ~0x1FU) | ((value & 0x1FU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_02_EAX) == 4, "Size of CPUID_EAX_10_ECX_02_EAX");
+
+class CPUID_EAX_10_ECX_02_EBX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_02_EBX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_02_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_02::Ebx)>
+  static constexpr CPUID_EAX_10_ECX_02_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_02_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_02_EBX&, const CPUID_EAX_10_ECX_02_EBX&) = default;
+
+  /**
+   * Bit-granular map of isolation/contention of allocation units.
+   */
+  constexpr UINT32 ebx_0() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_10_ECX_02_EBX with_ebx_0(UINT32 value) const { return CPUID_EAX_10_ECX_02_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_02_EBX) == 4, "Size of CPUID_EAX_10_ECX_02_EBX");
+
+class CPUID_EAX_10_ECX_02_ECX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_02_ECX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_02_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_02::Ecx)>
+  static constexpr CPUID_EAX_10_ECX_02_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_02_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_02_ECX&, const CPUID_EAX_10_ECX_02_ECX&) = default;
+
+  /**
+   * ECX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_10_ECX_02_ECX with_reserved(UINT32 value) const { return CPUID_EAX_10_ECX_02_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_02_ECX) == 4, "Size of CPUID_EAX_10_ECX_02_ECX");
+
+class CPUID_EAX_10_ECX_02_EDX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_02_EDX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_02_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_02::Edx)>
+  static constexpr CPUID_EAX_10_ECX_02_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_02_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_02_EDX&, const CPUID_EAX_10_ECX_02_EDX&) = default;
+
+  /**
+   * Highest COS number supported for this ResID.
+   */
+  constexpr UINT32 highest_cos_number_supported() const { return (Flags >> 0) & 0xFFFFU; }
+  constexpr CPUID_EAX_10_ECX_02_EDX with_highest_cos_number_supported(UINT32 value) const { return CPUID_EAX_10_ECX_02_EDX((Flags & ~0xFFFFU) | ((value & 0xFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_02_EDX) == 4, "Size of CPUID_EAX_10_ECX_02_EDX");
+
+class CPUID_EAX_10_ECX_03_EAX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_03_EAX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_03_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_03::Eax)>
+  static constexpr CPUID_EAX_10_ECX_03_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_03_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_03_EAX&, const CPUID_EAX_10_ECX_03_EAX&) = default;
+
+  /**
+   * Reports the maximum MBA throttling value supported for the corresponding ResID using minus-one notation.
+   */
+  constexpr UINT32 max_mba_throttling_value() const { return (Flags >> 0) & 0xFFFU; }
+  constexpr CPUID_EAX_10_ECX_03_EAX with_max_mba_throttling_value(UINT32 value) const { return CPUID_EAX_10_ECX_03_EAX((Flags & ~0xFFFU) | ((value & 0xFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_03_EAX) == 4, "Size of CPUID_EAX_10_ECX_03_EAX");
+
+class CPUID_EAX_10_ECX_03_EBX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_03_EBX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_03_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_03::Ebx)>
+  static constexpr CPUID_EAX_10_ECX_03_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_03_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_03_EBX&, const CPUID_EAX_10_ECX_03_EBX&) = default;
+
+  /**
+   * EBX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_10_ECX_03_EBX with_reserved(UINT32 value) const { return CPUID_EAX_10_ECX_03_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_03_EBX) == 4, "Size of CPUID_EAX_10_ECX_03_EBX");
+
+class CPUID_EAX_10_ECX_03_ECX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_03_ECX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_03_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_03::Ecx)>
+  static constexpr CPUID_EAX_10_ECX_03_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_03_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_03_ECX&, const CPUID_EAX_10_ECX_03_ECX&) = default;
+
+  /**
+   * Reports whether the response of the delay values is linear.
+   */
+  constexpr UINT32 response_of_delay_is_linear() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_10_ECX_03_ECX with_response_of_delay_is_linear(UINT32 value) const { return CPUID_EAX_10_ECX_03_ECX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_03_ECX) == 4, "Size of CPUID_EAX_10_ECX_03_ECX");
+
+class CPUID_EAX_10_ECX_03_EDX
+{
+public:
+  constexpr CPUID_EAX_10_ECX_03_EDX() = default;
+  constexpr explicit CPUID_EAX_10_ECX_03_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_10_ECX_03::Edx)>
+  static constexpr CPUID_EAX_10_ECX_03_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_10_ECX_03_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_10_ECX_03_EDX&, const CPUID_EAX_10_ECX_03_EDX&) = default;
+
+  /**
+   * Highest COS number supported for this ResID.
+   */
+  constexpr UINT32 highest_cos_number_supported() const { return (Flags >> 0) & 0xFFFFU; }
+  constexpr CPUID_EAX_10_ECX_03_EDX with_highest_cos_number_supported(UINT32 value) const { return CPUID_EAX_10_ECX_03_EDX((Flags & ~0xFFFFU) | ((value & 0xFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_10_ECX_03_EDX) == 4, "Size of CPUID_EAX_10_ECX_03_EDX");
+
+class CPUID_EAX_12_ECX_00_EAX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_00_EAX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_00_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_00::Eax)>
+  static constexpr CPUID_EAX_12_ECX_00_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_00_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_00_EAX&, const CPUID_EAX_12_ECX_00_EAX&) = default;
+
+  /**
+   * If 1, Indicates Intel SGX supports the collection of SGX1 leaf functions.
+   */
+  constexpr UINT32 sgx1() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_12_ECX_00_EAX with_sgx1(UINT32 value) const { return CPUID_EAX_12_ECX_00_EAX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * If 1, Indicates Intel SGX supports the collection of SGX2 leaf functions.
+   */
+  constexpr UINT32 sgx2() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_12_ECX_00_EAX with_sgx2(UINT32 value) const { return CPUID_EAX_12_ECX_00_EAX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * If 1, indicates Intel SGX supports ENCLV instruction leaves EINCVIRTCHILD, EDECVIRTCHILD, and ESETCONTEXT.
+   */
+  constexpr UINT32 sgx_enclv_advanced() const { return (Flags >> 5) & 0x01U; }
+  constexpr CPUID_EAX_12_ECX_00_EAX with_sgx_enclv_advanced(UINT32 value) const { return CPUID_EAX_12_ECX_00_EAX((Flags & ~0x20U) | ((value & 0x01U) << 5)); }
+
+  /**
+   * If 1, indicates Intel SGX supports ENCLS instruction leaves ETRACKC, ERDINFO, ELDBC, and ELDUC.
+   */
+  constexpr UINT32 sgx_encls_advanced() const { return (Flags >> 6) & 0x01U; }
+  constexpr CPUID_EAX_12_ECX_00_EAX with_sgx_encls_advanced(UINT32 value) const { return CPUID_EAX_12_ECX_00_EAX((Flags & ~0x40U) | ((value & 0x01U) << 6)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_00_EAX) == 4, "Size of CPUID_EAX_12_ECX_00_EAX");
+
+class CPUID_EAX_12_ECX_00_EBX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_00_EBX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_00_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_00::Ebx)>
+  static constexpr CPUID_EAX_12_ECX_00_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_00_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_00_EBX&, const CPUID_EAX_12_ECX_00_EBX&) = default;
+
+  /**
+   * Bit vector of supported extended SGX features.
+   */
+  constexpr UINT32 miscselect() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_12_ECX_00_EBX with_miscselect(UINT32 value) const { return CPUID_EAX_12_ECX_00_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_00_EBX) == 4, "Size of CPUID_EAX_12_ECX_00_EBX");
+
+class CPUID_EAX_12_ECX_00_ECX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_00_ECX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_00_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_00::Ecx)>
+  static constexpr CPUID_EAX_12_ECX_00_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_00_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_00_ECX&, const CPUID_EAX_12_ECX_00_ECX&) = default;
+
+  /**
+   * ECX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_12_ECX_00_ECX with_reserved(UINT32 value) const { return CPUID_EAX_12_ECX_00_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_00_ECX) == 4, "Size of CPUID_EAX_12_ECX_00_ECX");
+
+class CPUID_EAX_12_ECX_00_EDX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_00_EDX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_00_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_00::Edx)>
+  static constexpr CPUID_EAX_12_ECX_00_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_00_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_00_EDX&, const CPUID_EAX_12_ECX_00_EDX&) = default;
+
+  /**
+   * The maximum supported enclave size in non-64-bit mode is 2^(EDX[7:0]).
+   */
+  constexpr UINT32 max_enclave_size_not64() const { return (Flags >> 0) & 0xFFU; }
+  constexpr CPUID_EAX_12_ECX_00_EDX with_max_enclave_size_not64(UINT32 value) const { return CPUID_EAX_12_ECX_00_EDX((Flags & ~0xFFU) | ((value & 0xFFU) << 0)); }
+
+  /**
+   * The maximum supported enclave size in 64-bit mode is 2^(EDX[15:8]).
+   */
+  constexpr UINT32 max_enclave_size_64() const { return (Flags >> 8) & 0xFFU; }
+  constexpr CPUID_EAX_12_ECX_00_EDX with_max_enclave_size_64(UINT32 value) const { return CPUID_EAX_12_ECX_00_EDX((Flags & ~0xFF00U) | ((value & 0xFFU) << 8)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_00_EDX) == 4, "Size of CPUID_EAX_12_ECX_00_EDX");
+
+class CPUID_EAX_12_ECX_01_EAX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_01_EAX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_01_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_01::Eax)>
+  static constexpr CPUID_EAX_12_ECX_01_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_01_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_01_EAX&, const CPUID_EAX_12_ECX_01_EAX&) = default;
+
+  /**
+   * Reports the valid bits of SECS.ATTRIBUTES[31:0] that software can set with ECREATE.
+   */
+  constexpr UINT32 valid_secs_attributes_0() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_12_ECX_01_EAX with_valid_secs_attributes_0(UINT32 value) const { return CPUID_EAX_12_ECX_01_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_01_EAX) == 4, "Size of CPUID_EAX_12_ECX_01_EAX");
+
+class CPUID_EAX_12_ECX_01_EBX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_01_EBX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_01_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_01::Ebx)>
+  static constexpr CPUID_EAX_12_ECX_01_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_01_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_01_EBX&, const CPUID_EAX_12_ECX_01_EBX&) = default;
+
+  /**
+   * Reports the valid bits of SECS.ATTRIBUTES[63:32] that software can set with ECREATE.
+   */
+  constexpr UINT32 valid_secs_attributes_1() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_12_ECX_01_EBX with_valid_secs_attributes_1(UINT32 value) const { return CPUID_EAX_12_ECX_01_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_01_EBX) == 4, "Size of CPUID_EAX_12_ECX_01_EBX");
+
+class CPUID_EAX_12_ECX_01_ECX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_01_ECX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_01_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_01::Ecx)>
+  static constexpr CPUID_EAX_12_ECX_01_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_01_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_01_ECX&, const CPUID_EAX_12_ECX_01_ECX&) = default;
+
+  /**
+   * Reports the valid bits of SECS.ATTRIBUTES[95:64] that software can set with ECREATE.
+   */
+  constexpr UINT32 valid_secs_attributes_2() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_12_ECX_01_ECX with_valid_secs_attributes_2(UINT32 value) const { return CPUID_EAX_12_ECX_01_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_01_ECX) == 4, "Size of CPUID_EAX_12_ECX_01_ECX");
+
+class CPUID_EAX_12_ECX_01_EDX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_01_EDX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_01_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_01::Edx)>
+  static constexpr CPUID_EAX_12_ECX_01_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_01_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_01_EDX&, const CPUID_EAX_12_ECX_01_EDX&) = default;
+
+  /**
+   * Reports the valid bits of SECS.ATTRIBUTES[127:96] that software can set with ECREATE.
+   */
+  constexpr UINT32 valid_secs_attributes_3() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_12_ECX_01_EDX with_valid_secs_attributes_3(UINT32 value) const { return CPUID_EAX_12_ECX_01_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_01_EDX) == 4, "Size of CPUID_EAX_12_ECX_01_EDX");
+
+class CPUID_EAX_12_ECX_02P_SLT_0_EAX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_02P_SLT_0_EAX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_02P_SLT_0_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_02P_SLT_0::Eax)>
+  static constexpr CPUID_EAX_12_ECX_02P_SLT_0_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_02P_SLT_0_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_02P_SLT_0_EAX&, const CPUID_EAX_12_ECX_02P_SLT_0_EAX&) = default;
+
+  /**
+   * Sub-leaf Type 0. Indicates this sub-leaf is invalid.
+   */
+  constexpr UINT32 sub_leaf_type() const { return (Flags >> 0) & 0x0FU; }
+  constexpr CPUID_EAX_12_ECX_02P_SLT_0_EAX with_sub_leaf_type(UINT32 value) const { return CPUID_EAX_12_ECX_02P_SLT_0_EAX((Flags & ~0x0FU) | ((value & 0x0FU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_02P_SLT_0_EAX) == 4, "Size of CPUID_EAX_12_ECX_02P_SLT_0_EAX");
+
+class CPUID_EAX_12_ECX_02P_SLT_0_EBX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_02P_SLT_0_EBX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_02P_SLT_0_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_02P_SLT_0::Ebx)>
+  static constexpr CPUID_EAX_12_ECX_02P_SLT_0_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_02P_SLT_0_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_02P_SLT_0_EBX&, const CPUID_EAX_12_ECX_02P_SLT_0_EBX&) = default;
+
+  /**
+   * EBX is zero.
+   */
+  constexpr UINT32 zero() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_12_ECX_02P_SLT_0_EBX with_zero(UINT32 value) const { return CPUID_EAX_12_ECX_02P_SLT_0_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_02P_SLT_0_EBX) == 4, "Size of CPUID_EAX_12_ECX_02P_SLT_0_EBX");
+
+class CPUID_EAX_12_ECX_02P_SLT_0_ECX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_02P_SLT_0_ECX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_02P_SLT_0_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_02P_SLT_0::Ecx)>
+  static constexpr CPUID_EAX_12_ECX_02P_SLT_0_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_02P_SLT_0_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_02P_SLT_0_ECX&, const CPUID_EAX_12_ECX_02P_SLT_0_ECX&) = default;
+
+  /**
+   * ECX is zero.
+   */
+  constexpr UINT32 zero() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_12_ECX_02P_SLT_0_ECX with_zero(UINT32 value) const { return CPUID_EAX_12_ECX_02P_SLT_0_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_02P_SLT_0_ECX) == 4, "Size of CPUID_EAX_12_ECX_02P_SLT_0_ECX");
+
+class CPUID_EAX_12_ECX_02P_SLT_0_EDX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_02P_SLT_0_EDX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_02P_SLT_0_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_02P_SLT_0::Edx)>
+  static constexpr CPUID_EAX_12_ECX_02P_SLT_0_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_02P_SLT_0_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_02P_SLT_0_EDX&, const CPUID_EAX_12_ECX_02P_SLT_0_EDX&) = default;
+
+  /**
+   * EDX is zero.
+   */
+  constexpr UINT32 zero() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_12_ECX_02P_SLT_0_EDX with_zero(UINT32 value) const { return CPUID_EAX_12_ECX_02P_SLT_0_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_02P_SLT_0_EDX) == 4, "Size of CPUID_EAX_12_ECX_02P_SLT_0_EDX");
+
+class CPUID_EAX_12_ECX_02P_SLT_1_EAX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_02P_SLT_1_EAX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_02P_SLT_1_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_02P_SLT_1::Eax)>
+  static constexpr CPUID_EAX_12_ECX_02P_SLT_1_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_02P_SLT_1_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_02P_SLT_1_EAX&, const CPUID_EAX_12_ECX_02P_SLT_1_EAX&) = default;
+
+  /**
+   * Sub-leaf Type 1. This sub-leaf enumerates an EPC section. EBX:EAX and EDX:ECX provide information on the Enclave Page
+   * Cache (EPC) section.
+   */
+  constexpr UINT32 sub_leaf_type() const { return (Flags >> 0) & 0x0FU; }
+  constexpr CPUID_EAX_12_ECX_02P_SLT_1_EAX with_sub_leaf_type(UINT32 value) const { return CPUID_EAX_12_ECX_02P_SLT_1_EAX((Flags & ~0x0FU) | ((value & 0x0FU) << 0)); }
+
+  /**
+   * Bits 31:12 of the physical address of the base of the EPC section.
+   */
+  constexpr UINT32 epc_base_physical_address_1() const { return (Flags >> 12) & 0xFFFFFU; }
+  constexpr CPUID_EAX_12_ECX_02P_SLT_1_EAX with_epc_base_physical_address_1(UINT32 value) const { return CPUID_EAX_12_ECX_02P_SLT_1_EAX((Flags & ~0xFFFFF000U) | ((value & 0xFFFFFU) << 12)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_02P_SLT_1_EAX) == 4, "Size of CPUID_EAX_12_ECX_02P_SLT_1_EAX");
+
+class CPUID_EAX_12_ECX_02P_SLT_1_EBX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_02P_SLT_1_EBX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_02P_SLT_1_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_02P_SLT_1::Ebx)>
+  static constexpr CPUID_EAX_12_ECX_02P_SLT_1_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_02P_SLT_1_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_02P_SLT_1_EBX&, const CPUID_EAX_12_ECX_02P_SLT_1_EBX&) = default;
+
+  /**
+   * Bits 51:32 of the physical address of the base of the EPC section.
+   */
+  constexpr UINT32 epc_base_physical_address_2() const { return (Flags >> 0) & 0xFFFFFU; }
+  constexpr CPUID_EAX_12_ECX_02P_SLT_1_EBX with_epc_base_physical_address_2(UINT32 value) const { return CPUID_EAX_12_ECX_02P_SLT_1_EBX((Flags & ~0xFFFFFU) | ((value & 0xFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_02P_SLT_1_EBX) == 4, "Size of CPUID_EAX_12_ECX_02P_SLT_1_EBX");
+
+class CPUID_EAX_12_ECX_02P_SLT_1_ECX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_02P_SLT_1_ECX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_02P_SLT_1_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_02P_SLT_1::Ecx)>
+  static constexpr CPUID_EAX_12_ECX_02P_SLT_1_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_02P_SLT_1_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_02P_SLT_1_ECX&, const CPUID_EAX_12_ECX_02P_SLT_1_ECX&) = default;
+
+  /**
+   * EPC section property encoding defined as follows:
+   * - If EAX[3:0] 0000b, then all bits of the EDX:ECX pair are enumerated as 0.
+   * - If EAX[3:0] 0001b, then this section has confidentiality and integrity protection.
+   * All other encodings are reserved.
+   */
+  constexpr UINT32 epc_section_property() const { return (Flags >> 0) & 0x0FU; }
+  constexpr CPUID_EAX_12_ECX_02P_SLT_1_ECX with_epc_section_property(UINT32 value) const { return CPUID_EAX_12_ECX_02P_SLT_1_ECX((Flags & ~0x0FU) | ((value & 0x0FU) << 0)); }
+
+  /**
+   * Bits 31:12 of the size of the corresponding EPC section within the Processor Reserved Memory.
+   */
+  constexpr UINT32 epc_size_1() const { return (Flags >> 12) & 0xFFFFFU; }
+  constexpr CPUID_EAX_12_ECX_02P_SLT_1_ECX with_epc_size_1(UINT32 value) const { return CPUID_EAX_12_ECX_02P_SLT_1_ECX((Flags & ~0xFFFFF000U) | ((value & 0xFFFFFU) << 12)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_02P_SLT_1_ECX) == 4, "Size of CPUID_EAX_12_ECX_02P_SLT_1_ECX");
+
+class CPUID_EAX_12_ECX_02P_SLT_1_EDX
+{
+public:
+  constexpr CPUID_EAX_12_ECX_02P_SLT_1_EDX() = default;
+  constexpr explicit CPUID_EAX_12_ECX_02P_SLT_1_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_12_ECX_02P_SLT_1::Edx)>
+  static constexpr CPUID_EAX_12_ECX_02P_SLT_1_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_12_ECX_02P_SLT_1_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_12_ECX_02P_SLT_1_EDX&, const CPUID_EAX_12_ECX_02P_SLT_1_EDX&) = default;
+
+  /**
+   * Bits 51:32 of the size of the corresponding EPC section within the Processor Reserved Memory.
+   */
+  constexpr UINT32 epc_size_2() const { return (Flags >> 0) & 0xFFFFFU; }
+  constexpr CPUID_EAX_12_ECX_02P_SLT_1_EDX with_epc_size_2(UINT32 value) const { return CPUID_EAX_12_ECX_02P_SLT_1_EDX((Flags & ~0xFFFFFU) | ((value & 0xFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_12_ECX_02P_SLT_1_EDX) == 4, "Size of CPUID_EAX_12_ECX_02P_SLT_1_EDX");
+
+class CPUID_EAX_14_ECX_00_EAX
+{
+public:
+  constexpr CPUID_EAX_14_ECX_00_EAX() = default;
+  constexpr explicit CPUID_EAX_14_ECX_00_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_14_ECX_00::Eax)>
+  static constexpr CPUID_EAX_14_ECX_00_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_14_ECX_00_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_14_ECX_00_EAX&, const CPUID_EAX_14_ECX_00_EAX&) = default;
+
+  /**
+   * Reports the maximum sub-leaf supported in leaf 14H.
+   */
+  constexpr UINT32 max_sub_leaf() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_14_ECX_00_EAX with_max_sub_leaf(UINT32 value) const { return CPUID_EAX_14_ECX_00_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_14_ECX_00_EAX) == 4, "Size of CPUID_EAX_14_ECX_00_EAX");
+
+class CPUID_EAX_14_ECX_00_EBX
+{
+public:
+  constexpr CPUID_EAX_14_ECX_00_EBX() = default;
+  constexpr explicit CPUID_EAX_14_ECX_00_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_14_ECX_00::Ebx)>
+  static constexpr CPUID_EAX_14_ECX_00_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_14_ECX_00_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_14_ECX_00_EBX&, const CPUID_EAX_14_ECX_00_EBX&) = default;
+
+  /**
+   * If 1, indicates that IA32_RTIT_CTL.CR3Filter can be set to 1, and that IA32_RTIT_CR3_MATCH MSR can be accessed.
+   */
+  constexpr UINT32 flag0() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_14_ECX_00_EBX with_flag0(UINT32 value) const { return CPUID_EAX_14_ECX_00_EBX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * If 1, indicates support of Configurable PSB and Cycle-Accurate Mode.
+   */
+  constexpr UINT32 flag1() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_14_ECX_00_EBX with_flag1(UINT32 value) const { return CPUID_EAX_14_ECX_00_EBX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * If 1, indicates support of IP Filtering, TraceStop filtering, and preservation of Intel PT MSRs across warm reset.
+   */
+  constexpr UINT32 flag2() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_14_ECX_00_EBX with_flag2(UINT32 value) const { return CPUID_EAX_14_ECX_00_EBX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * If 1, indicates support of MTC timing packet and suppression of COFI-based packets.
+   */
+  constexpr UINT32 flag3() const { return (Flags >> 3) & 0x01U; }
+  constexpr CPUID_EAX_14_ECX_00_EBX with_flag3(UINT32 value) const { return CPUID_EAX_14_ECX_00_EBX((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+  /**
+   * If 1, indicates support of PTWRITE. Writes can set IA32_RTIT_CTL[12] (PTWEn) and IA32_RTIT_CTL[5] (FUPonPTW), and
+   * PTWRITE can generate packets.
+   */
+  constexpr UINT32 flag4() const { return (Flags >> 4) & 0x01U; }
+  constexpr CPUID_EAX_14_ECX_00_EBX with_flag4(UINT32 value) const { return CPUID_EAX_14_ECX_00_EBX((Flags & ~0x10U) | ((value & 0x01U) << 4)); }
+
+  /**
+   * If 1, indicates support of Power Event Trace. Writes can set IA32_RTIT_CTL[4] (PwrEvtEn), enabling Power Event Trace
+   * packet generation.
+   */
+  constexpr UINT32 flag5() const { return (Flags >> 5) & 0x01U; }
+  constexpr CPUID_EAX_14_ECX_00_EBX with_flag5(UINT32 value) const { return CPUID_EAX_14_ECX_00_EBX((Flags & ~0x20U) | ((value & 0x01U) << 5)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_14_ECX_00_EBX) == 4, "Size of CPUID_EAX_14_ECX_00_EBX");
+
+class CPUID_EAX_14_ECX_00_ECX
+{
+public:
+  constexpr CPUID_EAX_14_ECX_00_ECX() = default;
+  constexpr explicit CPUID_EAX_14_ECX_00_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_14_ECX_00::Ecx)>
+  static constexpr CPUID_EAX_14_ECX_00_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_14_ECX_00_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_14_ECX_00_ECX&, const CPUID_EAX_14_ECX_00_ECX&) = default;
+
+  /**
+   * If 1, Tracing can be enabled with IA32_RTIT_CTL.ToPA = 1, hence utilizing the ToPA output scheme; IA32_RTIT_OUTPUT_BASE
+   * and IA32_RTIT_OUTPUT_MASK_PTRS MSRs can be accessed.
+   */
+  constexpr UINT32 flag0() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_14_ECX_00_ECX with_flag0(UINT32 value) const { return CPUID_EAX_14_ECX_00_ECX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * If 1, ToPA tables can hold any number of output entries, up to the maximum allowed by the MaskOrTableOffset field of
+   * IA32_RTIT_OUTPUT_MASK_PTRS.
+   */
+  constexpr UINT32 flag1() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_14_ECX_00_ECX with_flag1(UINT32 value) const { return CPUID_EAX_14_ECX_00_ECX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * If 1, indicates support of Single-Range Output scheme.
+   */
+  constexpr UINT32 flag2() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_14_ECX_00_ECX with_flag2(UINT32 value) const { return CPUID_EAX_14_ECX_00_ECX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * If 1, indicates support of output to Trace Transport subsystem.
+   */
+  constexpr UINT32 flag3() const { return (Flags >> 3) & 0x01U; }
+  constexpr CPUID_EAX_14_ECX_00_ECX with_flag3(UINT32 value) const { return CPUID_EAX_14_ECX_00_ECX((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+  /**
+   * If 1, generated packets which contain IP payloads have LIP values, which include the CS base component.
+   */
+  constexpr UINT32 flag31() const { return (Flags >> 31) & 0x01U; }
+  constexpr CPUID_EAX_14_ECX_00_ECX with_flag31(UINT32 value) const { return CPUID_EAX_14_ECX_00_ECX((Flags & ~0x80000000U) | ((value & 0x01U) << 31)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_14_ECX_00_ECX) == 4, "Size of CPUID_EAX_14_ECX_00_ECX");
+
+class CPUID_EAX_14_ECX_00_EDX
+{
+public:
+  constexpr CPUID_EAX_14_ECX_00_EDX() = default;
+  constexpr explicit CPUID_EAX_14_ECX_00_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_14_ECX_00::Edx)>
+  static constexpr CPUID_EAX_14_ECX_00_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_14_ECX_00_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_14_ECX_00_EDX&, const CPUID_EAX_14_ECX_00_EDX&) = default;
+
+  /**
+   * EDX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_14_ECX_00_EDX with_reserved(UINT32 value) const { return CPUID_EAX_14_ECX_00_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_14_ECX_00_EDX) == 4, "Size of CPUID_EAX_14_ECX_00_EDX");
+
+class CPUID_EAX_14_ECX_01_EAX
+{
+public:
+  constexpr CPUID_EAX_14_ECX_01_EAX() = default;
+  constexpr explicit CPUID_EAX_14_ECX_01_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_14_ECX_01::Eax)>
+  static constexpr CPUID_EAX_14_ECX_01_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_14_ECX_01_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_14_ECX_01_EAX&, const CPUID_EAX_14_ECX_01_EAX&) = default;
+
+  /**
+   * Number of configurable Address Ranges for filtering.
+   */
+  constexpr UINT32 number_of_configurable_address_ranges_for_filtering() const { return (Flags >> 0) & 0x07U; }
+  constexpr CPUID_EAX_14_ECX_01_EAX with_number_of_configurable_address_ranges_for_filtering(UINT32 value) const { return CPUID_EAX_14_ECX_01_EAX((Flags & ~0x07U) | ((value & 0x07U) << 0)); }
+
+  /**
+   * Bitmap of supported MTC period encodings.
+   */
+  constexpr UINT32 bitmap_of_supported_mtc_period_encodings() const { return (Flags >> 16) & 0xFFFFU; }
+  constexpr CPUID_EAX_14_ECX_01_EAX with_bitmap_of_supported_mtc_period_encodings(UINT32 value) const { return CPUID_EAX_14_ECX_01_EAX((Flags & ~0xFFFF0000U) | ((value & 0xFFFFU) << 16)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_14_ECX_01_EAX) == 4, "Size of CPUID_EAX_14_ECX_01_EAX");
+
+class CPUID_EAX_14_ECX_01_EBX
+{
+public:
+  constexpr CPUID_EAX_14_ECX_01_EBX() = default;
+  constexpr explicit CPUID_EAX_14_ECX_01_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_14_ECX_01::Ebx)>
+  static constexpr CPUID_EAX_14_ECX_01_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_14_ECX_01_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_14_ECX_01_EBX&, const CPUID_EAX_14_ECX_01_EBX&) = default;
+
+  /**
+   * Bitmap of supported Cycle Threshold value encodings.
+   */
+  constexpr UINT32 bitmap_of_supported_cycle_threshold_value_encodings() const { return (Flags >> 0) & 0xFFFFU; }
+  constexpr CPUID_EAX_14_ECX_01_EBX with_bitmap_of_supported_cycle_threshold_value_encodings(UINT32 value) const { return CPUID_EAX_14_ECX_01_EBX((Flags & ~0xFFFFU) | ((value & 0xFFFFU) << 0)); }
+
+  /**
+   * Bitmap of supported Configurable PSB frequency encodings.
+   */
+  constexpr UINT32 bitmap_of_supported_configurable_psb_frequency_encodings() const { return (Flags >> 16) & 0xFFFFU; }
+  constexpr CPUID_EAX_14_ECX_01_EBX with_bitmap_of_supported_configurable_psb_frequency_encodings(UINT32 value) const { return CPUID_EAX_14_ECX_01_EBX((Flags & ~0xFFFF0000U) | ((value & 0xFFFFU) << 16)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_14_ECX_01_EBX) == 4, "Size of CPUID_EAX_14_ECX_01_EBX");
+
+class CPUID_EAX_14_ECX_01_ECX
+{
+public:
+  constexpr CPUID_EAX_14_ECX_01_ECX() = default;
+  constexpr explicit CPUID_EAX_14_ECX_01_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_14_ECX_01::Ecx)>
+  static constexpr CPUID_EAX_14_ECX_01_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_14_ECX_01_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_14_ECX_01_ECX&, const CPUID_EAX_14_ECX_01_ECX&) = default;
+
+  /**
+   * ECX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_14_ECX_01_ECX with_reserved(UINT32 value) const { return CPUID_EAX_14_ECX_01_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_14_ECX_01_ECX) == 4, "Size of CPUID_EAX_14_ECX_01_ECX");
+
+class CPUID_EAX_14_ECX_01_EDX
+{
+public:
+  constexpr CPUID_EAX_14_ECX_01_EDX() = default;
+  constexpr explicit CPUID_EAX_14_ECX_01_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_14_ECX_01::Edx)>
+  static constexpr CPUID_EAX_14_ECX_01_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_14_ECX_01_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_14_ECX_01_EDX&, const CPUID_EAX_14_ECX_01_EDX&) = default;
+
+  /**
+   * EDX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_14_ECX_01_EDX with_reserved(UINT32 value) const { return CPUID_EAX_14_ECX_01_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_14_ECX_01_EDX) == 4, "Size of CPUID_EAX_14_ECX_01_EDX");
+
+class CPUID_EAX_15_EAX
+{
+public:
+  constexpr CPUID_EAX_15_EAX() = default;
+  constexpr explicit CPUID_EAX_15_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_15::Eax)>
+  static constexpr CPUID_EAX_15_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_15_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_15_EAX&, const CPUID_EAX_15_EAX&) = default;
+
+  /**
+   * An unsigned integer which is the denominator of the TSC/"core crystal clock" ratio.
+   */
+  constexpr UINT32 denominator() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_15_EAX with_denominator(UINT32 value) const { return CPUID_EAX_15_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_15_EAX) == 4, "Size of CPUID_EAX_15_EAX");
+
+class CPUID_EAX_15_EBX
+{
+public:
+  constexpr CPUID_EAX_15_EBX() = default;
+  constexpr explicit CPUID_EAX_15_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_15::Ebx)>
+  static constexpr CPUID_EAX_15_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_15_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_15_EBX&, const CPUID_EAX_15_EBX&) = default;
+
+  /**
+   * An unsigned integer which is the numerator of the TSC/"core crystal clock" ratio.
+   */
+  constexpr UINT32 numerator() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_15_EBX with_numerator(UINT32 value) const { return CPUID_EAX_15_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_15_EBX) == 4, "Size of CPUID_EAX_15_EBX");
+
+class CPUID_EAX_15_ECX
+{
+public:
+  constexpr CPUID_EAX_15_ECX() = default;
+  constexpr explicit CPUID_EAX_15_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_15::Ecx)>
+  static constexpr CPUID_EAX_15_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_15_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_15_ECX&, const CPUID_EAX_15_ECX&) = default;
+
+  /**
+   * An unsigned integer which is the nominal frequency of the core crystal clock in Hz.
+   */
+  constexpr UINT32 nominal_frequency() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_15_ECX with_nominal_frequency(UINT32 value) const { return CPUID_EAX_15_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_15_ECX) == 4, "Size of CPUID_EAX_15_ECX");
+
+class CPUID_EAX_15_EDX
+{
+public:
+  constexpr CPUID_EAX_15_EDX() = default;
+  constexpr explicit CPUID_EAX_15_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_15::Edx)>
+  static constexpr CPUID_EAX_15_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_15_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_15_EDX&, const CPUID_EAX_15_EDX&) = default;
+
+  /**
+   * EDX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_15_EDX with_reserved(UINT32 value) const { return CPUID_EAX_15_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_15_EDX) == 4, "Size of CPUID_EAX_15_EDX");
+
+class CPUID_EAX_16_EAX
+{
+public:
+  constexpr CPUID_EAX_16_EAX() = default;
+  constexpr explicit CPUID_EAX_16_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_16::Eax)>
+  static constexpr CPUID_EAX_16_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_16_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_16_EAX&, const CPUID_EAX_16_EAX&) = default;
+
+  /**
+   * Processor Base Frequency (in MHz).
+   */
+  constexpr UINT32 procesor_base_frequency_mhz() const { return (Flags >> 0) & 0xFFFFU; }
+  constexpr CPUID_EAX_16_EAX with_procesor_base_frequency_mhz(UINT32 value) const { return CPUID_EAX_16_EAX((Flags & ~0xFFFFU) | ((value & 0xFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_16_EAX) == 4, "Size of CPUID_EAX_16_EAX");
+
+class CPUID_EAX_16_EBX
+{
+public:
+  constexpr CPUID_EAX_16_EBX() = default;
+  constexpr explicit CPUID_EAX_16_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_16::Ebx)>
+  static constexpr CPUID_EAX_16_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_16_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_16_EBX&, const CPUID_EAX_16_EBX&) = default;
+
+  /**
+   * Maximum Frequency (in MHz).
+   */
+  constexpr UINT32 processor_maximum_frequency_mhz() const { return (Flags >> 0) & 0xFFFFU; }
+  constexpr CPUID_EAX_16_EBX with_processor_maximum_frequency_mhz(UINT32 value) const { return CPUID_EAX_16_EBX((Flags & ~0xFFFFU) | ((value & 0xFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_16_EBX) == 4, "Size of CPUID_EAX_16_EBX");
+
+class CPUID_EAX_16_ECX
+{
+public:
+  constexpr CPUID_EAX_16_ECX() = default;
+  constexpr explicit CPUID_EAX_16_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_16::Ecx)>
+  static constexpr CPUID_EAX_16_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_16_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_16_ECX&, const CPUID_EAX_16_ECX&) = default;
+
+  /**
+   * Bus (Reference) Frequency (in MHz).
+   */
+  constexpr UINT32 bus_frequency_mhz() const { return (Flags >> 0) & 0xFFFFU; }
+  constexpr CPUID_EAX_16_ECX with_bus_frequency_mhz(UINT32 value) const { return CPUID_EAX_16_ECX((Flags & ~0xFFFFU) | ((value & 0xFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_16_ECX) == 4, "Size of CPUID_EAX_16_ECX");
+
+class CPUID_EAX_16_EDX
+{
+public:
+  constexpr CPUID_EAX_16_EDX() = default;
+  constexpr explicit CPUID_EAX_16_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_16::Edx)>
+  static constexpr CPUID_EAX_16_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_16_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_16_EDX&, const CPUID_EAX_16_EDX&) = default;
+
+  /**
+   * EDX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_16_EDX with_reserved(UINT32 value) const { return CPUID_EAX_16_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_16_EDX) == 4, "Size of CPUID_EAX_16_EDX");
+
+class CPUID_EAX_17_ECX_00_EAX
+{
+public:
+  constexpr CPUID_EAX_17_ECX_00_EAX() = default;
+  constexpr explicit CPUID_EAX_17_ECX_00_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_17_ECX_00::Eax)>
+  static constexpr CPUID_EAX_17_ECX_00_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_17_ECX_00_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_17_ECX_00_EAX&, const CPUID_EAX_17_ECX_00_EAX&) = default;
+
+  /**
+   * Reports the maximum input value of supported sub-leaf in leaf 17H.
+   */
+  constexpr UINT32 max_soc_id_index() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_17_ECX_00_EAX with_max_soc_id_index(UINT32 value) const { return CPUID_EAX_17_ECX_00_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_17_ECX_00_EAX) == 4, "Size of CPUID_EAX_17_ECX_00_EAX");
+
+class CPUID_EAX_17_ECX_00_EBX
+{
+public:
+  constexpr CPUID_EAX_17_ECX_00_EBX() = default;
+  constexpr explicit CPUID_EAX_17_ECX_00_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_17_ECX_00::Ebx)>
+  static constexpr CPUID_EAX_17_ECX_00_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_17_ECX_00_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_17_ECX_00_EBX&, const CPUID_EAX_17_ECX_00_EBX&) = default;
+
+  /**
+   * SOC Vendor ID.
+   */
+  constexpr UINT32 soc_vendor_id() const { return (Flags >> 0) & 0xFFFFU; }
+  constexpr CPUID_EAX_17_ECX_00_EBX with_soc_vendor_id(UINT32 value) const { return CPUID_EAX_17_ECX_00_EBX((Flags & ~0xFFFFU) | ((value & 0xFFFFU) << 0)); }
+
+  /**
+   * If 1, the SOC Vendor ID field is assigned via an industry standard enumeration scheme. Otherwise, the SOC Vendor ID
+   * field is assigned by Intel.
+   */
+  constexpr UINT32 is_vendor_scheme() const { return (Flags >> 16) & 0x01U; }
+  constexpr CPUID_EAX_17_ECX_00_EBX with_is_vendor_scheme(UINT32 value) const { return CPUID_EAX_17_ECX_00_EBX((Flags & ~0x10000U) | ((value & 0x01U) << 16)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_17_ECX_00_EBX) == 4, "Size of CPUID_EAX_17_ECX_00_EBX");
+
+class CPUID_EAX_17_ECX_00_ECX
+{
+public:
+  constexpr CPUID_EAX_17_ECX_00_ECX() = default;
+  constexpr explicit CPUID_EAX_17_ECX_00_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_17_ECX_00::Ecx)>
+  static constexpr CPUID_EAX_17_ECX_00_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_17_ECX_00_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_17_ECX_00_ECX&, const CPUID_EAX_17_ECX_00_ECX&) = default;
+
+  /**
+   * A unique number an SOC vendor assigns to its SOC projects.
+   */
+  constexpr UINT32 project_id() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_17_ECX_00_ECX with_project_id(UINT32 value) const { return CPUID_EAX_17_ECX_00_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_17_ECX_00_ECX) == 4, "Size of CPUID_EAX_17_ECX_00_ECX");
+
+class CPUID_EAX_17_ECX_00_EDX
+{
+public:
+  constexpr CPUID_EAX_17_ECX_00_EDX() = default;
+  constexpr explicit CPUID_EAX_17_ECX_00_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_17_ECX_00::Edx)>
+  static constexpr CPUID_EAX_17_ECX_00_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_17_ECX_00_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_17_ECX_00_EDX&, const CPUID_EAX_17_ECX_00_EDX&) = default;
+
+  /**
+   * A unique number within an SOC project that an SOC vendor assigns.
+   */
+  constexpr UINT32 stepping_id() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_17_ECX_00_EDX with_stepping_id(UINT32 value) const { return CPUID_EAX_17_ECX_00_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_17_ECX_00_EDX) == 4, "Size of CPUID_EAX_17_ECX_00_EDX");
+
+class CPUID_EAX_17_ECX_01_03_EAX
+{
+public:
+  constexpr CPUID_EAX_17_ECX_01_03_EAX() = default;
+  constexpr explicit CPUID_EAX_17_ECX_01_03_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_17_ECX_01_03::Eax)>
+  static constexpr CPUID_EAX_17_ECX_01_03_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_17_ECX_01_03_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_17_ECX_01_03_EAX&, const CPUID_EAX_17_ECX_01_03_EAX&) = default;
+
+  /**
+   * SOC Vendor Brand String. UTF-8 encoded string.
+   */
+  constexpr UINT32 soc_vendor_brand_string() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_17_ECX_01_03_EAX with_soc_vendor_brand_string(UINT32 value) const { return CPUID_EAX_17_ECX_01_03_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_17_ECX_01_03_EAX) == 4, "Size of CPUID_EAX_17_ECX_01_03_EAX");
+
+class CPUID_EAX_17_ECX_01_03_EBX
+{
+public:
+  constexpr CPUID_EAX_17_ECX_01_03_EBX() = default;
+  constexpr explicit CPUID_EAX_17_ECX_01_03_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_17_ECX_01_03::Ebx)>
+  static constexpr CPUID_EAX_17_ECX_01_03_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_17_ECX_01_03_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_17_ECX_01_03_EBX&, const CPUID_EAX_17_ECX_01_03_EBX&) = default;
+
+  /**
+   * SOC Vendor Brand String. UTF-8 encoded string.
+   */
+  constexpr UINT32 soc_vendor_brand_string() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_17_ECX_01_03_EBX with_soc_vendor_brand_string(UINT32 value) const { return CPUID_EAX_17_ECX_01_03_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_17_ECX_01_03_EBX) == 4, "Size of CPUID_EAX_17_ECX_01_03_EBX");
+
+class CPUID_EAX_17_ECX_01_03_ECX
+{
+public:
+  constexpr CPUID_EAX_17_ECX_01_03_ECX() = default;
+  constexpr explicit CPUID_EAX_17_ECX_01_03_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_17_ECX_01_03::Ecx)>
+  static constexpr CPUID_EAX_17_ECX_01_03_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_17_ECX_01_03_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_17_ECX_01_03_ECX&, const CPUID_EAX_17_ECX_01_03_ECX&) = default;
+
+  /**
+   * SOC Vendor Brand String. UTF-8 encoded string.
+   */
+  constexpr UINT32 soc_vendor_brand_string() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_17_ECX_01_03_ECX with_soc_vendor_brand_string(UINT32 value) const { return CPUID_EAX_17_ECX_01_03_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_17_ECX_01_03_ECX) == 4, "Size of CPUID_EAX_17_ECX_01_03_ECX");
+
+class CPUID_EAX_17_ECX_01_03_EDX
+{
+public:
+  constexpr CPUID_EAX_17_ECX_01_03_EDX() = default;
+  constexpr explicit CPUID_EAX_17_ECX_01_03_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_17_ECX_01_03::Edx)>
+  static constexpr CPUID_EAX_17_ECX_01_03_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_17_ECX_01_03_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_17_ECX_01_03_EDX&, const CPUID_EAX_17_ECX_01_03_EDX&) = default;
+
+  /**
+   * SOC Vendor Brand String. UTF-8 encoded string.
+   */
+  constexpr UINT32 soc_vendor_brand_string() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_17_ECX_01_03_EDX with_soc_vendor_brand_string(UINT32 value) const { return CPUID_EAX_17_ECX_01_03_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_17_ECX_01_03_EDX) == 4, "Size of CPUID_EAX_17_ECX_01_03_EDX");
+
+class CPUID_EAX_17_ECX_N_EAX
+{
+public:
+  constexpr CPUID_EAX_17_ECX_N_EAX() = default;
+  constexpr explicit CPUID_EAX_17_ECX_N_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_17_ECX_N::Eax)>
+  static constexpr CPUID_EAX_17_ECX_N_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_17_ECX_N_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_17_ECX_N_EAX&, const CPUID_EAX_17_ECX_N_EAX&) = default;
+
+  /**
+   * Reserved = 0.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_17_ECX_N_EAX with_reserved(UINT32 value) const { return CPUID_EAX_17_ECX_N_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_17_ECX_N_EAX) == 4, "Size of CPUID_EAX_17_ECX_N_EAX");
+
+class CPUID_EAX_17_ECX_N_EBX
+{
+public:
+  constexpr CPUID_EAX_17_ECX_N_EBX() = default;
+  constexpr explicit CPUID_EAX_17_ECX_N_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_17_ECX_N::Ebx)>
+  static constexpr CPUID_EAX_17_ECX_N_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_17_ECX_N_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_17_ECX_N_EBX&, const CPUID_EAX_17_ECX_N_EBX&) = default;
+
+  /**
+   * Reserved = 0.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_17_ECX_N_EBX with_reserved(UINT32 value) const { return CPUID_EAX_17_ECX_N_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_17_ECX_N_EBX) == 4, "Size of CPUID_EAX_17_ECX_N_EBX");
+
+class CPUID_EAX_17_ECX_N_ECX
+{
+public:
+  constexpr CPUID_EAX_17_ECX_N_ECX() = default;
+  constexpr explicit CPUID_EAX_17_ECX_N_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_17_ECX_N::Ecx)>
+  static constexpr CPUID_EAX_17_ECX_N_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_17_ECX_N_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_17_ECX_N_ECX&, const CPUID_EAX_17_ECX_N_ECX&) = default;
+
+  /**
+   * Reserved = 0.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_17_ECX_N_ECX with_reserved(UINT32 value) const { return CPUID_EAX_17_ECX_N_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_17_ECX_N_ECX) == 4, "Size of CPUID_EAX_17_ECX_N_ECX");
+
+class CPUID_EAX_17_ECX_N_EDX
+{
+public:
+  constexpr CPUID_EAX_17_ECX_N_EDX() = default;
+  constexpr explicit CPUID_EAX_17_ECX_N_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_17_ECX_N::Edx)>
+  static constexpr CPUID_EAX_17_ECX_N_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_17_ECX_N_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_17_ECX_N_EDX&, const CPUID_EAX_17_ECX_N_EDX&) = default;
+
+  /**
+   * Reserved = 0.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_17_ECX_N_EDX with_reserved(UINT32 value) const { return CPUID_EAX_17_ECX_N_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_17_ECX_N_EDX) == 4, "Size of CPUID_EAX_17_ECX_N_EDX");
+
+class CPUID_EAX_18_ECX_00_EAX
+{
+public:
+  constexpr CPUID_EAX_18_ECX_00_EAX() = default;
+  constexpr explicit CPUID_EAX_18_ECX_00_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_18_ECX_00::Eax)>
+  static constexpr CPUID_EAX_18_ECX_00_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_18_ECX_00_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_18_ECX_00_EAX&, const CPUID_EAX_18_ECX_00_EAX&) = default;
+
+  /**
+   * Reports the maximum input value of supported sub-leaf in leaf 18H.
+   */
+  constexpr UINT32 max_sub_leaf() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_18_ECX_00_EAX with_max_sub_leaf(UINT32 value) const { return CPUID_EAX_18_ECX_00_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_18_ECX_00_EAX) == 4, "Size of CPUID_EAX_18_ECX_00_EAX");
+
+class CPUID_EAX_18_ECX_00_EBX
+{
+public:
+  constexpr CPUID_EAX_18_ECX_00_EBX() = default;
+  constexpr explicit CPUID_EAX_18_ECX_00_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_18_ECX_00::Ebx)>
+  static constexpr CPUID_EAX_18_ECX_00_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_18_ECX_00_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_18_ECX_00_EBX&, const CPUID_EAX_18_ECX_00_EBX&) = default;
+
+  /**
+   * 4K page size entries supported by this structure.
+   */
+  constexpr UINT32 page_entries_4kb_supported() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_18_ECX_00_EBX with_page_entries_4kb_supported(UINT32 value) const { return CPUID_EAX_18_ECX_00_EBX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * 2MB page size entries supported by this structure.
+   */
+  constexpr UINT32 page_entries_2mb_supported() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_18_ECX_00_EBX with_page_entries_2mb_supported(UINT32 value) const { return CPUID_EAX_18_ECX_00_EBX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * 4MB page size entries supported by this structure.
+   */
+  constexpr UINT32 page_entries_4mb_supported() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_18_ECX_00_EBX with_page_entries_4mb_supported(UINT32 value) const { return CPUID_EAX_18_ECX_00_EBX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * 1 GB page size entries supported by this structure.
+   */
+  constexpr UINT32 page_entries_1gb_supported() const { return (Flags >> 3) & 0x01U; }
+  constexpr CPUID_EAX_18_ECX_00_EBX with_page_entries_1gb_supported(UINT32 value) const { return CPUID_EAX_18_ECX_00_EBX((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+  /**
+   * Partitioning (0: Soft partitioning between the logical processors sharing this structure).
+   */
+  constexpr UINT32 partitioning() const { return (Flags >> 8) & 0x07U; }
+  constexpr CPUID_EAX_18_ECX_00_EBX with_partitioning(UINT32 value) const { return CPUID_EAX_18_ECX_00_EBX((Flags & ~0x700U) | ((value & 0x07U) << 8)); }
+
+  /**
+   * W = Ways of associativity.
+   */
+  constexpr UINT32 ways_of_associativity_00() const { return (Flags >> 16) & 0xFFFFU; }
+  constexpr CPUID_EAX_18_ECX_00_EBX with_ways_of_associativity_00(UINT32 value) const { return CPUID_EAX_18_ECX_00_EBX((Flags & ~0xFFFF0000U) | ((value & 0xFFFFU) << 16)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_18_ECX_00_EBX) == 4, "Size of CPUID_EAX_18_ECX_00_EBX");
+
+class CPUID_EAX_18_ECX_00_ECX
+{
+public:
+  constexpr CPUID_EAX_18_ECX_00_ECX() = default;
+  constexpr explicit CPUID_EAX_18_ECX_00_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_18_ECX_00::Ecx)>
+  static constexpr CPUID_EAX_18_ECX_00_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_18_ECX_00_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_18_ECX_00_ECX&, const CPUID_EAX_18_ECX_00_ECX&) = default;
+
+  /**
+   * Number of Sets.
+   */
+  constexpr UINT32 number_of_sets() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_18_ECX_00_ECX with_number_of_sets(UINT32 value) const { return CPUID_EAX_18_ECX_00_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_18_ECX_00_ECX) == 4, "Size of CPUID_EAX_18_ECX_00_ECX");
+
+class CPUID_EAX_18_ECX_00_EDX
+{
+public:
+  constexpr CPUID_EAX_18_ECX_00_EDX() = default;
+  constexpr explicit CPUID_EAX_18_ECX_00_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_18_ECX_00::Edx)>
+  static constexpr CPUID_EAX_18_ECX_00_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_18_ECX_00_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_18_ECX_00_EDX&, const CPUID_EAX_18_ECX_00_EDX&) = default;
+
+  /**
+   * Translation cache type field.
+   * - 00000b: Null (indicates this sub-leaf is not valid).
+   * - 00001b: Data TLB.
+   * - 00010b: Instruction TLB.
+   * - 00011b: Unified TLB.
+   * All other encodings are reserved.
+   */
+  constexpr UINT32 translation_cache_type_field() const { return (Flags >> 0) & 0x1FU; }
+  constexpr CPUID_EAX_18_ECX_00_EDX with_translation_cache_type_field(UINT32 value) const { return CPUID_EAX_18_ECX_00_EDX((Flags & ~0x1FU) | ((value & 0x1FU) << 0)); }
+
+  /**
+   * Translation cache level (starts at 1).
+   */
+  constexpr UINT32 translation_cache_level() const { return (Flags >> 5) & 0x07U; }
+  constexpr CPUID_EAX_18_ECX_00_EDX with_translation_cache_level(UINT32 value) const { return CPUID_EAX_18_ECX_00_EDX((Flags & ~0xE0U) | ((value & 0x07U) << 5)); }
+
+  /**
+   * Fully associative structure.
+   */
+  constexpr UINT32 fully_associative_structure() const { return (Flags >> 8) & 0x01U; }
+  constexpr CPUID_EAX_18_ECX_00_EDX with_fully_associative_structure(UINT32 value) const { return CPUID_EAX_18_ECX_00_EDX((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+  /**
+   * Maximum number of addressable IDs for logical processors sharing this translation cache.
+   */
+  constexpr UINT32 max_addressable_ids_for_logical_processors() const { return (Flags >> 14) & 0xFFFU; }
+  constexpr CPUID_EAX_18_ECX_00_EDX with_max_addressable_ids_for_logical_processors(UINT32 value) const { return CPUID_EAX_18_ECX_00_EDX((Flags & ~0x3FFC000U) | ((value & 0xFFFU) << 14)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_18_ECX_00_EDX) == 4, "Size of CPUID_EAX_18_ECX_00_EDX");
+
+class CPUID_EAX_18_ECX_01P_EAX
+{
+public:
+  constexpr CPUID_EAX_18_ECX_01P_EAX() = default;
+  constexpr explicit CPUID_EAX_18_ECX_01P_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_18_ECX_01P::Eax)>
+  static constexpr CPUID_EAX_18_ECX_01P_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_18_ECX_01P_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_18_ECX_01P_EAX&, const CPUID_EAX_18_ECX_01P_EAX&) = default;
+
+  /**
+   * EAX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_18_ECX_01P_EAX with_reserved(UINT32 value) const { return CPUID_EAX_18_ECX_01P_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_18_ECX_01P_EAX) == 4, "Size of CPUID_EAX_18_ECX_01P_EAX");
+
+class CPUID_EAX_18_ECX_01P_EBX
+{
+public:
+  constexpr CPUID_EAX_18_ECX_01P_EBX() = default;
+  constexpr explicit CPUID_EAX_18_ECX_01P_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_18_ECX_01P::Ebx)>
+  static constexpr CPUID_EAX_18_ECX_01P_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_18_ECX_01P_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_18_ECX_01P_EBX&, const CPUID_EAX_18_ECX_01P_EBX&) = default;
+
+  /**
+   * 4K page size entries supported by this structure.
+   */
+  constexpr UINT32 page_entries_4kb_supported() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_18_ECX_01P_EBX with_page_entries_4kb_supported(UINT32 value) const { return CPUID_EAX_18_ECX_01P_EBX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * 2MB page size entries supported by this structure.
+   */
+  constexpr UINT32 page_entries_2mb_supported() const { return (Flags >> 1) & 0x01U; }
+  constexpr CPUID_EAX_18_ECX_01P_EBX with_page_entries_2mb_supported(UINT32 value) const { return CPUID_EAX_18_ECX_01P_EBX((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * 4MB page size entries supported by this structure.
+   */
+  constexpr UINT32 page_entries_4mb_supported() const { return (Flags >> 2) & 0x01U; }
+  constexpr CPUID_EAX_18_ECX_01P_EBX with_page_entries_4mb_supported(UINT32 value) const { return CPUID_EAX_18_ECX_01P_EBX((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * 1 GB page size entries supported by this structure.
+   */
+  constexpr UINT32 page_entries_1gb_supported() const { return (Flags >> 3) & 0x01U; }
+  constexpr CPUID_EAX_18_ECX_01P_EBX with_page_entries_1gb_supported(UINT32 value) const { return CPUID_EAX_18_ECX_01P_EBX((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+  /**
+   * Partitioning (0: Soft partitioning between the logical processors sharing this structure).
+   */
+  constexpr UINT32 partitioning() const { return (Flags >> 8) & 0x07U; }
+  constexpr CPUID_EAX_18_ECX_01P_EBX with_partitioning(UINT32 value) const { return CPUID_EAX_18_ECX_01P_EBX((Flags & ~0x700U) | ((value & 0x07U) << 8)); }
+
+  /**
+   * W = Ways of associativity.
+   */
+  constexpr UINT32 ways_of_associativity_01() const { return (Flags >> 16) & 0xFFFFU; }
+  constexpr CPUID_EAX_18_ECX_01P_EBX with_ways_of_associativity_01(UINT32 value) const { return CPUID_EAX_18_ECX_01P_EBX((Flags & ~0xFFFF0000U) | ((value & 0xFFFFU) << 16)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_18_ECX_01P_EBX) == 4, "Size of CPUID_EAX_18_ECX_01P_EBX");
+
+class CPUID_EAX_18_ECX_01P_ECX
+{
+public:
+  constexpr CPUID_EAX_18_ECX_01P_ECX() = default;
+  constexpr explicit CPUID_EAX_18_ECX_01P_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_18_ECX_01P::Ecx)>
+  static constexpr CPUID_EAX_18_ECX_01P_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_18_ECX_01P_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_18_ECX_01P_ECX&, const CPUID_EAX_18_ECX_01P_ECX&) = default;
+
+  /**
+   * Number of Sets.
+   */
+  constexpr UINT32 number_of_sets() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_18_ECX_01P_ECX with_number_of_sets(UINT32 value) const { return CPUID_EAX_18_ECX_01P_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_18_ECX_01P_ECX) == 4, "Size of CPUID_EAX_18_ECX_01P_ECX");
+
+class CPUID_EAX_18_ECX_01P_EDX
+{
+public:
+  constexpr CPUID_EAX_18_ECX_01P_EDX() = default;
+  constexpr explicit CPUID_EAX_18_ECX_01P_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_18_ECX_01P::Edx)>
+  static constexpr CPUID_EAX_18_ECX_01P_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_18_ECX_01P_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_18_ECX_01P_EDX&, const CPUID_EAX_18_ECX_01P_EDX&) = default;
+
+  /**
+   * Translation cache type field.
+   * - 00000b: Null (indicates this sub-leaf is not valid).
+   * - 00001b: Data TLB.
+   * - 00010b: Instruction TLB.
+   * - 00011b: Unified TLB.
+   * All other encodings are reserved.
+   */
+  constexpr UINT32 translation_cache_type_field() const { return (Flags >> 0) & 0x1FU; }
+  constexpr CPUID_EAX_18_ECX_01P_EDX with_translation_cache_type_field(UINT32 value) const { return CPUID_EAX_18_ECX_01P_EDX((Flags & ~0x1FU) | ((value & 0x1FU) << 0)); }
+
+  /**
+   * Translation cache level (starts at 1).
+   */
+  constexpr UINT32 translation_cache_level() const { return (Flags >> 5) & 0x07U; }
+  constexpr CPUID_EAX_18_ECX_01P_EDX with_translation_cache_level(UINT32 value) const { return CPUID_EAX_18_ECX_01P_EDX((Flags & ~0xE0U) | ((value & 0x07U) << 5)); }
+
+  /**
+   * Fully associative structure.
+   */
+  constexpr UINT32 fully_associative_structure() const { return (Flags >> 8) & 0x01U; }
+  constexpr CPUID_EAX_18_ECX_01P_EDX with_fully_associative_structure(UINT32 value) const { return CPUID_EAX_18_ECX_01P_EDX((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+  /**
+   * Maximum number of addressable IDs for logical processors sharing this translation cache.
+   */
+  constexpr UINT32 max_addressable_ids_for_logical_processors() const { return (Flags >> 14) & 0xFFFU; }
+  constexpr CPUID_EAX_18_ECX_01P_EDX with_max_addressable_ids_for_logical_processors(UINT32 value) const { return CPUID_EAX_18_ECX_01P_EDX((Flags & ~0x3FFC000U) | ((value & 0xFFFU) << 14)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_18_ECX_01P_EDX) == 4, "Size of CPUID_EAX_18_ECX_01P_EDX");
+
+class CPUID_EAX_80000000_EAX
+{
+public:
+  constexpr CPUID_EAX_80000000_EAX() = default;
+  constexpr explicit CPUID_EAX_80000000_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000000::Eax)>
+  static constexpr CPUID_EAX_80000000_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000000_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000000_EAX&, const CPUID_EAX_80000000_EAX&) = default;
+
+  /**
+   * Maximum Input Value for Extended Function CPUID Information.
+   */
+  constexpr UINT32 max_extended_functions() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000000_EAX with_max_extended_functions(UINT32 value) const { return CPUID_EAX_80000000_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000000_EAX) == 4, "Size of CPUID_EAX_80000000_EAX");
+
+class CPUID_EAX_80000000_EBX
+{
+public:
+  constexpr CPUID_EAX_80000000_EBX() = default;
+  constexpr explicit CPUID_EAX_80000000_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000000::Ebx)>
+  static constexpr CPUID_EAX_80000000_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000000_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000000_EBX&, const CPUID_EAX_80000000_EBX&) = default;
+
+  /**
+   * EBX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000000_EBX with_reserved(UINT32 value) const { return CPUID_EAX_80000000_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000000_EBX) == 4, "Size of CPUID_EAX_80000000_EBX");
+
+class CPUID_EAX_80000000_ECX
+{
+public:
+  constexpr CPUID_EAX_80000000_ECX() = default;
+  constexpr explicit CPUID_EAX_80000000_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000000::Ecx)>
+  static constexpr CPUID_EAX_80000000_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000000_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000000_ECX&, const CPUID_EAX_80000000_ECX&) = default;
+
+  /**
+   * ECX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000000_ECX with_reserved(UINT32 value) const { return CPUID_EAX_80000000_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000000_ECX) == 4, "Size of CPUID_EAX_80000000_ECX");
+
+class CPUID_EAX_80000000_EDX
+{
+public:
+  constexpr CPUID_EAX_80000000_EDX() = default;
+  constexpr explicit CPUID_EAX_80000000_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000000::Edx)>
+  static constexpr CPUID_EAX_80000000_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000000_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000000_EDX&, const CPUID_EAX_80000000_EDX&) = default;
+
+  /**
+   * EDX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000000_EDX with_reserved(UINT32 value) const { return CPUID_EAX_80000000_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000000_EDX) == 4, "Size of CPUID_EAX_80000000_EDX");
+
+class CPUID_EAX_80000001_EAX
+{
+public:
+  constexpr CPUID_EAX_80000001_EAX() = default;
+  constexpr explicit CPUID_EAX_80000001_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000001::Eax)>
+  static constexpr CPUID_EAX_80000001_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000001_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000001_EAX&, const CPUID_EAX_80000001_EAX&) = default;
+
+  /**
+   * EAX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000001_EAX with_reserved(UINT32 value) const { return CPUID_EAX_80000001_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000001_EAX) == 4, "Size of CPUID_EAX_80000001_EAX");
+
+class CPUID_EAX_80000001_EBX
+{
+public:
+  constexpr CPUID_EAX_80000001_EBX() = default;
+  constexpr explicit CPUID_EAX_80000001_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000001::Ebx)>
+  static constexpr CPUID_EAX_80000001_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000001_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000001_EBX&, const CPUID_EAX_80000001_EBX&) = default;
+
+  /**
+   * EBX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000001_EBX with_reserved(UINT32 value) const { return CPUID_EAX_80000001_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000001_EBX) == 4, "Size of CPUID_EAX_80000001_EBX");
+
+class CPUID_EAX_80000001_ECX
+{
+public:
+  constexpr CPUID_EAX_80000001_ECX() = default;
+  constexpr explicit CPUID_EAX_80000001_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000001::Ecx)>
+  static constexpr CPUID_EAX_80000001_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000001_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000001_ECX&, const CPUID_EAX_80000001_ECX&) = default;
+
+  /**
+   * LAHF/SAHF available in 64-bit mode.
+   */
+  constexpr UINT32 lahf_sahf_available_in_64_bit_mode() const { return (Flags >> 0) & 0x01U; }
+  constexpr CPUID_EAX_80000001_ECX with_lahf_sahf_available_in_64_bit_mode(UINT32 value) const { return CPUID_EAX_80000001_ECX((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * LZCNT.
+   */
+  constexpr UINT32 lzcnt() const { return (Flags >> 5) & 0x01U; }
+  constexpr CPUID_EAX_80000001_ECX with_lzcnt(UINT32 value) const { return CPUID_EAX_80000001_ECX((Flags & ~0x20U) | ((value & 0x01U) << 5)); }
+
+  /**
+   * PREFETCHW.
+   */
+  constexpr UINT32 prefetchw() const { return (Flags >> 8) & 0x01U; }
+  constexpr CPUID_EAX_80000001_ECX with_prefetchw(UINT32 value) const { return CPUID_EAX_80000001_ECX((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000001_ECX) == 4, "Size of CPUID_EAX_80000001_ECX");
+
+class CPUID_EAX_80000001_EDX
+{
+public:
+  constexpr CPUID_EAX_80000001_EDX() = default;
+  constexpr explicit CPUID_EAX_80000001_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000001::Edx)>
+  static constexpr CPUID_EAX_80000001_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000001_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000001_EDX&, const CPUID_EAX_80000001_EDX&) = default;
+
+  /**
+   * SYSCALL/SYSRET available in 64-bit mode.
+   */
+  constexpr UINT32 syscall_sysret_available_in_64_bit_mode() const { return (Flags >> 11) & 0x01U; }
+  constexpr CPUID_EAX_80000001_EDX with_syscall_sysret_available_in_64_bit_mode(UINT32 value) const { return CPUID_EAX_80000001_EDX((Flags & ~0x800U) | ((value & 0x01U) << 11)); }
+
+  /**
+   * Execute Disable Bit available.
+   */
+  constexpr UINT32 execute_disable_bit_available() const { return (Flags >> 20) & 0x01U; }
+  constexpr CPUID_EAX_80000001_EDX with_execute_disable_bit_available(UINT32 value) const { return CPUID_EAX_80000001_EDX((Flags & ~0x100000U) | ((value & 0x01U) << 20)); }
+
+  /**
+   * 1-GByte pages are available if 1.
+   */
+  constexpr UINT32 pages_1gb_available() const { return (Flags >> 26) & 0x01U; }
+  constexpr CPUID_EAX_80000001_EDX with_pages_1gb_available(UINT32 value) const { return CPUID_EAX_80000001_EDX((Flags & ~0x4000000U) | ((value & 0x01U) << 26)); }
+
+  /**
+   * RDTSCP and IA32_TSC_AUX are available if 1.
+   */
+  constexpr UINT32 rdtscp_available() const { return (Flags >> 27) & 0x01U; }
+  constexpr CPUID_EAX_80000001_EDX with_rdtscp_available(UINT32 value) const { return CPUID_EAX_80000001_EDX((Flags & ~0x8000000U) | ((value & 0x01U) << 27)); }
+
+  /**
+   * Intel(R) 64 Architecture available if 1.
+   */
+  constexpr UINT32 ia64_available() const { return (Flags >> 29) & 0x01U; }
+  constexpr CPUID_EAX_80000001_EDX with_ia64_available(UINT32 value) const { return CPUID_EAX_80000001_EDX((Flags & ~0x20000000U) | ((value & 0x01U) << 29)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000001_EDX) == 4, "Size of CPUID_EAX_80000001_EDX");
+
+class CPUID_EAX_80000002_EAX
+{
+public:
+  constexpr CPUID_EAX_80000002_EAX() = default;
+  constexpr explicit CPUID_EAX_80000002_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000002::Eax)>
+  static constexpr CPUID_EAX_80000002_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000002_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000002_EAX&, const CPUID_EAX_80000002_EAX&) = default;
+
+  /**
+   * Processor Brand String.
+   */
+  constexpr UINT32 processor_brand_string_1() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000002_EAX with_processor_brand_string_1(UINT32 value) const { return CPUID_EAX_80000002_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000002_EAX) == 4, "Size of CPUID_EAX_80000002_EAX");
+
+class CPUID_EAX_80000002_EBX
+{
+public:
+  constexpr CPUID_EAX_80000002_EBX() = default;
+  constexpr explicit CPUID_EAX_80000002_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000002::Ebx)>
+  static constexpr CPUID_EAX_80000002_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000002_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000002_EBX&, const CPUID_EAX_80000002_EBX&) = default;
+
+  /**
+   * Processor Brand String Continued.
+   */
+  constexpr UINT32 processor_brand_string_2() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000002_EBX with_processor_brand_string_2(UINT32 value) const { return CPUID_EAX_80000002_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000002_EBX) == 4, "Size of CPUID_EAX_80000002_EBX");
+
+class CPUID_EAX_80000002_ECX
+{
+public:
+  constexpr CPUID_EAX_80000002_ECX() = default;
+  constexpr explicit CPUID_EAX_80000002_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000002::Ecx)>
+  static constexpr CPUID_EAX_80000002_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000002_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000002_ECX&, const CPUID_EAX_80000002_ECX&) = default;
+
+  /**
+   * Processor Brand String Continued.
+   */
+  constexpr UINT32 processor_brand_string_3() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000002_ECX with_processor_brand_string_3(UINT32 value) const { return CPUID_EAX_80000002_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000002_ECX) == 4, "Size of CPUID_EAX_80000002_ECX");
+
+class CPUID_EAX_80000002_EDX
+{
+public:
+  constexpr CPUID_EAX_80000002_EDX() = default;
+  constexpr explicit CPUID_EAX_80000002_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000002::Edx)>
+  static constexpr CPUID_EAX_80000002_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000002_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000002_EDX&, const CPUID_EAX_80000002_EDX&) = default;
+
+  /**
+   * Processor Brand String Continued.
+   */
+  constexpr UINT32 processor_brand_string_4() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000002_EDX with_processor_brand_string_4(UINT32 value) const { return CPUID_EAX_80000002_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000002_EDX) == 4, "Size of CPUID_EAX_80000002_EDX");
+
+class CPUID_EAX_80000003_EAX
+{
+public:
+  constexpr CPUID_EAX_80000003_EAX() = default;
+  constexpr explicit CPUID_EAX_80000003_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000003::Eax)>
+  static constexpr CPUID_EAX_80000003_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000003_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000003_EAX&, const CPUID_EAX_80000003_EAX&) = default;
+
+  /**
+   * Processor Brand String Continued.
+   */
+  constexpr UINT32 processor_brand_string_5() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000003_EAX with_processor_brand_string_5(UINT32 value) const { return CPUID_EAX_80000003_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000003_EAX) == 4, "Size of CPUID_EAX_80000003_EAX");
+
+class CPUID_EAX_80000003_EBX
+{
+public:
+  constexpr CPUID_EAX_80000003_EBX() = default;
+  constexpr explicit CPUID_EAX_80000003_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000003::Ebx)>
+  static constexpr CPUID_EAX_80000003_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000003_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000003_EBX&, const CPUID_EAX_80000003_EBX&) = default;
+
+  /**
+   * Processor Brand String Continued.
+   */
+  constexpr UINT32 processor_brand_string_6() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000003_EBX with_processor_brand_string_6(UINT32 value) const { return CPUID_EAX_80000003_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000003_EBX) == 4, "Size of CPUID_EAX_80000003_EBX");
+
+class CPUID_EAX_80000003_ECX
+{
+public:
+  constexpr CPUID_EAX_80000003_ECX() = default;
+  constexpr explicit CPUID_EAX_80000003_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000003::Ecx)>
+  static constexpr CPUID_EAX_80000003_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000003_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000003_ECX&, const CPUID_EAX_80000003_ECX&) = default;
+
+  /**
+   * Processor Brand String Continued.
+   */
+  constexpr UINT32 processor_brand_string_7() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000003_ECX with_processor_brand_string_7(UINT32 value) const { return CPUID_EAX_80000003_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000003_ECX) == 4, "Size of CPUID_EAX_80000003_ECX");
+
+class CPUID_EAX_80000003_EDX
+{
+public:
+  constexpr CPUID_EAX_80000003_EDX() = default;
+  constexpr explicit CPUID_EAX_80000003_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000003::Edx)>
+  static constexpr CPUID_EAX_80000003_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000003_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000003_EDX&, const CPUID_EAX_80000003_EDX&) = default;
+
+  /**
+   * Processor Brand String Continued.
+   */
+  constexpr UINT32 processor_brand_string_8() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000003_EDX with_processor_brand_string_8(UINT32 value) const { return CPUID_EAX_80000003_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000003_EDX) == 4, "Size of CPUID_EAX_80000003_EDX");
+
+class CPUID_EAX_80000004_EAX
+{
+public:
+  constexpr CPUID_EAX_80000004_EAX() = default;
+  constexpr explicit CPUID_EAX_80000004_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000004::Eax)>
+  static constexpr CPUID_EAX_80000004_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000004_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000004_EAX&, const CPUID_EAX_80000004_EAX&) = default;
+
+  /**
+   * Processor Brand String Continued.
+   */
+  constexpr UINT32 processor_brand_string_9() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000004_EAX with_processor_brand_string_9(UINT32 value) const { return CPUID_EAX_80000004_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000004_EAX) == 4, "Size of CPUID_EAX_80000004_EAX");
+
+class CPUID_EAX_80000004_EBX
+{
+public:
+  constexpr CPUID_EAX_80000004_EBX() = default;
+  constexpr explicit CPUID_EAX_80000004_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000004::Ebx)>
+  static constexpr CPUID_EAX_80000004_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000004_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000004_EBX&, const CPUID_EAX_80000004_EBX&) = default;
+
+  /**
+   * Processor Brand String Continued.
+   */
+  constexpr UINT32 processor_brand_string_10() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000004_EBX with_processor_brand_string_10(UINT32 value) const { return CPUID_EAX_80000004_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000004_EBX) == 4, "Size of CPUID_EAX_80000004_EBX");
+
+class CPUID_EAX_80000004_ECX
+{
+public:
+  constexpr CPUID_EAX_80000004_ECX() = default;
+  constexpr explicit CPUID_EAX_80000004_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000004::Ecx)>
+  static constexpr CPUID_EAX_80000004_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000004_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000004_ECX&, const CPUID_EAX_80000004_ECX&) = default;
+
+  /**
+   * Processor Brand String Continued.
+   */
+  constexpr UINT32 processor_brand_string_11() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000004_ECX with_processor_brand_string_11(UINT32 value) const { return CPUID_EAX_80000004_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000004_ECX) == 4, "Size of CPUID_EAX_80000004_ECX");
+
+class CPUID_EAX_80000004_EDX
+{
+public:
+  constexpr CPUID_EAX_80000004_EDX() = default;
+  constexpr explicit CPUID_EAX_80000004_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000004::Edx)>
+  static constexpr CPUID_EAX_80000004_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000004_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000004_EDX&, const CPUID_EAX_80000004_EDX&) = default;
+
+  /**
+   * Processor Brand String Continued.
+   */
+  constexpr UINT32 processor_brand_string_12() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000004_EDX with_processor_brand_string_12(UINT32 value) const { return CPUID_EAX_80000004_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000004_EDX) == 4, "Size of CPUID_EAX_80000004_EDX");
+
+class CPUID_EAX_80000005_EAX
+{
+public:
+  constexpr CPUID_EAX_80000005_EAX() = default;
+  constexpr explicit CPUID_EAX_80000005_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000005::Eax)>
+  static constexpr CPUID_EAX_80000005_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000005_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000005_EAX&, const CPUID_EAX_80000005_EAX&) = default;
+
+  /**
+   * EAX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000005_EAX with_reserved(UINT32 value) const { return CPUID_EAX_80000005_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000005_EAX) == 4, "Size of CPUID_EAX_80000005_EAX");
+
+class CPUID_EAX_80000005_EBX
+{
+public:
+  constexpr CPUID_EAX_80000005_EBX() = default;
+  constexpr explicit CPUID_EAX_80000005_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000005::Ebx)>
+  static constexpr CPUID_EAX_80000005_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000005_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000005_EBX&, const CPUID_EAX_80000005_EBX&) = default;
+
+  /**
+   * EBX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000005_EBX with_reserved(UINT32 value) const { return CPUID_EAX_80000005_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000005_EBX) == 4, "Size of CPUID_EAX_80000005_EBX");
+
+class CPUID_EAX_80000005_ECX
+{
+public:
+  constexpr CPUID_EAX_80000005_ECX() = default;
+  constexpr explicit CPUID_EAX_80000005_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000005::Ecx)>
+  static constexpr CPUID_EAX_80000005_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000005_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000005_ECX&, const CPUID_EAX_80000005_ECX&) = default;
+
+  /**
+   * ECX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000005_ECX with_reserved(UINT32 value) const { return CPUID_EAX_80000005_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000005_ECX) == 4, "Size of CPUID_EAX_80000005_ECX");
+
+class CPUID_EAX_80000005_EDX
+{
+public:
+  constexpr CPUID_EAX_80000005_EDX() = default;
+  constexpr explicit CPUID_EAX_80000005_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000005::Edx)>
+  static constexpr CPUID_EAX_80000005_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000005_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000005_EDX&, const CPUID_EAX_80000005_EDX&) = default;
+
+  /**
+   * EDX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000005_EDX with_reserved(UINT32 value) const { return CPUID_EAX_80000005_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000005_EDX) == 4, "Size of CPUID_EAX_80000005_EDX");
+
+class CPUID_EAX_80000006_EAX
+{
+public:
+  constexpr CPUID_EAX_80000006_EAX() = default;
+  constexpr explicit CPUID_EAX_80000006_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000006::Eax)>
+  static constexpr CPUID_EAX_80000006_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000006_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000006_EAX&, const CPUID_EAX_80000006_EAX&) = default;
+
+  /**
+   * EAX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000006_EAX with_reserved(UINT32 value) const { return CPUID_EAX_80000006_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000006_EAX) == 4, "Size of CPUID_EAX_80000006_EAX");
+
+class CPUID_EAX_80000006_EBX
+{
+public:
+  constexpr CPUID_EAX_80000006_EBX() = default;
+  constexpr explicit CPUID_EAX_80000006_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000006::Ebx)>
+  static constexpr CPUID_EAX_80000006_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000006_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000006_EBX&, const CPUID_EAX_80000006_EBX&) = default;
+
+  /**
+   * EBX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000006_EBX with_reserved(UINT32 value) const { return CPUID_EAX_80000006_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000006_EBX) == 4, "Size of CPUID_EAX_80000006_EBX");
+
+class CPUID_EAX_80000006_ECX
+{
+public:
+  constexpr CPUID_EAX_80000006_ECX() = default;
+  constexpr explicit CPUID_EAX_80000006_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000006::Ecx)>
+  static constexpr CPUID_EAX_80000006_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000006_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000006_ECX&, const CPUID_EAX_80000006_ECX&) = default;
+
+  /**
+   * Cache Line size in bytes.
+   */
+  constexpr UINT32 cache_line_size_in_bytes() const { return (Flags >> 0) & 0xFFU; }
+  constexpr CPUID_EAX_80000006_ECX with_cache_line_size_in_bytes(UINT32 value) const { return CPUID_EAX_80000006_ECX((Flags & ~0xFFU) | ((value & 0xFFU) << 0)); }
+
+  /**
+   * L2 Associativity field.
+   * L2 associativity field encodings:
+   * - 00H - Disabled.
+   * - 01H - Direct mapped.
+   * - 02H - 2-way.
+   * - 04H - 4-way.
+   * - 06H - 8-way.
+   * - 08H - 16-way.
+   * - 0FH - Fully associative.
+   */
+  constexpr UINT32 l2_associativity_field() const { return (Flags >> 12) & 0x0FU; }
+  constexpr CPUID_EAX_80000006_ECX with_l2_associativity_field(UINT32 value) const { return CPUID_EAX_80000006_ECX((Flags & ~0xF000U) | ((value & 0x0FU) << 12)); }
+
+  /**
+   * Cache size in 1K units.
+   */
+  constexpr UINT32 cache_size_in_1k_units() const { return (Flags >> 16) & 0xFFFFU; }
+  constexpr CPUID_EAX_80000006_ECX with_cache_size_in_1k_units(UINT32 value) const { return CPUID_EAX_80000006_ECX((Flags & ~0xFFFF0000U) | ((value & 0xFFFFU) << 16)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000006_ECX) == 4, "Size of CPUID_EAX_80000006_ECX");
+
+class CPUID_EAX_80000006_EDX
+{
+public:
+  constexpr CPUID_EAX_80000006_EDX() = default;
+  constexpr explicit CPUID_EAX_80000006_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000006::Edx)>
+  static constexpr CPUID_EAX_80000006_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000006_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000006_EDX&, const CPUID_EAX_80000006_EDX&) = default;
+
+  /**
+   * EDX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000006_EDX with_reserved(UINT32 value) const { return CPUID_EAX_80000006_EDX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000006_EDX) == 4, "Size of CPUID_EAX_80000006_EDX");
+
+class CPUID_EAX_80000007_EAX
+{
+public:
+  constexpr CPUID_EAX_80000007_EAX() = default;
+  constexpr explicit CPUID_EAX_80000007_EAX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000007::Eax)>
+  static constexpr CPUID_EAX_80000007_EAX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000007_EAX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000007_EAX&, const CPUID_EAX_80000007_EAX&) = default;
+
+  /**
+   * EAX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000007_EAX with_reserved(UINT32 value) const { return CPUID_EAX_80000007_EAX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000007_EAX) == 4, "Size of CPUID_EAX_80000007_EAX");
+
+class CPUID_EAX_80000007_EBX
+{
+public:
+  constexpr CPUID_EAX_80000007_EBX() = default;
+  constexpr explicit CPUID_EAX_80000007_EBX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000007::Ebx)>
+  static constexpr CPUID_EAX_80000007_EBX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000007_EBX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000007_EBX&, const CPUID_EAX_80000007_EBX&) = default;
+
+  /**
+   * EBX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000007_EBX with_reserved(UINT32 value) const { return CPUID_EAX_80000007_EBX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000007_EBX) == 4, "Size of CPUID_EAX_80000007_EBX");
+
+class CPUID_EAX_80000007_ECX
+{
+public:
+  constexpr CPUID_EAX_80000007_ECX() = default;
+  constexpr explicit CPUID_EAX_80000007_ECX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000007::Ecx)>
+  static constexpr CPUID_EAX_80000007_ECX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000007_ECX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000007_ECX&, const CPUID_EAX_80000007_ECX&) = default;
+
+  /**
+   * ECX is reserved.
+   */
+  constexpr UINT32 reserved() const { return (Flags >> 0) & 0xFFFFFFFFU; }
+  constexpr CPUID_EAX_80000007_ECX with_reserved(UINT32 value) const { return CPUID_EAX_80000007_ECX((Flags & ~0xFFFFFFFFU) | ((value & 0xFFFFFFFFU) << 0)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000007_ECX) == 4, "Size of CPUID_EAX_80000007_ECX");
+
+class CPUID_EAX_80000007_EDX
+{
+public:
+  constexpr CPUID_EAX_80000007_EDX() = default;
+  constexpr explicit CPUID_EAX_80000007_EDX(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::CPUID_EAX_80000007::Edx)>
+  static constexpr CPUID_EAX_80000007_EDX from(const T& raw) { return std::bit_cast<CPUID_EAX_80000007_EDX>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const CPUID_EAX_80000007_EDX&, const CPUID_EAX_80000007_EDX&) = default;
+
+  /**
+   * Invariant TSC available if 1.
+   */
+  constexpr UINT32 invariant_tsc_available() const { return (Flags >> 8) & 0x01U; }
+  constexpr CPUID_EAX_80000007_EDX with_invariant_tsc_available(UINT32 value) const { return CPUID_EAX_80000007_EDX((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(CPUID_EAX_80000007_EDX) == 4, "Size of CPUID_EAX_80000007_EDX");
+
+class IA32_PLATFORM_ID_REGISTER
+{
+public:
+  constexpr IA32_PLATFORM_ID_REGISTER() = default;
+  constexpr explicit IA32_PLATFORM_ID_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PLATFORM_ID_REGISTER>
+  static constexpr IA32_PLATFORM_ID_REGISTER from(const T& raw) { return std::bit_cast<IA32_PLATFORM_ID_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PLATFORM_ID_REGISTER&, const IA32_PLATFORM_ID_REGISTER&) = default;
+
+  /**
+   * @brief Platform Id <b>(RO)</b>
+   *
+   * Contains information concerning the intended platform for the processor.
+   * 
+   * 
+   * 52 | 51 | 50 | _
+   * --:|:--:|:---|-----------------
+   * 0  | 0  | 0  | Processor Flag 0
+   * 0  | 0  | 1  | Processor Flag 1
+   * 0  | 1  | 0  | Processor Flag 2
+   * 0  | 1  | 1  | Processor Flag 3
+   * 1  | 0  | 0  | Processor Flag 4
+   * 1  | 0  | 1  | Processor Flag 5
+   * 1  | 1  | 0  | Processor Flag 6
+   * 1  | 1  | 1  | Processor Flag 7
+   */
+  constexpr UINT64 platform_id() const { return (Flags >> 50) & 0x07ULL; }
+  constexpr IA32_PLATFORM_ID_REGISTER with_platform_id(UINT64 value) const { return IA32_PLATFORM_ID_REGISTER((Flags & ~0x1C000000000000ULL) | ((value & 0x07ULL) << 50)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PLATFORM_ID_REGISTER) == 8, "Size of IA32_PLATFORM_ID_REGISTER");
+
+class IA32_APIC_BASE_REGISTER
+{
+public:
+  constexpr IA32_APIC_BASE_REGISTER() = default;
+  constexpr explicit IA32_APIC_BASE_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_APIC_BASE_REGISTER>
+  static constexpr IA32_APIC_BASE_REGISTER from(const T& raw) { return std::bit_cast<IA32_APIC_BASE_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_APIC_BASE_REGISTER&, const IA32_APIC_BASE_REGISTER&) = default;
+
+  /**
+   * BSP flag.
+   */
+  constexpr UINT64 bsp_flag() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr IA32_APIC_BASE_REGISTER with_bsp_flag(UINT64 value) const { return IA32_APIC_BASE_REGISTER((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * Enable x2APIC mode.
+   */
+  constexpr UINT64 enable_x2apic_mode() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr IA32_APIC_BASE_REGISTER with_enable_x2apic_mode(UINT64 value) const { return IA32_APIC_BASE_REGISTER((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * APIC Global Enable.
+   */
+  constexpr UINT64 apic_global_enable() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_APIC_BASE_REGISTER with_apic_global_enable(UINT64 value) const { return IA32_APIC_BASE_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+  /**
+   * APIC Base.
+   */
+  constexpr UINT64 apic_base() const { return (Flags >> 12) & 0xFFFFFFFFFULL; }
+  constexpr IA32_APIC_BASE_REGISTER with_apic_base(UINT64 value) const { return IA32_APIC_BASE_REGISTER((Flags & ~0xFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFULL) << 12)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_APIC_BASE_REGISTER) == 8, "Size of IA32_APIC_BASE_REGISTER");
+
+class IA32_FEATURE_CONTROL_REGISTER
+{
+public:
+  constexpr IA32_FEATURE_CONTROL_REGISTER() = default;
+  constexpr explicit IA32_FEATURE_CONTROL_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_FEATURE_CONTROL_REGISTER>
+  static constexpr IA32_FEATURE_CONTROL_REGISTER from(const T& raw) { return std::bit_cast<IA32_FEATURE_CONTROL_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_FEATURE_CONTROL_REGISTER&, const IA32_FEATURE_CONTROL_REGISTER&) = default;
+
+  /**
+   * @brief Lock bit <b>(R/WO)</b>
+   *
+   * When set, locks this MSR from being written; writes to this bit will result in GP(0).
+   *
+   * @note Once the Lock bit is set, the contents of this register cannot be modified. Therefore the lock bit must be set
+   *       after configuring support for Intel Virtualization Technology and prior to transferring control to an option ROM or the
+   *       OS. Hence, once the Lock bit is set, the entire IA32_FEATURE_CONTROL contents are preserved across RESET when PWRGOOD is
+   *       not deasserted.
+   * @remarks If any one enumeration condition for defined bit field position greater than bit 0 holds.
+   */
+  constexpr UINT64 lock_bit() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_FEATURE_CONTROL_REGISTER with_lock_bit(UINT64 value) const { return IA32_FEATURE_CONTROL_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * @brief Enable VMX inside SMX operation <b>(R/WL)</b>
+   *
+   * This bit enables a system executive to use VMX in conjunction with SMX to support Intel(R) Trusted Execution Technology.
+   * BIOS must set this bit only when the CPUID function 1 returns VMX feature flag and SMX feature flag set (ECX bits 5 and
+   * 6 respectively).
+   *
+   * @remarks If CPUID.01H:ECX[5] = 1 && CPUID.01H:ECX[6] = 1
+   */
+  constexpr UINT64 enable_vmx_inside_smx() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_FEATURE_CONTROL_REGISTER with_enable_vmx_inside_smx(UINT64 value) const { return IA32_FEATURE_CONTROL_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * @brief Enable VMX outside SMX operation <b>(R/WL)</b>
+   *
+   * This bit enables VMX for a system executive that does not require SMX. BIOS must set this bit only when the CPUID
+   * function 1 returns the VMX feature flag set (ECX bit 5).
+   *
+   * @remarks If CPUID.01H:ECX[5] = 1
+   */
+  constexpr UINT64 enable_vmx_outside_smx() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_FEATURE_CONTROL_REGISTER with_enable_vmx_outside_smx(UINT64 value) const { return IA32_FEATURE_CONTROL_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * @brief SENTER Local Function Enable <b>(R/WL)</b>
+   *
+   * When set, each bit in the field represents an enable control for a corresponding SENTER function. This field is
+   * supported only if CPUID.1:ECX.[bit 6] is set.
+   *
+   * @remarks If CPUID.01H:ECX[6] = 1
+   */
+  constexpr UINT64 senter_local_function_enables() const { return (Flags >> 8) & 0x7FULL; }
+  constexpr IA32_FEATURE_CONTROL_REGISTER with_senter_local_function_enables(UINT64 value) const { return IA32_FEATURE_CONTROL_REGISTER((Flags & ~0x7F00ULL) | ((value & 0x7FULL) << 8)); }
+
+  /**
+   * @brief SENTER Global Enable <b>(R/WL)</b>
+   *
+   * This bit must be set to enable SENTER leaf functions. This bit is supported only if CPUID.1:ECX.[bit 6] is set.
+   *
+   * @remarks If CPUID.01H:ECX[6] = 1
+   */
+  constexpr UINT64 senter_global_enable() const { return (Flags >> 15) & 0x01ULL; }
+  constexpr IA32_FEATURE_CONTROL_REGISTER with_senter_global_enable(UINT64 value) const { return IA32_FEATURE_CONTROL_REGISTER((Flags & ~0x8000ULL) | ((value & 0x01ULL) << 15)); }
+
+  /**
+   * @brief SGX Launch Control Enable <b>(R/WL)</b>
+   *
+   * This bit must be set to enable runtime reconfiguration of SGX Launch Control via the IA32_SGXLEPUBKEYHASHn MSR.
+   *
+   * @remarks If CPUID.(EAX=07H, ECX=0H): ECX[30] = 1
+   */
+  constexpr UINT64 sgx_launch_control_enable() const { return (Flags >> 17) & 0x01ULL; }
+  constexpr IA32_FEATURE_CONTROL_REGISTER with_sgx_launch_control_enable(UINT64 value) const { return IA32_FEATURE_CONTROL_REGISTER((Flags & ~0x20000ULL) | ((value & 0x01ULL) << 17)); }
+
+  /**
+   * @brief SGX Global Enable <b>(R/WL)</b>
+   *
+   * This bit must be set to enable SGX leaf functions.
+   *
+   * @remarks If CPUID.(EAX=07H, ECX=0H): EBX[2] = 1
+   */
+  constexpr UINT64 sgx_global_enable() const { return (Flags >> 18) & 0x01ULL; }
+  constexpr IA32_FEATURE_CONTROL_REGISTER with_sgx_global_enable(UINT64 value) const { return IA32_FEATURE_CONTROL_REGISTER((Flags & ~0x40000ULL) | ((value & 0x01ULL) << 18)); }
+
+  /**
+   * @brief LMCE On <b>(R/WL)</b>
+   *
+   * When set, system software can program the MSRs associated with LMCE to configure delivery of some machine check
+   * exceptions to a single logical processor.
+   *
+   * @remarks If IA32_MCG_CAP[27] = 1
+   */
+  constexpr UINT64 lmce_on() const { return (Flags >> 20) & 0x01ULL; }
+  constexpr IA32_FEATURE_CONTROL_REGISTER with_lmce_on(UINT64 value) const { return IA32_FEATURE_CONTROL_REGISTER((Flags & ~0x100000ULL) | ((value & 0x01ULL) << 20)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_FEATURE_CONTROL_REGISTER) == 8, "Size of IA32_FEATURE_CONTROL_REGISTER");
+
+class IA32_SMM_MONITOR_CTL_REGISTER
+{
+public:
+  constexpr IA32_SMM_MONITOR_CTL_REGISTER() = default;
+  constexpr explicit IA32_SMM_MONITOR_CTL_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_SMM_MONITOR_CTL_REGISTER>
+  static constexpr IA32_SMM_MONITOR_CTL_REGISTER from(const T& raw) { return std::bit_cast<IA32_SMM_MONITOR_CTL_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_SMM_MONITOR_CTL_REGISTER&, const IA32_SMM_MONITOR_CTL_REGISTER&) = default;
+
+  /**
+   * @brief Valid <b>(R/W)</b>
+   *
+   * The STM may be invoked using VMCALL only if this bit is 1. Because VMCALL is used to activate the dual-monitor
+   * treatment, the dual-monitor treatment cannot be activated if the bit is 0. This bit is cleared when the logical
+   * processor is reset.
+   *
+   * @see Vol3C[34.15.6(Activating the Dual-Monitor Treatment)]
+   * @see Vol3C[34.15.5(Enabling the Dual-Monitor Treatment)] (reference)
+   */
+  constexpr UINT64 valid() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_SMM_MONITOR_CTL_REGISTER with_valid(UINT64 value) const { return IA32_SMM_MONITOR_CTL_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * @brief Controls SMI unblocking by VMXOFF
+   *
+   * Determines whether executions of VMXOFF unblock SMIs under the default treatment of SMIs and SMM. Executions of VMXOFF
+   * unblock SMIs unless bit 2 is 1 (the value of bit 0 is irrelevant).
+   *
+   * @remarks If IA32_VMX_MISC[28]
+   * @see Vol3C[34.14.4(VMXOFF and SMI Unblocking)]
+   * @see Vol3C[34.15.5(Enabling the Dual-Monitor Treatment)] (reference)
+   */
+  constexpr UINT64 smi_unblocking_by_vmxoff() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_SMM_MONITOR_CTL_REGISTER with_smi_unblocking_by_vmxoff(UINT64 value) const { return IA32_SMM_MONITOR_CTL_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * @brief MSEG Base <b>(R/W)</b>
+   *
+   * Value that, when shifted left 12 bits, is the physical address of MSEG (the MSEG base address).
+   *
+   * @see Vol3C[34.15.5(Enabling the Dual-Monitor Treatment)] (reference)
+   */
+  constexpr UINT64 mseg_base() const { return (Flags >> 12) & 0xFFFFFULL; }
+  constexpr IA32_SMM_MONITOR_CTL_REGISTER with_mseg_base(UINT64 value) const { return IA32_SMM_MONITOR_CTL_REGISTER((Flags & ~0xFFFFF000ULL) | ((value & 0xFFFFFULL) << 12)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_SMM_MONITOR_CTL_REGISTER) == 8, "Size of IA32_SMM_MONITOR_CTL_REGISTER");
+
+class IA32_MTRR_CAPABILITIES_REGISTER
+{
+public:
+  constexpr IA32_MTRR_CAPABILITIES_REGISTER() = default;
+  constexpr explicit IA32_MTRR_CAPABILITIES_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_MTRR_CAPABILITIES_REGISTER>
+  static constexpr IA32_MTRR_CAPABILITIES_REGISTER from(const T& raw) { return std::bit_cast<IA32_MTRR_CAPABILITIES_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_MTRR_CAPABILITIES_REGISTER&, const IA32_MTRR_CAPABILITIES_REGISTER&) = default;
+
+  /**
+   * @brief VCNT (variable range registers count) field
+   *
+   * Indicates the number of variable ranges implemented on the processor.
+   */
+  constexpr UINT64 variable_range_count() const { return (Flags >> 0) & 0xFFULL; }
+  constexpr IA32_MTRR_CAPABILITIES_REGISTER with_variable_range_count(UINT64 value) const { return IA32_MTRR_CAPABILITIES_REGISTER((Flags & ~0xFFULL) | ((value & 0xFFULL) << 0)); }
+
+  /**
+   * @brief FIX (fixed range registers supported) flag
+   *
+   * Fixed range MTRRs (IA32_MTRR_FIX64K_00000 through IA32_MTRR_FIX4K_0F8000) are supported when set; no fixed range
+   * registers are supported when clear.
+   */
+  constexpr UINT64 fixed_range_supported() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr IA32_MTRR_CAPABILITIES_REGISTER with_fixed_range_supported(UINT64 value) const { return IA32_MTRR_CAPABILITIES_REGISTER((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * @brief WC (write combining) flag
+   *
+   * The write-combining (WC) memory type is supported when set; the WC type is not supported when clear.
+   */
+  constexpr UINT64 wc_supported() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr IA32_MTRR_CAPABILITIES_REGISTER with_wc_supported(UINT64 value) const { return IA32_MTRR_CAPABILITIES_REGISTER((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * @brief SMRR (System-Management Range Register) flag
+   *
+   * The system-management range register (SMRR) interface is supported when bit 11 is set; the SMRR interface is not
+   * supported when clear.
+   */
+  constexpr UINT64 smrr_supported() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_MTRR_CAPABILITIES_REGISTER with_smrr_supported(UINT64 value) const { return IA32_MTRR_CAPABILITIES_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_MTRR_CAPABILITIES_REGISTER) == 8, "Size of IA32_MTRR_CAPABILITIES_REGISTER");
+
+class IA32_MCG_CAP_REGISTER
+{
+public:
+  constexpr IA32_MCG_CAP_REGISTER() = default;
+  constexpr explicit IA32_MCG_CAP_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_MCG_CAP_REGISTER>
+  static constexpr IA32_MCG_CAP_REGISTER from(const T& raw) { return std::bit_cast<IA32_MCG_CAP_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_MCG_CAP_REGISTER&, const IA32_MCG_CAP_REGISTER&) = default;
+
+  /**
+   * Number of reporting banks.
+   */
+  constexpr UINT64 count() const { return (Flags >> 0) & 0xFFULL; }
+  constexpr IA32_MCG_CAP_REGISTER with_count(UINT64 value) const { return IA32_MCG_CAP_REGISTER((Flags & ~0xFFULL) | ((value & 0xFFULL) << 0)); }
+
+  /**
+   * IA32_MCG_CTL is present if this bit is set.
+   */
+  constexpr UINT64 mcg_ctl_p() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr IA32_MCG_CAP_REGISTER with_mcg_ctl_p(UINT64 value) const { return IA32_MCG_CAP_REGISTER((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * Extended machine check state registers are present if this bit is set.
+   */
+  constexpr UINT64 mcg_ext_p() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr IA32_MCG_CAP_REGISTER with_mcg_ext_p(UINT64 value) const { return IA32_MCG_CAP_REGISTER((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * Support for corrected MC error event is present.
+   */
+  constexpr UINT64 mcp_cmci_p() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr IA32_MCG_CAP_REGISTER with_mcp_cmci_p(UINT64 value) const { return IA32_MCG_CAP_REGISTER((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * Threshold-based error status register are present if this bit is set.
+   */
+  constexpr UINT64 mcg_tes_p() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_MCG_CAP_REGISTER with_mcg_tes_p(UINT64 value) const { return IA32_MCG_CAP_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+  /**
+   * Number of extended machine check state registers present.
+   */
+  constexpr UINT64 mcg_ext_cnt() const { return (Flags >> 16) & 0xFFULL; }
+  constexpr IA32_MCG_CAP_REGISTER with_mcg_ext_cnt(UINT64 value) const { return IA32_MCG_CAP_REGISTER((Flags & ~0xFF0000ULL) | ((value & 0xFFULL) << 16)); }
+
+  /**
+   * The processor supports software error recovery if this bit is set.
+   */
+  constexpr UINT64 mcg_ser_p() const { return (Flags >> 24) & 0x01ULL; }
+  constexpr IA32_MCG_CAP_REGISTER with_mcg_ser_p(UINT64 value) const { return IA32_MCG_CAP_REGISTER((Flags & ~0x1000000ULL) | ((value & 0x01ULL) << 24)); }
+
+  /**
+   * Indicates that the processor allows platform firmware to be invoked when an error is detected so that it may provide
+   * additional platform specific information in an ACPI format "Generic Error Data Entry" that augments the data included in
+   * machine check bank registers.
+   */
+  constexpr UINT64 mcg_elog_p() const { return (Flags >> 26) & 0x01ULL; }
+  constexpr IA32_MCG_CAP_REGISTER with_mcg_elog_p(UINT64 value) const { return IA32_MCG_CAP_REGISTER((Flags & ~0x4000000ULL) | ((value & 0x01ULL) << 26)); }
+
+  /**
+   * Indicates that the processor supports extended state in IA32_MCG_STATUS and associated MSR necessary to configure Local
+   * Machine Check Exception (LMCE).
+   */
+  constexpr UINT64 mcg_lmce_p() const { return (Flags >> 27) & 0x01ULL; }
+  constexpr IA32_MCG_CAP_REGISTER with_mcg_lmce_p(UINT64 value) const { return IA32_MCG_CAP_REGISTER((Flags & ~0x8000000ULL) | ((value & 0x01ULL) << 27)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_MCG_CAP_REGISTER) == 8, "Size of IA32_MCG_CAP_REGISTER");
+
+class IA32_MCG_STATUS_REGISTER
+{
+public:
+  constexpr IA32_MCG_STATUS_REGISTER() = default;
+  constexpr explicit IA32_MCG_STATUS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_MCG_STATUS_REGISTER>
+  static constexpr IA32_MCG_STATUS_REGISTER from(const T& raw) { return std::bit_cast<IA32_MCG_STATUS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_MCG_STATUS_REGISTER&, const IA32_MCG_STATUS_REGISTER&) = default;
+
+  /**
+   * Restart IP valid.
+   */
+  constexpr UINT64 ripv() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_MCG_STATUS_REGISTER with_ripv(UINT64 value) const { return IA32_MCG_STATUS_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Error IP valid.
+   */
+  constexpr UINT64 eipv() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_MCG_STATUS_REGISTER with_eipv(UINT64 value) const { return IA32_MCG_STATUS_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * Machine check in progress.
+   */
+  constexpr UINT64 mcip() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_MCG_STATUS_REGISTER with_mcip(UINT64 value) const { return IA32_MCG_STATUS_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * If IA32_MCG_CAP.LMCE_P[27] = 1.
+   */
+  constexpr UINT64 lmce_s() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr IA32_MCG_STATUS_REGISTER with_lmce_s(UINT64 value) const { return IA32_MCG_STATUS_REGISTER((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_MCG_STATUS_REGISTER) == 8, "Size of IA32_MCG_STATUS_REGISTER");
+
+class IA32_PERFEVTSEL_REGISTER
+{
+public:
+  constexpr IA32_PERFEVTSEL_REGISTER() = default;
+  constexpr explicit IA32_PERFEVTSEL_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PERFEVTSEL_REGISTER>
+  static constexpr IA32_PERFEVTSEL_REGISTER from(const T& raw) { return std::bit_cast<IA32_PERFEVTSEL_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PERFEVTSEL_REGISTER&, const IA32_PERFEVTSEL_REGISTER&) = default;
+
+  /**
+   * Selects a performance event logic unit.
+   */
+  constexpr UINT64 event_select() const { return (Flags >> 0) & 0xFFULL; }
+  constexpr IA32_PERFEVTSEL_REGISTER with_event_select(UINT64 value) const { return IA32_PERFEVTSEL_REGISTER((Flags & ~0xFFULL) | ((value & 0xFFULL) << 0)); }
+
+  /**
+   * Qualifies the microarchitectural condition to detect on the selected event logic.
+   */
+  constexpr UINT64 u_mask() const { return (Flags >> 8) & 0xFFULL; }
+  constexpr IA32_PERFEVTSEL_REGISTER with_u_mask(UINT64 value) const { return IA32_PERFEVTSEL_REGISTER((Flags & ~0xFF00ULL) | ((value & 0xFFULL) << 8)); }
+
+  /**
+   * Counts while in privilege level is not ring 0.
+   */
+  constexpr UINT64 usr() const { return (Flags >> 16) & 0x01ULL; }
+  constexpr IA32_PERFEVTSEL_REGISTER with_usr(UINT64 value) const { return IA32_PERFEVTSEL_REGISTER((Flags & ~0x10000ULL) | ((value & 0x01ULL) << 16)); }
+
+  /**
+   * Counts while in privilege level is ring 0.
+   */
+  constexpr UINT64 os() const { return (Flags >> 17) & 0x01ULL; }
+  constexpr IA32_PERFEVTSEL_REGISTER with_os(UINT64 value) const { return IA32_PERFEVTSEL_REGISTER((Flags & ~0x20000ULL) | ((value & 0x01ULL) << 17)); }
+
+  /**
+   * Enables edge detection if set.
+   */
+  constexpr UINT64 edge() const { return (Flags >> 18) & 0x01ULL; }
+  constexpr IA32_PERFEVTSEL_REGISTER with_edge(UINT64 value) const { return IA32_PERFEVTSEL_REGISTER((Flags & ~0x40000ULL) | ((value & 0x01ULL) << 18)); }
+
+  /**
+   * Enables pin control.
+   */
+  constexpr UINT64 pc() const { return (Flags >> 19) & 0x01ULL; }
+  constexpr IA32_PERFEVTSEL_REGISTER with_pc(UINT64 value) const { return IA32_PERFEVTSEL_REGISTER((Flags & ~0x80000ULL) | ((value & 0x01ULL) << 19)); }
+
+  /**
+   * Enables interrupt on counter overflow.
+   */
+  constexpr UINT64 int_() const { return (Flags >> 20) & 0x01ULL; }
+  constexpr IA32_PERFEVTSEL_REGISTER with_int(UINT64 value) const { return IA32_PERFEVTSEL_REGISTER((Flags & ~0x100000ULL) | ((value & 0x01ULL) << 20)); }
+
+  /**
+   * When set to 1, it enables counting the associated event conditions occurring across all logical processors sharing a
+   * processor core. When set to 0, the counter only increments the associated event conditions occurring in the logical
+   * processor which programmed the MSR.
+   */
+  constexpr UINT64 any_thread() const { return (Flags >> 21) & 0x01ULL; }
+  constexpr IA32_PERFEVTSEL_REGISTER with_any_thread(UINT64 value) const { return IA32_PERFEVTSEL_REGISTER((Flags & ~0x200000ULL) | ((value & 0x01ULL) << 21)); }
+
+  /**
+   * Enables the corresponding performance counter to commence counting when this bit is set.
+   */
+  constexpr UINT64 en() const { return (Flags >> 22) & 0x01ULL; }
+  constexpr IA32_PERFEVTSEL_REGISTER with_en(UINT64 value) const { return IA32_PERFEVTSEL_REGISTER((Flags & ~0x400000ULL) | ((value & 0x01ULL) << 22)); }
+
+  /**
+   * Invert the CMASK.
+   */
+  constexpr UINT64 inv() const { return (Flags >> 23) & 0x01ULL; }
+  constexpr IA32_PERFEVTSEL_REGISTER with_inv(UINT64 value) const { return IA32_PERFEVTSEL_REGISTER((Flags & ~0x800000ULL) | ((value & 0x01ULL) << 23)); }
+
+  /**
+   * When CMASK is not zero, the corresponding performance counter increments each cycle if the event count is greater than
+   * or equal to the CMASK.
+   */
+  constexpr UINT64 cmask() const { return (Flags >> 24) & 0xFFULL; }
+  constexpr IA32_PERFEVTSEL_REGISTER with_cmask(UINT64 value) const { return IA32_PERFEVTSEL_REGISTER((Flags & ~0xFF000000ULL) | ((value & 0xFFULL) << 24)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PERFEVTSEL_REGISTER) == 8, "Size of IA32_PERFEVTSEL_REGISTER");
+
+class IA32_PERF_CTL_REGISTER
+{
+public:
+  constexpr IA32_PERF_CTL_REGISTER() = default;
+  constexpr explicit IA32_PERF_CTL_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PERF_CTL_REGISTER>
+  static constexpr IA32_PERF_CTL_REGISTER from(const T& raw) { return std::bit_cast<IA32_PERF_CTL_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PERF_CTL_REGISTER&, const IA32_PERF_CTL_REGISTER&) = default;
+
+  /**
+   * Target performance State Value.
+   */
+  constexpr UINT64 target_state_value() const { return (Flags >> 0) & 0xFFFFULL; }
+  constexpr IA32_PERF_CTL_REGISTER with_target_state_value(UINT64 value) const { return IA32_PERF_CTL_REGISTER((Flags & ~0xFFFFULL) | ((value & 0xFFFFULL) << 0)); }
+
+  /**
+   * IDA Engage.
+   */
+  constexpr UINT64 ida_engage() const { return (Flags >> 32) & 0x01ULL; }
+  constexpr IA32_PERF_CTL_REGISTER with_ida_engage(UINT64 value) const { return IA32_PERF_CTL_REGISTER((Flags & ~0x100000000ULL) | ((value & 0x01ULL) << 32)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PERF_CTL_REGISTER) == 8, "Size of IA32_PERF_CTL_REGISTER");
+
+class IA32_CLOCK_MODULATION_REGISTER
+{
+public:
+  constexpr IA32_CLOCK_MODULATION_REGISTER() = default;
+  constexpr explicit IA32_CLOCK_MODULATION_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_CLOCK_MODULATION_REGISTER>
+  static constexpr IA32_CLOCK_MODULATION_REGISTER from(const T& raw) { return std::bit_cast<IA32_CLOCK_MODULATION_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_CLOCK_MODULATION_REGISTER&, const IA32_CLOCK_MODULATION_REGISTER&) = default;
+
+  /**
+   * Extended On-Demand Clock Modulation Duty Cycle.
+   */
+  constexpr UINT64 extended_on_demand_clock_modulation_duty_cycle() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_CLOCK_MODULATION_REGISTER with_extended_on_demand_clock_modulation_duty_cycle(UINT64 value) const { return IA32_CLOCK_MODULATION_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * @brief On-Demand Clock Modulation Duty Cycle
+   *
+   * On-Demand Clock Modulation Duty Cycle: Specific encoded values for target duty cycle modulation.
+   *
+   * @remarks If CPUID.01H:EDX[22] = 1
+   */
+  constexpr UINT64 on_demand_clock_modulation_duty_cycle() const { return (Flags >> 1) & 0x07ULL; }
+  constexpr IA32_CLOCK_MODULATION_REGISTER with_on_demand_clock_modulation_duty_cycle(UINT64 value) const { return IA32_CLOCK_MODULATION_REGISTER((Flags & ~0x0EULL) | ((value & 0x07ULL) << 1)); }
+
+  /**
+   * @brief On-Demand Clock Modulation Enable
+   *
+   * On-Demand Clock Modulation Enable: Set 1 to enable modulation.
+   *
+   * @remarks If CPUID.01H:EDX[22] = 1
+   */
+  constexpr UINT64 on_demand_clock_modulation_enable() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr IA32_CLOCK_MODULATION_REGISTER with_on_demand_clock_modulation_enable(UINT64 value) const { return IA32_CLOCK_MODULATION_REGISTER((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_CLOCK_MODULATION_REGISTER) == 8, "Size of IA32_CLOCK_MODULATION_REGISTER");
+
+class IA32_THERM_INTERRUPT_REGISTER
+{
+public:
+  constexpr IA32_THERM_INTERRUPT_REGISTER() = default;
+  constexpr explicit IA32_THERM_INTERRUPT_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_THERM_INTERRUPT_REGISTER>
+  static constexpr IA32_THERM_INTERRUPT_REGISTER from(const T& raw) { return std::bit_cast<IA32_THERM_INTERRUPT_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_THERM_INTERRUPT_REGISTER&, const IA32_THERM_INTERRUPT_REGISTER&) = default;
+
+  /**
+   * High-Temperature Interrupt Enable.
+   */
+  constexpr UINT64 high_temperature_interrupt_enable() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_THERM_INTERRUPT_REGISTER with_high_temperature_interrupt_enable(UINT64 value) const { return IA32_THERM_INTERRUPT_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Low-Temperature Interrupt Enable.
+   */
+  constexpr UINT64 low_temperature_interrupt_enable() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_THERM_INTERRUPT_REGISTER with_low_temperature_interrupt_enable(UINT64 value) const { return IA32_THERM_INTERRUPT_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * PROCHOT\# Interrupt Enable.
+   */
+  constexpr UINT64 prochot_interrupt_enable() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_THERM_INTERRUPT_REGISTER with_prochot_interrupt_enable(UINT64 value) const { return IA32_THERM_INTERRUPT_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * FORCEPR\# Interrupt Enable.
+   */
+  constexpr UINT64 forcepr_interrupt_enable() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr IA32_THERM_INTERRUPT_REGISTER with_forcepr_interrupt_enable(UINT64 value) const { return IA32_THERM_INTERRUPT_REGISTER((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * Critical Temperature Interrupt Enable.
+   */
+  constexpr UINT64 critical_temperature_interrupt_enable() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr IA32_THERM_INTERRUPT_REGISTER with_critical_temperature_interrupt_enable(UINT64 value) const { return IA32_THERM_INTERRUPT_REGISTER((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * Threshold \#1 Value
+   */
+  constexpr UINT64 threshold1_value() const { return (Flags >> 8) & 0x7FULL; }
+  constexpr IA32_THERM_INTERRUPT_REGISTER with_threshold1_value(UINT64 value) const { return IA32_THERM_INTERRUPT_REGISTER((Flags & ~0x7F00ULL) | ((value & 0x7FULL) << 8)); }
+
+  /**
+   * Threshold \#1 Interrupt Enable.
+   */
+  constexpr UINT64 threshold1_interrupt_enable() const { return (Flags >> 15) & 0x01ULL; }
+  constexpr IA32_THERM_INTERRUPT_REGISTER with_threshold1_interrupt_enable(UINT64 value) const { return IA32_THERM_INTERRUPT_REGISTER((Flags & ~0x8000ULL) | ((value & 0x01ULL) << 15)); }
+
+  /**
+   * Threshold \#2 Value.
+   */
+  constexpr UINT64 threshold2_value() const { return (Flags >> 16) & 0x7FULL; }
+  constexpr IA32_THERM_INTERRUPT_REGISTER with_threshold2_value(UINT64 value) const { return IA32_THERM_INTERRUPT_REGISTER((Flags & ~0x7F0000ULL) | ((value & 0x7FULL) << 16)); }
+
+  /**
+   * Threshold \#2 Interrupt Enable.
+   */
+  constexpr UINT64 threshold2_interrupt_enable() const { return (Flags >> 23) & 0x01ULL; }
+  constexpr IA32_THERM_INTERRUPT_REGISTER with_threshold2_interrupt_enable(UINT64 value) const { return IA32_THERM_INTERRUPT_REGISTER((Flags & ~0x800000ULL) | ((value & 0x01ULL) << 23)); }
+
+  /**
+   * Power Limit Notification Enable.
+   */
+  constexpr UINT64 power_limit_notification_enable() const { return (Flags >> 24) & 0x01ULL; }
+  constexpr IA32_THERM_INTERRUPT_REGISTER with_power_limit_notification_enable(UINT64 value) const { return IA32_THERM_INTERRUPT_REGISTER((Flags & ~0x1000000ULL) | ((value & 0x01ULL) << 24)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_THERM_INTERRUPT_REGISTER) == 8, "Size of IA32_THERM_INTERRUPT_REGISTER");
+
+class IA32_THERM_STATUS_REGISTER
+{
+public:
+  constexpr IA32_THERM_STATUS_REGISTER() = default;
+  constexpr explicit IA32_THERM_STATUS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_THERM_STATUS_REGISTER>
+  static constexpr IA32_THERM_STATUS_REGISTER from(const T& raw) { return std::bit_cast<IA32_THERM_STATUS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_THERM_STATUS_REGISTER&, const IA32_THERM_STATUS_REGISTER&) = default;
+
+  /**
+   * Thermal Status
+   */
+  constexpr UINT64 thermal_status() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_thermal_status(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Thermal Status Log
+   */
+  constexpr UINT64 thermal_status_log() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_thermal_status_log(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * PROCHOT \# or FORCEPR\# event
+   */
+  constexpr UINT64 prochot_forcepr_event() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_prochot_forcepr_event(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * PROCHOT \# or FORCEPR\# log
+   */
+  constexpr UINT64 prochot_forcepr_log() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_prochot_forcepr_log(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * Critical Temperature Status
+   */
+  constexpr UINT64 critical_temperature_status() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_critical_temperature_status(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * Critical Temperature Status log
+   */
+  constexpr UINT64 critical_temperature_status_log() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_critical_temperature_status_log(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * Thermal Threshold \#1 Status
+   */
+  constexpr UINT64 thermal_threshold1_status() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_thermal_threshold1_status(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * Thermal Threshold \#1 log
+   */
+  constexpr UINT64 thermal_threshold1_log() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_thermal_threshold1_log(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * Thermal Threshold \#2 Status
+   */
+  constexpr UINT64 thermal_threshold2_status() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_thermal_threshold2_status(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * Thermal Threshold \#2 log
+   */
+  constexpr UINT64 thermal_threshold2_log() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_thermal_threshold2_log(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * Power Limitation Status
+   */
+  constexpr UINT64 power_limitation_status() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_power_limitation_status(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * Power Limitation log
+   */
+  constexpr UINT64 power_limitation_log() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_power_limitation_log(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+  /**
+   * Current Limit Status
+   */
+  constexpr UINT64 current_limit_status() const { return (Flags >> 12) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_current_limit_status(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x1000ULL) | ((value & 0x01ULL) << 12)); }
+
+  /**
+   * Current Limit log
+   */
+  constexpr UINT64 current_limit_log() const { return (Flags >> 13) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_current_limit_log(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x2000ULL) | ((value & 0x01ULL) << 13)); }
+
+  /**
+   * Cross Domain Limit Status
+   */
+  constexpr UINT64 cross_domain_limit_status() const { return (Flags >> 14) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_cross_domain_limit_status(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x4000ULL) | ((value & 0x01ULL) << 14)); }
+
+  /**
+   * Cross Domain Limit log
+   */
+  constexpr UINT64 cross_domain_limit_log() const { return (Flags >> 15) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_cross_domain_limit_log(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x8000ULL) | ((value & 0x01ULL) << 15)); }
+
+  /**
+   * Digital Readout
+   */
+  constexpr UINT64 digital_readout() const { return (Flags >> 16) & 0x7FULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_digital_readout(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x7F0000ULL) | ((value & 0x7FULL) << 16)); }
+
+  /**
+   * Resolution in Degrees Celsius
+   */
+  constexpr UINT64 resolution_in_degrees_celsius() const { return (Flags >> 27) & 0x0FULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_resolution_in_degrees_celsius(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x78000000ULL) | ((value & 0x0FULL) << 27)); }
+
+  /**
+   * Reading Valid
+   */
+  constexpr UINT64 reading_valid() const { return (Flags >> 31) & 0x01ULL; }
+  constexpr IA32_THERM_STATUS_REGISTER with_reading_valid(UINT64 value) const { return IA32_THERM_STATUS_REGISTER((Flags & ~0x80000000ULL) | ((value & 0x01ULL) << 31)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_THERM_STATUS_REGISTER) == 8, "Size of IA32_THERM_STATUS_REGISTER");
+
+class IA32_MISC_ENABLE_REGISTER
+{
+public:
+  constexpr IA32_MISC_ENABLE_REGISTER() = default;
+  constexpr explicit IA32_MISC_ENABLE_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_MISC_ENABLE_REGISTER>
+  static constexpr IA32_MISC_ENABLE_REGISTER from(const T& raw) { return std::bit_cast<IA32_MISC_ENABLE_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_MISC_ENABLE_REGISTER&, const IA32_MISC_ENABLE_REGISTER&) = default;
+
+  /**
+   * @brief Fast-Strings Enable
+   *
+   * When set, the fast-strings feature (for REP MOVS and REP STORS) is enabled (default). When clear, fast-strings are
+   * disabled.
+   *
+   * @remarks 0F_0H
+   */
+  constexpr UINT64 fast_strings_enable() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_MISC_ENABLE_REGISTER with_fast_strings_enable(UINT64 value) const { return IA32_MISC_ENABLE_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * @brief Automatic Thermal Control Circuit Enable <b>(R/W)</b>
+   *
+   * - 1 = Setting this bit enables the thermal control circuit (TCC) portion of the Intel Thermal Monitor feature. This
+   * allows the processor to automatically reduce power consumption in response to TCC activation.
+   * - 0 = Disabled.
+   *
+   * @note In some products clearing this bit might be ignored in critical thermal conditions, and TM1, TM2 and adaptive
+   *       thermal throttling will still be activated. The default value of this field varies with product.
+   * @remarks 0F_0H
+   */
+  constexpr UINT64 automatic_thermal_control_circuit_enable() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr IA32_MISC_ENABLE_REGISTER with_automatic_thermal_control_circuit_enable(UINT64 value) const { return IA32_MISC_ENABLE_REGISTER((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * @brief Performance Monitoring Available <b>(R)</b>
+   *
+   * - 1 = Performance monitoring enabled.
+   * - 0 = Performance monitoring disabled.
+   *
+   * @remarks 0F_0H
+   */
+  constexpr UINT64 performance_monitoring_available() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr IA32_MISC_ENABLE_REGISTER with_performance_monitoring_available(UINT64 value) const { return IA32_MISC_ENABLE_REGISTER((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * @brief Branch Trace Storage Unavailable <b>(RO)</b>
+   *
+   * - 1 = Processor doesn't support branch trace storage (BTS).
+   * - 0 = BTS is supported.
+   *
+   * @remarks 0F_0H
+   */
+  constexpr UINT64 branch_trace_storage_unavailable() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_MISC_ENABLE_REGISTER with_branch_trace_storage_unavailable(UINT64 value) const { return IA32_MISC_ENABLE_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+  /**
+   * @brief Processor Event Based Sampling (PEBS) Unavailable <b>(RO)</b>
+   *
+   * - 1 = PEBS is not supported.
+   * - 0 = PEBS is supported.
+   *
+   * @remarks 06_0FH
+   */
+  constexpr UINT64 processor_event_based_sampling_unavailable() const { return (Flags >> 12) & 0x01ULL; }
+  constexpr IA32_MISC_ENABLE_REGISTER with_processor_event_based_sampling_unavailable(UINT64 value) const { return IA32_MISC_ENABLE_REGISTER((Flags & ~0x1000ULL) | ((value & 0x01ULL) << 12)); }
+
+  /**
+   * @brief Enhanced Intel SpeedStep Technology Enable <b>(R/W)</b>
+   *
+   * - 0 = Enhanced Intel SpeedStep Technology disabled.
+   * - 1 = Enhanced Intel SpeedStep Technology enabled.
+   *
+   * @remarks If CPUID.01H: ECX[7] = 1
+   */
+  constexpr UINT64 enhanced_intel_speedstep_technology_enable() const { return (Flags >> 16) & 0x01ULL; }
+  constexpr IA32_MISC_ENABLE_REGISTER with_enhanced_intel_speedstep_technology_enable(UINT64 value) const { return IA32_MISC_ENABLE_REGISTER((Flags & ~0x10000ULL) | ((value & 0x01ULL) << 16)); }
+
+  /**
+   * @brief ENABLE MONITOR FSM <b>(R/W)</b>
+   *
+   * When this bit is set to 0, the MONITOR feature flag is not set (CPUID.01H:ECX[bit3] = 0). This indicates that
+   * MONITOR/MWAIT are not supported. Software attempts to execute MONITOR/MWAIT will cause \#UD when this bit is 0.
+   * When this bit is set to 1 (default), MONITOR/MWAIT are supported (CPUID.01H:ECX[bit 3] = 1). If the SSE3 feature flag
+   * ECX[0] is not set (CPUID.01H:ECX[bit 0] = 0), the OS must not attempt to alter this bit. BIOS must leave it in the
+   * default state. Writing this bit when the SSE3 feature flag is set to 0 may generate a \#GP exception.
+   *
+   * @remarks 0F_03H
+   */
+  constexpr UINT64 enable_monitor_fsm() const { return (Flags >> 18) & 0x01ULL; }
+  constexpr IA32_MISC_ENABLE_REGISTER with_enable_monitor_fsm(UINT64 value) const { return IA32_MISC_ENABLE_REGISTER((Flags & ~0x40000ULL) | ((value & 0x01ULL) << 18)); }
+
+  /**
+   * @brief Limit CPUID Maxval <b>(R/W)</b>
+   *
+   * When this bit is set to 1, CPUID.00H returns a maximum value in EAX[7:0] of 2. BIOS should contain a setup question that
+   * allows users to specify when the installed OS does not support CPUID functions greater than 2.
+   * Before setting this bit, BIOS must execute the CPUID.0H and examine the maximum value returned in EAX[7:0]. If the
+   * maximum value is greater than 2, this bit is supported.
+   * Otherwise, this bit is not supported. Setting this bit when the maximum value is not greater than 2 may generate a \#GP
+   * exception. Setting this bit may cause unexpected behavior in software that depends on the availability of CPUID leaves
+   * greater than 2.
+   *
+   * @remarks 0F_03H
+   */
+  constexpr UINT64 limit_cpuid_maxval() const { return (Flags >> 22) & 0x01ULL; }
+  constexpr IA32_MISC_ENABLE_REGISTER with_limit_cpuid_maxval(UINT64 value) const { return IA32_MISC_ENABLE_REGISTER((Flags & ~0x400000ULL) | ((value & 0x01ULL) << 22)); }
+
+  /**
+   * @brief xTPR Message Disable <b>(R/W)</b>
+   *
+   * When set to 1, xTPR messages are disabled. xTPR messages are optional messages that allow the processor to inform the
+   * chipset of its priority.
+   *
+   * @remarks If CPUID.01H:ECX[14] = 1
+   */
+  constexpr UINT64 xtpr_message_disable() const { return (Flags >> 23) & 0x01ULL; }
+  constexpr IA32_MISC_ENABLE_REGISTER with_xtpr_message_disable(UINT64 value) const { return IA32_MISC_ENABLE_REGISTER((Flags & ~0x800000ULL) | ((value & 0x01ULL) << 23)); }
+
+  /**
+   * @brief XD Bit Disable <b>(R/W)</b>
+   *
+   * When set to 1, the Execute Disable Bit feature (XD Bit) is disabled and the XD Bit extended feature flag will be clear
+   * (CPUID.80000001H: EDX[20]=0).
+   * When set to a 0 (default), the Execute Disable Bit feature (if available) allows the OS to enable PAE paging and take
+   * advantage of data only pages.
+   * BIOS must not alter the contents of this bit location, if XD bit is not supported. Writing this bit to 1 when the XD Bit
+   * extended feature flag is set to 0 may generate a \#GP exception.
+   *
+   * @remarks If CPUID.80000001H:EDX[20] = 1
+   */
+  constexpr UINT64 xd_bit_disable() const { return (Flags >> 34) & 0x01ULL; }
+  constexpr IA32_MISC_ENABLE_REGISTER with_xd_bit_disable(UINT64 value) const { return IA32_MISC_ENABLE_REGISTER((Flags & ~0x400000000ULL) | ((value & 0x01ULL) << 34)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_MISC_ENABLE_REGISTER) == 8, "Size of IA32_MISC_ENABLE_REGISTER");
+
+class IA32_ENERGY_PERF_BIAS_REGISTER
+{
+public:
+  constexpr IA32_ENERGY_PERF_BIAS_REGISTER() = default;
+  constexpr explicit IA32_ENERGY_PERF_BIAS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_ENERGY_PERF_BIAS_REGISTER>
+  static constexpr IA32_ENERGY_PERF_BIAS_REGISTER from(const T& raw) { return std::bit_cast<IA32_ENERGY_PERF_BIAS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_ENERGY_PERF_BIAS_REGISTER&, const IA32_ENERGY_PERF_BIAS_REGISTER&) = default;
+
+  /**
+   * @brief Power Policy Preference
+   *
+   * - 0 indicates preference to highest performance.
+   * - 15 indicates preference to maximize energy saving.
+   */
+  constexpr UINT64 power_policy_preference() const { return (Flags >> 0) & 0x0FULL; }
+  constexpr IA32_ENERGY_PERF_BIAS_REGISTER with_power_policy_preference(UINT64 value) const { return IA32_ENERGY_PERF_BIAS_REGISTER((Flags & ~0x0FULL) | ((value & 0x0FULL) << 0)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_ENERGY_PERF_BIAS_REGISTER) == 8, "Size of IA32_ENERGY_PERF_BIAS_REGISTER");
+
+class IA32_PACKAGE_THERM_STATUS_REGISTER
+{
+public:
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER() = default;
+  constexpr explicit IA32_PACKAGE_THERM_STATUS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PACKAGE_THERM_STATUS_REGISTER>
+  static constexpr IA32_PACKAGE_THERM_STATUS_REGISTER from(const T& raw) { return std::bit_cast<IA32_PACKAGE_THERM_STATUS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PACKAGE_THERM_STATUS_REGISTER&, const IA32_PACKAGE_THERM_STATUS_REGISTER&) = default;
+
+  /**
+   * Pkg Thermal Status
+   */
+  constexpr UINT64 thermal_status() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER with_thermal_status(UINT64 value) const { return IA32_PACKAGE_THERM_STATUS_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Pkg Thermal Status Log
+   */
+  constexpr UINT64 thermal_status_log() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER with_thermal_status_log(UINT64 value) const { return IA32_PACKAGE_THERM_STATUS_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * Pkg PROCHOT \# event
+   */
+  constexpr UINT64 prochot_event() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER with_prochot_event(UINT64 value) const { return IA32_PACKAGE_THERM_STATUS_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * Pkg PROCHOT \# log
+   */
+  constexpr UINT64 prochot_log() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER with_prochot_log(UINT64 value) const { return IA32_PACKAGE_THERM_STATUS_REGISTER((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * Pkg Critical Temperature Status
+   */
+  constexpr UINT64 critical_temperature_status() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER with_critical_temperature_status(UINT64 value) const { return IA32_PACKAGE_THERM_STATUS_REGISTER((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * Pkg Critical Temperature Status Log
+   */
+  constexpr UINT64 critical_temperature_status_log() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER with_critical_temperature_status_log(UINT64 value) const { return IA32_PACKAGE_THERM_STATUS_REGISTER((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * Pkg Thermal Threshold \#1 Status
+   */
+  constexpr UINT64 thermal_threshold1_status() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER with_thermal_threshold1_status(UINT64 value) const { return IA32_PACKAGE_THERM_STATUS_REGISTER((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * Pkg Thermal Threshold \#1 log
+   */
+  constexpr UINT64 thermal_threshold1_log() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER with_thermal_threshold1_log(UINT64 value) const { return IA32_PACKAGE_THERM_STATUS_REGISTER((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * Pkg Thermal Threshold \#2 Status
+   */
+  constexpr UINT64 thermal_threshold2_status() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER with_thermal_threshold2_status(UINT64 value) const { return IA32_PACKAGE_THERM_STATUS_REGISTER((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * Pkg Thermal Threshold \#2 log
+   */
+  constexpr UINT64 thermal_threshold2_log() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER with_thermal_threshold2_log(UINT64 value) const { return IA32_PACKAGE_THERM_STATUS_REGISTER((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * Pkg Power Limitation Status
+   */
+  constexpr UINT64 power_limitation_status() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER with_power_limitation_status(UINT64 value) const { return IA32_PACKAGE_THERM_STATUS_REGISTER((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * Pkg Power Limitation log
+   */
+  constexpr UINT64 power_limitation_log() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER with_power_limitation_log(UINT64 value) const { return IA32_PACKAGE_THERM_STATUS_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+  /**
+   * Pkg Digital Readout
+   */
+  constexpr UINT64 digital_readout() const { return (Flags >> 16) & 0x7FULL; }
+  constexpr IA32_PACKAGE_THERM_STATUS_REGISTER with_digital_readout(UINT64 value) const { return IA32_PACKAGE_THERM_STATUS_REGISTER((Flags & ~0x7F0000ULL) | ((value & 0x7FULL) << 16)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PACKAGE_THERM_STATUS_REGISTER) == 8, "Size of IA32_PACKAGE_THERM_STATUS_REGISTER");
+
+class IA32_PACKAGE_THERM_INTERRUPT_REGISTER
+{
+public:
+  constexpr IA32_PACKAGE_THERM_INTERRUPT_REGISTER() = default;
+  constexpr explicit IA32_PACKAGE_THERM_INTERRUPT_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PACKAGE_THERM_INTERRUPT_REGISTER>
+  static constexpr IA32_PACKAGE_THERM_INTERRUPT_REGISTER from(const T& raw) { return std::bit_cast<IA32_PACKAGE_THERM_INTERRUPT_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PACKAGE_THERM_INTERRUPT_REGISTER&, const IA32_PACKAGE_THERM_INTERRUPT_REGISTER&) = default;
+
+  /**
+   * Pkg High-Temperature Interrupt Enable.
+   */
+  constexpr UINT64 high_temperature_interrupt_enable() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_INTERRUPT_REGISTER with_high_temperature_interrupt_enable(UINT64 value) const { return IA32_PACKAGE_THERM_INTERRUPT_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Pkg Low-Temperature Interrupt Enable.
+   */
+  constexpr UINT64 low_temperature_interrupt_enable() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_INTERRUPT_REGISTER with_low_temperature_interrupt_enable(UINT64 value) const { return IA32_PACKAGE_THERM_INTERRUPT_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * Pkg PROCHOT\# Interrupt Enable.
+   */
+  constexpr UINT64 prochot_interrupt_enable() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_INTERRUPT_REGISTER with_prochot_interrupt_enable(UINT64 value) const { return IA32_PACKAGE_THERM_INTERRUPT_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * Pkg Overheat Interrupt Enable.
+   */
+  constexpr UINT64 overheat_interrupt_enable() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_INTERRUPT_REGISTER with_overheat_interrupt_enable(UINT64 value) const { return IA32_PACKAGE_THERM_INTERRUPT_REGISTER((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * Pkg Threshold \#1 Value
+   */
+  constexpr UINT64 threshold1_value() const { return (Flags >> 8) & 0x7FULL; }
+  constexpr IA32_PACKAGE_THERM_INTERRUPT_REGISTER with_threshold1_value(UINT64 value) const { return IA32_PACKAGE_THERM_INTERRUPT_REGISTER((Flags & ~0x7F00ULL) | ((value & 0x7FULL) << 8)); }
+
+  /**
+   * Pkg Threshold \#1 Interrupt Enable.
+   */
+  constexpr UINT64 threshold1_interrupt_enable() const { return (Flags >> 15) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_INTERRUPT_REGISTER with_threshold1_interrupt_enable(UINT64 value) const { return IA32_PACKAGE_THERM_INTERRUPT_REGISTER((Flags & ~0x8000ULL) | ((value & 0x01ULL) << 15)); }
+
+  /**
+   * Pkg Threshold \#2 Value.
+   */
+  constexpr UINT64 threshold2_value() const { return (Flags >> 16) & 0x7FULL; }
+  constexpr IA32_PACKAGE_THERM_INTERRUPT_REGISTER with_threshold2_value(UINT64 value) const { return IA32_PACKAGE_THERM_INTERRUPT_REGISTER((Flags & ~0x7F0000ULL) | ((value & 0x7FULL) << 16)); }
+
+  /**
+   * Pkg Threshold \#2 Interrupt Enable.
+   */
+  constexpr UINT64 threshold2_interrupt_enable() const { return (Flags >> 23) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_INTERRUPT_REGISTER with_threshold2_interrupt_enable(UINT64 value) const { return IA32_PACKAGE_THERM_INTERRUPT_REGISTER((Flags & ~0x800000ULL) | ((value & 0x01ULL) << 23)); }
+
+  /**
+   * Pkg Power Limit Notification Enable.
+   */
+  constexpr UINT64 power_limit_notification_enable() const { return (Flags >> 24) & 0x01ULL; }
+  constexpr IA32_PACKAGE_THERM_INTERRUPT_REGISTER with_power_limit_notification_enable(UINT64 value) const { return IA32_PACKAGE_THERM_INTERRUPT_REGISTER((Flags & ~0x1000000ULL) | ((value & 0x01ULL) << 24)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PACKAGE_THERM_INTERRUPT_REGISTER) == 8, "Size of IA32_PACKAGE_THERM_INTERRUPT_REGISTER");
+
+class IA32_DEBUGCTL_REGISTER
+{
+public:
+  constexpr IA32_DEBUGCTL_REGISTER() = default;
+  constexpr explicit IA32_DEBUGCTL_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_DEBUGCTL_REGISTER>
+  static constexpr IA32_DEBUGCTL_REGISTER from(const T& raw) { return std::bit_cast<IA32_DEBUGCTL_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_DEBUGCTL_REGISTER&, const IA32_DEBUGCTL_REGISTER&) = default;
+
+  /**
+   * Setting this bit to 1 enables the processor to record a running trace of the most recent branches taken by the processor
+   * in the LBR stack.
+   */
+  constexpr UINT64 lbr() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_DEBUGCTL_REGISTER with_lbr(UINT64 value) const { return IA32_DEBUGCTL_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Setting this bit to 1 enables the processor to treat EFLAGS.TF as single-step on branches instead of single-step on
+   * instructions.
+   */
+  constexpr UINT64 btf() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_DEBUGCTL_REGISTER with_btf(UINT64 value) const { return IA32_DEBUGCTL_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * Setting this bit to 1 enables branch trace messages to be sent.
+   */
+  constexpr UINT64 tr() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr IA32_DEBUGCTL_REGISTER with_tr(UINT64 value) const { return IA32_DEBUGCTL_REGISTER((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * Setting this bit enables branch trace messages (BTMs) to be logged in a BTS buffer.
+   */
+  constexpr UINT64 bts() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr IA32_DEBUGCTL_REGISTER with_bts(UINT64 value) const { return IA32_DEBUGCTL_REGISTER((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * When clear, BTMs are logged in a BTS buffer in circular fashion. When this bit is set, an interrupt is generated by the
+   * BTS facility when the BTS buffer is full.
+   */
+  constexpr UINT64 btint() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr IA32_DEBUGCTL_REGISTER with_btint(UINT64 value) const { return IA32_DEBUGCTL_REGISTER((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * When set, BTS or BTM is skipped if CPL = 0.
+   */
+  constexpr UINT64 bts_off_os() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr IA32_DEBUGCTL_REGISTER with_bts_off_os(UINT64 value) const { return IA32_DEBUGCTL_REGISTER((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * When set, BTS or BTM is skipped if CPL > 0.
+   */
+  constexpr UINT64 bts_off_usr() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr IA32_DEBUGCTL_REGISTER with_bts_off_usr(UINT64 value) const { return IA32_DEBUGCTL_REGISTER((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * When set, the LBR stack is frozen on a PMI request.
+   */
+  constexpr UINT64 freeze_lbrs_on_pmi() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_DEBUGCTL_REGISTER with_freeze_lbrs_on_pmi(UINT64 value) const { return IA32_DEBUGCTL_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+  /**
+   * When set, each ENABLE bit of the global counter control MSR are frozen (address 38FH) on a PMI request.
+   */
+  constexpr UINT64 freeze_perfmon_on_pmi() const { return (Flags >> 12) & 0x01ULL; }
+  constexpr IA32_DEBUGCTL_REGISTER with_freeze_perfmon_on_pmi(UINT64 value) const { return IA32_DEBUGCTL_REGISTER((Flags & ~0x1000ULL) | ((value & 0x01ULL) << 12)); }
+
+  /**
+   * When set, enables the logical processor to receive and generate PMI on behalf of the uncore.
+   */
+  constexpr UINT64 enable_uncore_pmi() const { return (Flags >> 13) & 0x01ULL; }
+  constexpr IA32_DEBUGCTL_REGISTER with_enable_uncore_pmi(UINT64 value) const { return IA32_DEBUGCTL_REGISTER((Flags & ~0x2000ULL) | ((value & 0x01ULL) << 13)); }
+
+  /**
+   * When set, freezes perfmon and trace messages while in SMM.
+   */
+  constexpr UINT64 freeze_while_smm() const { return (Flags >> 14) & 0x01ULL; }
+  constexpr IA32_DEBUGCTL_REGISTER with_freeze_while_smm(UINT64 value) const { return IA32_DEBUGCTL_REGISTER((Flags & ~0x4000ULL) | ((value & 0x01ULL) << 14)); }
+
+  /**
+   * When set, enables DR7 debug bit on XBEGIN.
+   */
+  constexpr UINT64 rtm_debug() const { return (Flags >> 15) & 0x01ULL; }
+  constexpr IA32_DEBUGCTL_REGISTER with_rtm_debug(UINT64 value) const { return IA32_DEBUGCTL_REGISTER((Flags & ~0x8000ULL) | ((value & 0x01ULL) << 15)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_DEBUGCTL_REGISTER) == 8, "Size of IA32_DEBUGCTL_REGISTER");
+
+class IA32_SMRR_PHYSBASE_REGISTER
+{
+public:
+  constexpr IA32_SMRR_PHYSBASE_REGISTER() = default;
+  constexpr explicit IA32_SMRR_PHYSBASE_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_SMRR_PHYSBASE_REGISTER>
+  static constexpr IA32_SMRR_PHYSBASE_REGISTER from(const T& raw) { return std::bit_cast<IA32_SMRR_PHYSBASE_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_SMRR_PHYSBASE_REGISTER&, const IA32_SMRR_PHYSBASE_REGISTER&) = default;
+
+  /**
+   * @brief Type
+   *
+   * Type. Specifies memory type of the range.
+   */
+  constexpr UINT64 type() const { return (Flags >> 0) & 0xFFULL; }
+  constexpr IA32_SMRR_PHYSBASE_REGISTER with_type(UINT64 value) const { return IA32_SMRR_PHYSBASE_REGISTER((Flags & ~0xFFULL) | ((value & 0xFFULL) << 0)); }
+
+  /**
+   * SMRR physical Base Address.
+   */
+  constexpr UINT64 smrr_physical_base_address() const { return (Flags >> 12) & 0xFFFFFULL; }
+  constexpr IA32_SMRR_PHYSBASE_REGISTER with_smrr_physical_base_address(UINT64 value) const { return IA32_SMRR_PHYSBASE_REGISTER((Flags & ~0xFFFFF000ULL) | ((value & 0xFFFFFULL) << 12)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_SMRR_PHYSBASE_REGISTER) == 8, "Size of IA32_SMRR_PHYSBASE_REGISTER");
+
+class IA32_SMRR_PHYSMASK_REGISTER
+{
+public:
+  constexpr IA32_SMRR_PHYSMASK_REGISTER() = default;
+  constexpr explicit IA32_SMRR_PHYSMASK_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_SMRR_PHYSMASK_REGISTER>
+  static constexpr IA32_SMRR_PHYSMASK_REGISTER from(const T& raw) { return std::bit_cast<IA32_SMRR_PHYSMASK_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_SMRR_PHYSMASK_REGISTER&, const IA32_SMRR_PHYSMASK_REGISTER&) = default;
+
+  /**
+   * Enable range mask.
+   */
+  constexpr UINT64 enable_range_mask() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_SMRR_PHYSMASK_REGISTER with_enable_range_mask(UINT64 value) const { return IA32_SMRR_PHYSMASK_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+  /**
+   * SMRR address range mask.
+   */
+  constexpr UINT64 smrr_address_range_mask() const { return (Flags >> 12) & 0xFFFFFULL; }
+  constexpr IA32_SMRR_PHYSMASK_REGISTER with_smrr_address_range_mask(UINT64 value) const { return IA32_SMRR_PHYSMASK_REGISTER((Flags & ~0xFFFFF000ULL) | ((value & 0xFFFFFULL) << 12)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_SMRR_PHYSMASK_REGISTER) == 8, "Size of IA32_SMRR_PHYSMASK_REGISTER");
+
+class IA32_DCA_0_CAP_REGISTER
+{
+public:
+  constexpr IA32_DCA_0_CAP_REGISTER() = default;
+  constexpr explicit IA32_DCA_0_CAP_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_DCA_0_CAP_REGISTER>
+  static constexpr IA32_DCA_0_CAP_REGISTER from(const T& raw) { return std::bit_cast<IA32_DCA_0_CAP_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_DCA_0_CAP_REGISTER&, const IA32_DCA_0_CAP_REGISTER&) = default;
+
+  /**
+   * Set by HW when DCA is fuseenabled and no defeatures are set.
+   */
+  constexpr UINT64 dca_active() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_DCA_0_CAP_REGISTER with_dca_active(UINT64 value) const { return IA32_DCA_0_CAP_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * TRANSACTION.
+   */
+  constexpr UINT64 transaction() const { return (Flags >> 1) & 0x03ULL; }
+  constexpr IA32_DCA_0_CAP_REGISTER with_transaction(UINT64 value) const { return IA32_DCA_0_CAP_REGISTER((Flags & ~0x06ULL) | ((value & 0x03ULL) << 1)); }
+
+  /**
+   * DCA_TYPE.
+   */
+  constexpr UINT64 dca_type() const { return (Flags >> 3) & 0x0FULL; }
+  constexpr IA32_DCA_0_CAP_REGISTER with_dca_type(UINT64 value) const { return IA32_DCA_0_CAP_REGISTER((Flags & ~0x78ULL) | ((value & 0x0FULL) << 3)); }
+
+  /**
+   * DCA_QUEUE_SIZE.
+   */
+  constexpr UINT64 dca_queue_size() const { return (Flags >> 7) & 0x0FULL; }
+  constexpr IA32_DCA_0_CAP_REGISTER with_dca_queue_size(UINT64 value) const { return IA32_DCA_0_CAP_REGISTER((Flags & ~0x780ULL) | ((value & 0x0FULL) << 7)); }
+
+  /**
+   * Writes will update the register but have no HW side-effect.
+   */
+  constexpr UINT64 dca_delay() const { return (Flags >> 13) & 0x0FULL; }
+  constexpr IA32_DCA_0_CAP_REGISTER with_dca_delay(UINT64 value) const { return IA32_DCA_0_CAP_REGISTER((Flags & ~0x1E000ULL) | ((value & 0x0FULL) << 13)); }
+
+  /**
+   * SW can request DCA block by setting this bit.
+   */
+  constexpr UINT64 sw_block() const { return (Flags >> 24) & 0x01ULL; }
+  constexpr IA32_DCA_0_CAP_REGISTER with_sw_block(UINT64 value) const { return IA32_DCA_0_CAP_REGISTER((Flags & ~0x1000000ULL) | ((value & 0x01ULL) << 24)); }
+
+  /**
+   * Set when DCA is blocked by HW (e.g. CR0.CD = 1).
+   */
+  constexpr UINT64 hw_block() const { return (Flags >> 26) & 0x01ULL; }
+  constexpr IA32_DCA_0_CAP_REGISTER with_hw_block(UINT64 value) const { return IA32_DCA_0_CAP_REGISTER((Flags & ~0x4000000ULL) | ((value & 0x01ULL) << 26)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_DCA_0_CAP_REGISTER) == 8, "Size of IA32_DCA_0_CAP_REGISTER");
+
+class IA32_PAT_REGISTER
+{
+public:
+  constexpr IA32_PAT_REGISTER() = default;
+  constexpr explicit IA32_PAT_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PAT_REGISTER>
+  static constexpr IA32_PAT_REGISTER from(const T& raw) { return std::bit_cast<IA32_PAT_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PAT_REGISTER&, const IA32_PAT_REGISTER&) = default;
+
+  /**
+   * PA0.
+   */
+  constexpr UINT64 pa0() const { return (Flags >> 0) & 0x07ULL; }
+  constexpr IA32_PAT_REGISTER with_pa0(UINT64 value) const { return IA32_PAT_REGISTER((Flags & ~0x07ULL) | ((value & 0x07ULL) << 0)); }
+
+  /**
+   * PA1.
+   */
+  constexpr UINT64 pa1() const { return (Flags >> 8) & 0x07ULL; }
+  constexpr IA32_PAT_REGISTER with_pa1(UINT64 value) const { return IA32_PAT_REGISTER((Flags & ~0x700ULL) | ((value & 0x07ULL) << 8)); }
+
+  /**
+   * PA2.
+   */
+  constexpr UINT64 pa2() const { return (Flags >> 16) & 0x07ULL; }
+  constexpr IA32_PAT_REGISTER with_pa2(UINT64 value) const { return IA32_PAT_REGISTER((Flags & ~0x70000ULL) | ((value & 0x07ULL) << 16)); }
+
+  /**
+   * PA3.
+   */
+  constexpr UINT64 pa3() const { return (Flags >> 24) & 0x07ULL; }
+  constexpr IA32_PAT_REGISTER with_pa3(UINT64 value) const { return IA32_PAT_REGISTER((Flags & ~0x7000000ULL) | ((value & 0x07ULL) << 24)); }
+
+  /**
+   * PA4.
+   */
+  constexpr UINT64 pa4() const { return (Flags >> 32) & 0x07ULL; }
+  constexpr IA32_PAT_REGISTER with_pa4(UINT64 value) const { return IA32_PAT_REGISTER((Flags & ~0x700000000ULL) | ((value & 0x07ULL) << 32)); }
+
+  /**
+   * PA5.
+   */
+  constexpr UINT64 pa5() const { return (Flags >> 40) & 0x07ULL; }
+  constexpr IA32_PAT_REGISTER with_pa5(UINT64 value) const { return IA32_PAT_REGISTER((Flags & ~0x70000000000ULL) | ((value & 0x07ULL) << 40)); }
+
+  /**
+   * PA6.
+   */
+  constexpr UINT64 pa6() const { return (Flags >> 48) & 0x07ULL; }
+  constexpr IA32_PAT_REGISTER with_pa6(UINT64 value) const { return IA32_PAT_REGISTER((Flags & ~0x7000000000000ULL) | ((value & 0x07ULL) << 48)); }
+
+  /**
+   * PA7.
+   */
+  constexpr UINT64 pa7() const { return (Flags >> 56) & 0x07ULL; }
+  constexpr IA32_PAT_REGISTER with_pa7(UINT64 value) const { return IA32_PAT_REGISTER((Flags & ~0x700000000000000ULL) | ((value & 0x07ULL) << 56)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PAT_REGISTER) == 8, "Size of IA32_PAT_REGISTER");
+
+class IA32_MC_CTL2_REGISTER
+{
+public:
+  constexpr IA32_MC_CTL2_REGISTER() = default;
+  constexpr explicit IA32_MC_CTL2_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_MC_CTL2_REGISTER>
+  static constexpr IA32_MC_CTL2_REGISTER from(const T& raw) { return std::bit_cast<IA32_MC_CTL2_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_MC_CTL2_REGISTER&, const IA32_MC_CTL2_REGISTER&) = default;
+
+  /**
+   * Corrected error count threshold.
+   */
+  constexpr UINT64 corrected_error_count_threshold() const { return (Flags >> 0) & 0x7FFFULL; }
+  constexpr IA32_MC_CTL2_REGISTER with_corrected_error_count_threshold(UINT64 value) const { return IA32_MC_CTL2_REGISTER((Flags & ~0x7FFFULL) | ((value & 0x7FFFULL) << 0)); }
+
+  /**
+   * CMCI_EN.
+   */
+  constexpr UINT64 cmci_en() const { return (Flags >> 30) & 0x01ULL; }
+  constexpr IA32_MC_CTL2_REGISTER with_cmci_en(UINT64 value) const { return IA32_MC_CTL2_REGISTER((Flags & ~0x40000000ULL) | ((value & 0x01ULL) << 30)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_MC_CTL2_REGISTER) == 8, "Size of IA32_MC_CTL2_REGISTER");
+
+class IA32_MTRR_DEF_TYPE_REGISTER
+{
+public:
+  constexpr IA32_MTRR_DEF_TYPE_REGISTER() = default;
+  constexpr explicit IA32_MTRR_DEF_TYPE_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_MTRR_DEF_TYPE_REGISTER>
+  static constexpr IA32_MTRR_DEF_TYPE_REGISTER from(const T& raw) { return std::bit_cast<IA32_MTRR_DEF_TYPE_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_MTRR_DEF_TYPE_REGISTER&, const IA32_MTRR_DEF_TYPE_REGISTER&) = default;
+
+  /**
+   * Default Memory Type.
+   */
+  constexpr UINT64 default_memory_type() const { return (Flags >> 0) & 0x07ULL; }
+  constexpr IA32_MTRR_DEF_TYPE_REGISTER with_default_memory_type(UINT64 value) const { return IA32_MTRR_DEF_TYPE_REGISTER((Flags & ~0x07ULL) | ((value & 0x07ULL) << 0)); }
+
+  /**
+   * Fixed Range MTRR Enable.
+   */
+  constexpr UINT64 fixed_range_mtrr_enable() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr IA32_MTRR_DEF_TYPE_REGISTER with_fixed_range_mtrr_enable(UINT64 value) const { return IA32_MTRR_DEF_TYPE_REGISTER((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * MTRR Enable.
+   */
+  constexpr UINT64 mtrr_enable() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_MTRR_DEF_TYPE_REGISTER with_mtrr_enable(UINT64 value) const { return IA32_MTRR_DEF_TYPE_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_MTRR_DEF_TYPE_REGISTER) == 8, "Size of IA32_MTRR_DEF_TYPE_REGISTER");
+
+class IA32_PERF_CAPABILITIES_REGISTER
+{
+public:
+  constexpr IA32_PERF_CAPABILITIES_REGISTER() = default;
+  constexpr explicit IA32_PERF_CAPABILITIES_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PERF_CAPABILITIES_REGISTER>
+  static constexpr IA32_PERF_CAPABILITIES_REGISTER from(const T& raw) { return std::bit_cast<IA32_PERF_CAPABILITIES_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PERF_CAPABILITIES_REGISTER&, const IA32_PERF_CAPABILITIES_REGISTER&) = default;
+
+  /**
+   * LBR format.
+   */
+  constexpr UINT64 lbr_format() const { return (Flags >> 0) & 0x3FULL; }
+  constexpr IA32_PERF_CAPABILITIES_REGISTER with_lbr_format(UINT64 value) const { return IA32_PERF_CAPABILITIES_REGISTER((Flags & ~0x3FULL) | ((value & 0x3FULL) << 0)); }
+
+  /**
+   * PEBS Trap.
+   */
+  constexpr UINT64 pebs_trap() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr IA32_PERF_CAPABILITIES_REGISTER with_pebs_trap(UINT64 value) const { return IA32_PERF_CAPABILITIES_REGISTER((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * PEBSSaveArchRegs.
+   */
+  constexpr UINT64 pebs_save_arch_regs() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr IA32_PERF_CAPABILITIES_REGISTER with_pebs_save_arch_regs(UINT64 value) const { return IA32_PERF_CAPABILITIES_REGISTER((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * PEBS Record Format.
+   */
+  constexpr UINT64 pebs_record_format() const { return (Flags >> 8) & 0x0FULL; }
+  constexpr IA32_PERF_CAPABILITIES_REGISTER with_pebs_record_format(UINT64 value) const { return IA32_PERF_CAPABILITIES_REGISTER((Flags & ~0xF00ULL) | ((value & 0x0FULL) << 8)); }
+
+  /**
+   * Freeze while SMM is supported.
+   */
+  constexpr UINT64 freeze_while_smm_is_supported() const { return (Flags >> 12) & 0x01ULL; }
+  constexpr IA32_PERF_CAPABILITIES_REGISTER with_freeze_while_smm_is_supported(UINT64 value) const { return IA32_PERF_CAPABILITIES_REGISTER((Flags & ~0x1000ULL) | ((value & 0x01ULL) << 12)); }
+
+  /**
+   * Full width of counter writable via IA32_A_PMCx.
+   */
+  constexpr UINT64 full_width_counter_write() const { return (Flags >> 13) & 0x01ULL; }
+  constexpr IA32_PERF_CAPABILITIES_REGISTER with_full_width_counter_write(UINT64 value) const { return IA32_PERF_CAPABILITIES_REGISTER((Flags & ~0x2000ULL) | ((value & 0x01ULL) << 13)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PERF_CAPABILITIES_REGISTER) == 8, "Size of IA32_PERF_CAPABILITIES_REGISTER");
+
+class IA32_FIXED_CTR_CTRL_REGISTER
+{
+public:
+  constexpr IA32_FIXED_CTR_CTRL_REGISTER() = default;
+  constexpr explicit IA32_FIXED_CTR_CTRL_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_FIXED_CTR_CTRL_REGISTER>
+  static constexpr IA32_FIXED_CTR_CTRL_REGISTER from(const T& raw) { return std::bit_cast<IA32_FIXED_CTR_CTRL_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_FIXED_CTR_CTRL_REGISTER&, const IA32_FIXED_CTR_CTRL_REGISTER&) = default;
+
+  /**
+   * EN0_OS: Enable Fixed Counter 0 to count while CPL = 0.
+   */
+  constexpr UINT64 en0_os() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_FIXED_CTR_CTRL_REGISTER with_en0_os(UINT64 value) const { return IA32_FIXED_CTR_CTRL_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * EN0_Usr: Enable Fixed Counter 0 to count while CPL > 0.
+   */
+  constexpr UINT64 en0_usr() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_FIXED_CTR_CTRL_REGISTER with_en0_usr(UINT64 value) const { return IA32_FIXED_CTR_CTRL_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * AnyThread: When set to 1, it enables counting the associated event conditions occurring across all logical processors
+   * sharing a processor core. When set to 0, the counter only increments the associated event conditions occurring in the
+   * logical processor which programmed the MSR.
+   */
+  constexpr UINT64 any_thread0() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_FIXED_CTR_CTRL_REGISTER with_any_thread0(UINT64 value) const { return IA32_FIXED_CTR_CTRL_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * EN0_PMI: Enable PMI when fixed counter 0 overflows.
+   */
+  constexpr UINT64 en0_pmi() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr IA32_FIXED_CTR_CTRL_REGISTER with_en0_pmi(UINT64 value) const { return IA32_FIXED_CTR_CTRL_REGISTER((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * EN1_OS: Enable Fixed Counter 1 to count while CPL = 0.
+   */
+  constexpr UINT64 en1_os() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr IA32_FIXED_CTR_CTRL_REGISTER with_en1_os(UINT64 value) const { return IA32_FIXED_CTR_CTRL_REGISTER((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * EN1_Usr: Enable Fixed Counter 1 to count while CPL > 0.
+   */
+  constexpr UINT64 en1_usr() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr IA32_FIXED_CTR_CTRL_REGISTER with_en1_usr(UINT64 value) const { return IA32_FIXED_CTR_CTRL_REGISTER((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * AnyThread: When set to 1, it enables counting the associated event conditions occurring across all logical processors
+   * sharing a processor core. When set to 0, the counter only increments the associated event conditions occurring in the
+   * logical processor which programmed the MSR.
+   */
+  constexpr UINT64 any_thread1() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr IA32_FIXED_CTR_CTRL_REGISTER with_any_thread1(UINT64 value) const { return IA32_FIXED_CTR_CTRL_REGISTER((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * EN1_PMI: Enable PMI when fixed counter 1 overflows.
+   */
+  constexpr UINT64 en1_pmi() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr IA32_FIXED_CTR_CTRL_REGISTER with_en1_pmi(UINT64 value) const { return IA32_FIXED_CTR_CTRL_REGISTER((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * EN2_OS: Enable Fixed Counter 2 to count while CPL = 0.
+   */
+  constexpr UINT64 en2_os() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr IA32_FIXED_CTR_CTRL_REGISTER with_en2_os(UINT64 value) const { return IA32_FIXED_CTR_CTRL_REGISTER((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * EN2_Usr: Enable Fixed Counter 2 to count while CPL > 0.
+   */
+  constexpr UINT64 en2_usr() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr IA32_FIXED_CTR_CTRL_REGISTER with_en2_usr(UINT64 value) const { return IA32_FIXED_CTR_CTRL_REGISTER((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * AnyThread: When set to 1, it enables counting the associated event conditions occurring across all logical processors
+   * sharing a processor core. When set to 0, the counter only increments the associated event conditions occurring in the
+   * logical processor which programmed the MSR.
+   */
+  constexpr UINT64 any_thread2() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr IA32_FIXED_CTR_CTRL_REGISTER with_any_thread2(UINT64 value) const { return IA32_FIXED_CTR_CTRL_REGISTER((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * EN2_PMI: Enable PMI when fixed counter 2 overflows.
+   */
+  constexpr UINT64 en2_pmi() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_FIXED_CTR_CTRL_REGISTER with_en2_pmi(UINT64 value) const { return IA32_FIXED_CTR_CTRL_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_FIXED_CTR_CTRL_REGISTER) == 8, "Size of IA32_FIXED_CTR_CTRL_REGISTER");
+
+class IA32_PERF_GLOBAL_STATUS_REGISTER
+{
+public:
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER() = default;
+  constexpr explicit IA32_PERF_GLOBAL_STATUS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PERF_GLOBAL_STATUS_REGISTER>
+  static constexpr IA32_PERF_GLOBAL_STATUS_REGISTER from(const T& raw) { return std::bit_cast<IA32_PERF_GLOBAL_STATUS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PERF_GLOBAL_STATUS_REGISTER&, const IA32_PERF_GLOBAL_STATUS_REGISTER&) = default;
+
+  /**
+   * Ovf_PMC0: Overflow status of IA32_PMC0.
+   */
+  constexpr UINT64 ovf_pmc0() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_ovf_pmc0(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Ovf_PMC1: Overflow status of IA32_PMC1.
+   */
+  constexpr UINT64 ovf_pmc1() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_ovf_pmc1(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * Ovf_PMC2: Overflow status of IA32_PMC2.
+   */
+  constexpr UINT64 ovf_pmc2() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_ovf_pmc2(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * Ovf_PMC3: Overflow status of IA32_PMC3.
+   */
+  constexpr UINT64 ovf_pmc3() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_ovf_pmc3(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * Ovf_FixedCtr0: Overflow status of IA32_FIXED_CTR0.
+   */
+  constexpr UINT64 ovf_fixedctr0() const { return (Flags >> 32) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_ovf_fixedctr0(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x100000000ULL) | ((value & 0x01ULL) << 32)); }
+
+  /**
+   * Ovf_FixedCtr1: Overflow status of IA32_FIXED_CTR1.
+   */
+  constexpr UINT64 ovf_fixedctr1() const { return (Flags >> 33) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_ovf_fixedctr1(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x200000000ULL) | ((value & 0x01ULL) << 33)); }
+
+  /**
+   * Ovf_FixedCtr2: Overflow status of IA32_FIXED_CTR2.
+   */
+  constexpr UINT64 ovf_fixedctr2() const { return (Flags >> 34) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_ovf_fixedctr2(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x400000000ULL) | ((value & 0x01ULL) << 34)); }
+
+  /**
+   * Trace_ToPA_PMI: A PMI occurred due to a ToPA entry memory buffer that was completely filled.
+   */
+  constexpr UINT64 trace_topa_pmi() const { return (Flags >> 55) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_trace_topa_pmi(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x80000000000000ULL) | ((value & 0x01ULL) << 55)); }
+
+  /**
+   * LBR_Frz. LBRs are frozen due to:
+   * * IA32_DEBUGCTL.FREEZE_LBR_ON_PMI=1.
+   * * The LBR stack overflowed.
+   */
+  constexpr UINT64 lbr_frz() const { return (Flags >> 58) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_lbr_frz(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x400000000000000ULL) | ((value & 0x01ULL) << 58)); }
+
+  /**
+   * CTR_Frz. Performance counters in the core PMU are frozen due to:
+   * * IA32_DEBUGCTL.FREEZE_PERFMON_ON_PMI=1.
+   * * One or more core PMU counters overflowed.
+   */
+  constexpr UINT64 ctr_frz() const { return (Flags >> 59) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_ctr_frz(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x800000000000000ULL) | ((value & 0x01ULL) << 59)); }
+
+  /**
+   * ASCI: Data in the performance counters in the core PMU may include contributions from the direct or indirect operation
+   * Intel SGX to protect an enclave.
+   */
+  constexpr UINT64 asci() const { return (Flags >> 60) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_asci(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x1000000000000000ULL) | ((value & 0x01ULL) << 60)); }
+
+  /**
+   * Uncore counter overflow status.
+   */
+  constexpr UINT64 ovf_uncore() const { return (Flags >> 61) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_ovf_uncore(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x2000000000000000ULL) | ((value & 0x01ULL) << 61)); }
+
+  /**
+   * OvfBuf: DS SAVE area Buffer overflow status.
+   */
+  constexpr UINT64 ovf_buf() const { return (Flags >> 62) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_ovf_buf(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x4000000000000000ULL) | ((value & 0x01ULL) << 62)); }
+
+  /**
+   * CondChgd: Status bits of this register have changed.
+   */
+  constexpr UINT64 cond_chgd() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_REGISTER with_cond_chgd(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_REGISTER((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PERF_GLOBAL_STATUS_REGISTER) == 8, "Size of IA32_PERF_GLOBAL_STATUS_REGISTER");
+
+class IA32_PERF_GLOBAL_STATUS_RESET_REGISTER
+{
+public:
+  constexpr IA32_PERF_GLOBAL_STATUS_RESET_REGISTER() = default;
+  constexpr explicit IA32_PERF_GLOBAL_STATUS_RESET_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PERF_GLOBAL_STATUS_RESET_REGISTER>
+  static constexpr IA32_PERF_GLOBAL_STATUS_RESET_REGISTER from(const T& raw) { return std::bit_cast<IA32_PERF_GLOBAL_STATUS_RESET_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PERF_GLOBAL_STATUS_RESET_REGISTER&, const IA32_PERF_GLOBAL_STATUS_RESET_REGISTER&) = default;
+
+  /**
+   * Set 1 to clear Ovf_PMC(n) bit. Clear bitmask. Only the first n-1 bits are valid. Bits 31:n are reserved.
+   */
+  constexpr UINT64 clear_ovf_pmcn() const { return (Flags >> 0) & 0xFFFFFFFFULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_RESET_REGISTER with_clear_ovf_pmcn(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_RESET_REGISTER((Flags & ~0xFFFFFFFFULL) | ((value & 0xFFFFFFFFULL) << 0)); }
+
+  /**
+   * Set 1 to clear Ovf_FIXED_CTR(n) bit. Clear bitmask. Only the first n-1 bits are valid. Bits 31:n are reserved.
+   */
+  constexpr UINT64 clear_ovf_fixed_ctrn() const { return (Flags >> 32) & 0x07ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_RESET_REGISTER with_clear_ovf_fixed_ctrn(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_RESET_REGISTER((Flags & ~0x700000000ULL) | ((value & 0x07ULL) << 32)); }
+
+  /**
+   * Set 1 to clear Trace_ToPA_PMI bit.
+   */
+  constexpr UINT64 clear_trace_topa_pmi() const { return (Flags >> 55) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_RESET_REGISTER with_clear_trace_topa_pmi(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_RESET_REGISTER((Flags & ~0x80000000000000ULL) | ((value & 0x01ULL) << 55)); }
+
+  /**
+   * Set 1 to clear LBR_Frz bit.
+   */
+  constexpr UINT64 clear_lbr_frz() const { return (Flags >> 58) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_RESET_REGISTER with_clear_lbr_frz(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_RESET_REGISTER((Flags & ~0x400000000000000ULL) | ((value & 0x01ULL) << 58)); }
+
+  /**
+   * Set 1 to clear CTR_Frz bit.
+   */
+  constexpr UINT64 clear_ctr_frz() const { return (Flags >> 59) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_RESET_REGISTER with_clear_ctr_frz(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_RESET_REGISTER((Flags & ~0x800000000000000ULL) | ((value & 0x01ULL) << 59)); }
+
+  /**
+   * Set 1 to clear ASCI bit.
+   */
+  constexpr UINT64 clear_asci() const { return (Flags >> 60) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_RESET_REGISTER with_clear_asci(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_RESET_REGISTER((Flags & ~0x1000000000000000ULL) | ((value & 0x01ULL) << 60)); }
+
+  /**
+   * Set 1 to clear Ovf_Uncore bit.
+   */
+  constexpr UINT64 clear_ovf_uncore() const { return (Flags >> 61) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_RESET_REGISTER with_clear_ovf_uncore(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_RESET_REGISTER((Flags & ~0x2000000000000000ULL) | ((value & 0x01ULL) << 61)); }
+
+  /**
+   * Set 1 to clear OvfBuf bit.
+   */
+  constexpr UINT64 clear_ovf_buf() const { return (Flags >> 62) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_RESET_REGISTER with_clear_ovf_buf(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_RESET_REGISTER((Flags & ~0x4000000000000000ULL) | ((value & 0x01ULL) << 62)); }
+
+  /**
+   * Set 1 to clear CondChgd bit.
+   */
+  constexpr UINT64 clear_cond_chgd() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_RESET_REGISTER with_clear_cond_chgd(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_RESET_REGISTER((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PERF_GLOBAL_STATUS_RESET_REGISTER) == 8, "Size of IA32_PERF_GLOBAL_STATUS_RESET_REGISTER");
+
+class IA32_PERF_GLOBAL_STATUS_SET_REGISTER
+{
+public:
+  constexpr IA32_PERF_GLOBAL_STATUS_SET_REGISTER() = default;
+  constexpr explicit IA32_PERF_GLOBAL_STATUS_SET_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PERF_GLOBAL_STATUS_SET_REGISTER>
+  static constexpr IA32_PERF_GLOBAL_STATUS_SET_REGISTER from(const T& raw) { return std::bit_cast<IA32_PERF_GLOBAL_STATUS_SET_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PERF_GLOBAL_STATUS_SET_REGISTER&, const IA32_PERF_GLOBAL_STATUS_SET_REGISTER&) = default;
+
+  /**
+   * Set 1 to cause Ovf_PMC(n) = 1. Set bitmask. Only the first n-1 bits are valid. Bits 31:n are reserved.
+   */
+  constexpr UINT64 ovf_pmcn() const { return (Flags >> 0) & 0xFFFFFFFFULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_SET_REGISTER with_ovf_pmcn(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_SET_REGISTER((Flags & ~0xFFFFFFFFULL) | ((value & 0xFFFFFFFFULL) << 0)); }
+
+  /**
+   * Set 1 to cause Ovf_FIXED_CTR(n) = 1. Set bitmask. Only the first n-1 bits are valid. Bits 31:n are reserved.
+   */
+  constexpr UINT64 ovf_fixed_ctrn() const { return (Flags >> 32) & 0x07ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_SET_REGISTER with_ovf_fixed_ctrn(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_SET_REGISTER((Flags & ~0x700000000ULL) | ((value & 0x07ULL) << 32)); }
+
+  /**
+   * Set 1 to cause Trace_ToPA_PMI = 1.
+   */
+  constexpr UINT64 trace_topa_pmi() const { return (Flags >> 55) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_SET_REGISTER with_trace_topa_pmi(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_SET_REGISTER((Flags & ~0x80000000000000ULL) | ((value & 0x01ULL) << 55)); }
+
+  /**
+   * Set 1 to cause LBR_Frz = 1.
+   */
+  constexpr UINT64 lbr_frz() const { return (Flags >> 58) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_SET_REGISTER with_lbr_frz(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_SET_REGISTER((Flags & ~0x400000000000000ULL) | ((value & 0x01ULL) << 58)); }
+
+  /**
+   * Set 1 to cause CTR_Frz = 1.
+   */
+  constexpr UINT64 ctr_frz() const { return (Flags >> 59) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_SET_REGISTER with_ctr_frz(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_SET_REGISTER((Flags & ~0x800000000000000ULL) | ((value & 0x01ULL) << 59)); }
+
+  /**
+   * Set 1 to cause ASCI = 1.
+   */
+  constexpr UINT64 asci() const { return (Flags >> 60) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_SET_REGISTER with_asci(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_SET_REGISTER((Flags & ~0x1000000000000000ULL) | ((value & 0x01ULL) << 60)); }
+
+  /**
+   * Set 1 to cause Ovf_Uncore = 1.
+   */
+  constexpr UINT64 ovf_uncore() const { return (Flags >> 61) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_SET_REGISTER with_ovf_uncore(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_SET_REGISTER((Flags & ~0x2000000000000000ULL) | ((value & 0x01ULL) << 61)); }
+
+  /**
+   * Set 1 to cause OvfBuf = 1.
+   */
+  constexpr UINT64 ovf_buf() const { return (Flags >> 62) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_STATUS_SET_REGISTER with_ovf_buf(UINT64 value) const { return IA32_PERF_GLOBAL_STATUS_SET_REGISTER((Flags & ~0x4000000000000000ULL) | ((value & 0x01ULL) << 62)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PERF_GLOBAL_STATUS_SET_REGISTER) == 8, "Size of IA32_PERF_GLOBAL_STATUS_SET_REGISTER");
+
+class IA32_PERF_GLOBAL_INUSE_REGISTER
+{
+public:
+  constexpr IA32_PERF_GLOBAL_INUSE_REGISTER() = default;
+  constexpr explicit IA32_PERF_GLOBAL_INUSE_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PERF_GLOBAL_INUSE_REGISTER>
+  static constexpr IA32_PERF_GLOBAL_INUSE_REGISTER from(const T& raw) { return std::bit_cast<IA32_PERF_GLOBAL_INUSE_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PERF_GLOBAL_INUSE_REGISTER&, const IA32_PERF_GLOBAL_INUSE_REGISTER&) = default;
+
+  /**
+   * IA32_PERFEVTSEL(n) in use. Status bitmask. Only the first n-1 bits are valid. Bits 31:n are reserved.
+   */
+  constexpr UINT64 ia32_perfevtseln_in_use() const { return (Flags >> 0) & 0xFFFFFFFFULL; }
+  constexpr IA32_PERF_GLOBAL_INUSE_REGISTER with_ia32_perfevtseln_in_use(UINT64 value) const { return IA32_PERF_GLOBAL_INUSE_REGISTER((Flags & ~0xFFFFFFFFULL) | ((value & 0xFFFFFFFFULL) << 0)); }
+
+  /**
+   * IA32_FIXED_CTR(n) in use. Status bitmask. Only the first n-1 bits are valid. Bits 31:n are reserved.
+   */
+  constexpr UINT64 ia32_fixed_ctrn_in_use() const { return (Flags >> 32) & 0x07ULL; }
+  constexpr IA32_PERF_GLOBAL_INUSE_REGISTER with_ia32_fixed_ctrn_in_use(UINT64 value) const { return IA32_PERF_GLOBAL_INUSE_REGISTER((Flags & ~0x700000000ULL) | ((value & 0x07ULL) << 32)); }
+
+  /**
+   * PMI in use.
+   */
+  constexpr UINT64 pmi_in_use() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr IA32_PERF_GLOBAL_INUSE_REGISTER with_pmi_in_use(UINT64 value) const { return IA32_PERF_GLOBAL_INUSE_REGISTER((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PERF_GLOBAL_INUSE_REGISTER) == 8, "Size of IA32_PERF_GLOBAL_INUSE_REGISTER");
+
+class IA32_PEBS_ENABLE_REGISTER
+{
+public:
+  constexpr IA32_PEBS_ENABLE_REGISTER() = default;
+  constexpr explicit IA32_PEBS_ENABLE_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PEBS_ENABLE_REGISTER>
+  static constexpr IA32_PEBS_ENABLE_REGISTER from(const T& raw) { return std::bit_cast<IA32_PEBS_ENABLE_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PEBS_ENABLE_REGISTER&, const IA32_PEBS_ENABLE_REGISTER&) = default;
+
+  /**
+   * Enable PEBS on IA32_PMC0.
+   */
+  constexpr UINT64 enable_pebs() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_PEBS_ENABLE_REGISTER with_enable_pebs(UINT64 value) const { return IA32_PEBS_ENABLE_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Reserved or model specific.
+   */
+  constexpr UINT64 reservedormodelspecific1() const { return (Flags >> 1) & 0x07ULL; }
+  constexpr IA32_PEBS_ENABLE_REGISTER with_reservedormodelspecific1(UINT64 value) const { return IA32_PEBS_ENABLE_REGISTER((Flags & ~0x0EULL) | ((value & 0x07ULL) << 1)); }
+
+  /**
+   * Reserved or model specific.
+   */
+  constexpr UINT64 reservedormodelspecific2() const { return (Flags >> 32) & 0x0FULL; }
+  constexpr IA32_PEBS_ENABLE_REGISTER with_reservedormodelspecific2(UINT64 value) const { return IA32_PEBS_ENABLE_REGISTER((Flags & ~0xF00000000ULL) | ((value & 0x0FULL) << 32)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PEBS_ENABLE_REGISTER) == 8, "Size of IA32_PEBS_ENABLE_REGISTER");
+
+class IA32_VMX_BASIC_REGISTER
+{
+public:
+  constexpr IA32_VMX_BASIC_REGISTER() = default;
+  constexpr explicit IA32_VMX_BASIC_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_VMX_BASIC_REGISTER>
+  static constexpr IA32_VMX_BASIC_REGISTER from(const T& raw) { return std::bit_cast<IA32_VMX_BASIC_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_VMX_BASIC_REGISTER&, const IA32_VMX_BASIC_REGISTER&) = default;
+
+  /**
+   * @brief VMCS revision identifier used by the processor
+   *
+   * 31-bit VMCS revision identifier used by the processor. Processors that use the same VMCS revision identifier use the
+   * same size for VMCS regions.
+   */
+  constexpr UINT64 vmcs_revision_id() const { return (Flags >> 0) & 0x7FFFFFFFULL; }
+  constexpr IA32_VMX_BASIC_REGISTER with_vmcs_revision_id(UINT64 value) const { return IA32_VMX_BASIC_REGISTER((Flags & ~0x7FFFFFFFULL) | ((value & 0x7FFFFFFFULL) << 0)); }
+
+  /**
+   * Bit 31 is always 0.
+   */
+  constexpr UINT64 must_be_zero() const { return (Flags >> 31) & 0x01ULL; }
+  constexpr IA32_VMX_BASIC_REGISTER with_must_be_zero(UINT64 value) const { return IA32_VMX_BASIC_REGISTER((Flags & ~0x80000000ULL) | ((value & 0x01ULL) << 31)); }
+
+  /**
+   * @brief Size of the VMCS
+   *
+   * Report the number of bytes that software should allocate for the VMXON region and any VMCS region. It is a value greater
+   * than 0 and at most 4096 (bit 44 is set if and only if bits 43:32 are clear).
+   */
+  constexpr UINT64 vmcs_size_in_bytes() const { return (Flags >> 32) & 0x1FFFULL; }
+  constexpr IA32_VMX_BASIC_REGISTER with_vmcs_size_in_bytes(UINT64 value) const { return IA32_VMX_BASIC_REGISTER((Flags & ~0x1FFF00000000ULL) | ((value & 0x1FFFULL) << 32)); }
+
+  /**
+   * @brief Width of physical address used for the VMCS
+   *        - 0 -> limited to the available amount of physical RAM
+   *        - 1 -> within the first 4 GB
+   *
+   * Indicates the width of the physical addresses that may be used for the VMXON region, each VMCS, and data structures
+   * referenced by pointers in a VMCS (I/O bitmaps, virtual-APIC page, MSR areas for VMX transitions). If the bit is 0, these
+   * addresses are limited to the processor's physical-address width.2 If the bit is 1, these addresses are limited to 32
+   * bits. This bit is always 0 for processors that support Intel 64 architecture.
+   */
+  constexpr UINT64 vmcs_physical_address_width() const { return (Flags >> 48) & 0x01ULL; }
+  constexpr IA32_VMX_BASIC_REGISTER with_vmcs_physical_address_width(UINT64 value) const { return IA32_VMX_BASIC_REGISTER((Flags & ~0x1000000000000ULL) | ((value & 0x01ULL) << 48)); }
+
+  /**
+   * @brief Whether the processor supports the dual-monitor treatment of system-management interrupts and system-management
+   *        code (always 1)
+   *
+   * Read as 1, the logical processor supports the dual-monitor treatment of system-management interrupts and
+   * system-management mode.
+   *
+   * @see Vol3C[34.15(DUAL-MONITOR TREATMENT OF SMIs AND SMM)]
+   */
+  constexpr UINT64 dual_monitor_support() const { return (Flags >> 49) & 0x01ULL; }
+  constexpr IA32_VMX_BASIC_REGISTER with_dual_monitor_support(UINT64 value) const { return IA32_VMX_BASIC_REGISTER((Flags & ~0x2000000000000ULL) | ((value & 0x01ULL) << 49)); }
+
+  /**
+   * @brief Memory type that must be used for the VMCS
+   *
+   * Report the memory type that should be used for the VMCS, for data structures referenced by pointers in the VMCS (I/O
+   * bitmaps, virtual-APIC page, MSR areas for VMX transitions), and for the MSEG header. If software needs to access these
+   * data structures (e.g., to modify the contents of the MSR bitmaps), it can configure the paging structures to map them
+   * into the linear-address space. If it does so, it should establish mappings that use the memory type reported bits 53:50
+   * in this MSR.
+   * As of this writing, all processors that support VMX operation indicate the write-back type.
+   */
+  constexpr UINT64 memory_type() const { return (Flags >> 50) & 0x0FULL; }
+  constexpr IA32_VMX_BASIC_REGISTER with_memory_type(UINT64 value) const { return IA32_VMX_BASIC_REGISTER((Flags & ~0x3C000000000000ULL) | ((value & 0x0FULL) << 50)); }
+
+  /**
+   * @brief Whether the processor provides additional information for exits due to INS/OUTS
+   *
+   * When set to 1, the processor reports information in the VM-exit instruction-information field on VM exits due to
+   * execution of the INS and OUTS instructions. This reporting is done only if this bit is read as 1.
+   *
+   * @see Vol3C[27.2.4(Information for VM Exits Due to Instruction Execution)]
+   */
+  constexpr UINT64 ins_outs_reporting() const { return (Flags >> 54) & 0x01ULL; }
+  constexpr IA32_VMX_BASIC_REGISTER with_ins_outs_reporting(UINT64 value) const { return IA32_VMX_BASIC_REGISTER((Flags & ~0x40000000000000ULL) | ((value & 0x01ULL) << 54)); }
+
+  /**
+   * @brief Whether default 1 bits in control MSRs (pin/proc/exit/entry) may be cleared to 0 and that 'true' control MSRs are
+   *        supported
+   *
+   * Is read as 1 if any VMX controls that default to 1 may be cleared to 0. It also reports support for the VMX capability
+   * MSRs IA32_VMX_TRUE_PINBASED_CTLS, IA32_VMX_TRUE_PROCBASED_CTLS, IA32_VMX_TRUE_EXIT_CTLS, and IA32_VMX_TRUE_ENTRY_CTLS.
+   *
+   * @see Vol3D[A.2(RESERVED CONTROLS AND DEFAULT SETTINGS)]
+   * @see Vol3D[A.3.1(Pin-Based VM-Execution Controls)]
+   * @see Vol3D[A.3.2(Primary Processor-Based VM-Execution Controls)]
+   * @see Vol3D[A.4(VM-EXIT CONTROLS)]
+   * @see Vol3D[A.5(VM-ENTRY CONTROLS)]
+   */
+  constexpr UINT64 vmx_controls() const { return (Flags >> 55) & 0x01ULL; }
+  constexpr IA32_VMX_BASIC_REGISTER with_vmx_controls(UINT64 value) const { return IA32_VMX_BASIC_REGISTER((Flags & ~0x80000000000000ULL) | ((value & 0x01ULL) << 55)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_VMX_BASIC_REGISTER) == 8, "Size of IA32_VMX_BASIC_REGISTER");
+
+class IA32_VMX_PINBASED_CTLS_REGISTER
+{
+public:
+  constexpr IA32_VMX_PINBASED_CTLS_REGISTER() = default;
+  constexpr explicit IA32_VMX_PINBASED_CTLS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_VMX_PINBASED_CTLS_REGISTER>
+  static constexpr IA32_VMX_PINBASED_CTLS_REGISTER from(const T& raw) { return std::bit_cast<IA32_VMX_PINBASED_CTLS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_VMX_PINBASED_CTLS_REGISTER&, const IA32_VMX_PINBASED_CTLS_REGISTER&) = default;
+
+  /**
+   * @brief External interrupts cause VM-exits if set; otherwise dispatched through the guest's IDT
+   *
+   * If this control is 1, external interrupts cause VM exits. Otherwise, they are delivered normally through the guest
+   * interrupt-descriptor table (IDT). If this control is 1, the value of RFLAGS.IF does not affect interrupt blocking.
+   */
+  constexpr UINT64 external_interrupt_exiting() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_VMX_PINBASED_CTLS_REGISTER with_external_interrupt_exiting(UINT64 value) const { return IA32_VMX_PINBASED_CTLS_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * @brief Non-maskable interrupts cause VM-exits if set; otherwise dispatched through the guest's IDT
+   *
+   * If this control is 1, non-maskable interrupts (NMIs) cause VM exits. Otherwise, they are delivered normally using
+   * descriptor 2 of the IDT. This control also determines interactions between IRET and blocking by NMI.
+   *
+   * @see Vol3C[25.3(CHANGES TO INSTRUCTION BEHAVIOR IN VMX NON-ROOT OPERATION)]
+   */
+  constexpr UINT64 nmi_exiting() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr IA32_VMX_PINBASED_CTLS_REGISTER with_nmi_exiting(UINT64 value) const { return IA32_VMX_PINBASED_CTLS_REGISTER((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * @brief Virtual NMIs
+   *
+   * If this control is 1, NMIs are never blocked and the "blocking by NMI" bit (bit 3) in the interruptibility-state field
+   * indicates "virtual-NMI blocking". This control also interacts with the "NMI-window exiting" VM-execution control.
+   *
+   * @see Vol3C[24.6.2(Processor-Based VM-Execution Controls)]
+   */
+  constexpr UINT64 virtual_nmi() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr IA32_VMX_PINBASED_CTLS_REGISTER with_virtual_nmi(UINT64 value) const { return IA32_VMX_PINBASED_CTLS_REGISTER((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * @brief Activate VMX preemption timer
+   *
+   * If this control is 1, the VMX-preemption timer counts down in VMX non-root operation. A VM exit occurs when the timer
+   * counts down to zero.
+   *
+   * @see Vol3C[25.5.1(VMX-Preemption Timer)]
+   * @see Vol3C[25.2(OTHER CAUSES OF VM EXITS)]
+   */
+  constexpr UINT64 activate_vmx_preemption_timer() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr IA32_VMX_PINBASED_CTLS_REGISTER with_activate_vmx_preemption_timer(UINT64 value) const { return IA32_VMX_PINBASED_CTLS_REGISTER((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * @brief Process interrupts with the posted-interrupt notification vector
+   *
+   * If this control is 1, the processor treats interrupts with the posted-interrupt notification vector specially, updating
+   * the virtual-APIC page with posted-interrupt requests.
+   *
+   * @see Vol3C[24.6.8(Controls for APIC Virtualization)]
+   * @see Vol3C[29.6(POSTED-INTERRUPT PROCESSING)]
+   */
+  constexpr UINT64 process_posted_interrupts() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr IA32_VMX_PINBASED_CTLS_REGISTER with_process_posted_interrupts(UINT64 value) const { return IA32_VMX_PINBASED_CTLS_REGISTER((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_VMX_PINBASED_CTLS_REGISTER) == 8, "Size of IA32_VMX_PINBASED_CTLS_REGISTER");
+
+class IA32_VMX_PROCBASED_CTLS_REGISTER
+{
+public:
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER() = default;
+  constexpr explicit IA32_VMX_PROCBASED_CTLS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_VMX_PROCBASED_CTLS_REGISTER>
+  static constexpr IA32_VMX_PROCBASED_CTLS_REGISTER from(const T& raw) { return std::bit_cast<IA32_VMX_PROCBASED_CTLS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_VMX_PROCBASED_CTLS_REGISTER&, const IA32_VMX_PROCBASED_CTLS_REGISTER&) = default;
+
+  /**
+   * @brief VM-exit as soon as RFLAGS.IF=1 and no blocking is active
+   *
+   * If this control is 1, a VM exit occurs at the beginning of any instruction if RFLAGS.IF = 1 and there are no other
+   * blocking of interrupts.
+   *
+   * @see Vol3C[24.4.2(Guest Non-Register State)]
+   */
+  constexpr UINT64 interrupt_window_exiting() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_interrupt_window_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * @brief Use timestamp counter offset
+   *
+   * This control determines whether executions of RDTSC, executions of RDTSCP, and executions of RDMSR that read from the
+   * IA32_TIME_STAMP_COUNTER MSR return a value modified by the TSC offset field.
+   *
+   * @see Vol3C[24.6.5(Time-Stamp Counter Offset and Multiplier)]
+   * @see Vol3C[25.3(CHANGES TO INSTRUCTION BEHAVIOR IN VMX NON-ROOT OPERATION)]
+   */
+  constexpr UINT64 use_tsc_offsetting() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_use_tsc_offsetting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * @brief VM-exit when executing the HLT instruction
+   *
+   * This control determines whether executions of HLT cause VM exits.
+   */
+  constexpr UINT64 hlt_exiting() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_hlt_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * @brief VM-exit when executing the INVLPG instruction
+   *
+   * This control determines whether executions of INVLPG cause VM exits.
+   */
+  constexpr UINT64 invlpg_exiting() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_invlpg_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * @brief VM-exit when executing the MWAIT instruction
+   *
+   * This control determines whether executions of MWAIT cause VM exits.
+   */
+  constexpr UINT64 mwait_exiting() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_mwait_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * @brief VM-exit when executing the RDPMC instruction
+   *
+   * This control determines whether executions of RDPMC cause VM exits.
+   */
+  constexpr UINT64 rdpmc_exiting() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_rdpmc_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+  /**
+   * @brief VM-exit when executing the RDTSC/RDTSCP instruction
+   *
+   * This control determines whether executions of RDTSC and RDTSCP cause VM exits.
+   */
+  constexpr UINT64 rdtsc_exiting() const { return (Flags >> 12) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_rdtsc_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x1000ULL) | ((value & 0x01ULL) << 12)); }
+
+  /**
+   * @brief VM-exit when executing the MOV to CR3 instruction (forced to 1 on the 'first' VT-x capable CPUs; this actually
+   *        includes the newest Nehalem CPUs)
+   *
+   * In conjunction with the CR3-target controls, this control determines whether executions of MOV to CR3 cause VM exits.
+   * The first processors to support the virtual-machine extensions supported only the 1-setting of this control.
+   *
+   * @see Vol3C[24.6.7(CR3-Target Controls)]
+   * @see Vol3C[25.1.3(Instructions That Cause VM Exits Conditionally)]
+   */
+  constexpr UINT64 cr3_load_exiting() const { return (Flags >> 15) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_cr3_load_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x8000ULL) | ((value & 0x01ULL) << 15)); }
+
+  /**
+   * @brief VM-exit when executing the MOV from CR3 instruction (forced to 1 on the 'first' VT-x capable CPUs; this actually
+   *        includes the newest Nehalem CPUs)
+   *
+   * This control determines whether executions of MOV from CR3 cause VM exits. The first processors to support the
+   * virtual-machine extensions supported only the 1-setting of this control.
+   */
+  constexpr UINT64 cr3_store_exiting() const { return (Flags >> 16) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_cr3_store_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x10000ULL) | ((value & 0x01ULL) << 16)); }
+
+  /**
+   * @brief VM-exit on CR8 loads
+   *
+   * This control determines whether executions of MOV to CR8 cause VM exits.
+   */
+  constexpr UINT64 cr8_load_exiting() const { return (Flags >> 19) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_cr8_load_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x80000ULL) | ((value & 0x01ULL) << 19)); }
+
+  /**
+   * @brief VM-exit on CR8 stores
+   *
+   * This control determines whether executions of MOV from CR8 cause VM exits.
+   */
+  constexpr UINT64 cr8_store_exiting() const { return (Flags >> 20) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_cr8_store_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x100000ULL) | ((value & 0x01ULL) << 20)); }
+
+  /**
+   * @brief Use TPR shadow
+   *
+   * Setting this control to 1 enables TPR virtualization and other APIC-virtualization features.
+   *
+   * @see Vol3C[29(APIC VIRTUALIZATION AND VIRTUAL INTERRUPTS)]
+   */
+  constexpr UINT64 use_tpr_shadow() const { return (Flags >> 21) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_use_tpr_shadow(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x200000ULL) | ((value & 0x01ULL) << 21)); }
+
+  /**
+   * @brief VM-exit when virtual NMI blocking is disabled
+   *
+   * If this control is 1, a VM exit occurs at the beginning of any instruction if there is no virtual-NMI blocking.
+   *
+   * @see Vol3C[24.4.2(Guest Non-Register State)]
+   */
+  constexpr UINT64 nmi_window_exiting() const { return (Flags >> 22) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_nmi_window_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x400000ULL) | ((value & 0x01ULL) << 22)); }
+
+  /**
+   * @brief VM-exit when executing a MOV DRx instruction
+   *
+   * This control determines whether executions of MOV DR cause VM exits.
+   */
+  constexpr UINT64 mov_dr_exiting() const { return (Flags >> 23) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_mov_dr_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x800000ULL) | ((value & 0x01ULL) << 23)); }
+
+  /**
+   * @brief VM-exit when executing IO instructions
+   *
+   * This control determines whether executions of I/O instructions (IN, INS/INSB/INSW/INSD, OUT, and OUTS/OUTSB/OUTSW/OUTSD)
+   * cause VM exits.
+   */
+  constexpr UINT64 unconditional_io_exiting() const { return (Flags >> 24) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_unconditional_io_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x1000000ULL) | ((value & 0x01ULL) << 24)); }
+
+  /**
+   * @brief Use IO bitmaps
+   *
+   * This control determines whether I/O bitmaps are used to restrict executions of I/O instructions For this control, "0"
+   * means "do not use I/O bitmaps" and "1" means "use I/O bitmaps." If the I/O bitmaps are used, the setting of the
+   * "unconditional I/O exiting" control is ignored.
+   *
+   * @see Vol3C[24.6.4(I/O-Bitmap Addresses)]
+   * @see Vol3C[25.1.3(Instructions That Cause VM Exits Conditionally)]
+   */
+  constexpr UINT64 use_io_bitmaps() const { return (Flags >> 25) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_use_io_bitmaps(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x2000000ULL) | ((value & 0x01ULL) << 25)); }
+
+  /**
+   * @brief Monitor trap flag
+   *
+   * If this control is 1, the monitor trap flag debugging feature is enabled.
+   *
+   * @see Vol3C[25.5.2(Monitor Trap Flag)]
+   */
+  constexpr UINT64 monitor_trap_flag() const { return (Flags >> 27) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_monitor_trap_flag(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x8000000ULL) | ((value & 0x01ULL) << 27)); }
+
+  /**
+   * @brief Use MSR bitmaps
+   *
+   * This control determines whether MSR bitmaps are used to control execution of the RDMSR and WRMSR instructions. For this
+   * control, "0" means "do not use MSR bitmaps" and "1" means "use MSR bitmaps." If the MSR bitmaps are not used, all
+   * executions of the RDMSR and WRMSR instructions cause VM exits.
+   *
+   * @see Vol3C[24.6.9(MSR-Bitmap Address)]
+   * @see Vol3C[25.1.3(Instructions That Cause VM Exits Conditionally)]
+   */
+  constexpr UINT64 use_msr_bitmaps() const { return (Flags >> 28) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_use_msr_bitmaps(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x10000000ULL) | ((value & 0x01ULL) << 28)); }
+
+  /**
+   * @brief VM-exit when executing the MONITOR instruction
+   *
+   * This control determines whether executions of MONITOR cause VM exits.
+   */
+  constexpr UINT64 monitor_exiting() const { return (Flags >> 29) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_monitor_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x20000000ULL) | ((value & 0x01ULL) << 29)); }
+
+  /**
+   * @brief VM-exit when executing the PAUSE instruction
+   *
+   * This control determines whether executions of PAUSE cause VM exits.
+   */
+  constexpr UINT64 pause_exiting() const { return (Flags >> 30) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_pause_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x40000000ULL) | ((value & 0x01ULL) << 30)); }
+
+  /**
+   * @brief Determines whether the secondary processor based VM-execution controls are used
+   *
+   * This control determines whether the secondary processor-based VM-execution controls are used. If this control is 0, the
+   * logical processor operates as if all the secondary processor-based VM-execution controls were also 0.
+   */
+  constexpr UINT64 activate_secondary_controls() const { return (Flags >> 31) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS_REGISTER with_activate_secondary_controls(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS_REGISTER((Flags & ~0x80000000ULL) | ((value & 0x01ULL) << 31)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_VMX_PROCBASED_CTLS_REGISTER) == 8, "Size of IA32_VMX_PROCBASED_CTLS_REGISTER");
+
+class IA32_VMX_EXIT_CTLS_REGISTER
+{
+public:
+  constexpr IA32_VMX_EXIT_CTLS_REGISTER() = default;
+  constexpr explicit IA32_VMX_EXIT_CTLS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_VMX_EXIT_CTLS_REGISTER>
+  static constexpr IA32_VMX_EXIT_CTLS_REGISTER from(const T& raw) { return std::bit_cast<IA32_VMX_EXIT_CTLS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_VMX_EXIT_CTLS_REGISTER&, const IA32_VMX_EXIT_CTLS_REGISTER&) = default;
+
+  /**
+   * @brief Save guest debug controls (dr7 & IA32_DEBUGCTL_MSR) (forced to 1 on the 'first' VT-x capable CPUs; this actually
+   *        includes the newest Nehalem CPUs)
+   *
+   * This control determines whether DR7 and the IA32_DEBUGCTL MSR are saved on VM exit. The first processors to support the
+   * virtual-machine extensions supported only the 1-setting of this control.
+   */
+  constexpr UINT64 save_debug_controls() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_VMX_EXIT_CTLS_REGISTER with_save_debug_controls(UINT64 value) const { return IA32_VMX_EXIT_CTLS_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * @brief Return to long mode after a VM-exit
+   *
+   * On processors that support Intel 64 architecture, this control determines whether a logical processor is in 64-bit mode
+   * after the next VM exit. Its value is loaded into CS.L, IA32_EFER.LME, and IA32_EFER.LMA on every VM exit.1 This control
+   * must be 0 on processors that do not support Intel 64 architecture.
+   */
+  constexpr UINT64 host_address_space_size() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr IA32_VMX_EXIT_CTLS_REGISTER with_host_address_space_size(UINT64 value) const { return IA32_VMX_EXIT_CTLS_REGISTER((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * @brief Whether the IA32_PERF_GLOBAL_CTRL MSR is loaded on VM-exit
+   *
+   * This control determines whether the IA32_PERF_GLOBAL_CTRL MSR is loaded on VM exit.
+   */
+  constexpr UINT64 load_ia32_perf_global_ctrl() const { return (Flags >> 12) & 0x01ULL; }
+  constexpr IA32_VMX_EXIT_CTLS_REGISTER with_load_ia32_perf_global_ctrl(UINT64 value) const { return IA32_VMX_EXIT_CTLS_REGISTER((Flags & ~0x1000ULL) | ((value & 0x01ULL) << 12)); }
+
+  /**
+   * @brief Acknowledge external interrupts with the irq controller if one caused a VM-exit
+   *
+   * This control affects VM exits due to external interrupts:
+   * - If such a VM exit occurs and this control is 1, the logical processor acknowledges the interrupt controller, acquiring
+   * the interrupt's vector. The vector is stored in the VM-exit interruption-information field, which is marked valid.
+   * - If such a VM exit occurs and this control is 0, the interrupt is not acknowledged and the VM-exit
+   * interruption-information field is marked invalid.
+   */
+  constexpr UINT64 acknowledge_interrupt_on_exit() const { return (Flags >> 15) & 0x01ULL; }
+  constexpr IA32_VMX_EXIT_CTLS_REGISTER with_acknowledge_interrupt_on_exit(UINT64 value) const { return IA32_VMX_EXIT_CTLS_REGISTER((Flags & ~0x8000ULL) | ((value & 0x01ULL) << 15)); }
+
+  /**
+   * @brief Whether the guest IA32_PAT MSR is saved on VM-exit
+   *
+   * This control determines whether the IA32_PAT MSR is saved on VM exit.
+   */
+  constexpr UINT64 save_ia32_pat() const { return (Flags >> 18) & 0x01ULL; }
+  constexpr IA32_VMX_EXIT_CTLS_REGISTER with_save_ia32_pat(UINT64 value) const { return IA32_VMX_EXIT_CTLS_REGISTER((Flags & ~0x40000ULL) | ((value & 0x01ULL) << 18)); }
+
+  /**
+   * @brief Whether the host IA32_PAT MSR is loaded on VM-exit
+   *
+   * This control determines whether the IA32_PAT MSR is loaded on VM exit.
+   */
+  constexpr UINT64 load_ia32_pat() const { return (Flags >> 19) & 0x01ULL; }
+  constexpr IA32_VMX_EXIT_CTLS_REGISTER with_load_ia32_pat(UINT64 value) const { return IA32_VMX_EXIT_CTLS_REGISTER((Flags & ~0x80000ULL) | ((value & 0x01ULL) << 19)); }
+
+  /**
+   * @brief Whether the guest IA32_EFER MSR is saved on VM-exit
+   *
+   * This control determines whether the IA32_EFER MSR is saved on VM exit.
+   */
+  constexpr UINT64 save_ia32_efer() const { return (Flags >> 20) & 0x01ULL; }
+  constexpr IA32_VMX_EXIT_CTLS_REGISTER with_save_ia32_efer(UINT64 value) const { return IA32_VMX_EXIT_CTLS_REGISTER((Flags & ~0x100000ULL) | ((value & 0x01ULL) << 20)); }
+
+  /**
+   * @brief Whether the host IA32_EFER MSR is loaded on VM-exit
+   *
+   * This control determines whether the IA32_EFER MSR is loaded on VM exit.
+   */
+  constexpr UINT64 load_ia32_efer() const { return (Flags >> 21) & 0x01ULL; }
+  constexpr IA32_VMX_EXIT_CTLS_REGISTER with_load_ia32_efer(UINT64 value) const { return IA32_VMX_EXIT_CTLS_REGISTER((Flags & ~0x200000ULL) | ((value & 0x01ULL) << 21)); }
+
+  /**
+   * @brief Whether the value of the VMX preemption timer is saved on every VM-exit
+   *
+   * This control determines whether the value of the VMX-preemption timer is saved on VM exit.
+   */
+  constexpr UINT64 save_vmx_preemption_timer_value() const { return (Flags >> 22) & 0x01ULL; }
+  constexpr IA32_VMX_EXIT_CTLS_REGISTER with_save_vmx_preemption_timer_value(UINT64 value) const { return IA32_VMX_EXIT_CTLS_REGISTER((Flags & ~0x400000ULL) | ((value & 0x01ULL) << 22)); }
+
+  /**
+   * This control determines whether the IA32_BNDCFGS MSR is cleared on VM exit.
+   */
+  constexpr UINT64 clear_ia32_bndcfgs() const { return (Flags >> 23) & 0x01ULL; }
+  constexpr IA32_VMX_EXIT_CTLS_REGISTER with_clear_ia32_bndcfgs(UINT64 value) const { return IA32_VMX_EXIT_CTLS_REGISTER((Flags & ~0x800000ULL) | ((value & 0x01ULL) << 23)); }
+
+  /**
+   * If this control is 1, Intel Processor Trace does not produce a paging information packet (PIP) on a VM exit or a VMCS
+   * packet on an SMM VM exit.
+   */
+  constexpr UINT64 conceal_vmx_from_pt() const { return (Flags >> 24) & 0x01ULL; }
+  constexpr IA32_VMX_EXIT_CTLS_REGISTER with_conceal_vmx_from_pt(UINT64 value) const { return IA32_VMX_EXIT_CTLS_REGISTER((Flags & ~0x1000000ULL) | ((value & 0x01ULL) << 24)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_VMX_EXIT_CTLS_REGISTER) == 8, "Size of IA32_VMX_EXIT_CTLS_REGISTER");
+
+class IA32_VMX_ENTRY_CTLS_REGISTER
+{
+public:
+  constexpr IA32_VMX_ENTRY_CTLS_REGISTER() = default;
+  constexpr explicit IA32_VMX_ENTRY_CTLS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_VMX_ENTRY_CTLS_REGISTER>
+  static constexpr IA32_VMX_ENTRY_CTLS_REGISTER from(const T& raw) { return std::bit_cast<IA32_VMX_ENTRY_CTLS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_VMX_ENTRY_CTLS_REGISTER&, const IA32_VMX_ENTRY_CTLS_REGISTER&) = default;
+
+  /**
+   * @brief Load guest debug controls (dr7 & IA32_DEBUGCTL_MSR) (forced to 1 on the 'first' VT-x capable CPUs; this actually
+   *        includes the newest Nehalem CPUs)
+   *
+   * This control determines whether DR7 and the IA32_DEBUGCTL MSR are loaded on VM entry. The first processors to support
+   * the virtual-machine extensions supported only the 1-setting of this control.
+   */
+  constexpr UINT64 load_debug_controls() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_VMX_ENTRY_CTLS_REGISTER with_load_debug_controls(UINT64 value) const { return IA32_VMX_ENTRY_CTLS_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * @brief 64 bits guest mode. Must be 0 for CPUs that don't support AMD64
+   *
+   * On processors that support Intel 64 architecture, this control determines whether the logical processor is in IA-32e
+   * mode after VM entry. Its value is loaded into IA32_EFER.LMA as part of VM entry. This control must be 0 on processors
+   * that do not support Intel 64 architecture.
+   */
+  constexpr UINT64 ia32e_mode_guest() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr IA32_VMX_ENTRY_CTLS_REGISTER with_ia32e_mode_guest(UINT64 value) const { return IA32_VMX_ENTRY_CTLS_REGISTER((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * @brief In SMM mode after VM-entry
+   *
+   * This control determines whether the logical processor is in system-management mode (SMM) after VM entry. This control
+   * must be 0 for any VM entry from outside SMM.
+   */
+  constexpr UINT64 entry_to_smm() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr IA32_VMX_ENTRY_CTLS_REGISTER with_entry_to_smm(UINT64 value) const { return IA32_VMX_ENTRY_CTLS_REGISTER((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * @brief Disable dual treatment of SMI and SMM; must be zero for VM-entry outside of SMM
+   *
+   * If set to 1, the default treatment of SMIs and SMM is in effect after the VM entry. This control must be 0 for any VM
+   * entry from outside SMM
+   *
+   * @see Vol3C[34.15.7(Deactivating the Dual-Monitor Treatment)]
+   */
+  constexpr UINT64 deactivate_dual_monitor_treatment() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_VMX_ENTRY_CTLS_REGISTER with_deactivate_dual_monitor_treatment(UINT64 value) const { return IA32_VMX_ENTRY_CTLS_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+  /**
+   * @brief Whether the guest IA32_PERF_GLOBAL_CTRL MSR is loaded on VM-entry
+   *
+   * This control determines whether the IA32_PERF_GLOBAL_CTRL MSR is loaded on VM entry.
+   */
+  constexpr UINT64 load_ia32_perf_global_ctrl() const { return (Flags >> 13) & 0x01ULL; }
+  constexpr IA32_VMX_ENTRY_CTLS_REGISTER with_load_ia32_perf_global_ctrl(UINT64 value) const { return IA32_VMX_ENTRY_CTLS_REGISTER((Flags & ~0x2000ULL) | ((value & 0x01ULL) << 13)); }
+
+  /**
+   * @brief Whether the guest IA32_PAT MSR is loaded on VM-entry
+   *
+   * This control determines whether the IA32_PAT MSR is loaded on VM entry.
+   */
+  constexpr UINT64 load_ia32_pat() const { return (Flags >> 14) & 0x01ULL; }
+  constexpr IA32_VMX_ENTRY_CTLS_REGISTER with_load_ia32_pat(UINT64 value) const { return IA32_VMX_ENTRY_CTLS_REGISTER((Flags & ~0x4000ULL) | ((value & 0x01ULL) << 14)); }
+
+  /**
+   * @brief Whether the guest IA32_EFER MSR is loaded on VM-entry
+   *
+   * This control determines whether the IA32_EFER MSR is loaded on VM entry.
+   */
+  constexpr UINT64 load_ia32_efer() const { return (Flags >> 15) & 0x01ULL; }
+  constexpr IA32_VMX_ENTRY_CTLS_REGISTER with_load_ia32_efer(UINT64 value) const { return IA32_VMX_ENTRY_CTLS_REGISTER((Flags & ~0x8000ULL) | ((value & 0x01ULL) << 15)); }
+
+  /**
+   * This control determines whether the IA32_BNDCFGS MSR is loaded on VM entry.
+   */
+  constexpr UINT64 load_ia32_bndcfgs() const { return (Flags >> 16) & 0x01ULL; }
+  constexpr IA32_VMX_ENTRY_CTLS_REGISTER with_load_ia32_bndcfgs(UINT64 value) const { return IA32_VMX_ENTRY_CTLS_REGISTER((Flags & ~0x10000ULL) | ((value & 0x01ULL) << 16)); }
+
+  /**
+   * If this control is 1, Intel Processor Trace does not produce a paging information packet (PIP) on a VM entry or a VMCS
+   * packet on a VM entry that returns from SMM.
+   */
+  constexpr UINT64 conceal_vmx_from_pt() const { return (Flags >> 17) & 0x01ULL; }
+  constexpr IA32_VMX_ENTRY_CTLS_REGISTER with_conceal_vmx_from_pt(UINT64 value) const { return IA32_VMX_ENTRY_CTLS_REGISTER((Flags & ~0x20000ULL) | ((value & 0x01ULL) << 17)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_VMX_ENTRY_CTLS_REGISTER) == 8, "Size of IA32_VMX_ENTRY_CTLS_REGISTER");
+
+class IA32_VMX_MISC_REGISTER
+{
+public:
+  constexpr IA32_VMX_MISC_REGISTER() = default;
+  constexpr explicit IA32_VMX_MISC_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_VMX_MISC_REGISTER>
+  static constexpr IA32_VMX_MISC_REGISTER from(const T& raw) { return std::bit_cast<IA32_VMX_MISC_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_VMX_MISC_REGISTER&, const IA32_VMX_MISC_REGISTER&) = default;
+
+  /**
+   * @brief Relationship between the preemption timer and tsc; count down every time bit x of the tsc changes
+   *
+   * Report a value X that specifies the relationship between the rate of the VMX-preemption timer and that of the timestamp
+   * counter (TSC). Specifically, the VMX-preemption timer (if it is active) counts down by 1 every time bit X in the TSC
+   * changes due to a TSC increment.
+   */
+  constexpr UINT64 preemption_timer_tsc_relationship() const { return (Flags >> 0) & 0x1FULL; }
+  constexpr IA32_VMX_MISC_REGISTER with_preemption_timer_tsc_relationship(UINT64 value) const { return IA32_VMX_MISC_REGISTER((Flags & ~0x1FULL) | ((value & 0x1FULL) << 0)); }
+
+  /**
+   * @brief Whether VM-exit stores EFER.LMA into the "IA32e mode guest" field
+   *
+   * When set to 1, VM exits store the value of IA32_EFER.LMA into the "IA-32e mode guest" VM-entry control. This bit is read
+   * as 1 on any logical processor that supports the 1-setting of the "unrestricted guest" VM-execution control.
+   *
+   * @see Vol3C[27.2(RECORDING VM-EXIT INFORMATION AND UPDATING VM-ENTRY CONTROL FIELDS)]
+   */
+  constexpr UINT64 store_efer_lma_on_vmexit() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr IA32_VMX_MISC_REGISTER with_store_efer_lma_on_vmexit(UINT64 value) const { return IA32_VMX_MISC_REGISTER((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * @brief Activity states supported by the implementation
+   *
+   * Report, as a bitmap, the activity states supported by the implementation:
+   * - Bit 6 reports (if set) the support for activity state 1 (HLT).
+   * - Bit 7 reports (if set) the support for activity state 2 (shutdown).
+   * - Bit 8 reports (if set) the support for activity state 3 (wait-for-SIPI).
+   * If an activity state is not supported, the implementation causes a VM entry to fail if it attempts to establish that
+   * activity state. All implementations support VM entry to activity state 0 (active).
+   */
+  constexpr UINT64 activity_states() const { return (Flags >> 6) & 0x07ULL; }
+  constexpr IA32_VMX_MISC_REGISTER with_activity_states(UINT64 value) const { return IA32_VMX_MISC_REGISTER((Flags & ~0x1C0ULL) | ((value & 0x07ULL) << 6)); }
+
+  /**
+   * @brief Intel Processor Trace (Intel PT) can be used in VMX operation
+   *
+   * When set to 1, Intel(R) Processor Trace (Intel PT) can be used in VMX operation. If the processor supports Intel PT but
+   * does not allow it to be used in VMX operation, execution of VMXON clears IA32_RTIT_CTL.TraceEn; any attempt to write
+   * IA32_RTIT_CTL while in VMX operation (including VMX root operation) causes a general-protection exception.
+   *
+   * @see Vol3C[30.3(VMX INSTRUCTIONS | VMXON-Enter VMX Operation)]
+   */
+  constexpr UINT64 intel_pt_available_in_vmx() const { return (Flags >> 14) & 0x01ULL; }
+  constexpr IA32_VMX_MISC_REGISTER with_intel_pt_available_in_vmx(UINT64 value) const { return IA32_VMX_MISC_REGISTER((Flags & ~0x4000ULL) | ((value & 0x01ULL) << 14)); }
+
+  /**
+   * @brief Whether RDMSR can be used to read IA32_SMBASE_MSR in SMM
+   *
+   * When set to 1, the RDMSR instruction can be used in system-management mode (SMM) to read the IA32_SMBASE MSR (MSR
+   * address 9EH).
+   *
+   * @see Vol3C[34.15.6.3(Saving Guest State)]
+   */
+  constexpr UINT64 rdmsr_can_read_ia32_smbase_msr_in_smm() const { return (Flags >> 15) & 0x01ULL; }
+  constexpr IA32_VMX_MISC_REGISTER with_rdmsr_can_read_ia32_smbase_msr_in_smm(UINT64 value) const { return IA32_VMX_MISC_REGISTER((Flags & ~0x8000ULL) | ((value & 0x01ULL) << 15)); }
+
+  /**
+   * @brief Number of CR3 target values supported by the processor (0-256)
+   *
+   * Indicate the number of CR3-target values supported by the processor. This number is a value between 0 and 256, inclusive
+   * (bit 24 is set if and only if bits 23:16 are clear).
+   */
+  constexpr UINT64 cr3_target_count() const { return (Flags >> 16) & 0x1FFULL; }
+  constexpr IA32_VMX_MISC_REGISTER with_cr3_target_count(UINT64 value) const { return IA32_VMX_MISC_REGISTER((Flags & ~0x1FF0000ULL) | ((value & 0x1FFULL) << 16)); }
+
+  /**
+   * @brief Maximum number of MSRs in the VMCS. (N+1)*512
+   *
+   * Used to compute the recommended maximum number of MSRs that should appear in the VM-exit MSR-store list, the VM-exit
+   * MSR-load list, or the VM-entry MSR-load list. Specifically, if the value bits 27:25 of IA32_VMX_MISC is N, then 512 * (N
+   * + 1) is the recommended maximum number of MSRs to be included in each list. If the limit is exceeded, undefined
+   * processor behavior may result (including a machine check during the VMX transition).
+   */
+  constexpr UINT64 max_number_of_msr() const { return (Flags >> 25) & 0x07ULL; }
+  constexpr IA32_VMX_MISC_REGISTER with_max_number_of_msr(UINT64 value) const { return IA32_VMX_MISC_REGISTER((Flags & ~0xE000000ULL) | ((value & 0x07ULL) << 25)); }
+
+  /**
+   * @brief Whether bit 2 of IA32_SMM_MONITOR_CTL can be set to 1
+   *
+   * When set to 1, bit 2 of the IA32_SMM_MONITOR_CTL can be set to 1. VMXOFF unblocks SMIs unless IA32_SMM_MONITOR_CTL[bit
+   * 2] is 1.
+   *
+   * @see Vol3C[34.14.4(VMXOFF and SMI Unblocking)]
+   */
+  constexpr UINT64 smm_monitor_ctl_b2() const { return (Flags >> 28) & 0x01ULL; }
+  constexpr IA32_VMX_MISC_REGISTER with_smm_monitor_ctl_b2(UINT64 value) const { return IA32_VMX_MISC_REGISTER((Flags & ~0x10000000ULL) | ((value & 0x01ULL) << 28)); }
+
+  /**
+   * @brief Whether VMWRITE can be used to write VM-exit information fields
+   *
+   * When set to 1, software can use VMWRITE to write to any supported field in the VMCS; otherwise, VMWRITE cannot be used
+   * to modify VM-exit information fields.
+   */
+  constexpr UINT64 vmwrite_vmexit_info() const { return (Flags >> 29) & 0x01ULL; }
+  constexpr IA32_VMX_MISC_REGISTER with_vmwrite_vmexit_info(UINT64 value) const { return IA32_VMX_MISC_REGISTER((Flags & ~0x20000000ULL) | ((value & 0x01ULL) << 29)); }
+
+  /**
+   * When set to 1, VM entry allows injection of a software interrupt, software exception, or privileged software exception
+   * with an instruction length of 0.
+   */
+  constexpr UINT64 zero_length_instruction_vmentry_injection() const { return (Flags >> 30) & 0x01ULL; }
+  constexpr IA32_VMX_MISC_REGISTER with_zero_length_instruction_vmentry_injection(UINT64 value) const { return IA32_VMX_MISC_REGISTER((Flags & ~0x40000000ULL) | ((value & 0x01ULL) << 30)); }
+
+  /**
+   * @brief MSEG revision identifier used by the processor
+   *
+   * Report the 32-bit MSEG revision identifier used by the processor.
+   */
+  constexpr UINT64 mseg_id() const { return (Flags >> 32) & 0xFFFFFFFFULL; }
+  constexpr IA32_VMX_MISC_REGISTER with_mseg_id(UINT64 value) const { return IA32_VMX_MISC_REGISTER((Flags & ~0xFFFFFFFF00000000ULL) | ((value & 0xFFFFFFFFULL) << 32)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_VMX_MISC_REGISTER) == 8, "Size of IA32_VMX_MISC_REGISTER");
+
+class IA32_VMX_VMCS_ENUM_REGISTER
+{
+public:
+  constexpr IA32_VMX_VMCS_ENUM_REGISTER() = default;
+  constexpr explicit IA32_VMX_VMCS_ENUM_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_VMX_VMCS_ENUM_REGISTER>
+  static constexpr IA32_VMX_VMCS_ENUM_REGISTER from(const T& raw) { return std::bit_cast<IA32_VMX_VMCS_ENUM_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_VMX_VMCS_ENUM_REGISTER&, const IA32_VMX_VMCS_ENUM_REGISTER&) = default;
+
+  /**
+   * Indicates access type.
+   */
+  constexpr UINT64 access_type() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_VMX_VMCS_ENUM_REGISTER with_access_type(UINT64 value) const { return IA32_VMX_VMCS_ENUM_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Highest index value used for any VMCS encoding.
+   */
+  constexpr UINT64 highest_index_value() const { return (Flags >> 1) & 0x1FFULL; }
+  constexpr IA32_VMX_VMCS_ENUM_REGISTER with_highest_index_value(UINT64 value) const { return IA32_VMX_VMCS_ENUM_REGISTER((Flags & ~0x3FEULL) | ((value & 0x1FFULL) << 1)); }
+
+  /**
+   * Indicate the field's type.
+   */
+  constexpr UINT64 field_type() const { return (Flags >> 10) & 0x03ULL; }
+  constexpr IA32_VMX_VMCS_ENUM_REGISTER with_field_type(UINT64 value) const { return IA32_VMX_VMCS_ENUM_REGISTER((Flags & ~0xC00ULL) | ((value & 0x03ULL) << 10)); }
+
+  /**
+   * Indicate the field's width.
+   */
+  constexpr UINT64 field_width() const { return (Flags >> 13) & 0x03ULL; }
+  constexpr IA32_VMX_VMCS_ENUM_REGISTER with_field_width(UINT64 value) const { return IA32_VMX_VMCS_ENUM_REGISTER((Flags & ~0x6000ULL) | ((value & 0x03ULL) << 13)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_VMX_VMCS_ENUM_REGISTER) == 8, "Size of IA32_VMX_VMCS_ENUM_REGISTER");
+
+class IA32_VMX_PROCBASED_CTLS2_REGISTER
+{
+public:
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER() = default;
+  constexpr explicit IA32_VMX_PROCBASED_CTLS2_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_VMX_PROCBASED_CTLS2_REGISTER>
+  static constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER from(const T& raw) { return std::bit_cast<IA32_VMX_PROCBASED_CTLS2_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_VMX_PROCBASED_CTLS2_REGISTER&, const IA32_VMX_PROCBASED_CTLS2_REGISTER&) = default;
+
+  /**
+   * @brief Virtualize APIC access
+   *
+   * If this control is 1, the logical processor treats specially accesses to the page with the APICaccess address.
+   *
+   * @see Vol3C[29.4(VIRTUALIZING MEMORY-MAPPED APIC ACCESSES)]
+   */
+  constexpr UINT64 virtualize_apic_accesses() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_virtualize_apic_accesses(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * @brief EPT supported/enabled
+   *
+   * If this control is 1, extended page tables (EPT) are enabled.
+   *
+   * @see Vol3C[28.2(THE EXTENDED PAGE TABLE MECHANISM (EPT))]
+   */
+  constexpr UINT64 enable_ept() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_enable_ept(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * @brief Descriptor table instructions cause VM-exits
+   *
+   * This control determines whether executions of LGDT, LIDT, LLDT, LTR, SGDT, SIDT, SLDT, and STR cause VM exits.
+   */
+  constexpr UINT64 descriptor_table_exiting() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_descriptor_table_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * @brief RDTSCP supported/enabled
+   *
+   * If this control is 0, any execution of RDTSCP causes an invalid-opcode exception (\#UD).
+   */
+  constexpr UINT64 enable_rdtscp() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_enable_rdtscp(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * @brief Virtualize x2APIC mode
+   *
+   * If this control is 1, the logical processor treats specially RDMSR and WRMSR to APIC MSRs (in the range 800H-8FFH).
+   *
+   * @see Vol3C[29.5(VIRTUALIZING MSR-BASED APIC ACCESSES)]
+   */
+  constexpr UINT64 virtualize_x2apic_mode() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_virtualize_x2apic_mode(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * @brief VPID supported/enabled
+   *
+   * If this control is 1, cached translations of linear addresses are associated with a virtualprocessor identifier (VPID).
+   *
+   * @see Vol3C[28.1(VIRTUAL PROCESSOR IDENTIFIERS (VPIDS))]
+   */
+  constexpr UINT64 enable_vpid() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_enable_vpid(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * @brief VM-exit when executing the WBINVD instruction
+   *
+   * This control determines whether executions of WBINVD cause VM exits.
+   */
+  constexpr UINT64 wbinvd_exiting() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_wbinvd_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * @brief Unrestricted guest execution
+   *
+   * This control determines whether guest software may run in unpaged protected mode or in realaddress mode.
+   */
+  constexpr UINT64 unrestricted_guest() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_unrestricted_guest(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * @brief APIC register virtualization
+   *
+   * If this control is 1, the logical processor virtualizes certain APIC accesses.
+   *
+   * @see Vol3C[29.4(VIRTUALIZING MEMORY-MAPPED APIC ACCESSES)]
+   * @see Vol3C[29.5(VIRTUALIZING MSR-BASED APIC ACCESSES)]
+   */
+  constexpr UINT64 apic_register_virtualization() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_apic_register_virtualization(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * @brief Virtual-interrupt delivery
+   *
+   * This controls enables the evaluation and delivery of pending virtual interrupts as well as the emulation of writes to
+   * the APIC registers that control interrupt prioritization.
+   */
+  constexpr UINT64 virtual_interrupt_delivery() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_virtual_interrupt_delivery(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * @brief A specified number of pause loops cause a VM-exit
+   *
+   * This control determines whether a series of executions of PAUSE can cause a VM exit.
+   *
+   * @see Vol3C[24.6.13(Controls for PAUSE-Loop Exiting)]
+   * @see Vol3C[25.1.3(Instructions That Cause VM Exits Conditionally)]
+   */
+  constexpr UINT64 pause_loop_exiting() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_pause_loop_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * @brief VM-exit when executing RDRAND instructions
+   *
+   * This control determines whether executions of RDRAND cause VM exits.
+   */
+  constexpr UINT64 rdrand_exiting() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_rdrand_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+  /**
+   * @brief Enables INVPCID instructions
+   *
+   * If this control is 0, any execution of INVPCID causes a \#UD.
+   */
+  constexpr UINT64 enable_invpcid() const { return (Flags >> 12) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_enable_invpcid(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x1000ULL) | ((value & 0x01ULL) << 12)); }
+
+  /**
+   * @brief Enables VMFUNC instructions
+   *
+   * Setting this control to 1 enables use of the VMFUNC instruction in VMX non-root operation.
+   *
+   * @see Vol3C[25.5.5(VM Functions)]
+   */
+  constexpr UINT64 enable_vm_functions() const { return (Flags >> 13) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_enable_vm_functions(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x2000ULL) | ((value & 0x01ULL) << 13)); }
+
+  /**
+   * @brief Enables VMCS shadowing
+   *
+   * If this control is 1, executions of VMREAD and VMWRITE in VMX non-root operation may access a shadow VMCS (instead of
+   * causing VM exits).
+   *
+   * @see Vol3C[24.10(VMCS TYPES: ORDINARY AND SHADOW)]
+   * @see Vol3C[30.3(VMX INSTRUCTIONS)]
+   */
+  constexpr UINT64 vmcs_shadowing() const { return (Flags >> 14) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_vmcs_shadowing(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x4000ULL) | ((value & 0x01ULL) << 14)); }
+
+  /**
+   * @brief Enables ENCLS VM-exits
+   *
+   * If this control is 1, executions of ENCLS consult the ENCLS-exiting bitmap to determine whether the instruction causes a
+   * VM exit.
+   *
+   * @see Vol3C[24.6.16(ENCLS-Exiting Bitmap)]
+   * @see Vol3C[25.1.3(Instructions That Cause VM Exits Conditionally)]
+   */
+  constexpr UINT64 enable_encls_exiting() const { return (Flags >> 15) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_enable_encls_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x8000ULL) | ((value & 0x01ULL) << 15)); }
+
+  /**
+   * @brief VM-exit when executing RDSEED
+   *
+   * This control determines whether executions of RDSEED cause VM exits.
+   */
+  constexpr UINT64 rdseed_exiting() const { return (Flags >> 16) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_rdseed_exiting(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x10000ULL) | ((value & 0x01ULL) << 16)); }
+
+  /**
+   * @brief Enables page-modification logging
+   *
+   * If this control is 1, an access to a guest-physical address that sets an EPT dirty bit first adds an entry to the
+   * page-modification log.
+   *
+   * @see Vol3C[28.2.5(Page-Modification Logging)]
+   */
+  constexpr UINT64 enable_pml() const { return (Flags >> 17) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_enable_pml(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x20000ULL) | ((value & 0x01ULL) << 17)); }
+
+  /**
+   * @brief Controls whether EPT-violations may cause
+   *
+   * If this control is 1, EPT violations may cause virtualization exceptions (\#VE) instead of VM exits.
+   *
+   * @see Vol3C[25.5.6(Virtualization Exceptions)]
+   */
+  constexpr UINT64 ept_violation() const { return (Flags >> 18) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_ept_violation(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x40000ULL) | ((value & 0x01ULL) << 18)); }
+
+  /**
+   * @brief Conceal VMX non-root operation from Intel processor trace (PT)
+   *
+   * If this control is 1, Intel Processor Trace suppresses from PIPs an indication that the processor was in VMX non-root
+   * operation and omits a VMCS packet from any PSB+ produced in VMX nonroot operation.
+   *
+   * @see Vol3C[35(INTEL(R) PROCESSOR TRACE)]
+   */
+  constexpr UINT64 conceal_vmx_from_pt() const { return (Flags >> 19) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_conceal_vmx_from_pt(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x80000ULL) | ((value & 0x01ULL) << 19)); }
+
+  /**
+   * @brief Enables XSAVES/XRSTORS instructions
+   *
+   * If this control is 0, any execution of XSAVES or XRSTORS causes a \#UD.
+   */
+  constexpr UINT64 enable_xsaves() const { return (Flags >> 20) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_enable_xsaves(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x100000ULL) | ((value & 0x01ULL) << 20)); }
+
+  /**
+   * If this control is 1, EPT execute permissions are based on whether the linear address being accessed is supervisor mode
+   * or user mode.
+   */
+  constexpr UINT64 mode_based_execute_control_for_ept() const { return (Flags >> 22) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_mode_based_execute_control_for_ept(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x400000ULL) | ((value & 0x01ULL) << 22)); }
+
+  /**
+   * @brief Use TSC scaling
+   *
+   * This control determines whether executions of RDTSC, executions of RDTSCP, and executions of RDMSR that read from the
+   * IA32_TIME_STAMP_COUNTER MSR return a value modified by the TSC multiplier field.
+   *
+   * @see Vol3C[24.6.5(Time-Stamp Counter Offset and Multiplier)]
+   * @see Vol3C[25.3(CHANGES TO INSTRUCTION BEHAVIOR IN VMX NON-ROOT OPERATION)]
+   */
+  constexpr UINT64 use_tsc_scaling() const { return (Flags >> 25) & 0x01ULL; }
+  constexpr IA32_VMX_PROCBASED_CTLS2_REGISTER with_use_tsc_scaling(UINT64 value) const { return IA32_VMX_PROCBASED_CTLS2_REGISTER((Flags & ~0x2000000ULL) | ((value & 0x01ULL) << 25)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_VMX_PROCBASED_CTLS2_REGISTER) == 8, "Size of IA32_VMX_PROCBASED_CTLS2_REGISTER");
+
+class IA32_VMX_EPT_VPID_CAP_REGISTER
+{
+public:
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER() = default;
+  constexpr explicit IA32_VMX_EPT_VPID_CAP_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_VMX_EPT_VPID_CAP_REGISTER>
+  static constexpr IA32_VMX_EPT_VPID_CAP_REGISTER from(const T& raw) { return std::bit_cast<IA32_VMX_EPT_VPID_CAP_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_VMX_EPT_VPID_CAP_REGISTER&, const IA32_VMX_EPT_VPID_CAP_REGISTER&) = default;
+
+  /**
+   * When set to 1, the processor supports execute-only translations by EPT. This support allows software to configure EPT
+   * paging-structure entries in which bits 1:0 are clear (indicating that data accesses are not allowed) and bit 2 is set
+   * (indicating that instruction fetches are allowed).
+   */
+  constexpr UINT64 execute_only_pages() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_execute_only_pages(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Indicates support for a page-walk length of 4.
+   */
+  constexpr UINT64 page_walk_length_4() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_page_walk_length_4(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * When set to 1, the logical processor allows software to configure the EPT paging-structure memory type to be uncacheable
+   * (UC).
+   */
+  constexpr UINT64 memory_type_uncacheable() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_memory_type_uncacheable(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * When set to 1, the logical processor allows software to configure the EPT paging-structure memory type to be write-back
+   * (WB).
+   */
+  constexpr UINT64 memory_type_write_back() const { return (Flags >> 14) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_memory_type_write_back(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x4000ULL) | ((value & 0x01ULL) << 14)); }
+
+  /**
+   * When set to 1, the logical processor allows software to configure a EPT PDE to map a 2-Mbyte page (by setting bit 7 in
+   * the EPT PDE).
+   */
+  constexpr UINT64 pde_2mb_pages() const { return (Flags >> 16) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_pde_2mb_pages(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x10000ULL) | ((value & 0x01ULL) << 16)); }
+
+  /**
+   * When set to 1, the logical processor allows software to configure a EPT PDPTE to map a 1-Gbyte page (by setting bit 7 in
+   * the EPT PDPTE).
+   */
+  constexpr UINT64 pdpte_1gb_pages() const { return (Flags >> 17) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_pdpte_1gb_pages(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x20000ULL) | ((value & 0x01ULL) << 17)); }
+
+  /**
+   * If bit 20 is read as 1, the INVEPT instruction is supported.
+   */
+  constexpr UINT64 invept() const { return (Flags >> 20) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_invept(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x100000ULL) | ((value & 0x01ULL) << 20)); }
+
+  /**
+   * When set to 1, accessed and dirty flags for EPT are supported.
+   */
+  constexpr UINT64 ept_accessed_and_dirty_flags() const { return (Flags >> 21) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_ept_accessed_and_dirty_flags(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x200000ULL) | ((value & 0x01ULL) << 21)); }
+
+  /**
+   * When set to 1, the processor reports advanced VM-exit information for EPT violations. This reporting is done only if
+   * this bit is read as 1.
+   */
+  constexpr UINT64 advanced_vmexit_ept_violations_information() const { return (Flags >> 22) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_advanced_vmexit_ept_violations_information(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x400000ULL) | ((value & 0x01ULL) << 22)); }
+
+  /**
+   * When set to 1, the single-context INVEPT type is supported.
+   */
+  constexpr UINT64 invept_single_context() const { return (Flags >> 25) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_invept_single_context(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x2000000ULL) | ((value & 0x01ULL) << 25)); }
+
+  /**
+   * When set to 1, the all-context INVEPT type is supported.
+   */
+  constexpr UINT64 invept_all_contexts() const { return (Flags >> 26) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_invept_all_contexts(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x4000000ULL) | ((value & 0x01ULL) << 26)); }
+
+  /**
+   * When set to 1, the INVVPID instruction is supported.
+   */
+  constexpr UINT64 invvpid() const { return (Flags >> 32) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_invvpid(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x100000000ULL) | ((value & 0x01ULL) << 32)); }
+
+  /**
+   * When set to 1, the individual-address INVVPID type is supported.
+   */
+  constexpr UINT64 invvpid_individual_address() const { return (Flags >> 40) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_invvpid_individual_address(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x10000000000ULL) | ((value & 0x01ULL) << 40)); }
+
+  /**
+   * When set to 1, the single-context INVVPID type is supported.
+   */
+  constexpr UINT64 invvpid_single_context() const { return (Flags >> 41) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_invvpid_single_context(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x20000000000ULL) | ((value & 0x01ULL) << 41)); }
+
+  /**
+   * When set to 1, the all-context INVVPID type is supported.
+   */
+  constexpr UINT64 invvpid_all_contexts() const { return (Flags >> 42) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_invvpid_all_contexts(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x40000000000ULL) | ((value & 0x01ULL) << 42)); }
+
+  /**
+   * When set to 1, the single-context-retaining-globals INVVPID type is supported.
+   */
+  constexpr UINT64 invvpid_single_context_retain_globals() const { return (Flags >> 43) & 0x01ULL; }
+  constexpr IA32_VMX_EPT_VPID_CAP_REGISTER with_invvpid_single_context_retain_globals(UINT64 value) const { return IA32_VMX_EPT_VPID_CAP_REGISTER((Flags & ~0x80000000000ULL) | ((value & 0x01ULL) << 43)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_VMX_EPT_VPID_CAP_REGISTER) == 8, "Size of IA32_VMX_EPT_VPID_CAP_REGISTER");
+
+class IA32_VMX_VMFUNC_REGISTER
+{
+public:
+  constexpr IA32_VMX_VMFUNC_REGISTER() = default;
+  constexpr explicit IA32_VMX_VMFUNC_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_VMX_VMFUNC_REGISTER>
+  static constexpr IA32_VMX_VMFUNC_REGISTER from(const T& raw) { return std::bit_cast<IA32_VMX_VMFUNC_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_VMX_VMFUNC_REGISTER&, const IA32_VMX_VMFUNC_REGISTER&) = default;
+
+  /**
+   * The EPTP-switching VM function changes the EPT pointer to a value chosen from the EPTP list.
+   */
+  constexpr UINT64 eptp_switching() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_VMX_VMFUNC_REGISTER with_eptp_switching(UINT64 value) const { return IA32_VMX_VMFUNC_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_VMX_VMFUNC_REGISTER) == 8, "Size of IA32_VMX_VMFUNC_REGISTER");
+
+class IA32_MCG_EXT_CTL_REGISTER
+{
+public:
+  constexpr IA32_MCG_EXT_CTL_REGISTER() = default;
+  constexpr explicit IA32_MCG_EXT_CTL_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_MCG_EXT_CTL_REGISTER>
+  static constexpr IA32_MCG_EXT_CTL_REGISTER from(const T& raw) { return std::bit_cast<IA32_MCG_EXT_CTL_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_MCG_EXT_CTL_REGISTER&, const IA32_MCG_EXT_CTL_REGISTER&) = default;
+
+  constexpr UINT64 lmce_en() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_MCG_EXT_CTL_REGISTER with_lmce_en(UINT64 value) const { return IA32_MCG_EXT_CTL_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_MCG_EXT_CTL_REGISTER) == 8, "Size of IA32_MCG_EXT_CTL_REGISTER");
+
+class IA32_SGX_SVN_STATUS_REGISTER
+{
+public:
+  constexpr IA32_SGX_SVN_STATUS_REGISTER() = default;
+  constexpr explicit IA32_SGX_SVN_STATUS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_SGX_SVN_STATUS_REGISTER>
+  static constexpr IA32_SGX_SVN_STATUS_REGISTER from(const T& raw) { return std::bit_cast<IA32_SGX_SVN_STATUS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_SGX_SVN_STATUS_REGISTER&, const IA32_SGX_SVN_STATUS_REGISTER&) = default;
+
+  /**
+   * - If 1, indicates that a non-faulting Intel SGX instruction has been executed, consequently, launching a properly signed
+   * ACM but with Intel SGX SVN value less than the BIOS specified Intel SGX SVN threshold would lead to an TXT shutdown.
+   * - If 0, indicates that the processor will allow a properly signed ACM to launch irrespective of the Intel SGX SVN value
+   * of the ACM.
+   */
+  constexpr UINT64 lock() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_SGX_SVN_STATUS_REGISTER with_lock(UINT64 value) const { return IA32_SGX_SVN_STATUS_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * @brief Reflects the expected threshold of Intel SGX SVN for the SINIT ACM
+   *
+   * - If CPUID.01H:ECX.SMX = 1, this field reflects the expected threshold of Intel SGX SVN for the SINIT ACM.
+   * - If CPUID.01H:ECX.SMX = 0, this field is reserved (0).
+   *
+   * @see Vol3D[41.11.3(Interactions with Authenticated Code Modules (ACMs))]
+   */
+  constexpr UINT64 sgx_svn_sinit() const { return (Flags >> 16) & 0xFFULL; }
+  constexpr IA32_SGX_SVN_STATUS_REGISTER with_sgx_svn_sinit(UINT64 value) const { return IA32_SGX_SVN_STATUS_REGISTER((Flags & ~0xFF0000ULL) | ((value & 0xFFULL) << 16)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_SGX_SVN_STATUS_REGISTER) == 8, "Size of IA32_SGX_SVN_STATUS_REGISTER");
+
+class IA32_RTIT_OUTPUT_BASE_REGISTER
+{
+public:
+  constexpr IA32_RTIT_OUTPUT_BASE_REGISTER() = default;
+  constexpr explicit IA32_RTIT_OUTPUT_BASE_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_RTIT_OUTPUT_BASE_REGISTER>
+  static constexpr IA32_RTIT_OUTPUT_BASE_REGISTER from(const T& raw) { return std::bit_cast<IA32_RTIT_OUTPUT_BASE_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_RTIT_OUTPUT_BASE_REGISTER&, const IA32_RTIT_OUTPUT_BASE_REGISTER&) = default;
+
+  /**
+   * @brief Base physical address
+   *
+   * The base physical address. How this address is used depends on the value of IA32_RTIT_CTL.ToPA:
+   * - 0: This is the base physical address of a single, contiguous physical output region. This could be mapped to DRAM or
+   * to MMIO, depending on the value. The base address should be aligned with the size of the region, such that none of the
+   * 1s in the mask value overlap with 1s in the base address. If the base is not aligned, an operational error will result.
+   * - 1: The base physical address of the current ToPA table. The address must be 4K aligned. Writing an address in which
+   * bits 11:7 are non-zero will not cause a \#GP, but an operational error will be signaled once TraceEn is set.
+   *
+   * @see Vol3C[35.2.7.8(IA32_RTIT_OUTPUT_MASK_PTRS MSR)]
+   * @see Vol3C[35.3.9(Operational Errors)]
+   * @see Vol3C[35.2.6.2(Table of Physical Addresses (ToPA))]
+   */
+  constexpr UINT64 base_physical_address() const { return (Flags >> 7) & 0x1FFFFFFFFFFULL; }
+  constexpr IA32_RTIT_OUTPUT_BASE_REGISTER with_base_physical_address(UINT64 value) const { return IA32_RTIT_OUTPUT_BASE_REGISTER((Flags & ~0xFFFFFFFFFF80ULL) | ((value & 0x1FFFFFFFFFFULL) << 7)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_RTIT_OUTPUT_BASE_REGISTER) == 8, "Size of IA32_RTIT_OUTPUT_BASE_REGISTER");
+
+class IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER
+{
+public:
+  constexpr IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER() = default;
+  constexpr explicit IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER>
+  static constexpr IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER from(const T& raw) { return std::bit_cast<IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER&, const IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER&) = default;
+
+  /**
+   * Forced to 1, writes are ignored.
+   */
+  constexpr UINT64 lower_mask() const { return (Flags >> 0) & 0x7FULL; }
+  constexpr IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER with_lower_mask(UINT64 value) const { return IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER((Flags & ~0x7FULL) | ((value & 0x7FULL) << 0)); }
+
+  /**
+   * @brief MaskOrTableOffset
+   *
+   * The use of this field depends on the value of IA32_RTIT_CTL.ToPA:
+   * - 0: This field holds bits 31:7 of the mask value for the single, contiguous physical output region. The size of this
+   * field indicates that regions can be of size 128B up to 4GB. This value (combined with the lower 7 bits, which are
+   * reserved to 1) will be ANDed with the OutputOffset field to determine the next write address. All 1s in this field
+   * should be consecutive and starting at bit 7, otherwise the region will not be contiguous, and an operational error will
+   * be signaled when TraceEn is set.
+   * - 1: This field holds bits 27:3 of the offset pointer into the current ToPA table. This value can be added to the
+   * IA32_RTIT_OUTPUT_BASE value to produce a pointer to the current ToPA table entry, which itself is a pointer to the
+   * current output region. In this scenario, the lower 7 reserved bits are ignored. This field supports tables up to 256
+   * MBytes in size.
+   *
+   * @see Vol3C[35.3.9(Operational Errors)]
+   */
+  constexpr UINT64 mask_or_table_offset() const { return (Flags >> 7) & 0x1FFFFFFULL; }
+  constexpr IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER with_mask_or_table_offset(UINT64 value) const { return IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER((Flags & ~0xFFFFFF80ULL) | ((value & 0x1FFFFFFULL) << 7)); }
+
+  /**
+   * @brief Output Offset
+   *
+   * The use of this field depends on the value of IA32_RTIT_CTL.ToPA:
+   * - 0: This is bits 31:0 of the offset pointer into the single, contiguous physical output region. This value will be
+   * added to the IA32_RTIT_OUTPUT_BASE value to form the physical address at which the next byte of packet output data will
+   * be written. This value must be less than or equal to the MaskOrTableOffset field, otherwise an operational error will be
+   * signaled when TraceEn is set.
+   * - 1: This field holds bits 31:0 of the offset pointer into the current ToPA output region. This value will be added to
+   * the output region base field, found in the current ToPA table entry, to form the physical address at which the next byte
+   * of trace output data will be written. This value must be less than the ToPA entry size, otherwise an operational error
+   * will be signaled when TraceEn is set.
+   *
+   * @see Vol3C[35.3.9(Operational Errors)]
+   */
+  constexpr UINT64 output_offset() const { return (Flags >> 32) & 0xFFFFFFFFULL; }
+  constexpr IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER with_output_offset(UINT64 value) const { return IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER((Flags & ~0xFFFFFFFF00000000ULL) | ((value & 0xFFFFFFFFULL) << 32)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER) == 8, "Size of IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER");
+
+class IA32_RTIT_CTL_REGISTER
+{
+public:
+  constexpr IA32_RTIT_CTL_REGISTER() = default;
+  constexpr explicit IA32_RTIT_CTL_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_RTIT_CTL_REGISTER>
+  static constexpr IA32_RTIT_CTL_REGISTER from(const T& raw) { return std::bit_cast<IA32_RTIT_CTL_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_RTIT_CTL_REGISTER&, const IA32_RTIT_CTL_REGISTER&) = default;
+
+  /**
+   * @brief TraceEn
+   *
+   * If 1, enables tracing; else tracing is disabled.
+   * When this bit transitions from 1 to 0, all buffered packets are flushed out of internal buffers. A further store, fence,
+   * or architecturally serializing instruction may be required to ensure that packet data can be observed at the trace
+   * endpoint.
+   * Note that the processor will clear this bit on \#SMI (Section) and warm reset. Other MSR bits of IA32_RTIT_CTL (and
+   * other trace configuration MSRs) are not impacted by these events.
+   *
+   * @see Vol3C[35.2.7.3(Enabling and Disabling Packet Generation with TraceEn)]
+   */
+  constexpr UINT64 trace_enabled() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_trace_enabled(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * @brief CYCEn
+   *
+   * - 0: Disables CYC Packet.
+   * - 1: Enables CYC Packet.
+   *
+   * @remarks If CPUID.(EAX=14H, ECX=0):EBX.CPSB_CAM[bit 1] = 0
+   * @see Vol3C[35.4.2.14(Cycle Count (CYC) Packet)]
+   */
+  constexpr UINT64 cyc_enabled() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_cyc_enabled(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * @brief OS
+   *
+   * - 0: Packet generation is disabled when CPL = 0.
+   * - 1: Packet generation may be enabled when CPL = 0.
+   */
+  constexpr UINT64 os() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_os(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * @brief User
+   *
+   * - 0: Packet generation is disabled when CPL > 0.
+   * - 1: Packet generation may be enabled when CPL > 0.
+   */
+  constexpr UINT64 user() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_user(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * @brief PwrEvtEn
+   *
+   * - 0: Power Event Trace packets are disabled.
+   * - 1: Power Event Trace packets are enabled.
+   *
+   * @see Vol3C[35.2.3(Power Event Tracing)]
+   */
+  constexpr UINT64 power_event_trace_enabled() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_power_event_trace_enabled(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * @brief FUPonPTW
+   *
+   * - 0: PTW packets are not followed by FUPs.
+   * - 1: PTW packets are followed by FUPs.
+   */
+  constexpr UINT64 fup_on_ptw() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_fup_on_ptw(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * @brief FabricEn
+   *
+   * - 0: Trace output is directed to the memory subsystem, mechanism depends on IA32_RTIT_CTL.ToPA.
+   * - 1: Trace output is directed to the trace transport subsystem, IA32_RTIT_CTL.ToPA is ignored.
+   *
+   * @remarks If (CPUID.(EAX=07H, ECX=0):ECX[3] = 1) Reserved if CPUID.(EAX=14H, ECX=0):ECX[bit 3] = 0
+   */
+  constexpr UINT64 fabric_enabled() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_fabric_enabled(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * @brief CR3 filter
+   *
+   * - 0: Disables CR3 filtering.
+   * - 1: Enables CR3 filtering.
+   */
+  constexpr UINT64 cr3_filter() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_cr3_filter(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * @brief ToPA
+   *
+   * - 0: Single-range output scheme enabled.
+   * - 1: ToPA output scheme enabled.
+   *
+   * @remarks 0: If CPUID.(EAX=14H, ECX=0):ECX.SNGLRGNOUT[bit 2] = 1 and IA32_RTIT_CTL.FabricEn=0 1: If CPUID.(EAX=14H,
+   *          ECX=0):ECX.TOPA[bit 0] = 1, and IA32_RTIT_CTL.FabricEn=0
+   *          WRMSR to IA32_RTIT_CTL that sets TraceEn but clears this bit and FabricEn would cause \#GP: If CPUID.(EAX=14H,
+   *          ECX=0):ECX.SNGLRGNOUT[bit 2] = 0 WRMSR to IA32_RTIT_CTL that sets this bit causes \#GP: If CPUID.(EAX=14H,
+   *          ECX=0):ECX.TOPA[bit 0] = 0
+   * @see Vol3C[35.2.6.2(Table of Physical Addresses (ToPA))]
+   */
+  constexpr UINT64 topa() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_topa(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * @brief MTCEn
+   *
+   * - 0: Disables MTC Packet.
+   * - 1: Enables MTC Packet.
+   *
+   * @remarks If (CPUID.(EAX=07H, ECX=0):EBX[3] = 1) Reserved if CPUID.(EAX=14H, ECX=0):EBX.MTC[bit 3] = 0
+   * @see Vol3C[35.4.2.16(Overflow (OVF) Packet)]
+   */
+  constexpr UINT64 mtc_enabled() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_mtc_enabled(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * @brief TSCEn
+   *
+   * - 0: Disable TSC packets.
+   * - 1: Enable TSC packets.
+   *
+   * @see Vol3C[35.4.2.11(Timestamp Counter (TSC) Packet)]
+   */
+  constexpr UINT64 tsc_enabled() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_tsc_enabled(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * @brief DisRETC
+   *
+   * - 0: Enable RET compression.
+   * - 1: Disable RET compression.
+   *
+   * @see Vol3C[35.2.1.2(Indirect Transfer COFI)]
+   */
+  constexpr UINT64 ret_compression_disabled() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_ret_compression_disabled(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+  /**
+   * @brief PTWEn
+   *
+   * - 0: PTWRITE packet generation disabled.
+   * - 1: PTWRITE packet generation enabled.
+   */
+  constexpr UINT64 ptw_enabled() const { return (Flags >> 12) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_ptw_enabled(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x1000ULL) | ((value & 0x01ULL) << 12)); }
+
+  /**
+   * @brief BranchEn
+   *
+   * - 0: Disable COFI-based packets.
+   * - 1: Enable COFI-based packets: FUP, TIP, TIP.PGE, TIP.PGD, TNT, MODE.Exec, MODE.TSX.
+   *
+   * @see Vol3C[35.2.5.4(Branch Enable (BranchEn))]
+   */
+  constexpr UINT64 branch_enabled() const { return (Flags >> 13) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_branch_enabled(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x2000ULL) | ((value & 0x01ULL) << 13)); }
+
+  /**
+   * @brief MTCFreq
+   *
+   * Defines MTC packet Frequency, which is based on the core crystal clock, or Always Running Timer (ART). MTC will be sent
+   * each time the selected ART bit toggles. The following Encodings are defined:
+   * 0: ART(0), 1: ART(1), 2: ART(2), 3: ART(3), 4: ART(4), 5: ART(5), 6: ART(6), 7: ART(7), 8: ART(8), 9: ART(9), 10:
+   * ART(10), 11: ART(11), 12: ART(12), 13: ART(13), 14: ART(14), 15: ART(15)
+   *
+   * @remarks If (CPUID.(EAX=07H, ECX=0):EBX[3] = 1) Reserved if CPUID.(EAX=14H, ECX=0):EBX.MTC[bit 3] = 0
+   * @see Vol3C[35.3.1(Detection of Intel Processor Trace and Capability Enumeration)]
+   */
+  constexpr UINT64 mtc_frequency() const { return (Flags >> 14) & 0x0FULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_mtc_frequency(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x3C000ULL) | ((value & 0x0FULL) << 14)); }
+
+  /**
+   * @brief CYCThresh
+   *
+   * CYC packet threshold. CYC packets will be sent with the first eligible packet after N cycles have passed since the last
+   * CYC packet. If CycThresh is 0 then N=0, otherwise N is defined as 2(CycThresh-1). The following Encodings are defined:
+   * 0: 0, 1: 1, 2: 2, 3: 4, 4: 8, 5: 16, 6: 32, 7: 64, 8: 128, 9: 256, 10: 512, 11: 1024, 12: 2048, 13: 4096, 14: 8192, 15:
+   * 16384
+   *
+   * @remarks If (CPUID.(EAX=07H, ECX=0):EBX[1] = 1) Reserved if CPUID.(EAX=14H, ECX=0):EBX.CPSB_CAM[bit 1] = 0
+   * @see Vol3C[35.3.6(Cycle-Accurate Mode)]
+   * @see Vol3C[35.3.1(Detection of Intel Processor Trace and Capability Enumeration)]
+   */
+  constexpr UINT64 cyc_threshold() const { return (Flags >> 19) & 0x0FULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_cyc_threshold(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x780000ULL) | ((value & 0x0FULL) << 19)); }
+
+  /**
+   * @brief PSBFreq
+   *
+   * Indicates the frequency of PSB packets. PSB packet frequency is based on the number of Intel PT packet bytes output, so
+   * this field allows the user to determine the increment of IA32_IA32_RTIT_STATUS.PacketByteCnt that should cause a PSB to
+   * be generated. Note that PSB insertion is not precise, but the average output bytes per PSB should approximate the SW
+   * selected period. The following Encodings are defined:
+   * 0: 2K, 1: 4K, 2: 8K, 3: 16K, 4: 32K, 5: 64K, 6: 128K, 7: 256K, 8: 512K, 9: 1M, 10: 2M, 11: 4M, 12: 8M, 13: 16M, 14: 32M,
+   * 15: 64M
+   *
+   * @remarks If (CPUID.(EAX=07H, ECX=0):EBX[1] = 1) Reserved if CPUID.(EAX=14H, ECX=0):EBX.CPSB_CAM[bit 1] = 0
+   * @see Vol3C[35.3.1(Detection of Intel Processor Trace and Capability Enumeration)]
+   */
+  constexpr UINT64 psb_frequency() const { return (Flags >> 24) & 0x0FULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_psb_frequency(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0xF000000ULL) | ((value & 0x0FULL) << 24)); }
+
+  /**
+   * @brief ADDR0_CFG
+   *
+   * Configures the base/limit register pair IA32_RTIT_ADDR0_A/B based on the following encodings:
+   * - 0: ADDR0 range unused.
+   * - 1: The [IA32_RTIT_ADDR0_A..IA32_RTIT_ADDR0_B] range defines a FilterEn range. FilterEn will only be set when the IP is
+   * within this range, though other FilterEn ranges can additionally be used.
+   * - 2: The [IA32_RTIT_ADDR0_A..IA32_RTIT_ADDR0_B] range defines a TraceStop range. TraceStop will be asserted if code
+   * branches into this range.
+   * - 3..15: Reserved (\#GP).
+   *
+   * @remarks If (CPUID.(EAX=07H, ECX=1):EAX[2:0] > 0) Reserved if CPUID.(EAX=14H, ECX=1):EBX.RANGECNT[2:0] >= 0
+   * @see Vol3C[35.2.4.3(Filtering by IP)]
+   * @see Vol3C[35.4.2.10(Core:Bus Ratio (CBR) Packet)]
+   */
+  constexpr UINT64 addr0_cfg() const { return (Flags >> 32) & 0x0FULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_addr0_cfg(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0xF00000000ULL) | ((value & 0x0FULL) << 32)); }
+
+  /**
+   * @brief ADDR1_CFG
+   *
+   * Configures the base/limit register pair IA32_RTIT_ADDR1_A/B based on the following encodings:
+   * - 0: ADDR1 range unused.
+   * - 1: The [IA32_RTIT_ADDR1_A..IA32_RTIT_ADDR1_B] range defines a FilterEn range. FilterEn will only be set when the IP is
+   * within this range, though other FilterEn ranges can additionally be used.
+   * - 2: The [IA32_RTIT_ADDR1_A..IA32_RTIT_ADDR1_B] range defines a TraceStop range. TraceStop will be asserted if code
+   * branches into this range.
+   * - 3..15: Reserved (\#GP).
+   *
+   * @remarks If (CPUID.(EAX=07H, ECX=1):EAX[2:0] > 1) Reserved if CPUID.(EAX=14H, ECX=1):EBX.RANGECNT[2:0] < 2
+   * @see Vol3C[35.2.4.3(Filtering by IP)]
+   * @see Vol3C[35.4.2.10(Core:Bus Ratio (CBR) Packet)]
+   */
+  constexpr UINT64 addr1_cfg() const { return (Flags >> 36) & 0x0FULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_addr1_cfg(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0xF000000000ULL) | ((value & 0x0FULL) << 36)); }
+
+  /**
+   * @brief ADDR2_CFG
+   *
+   * Configures the base/limit register pair IA32_RTIT_ADDR2_A/B based on the following encodings:
+   * - 0: ADDR2 range unused.
+   * - 1: The [IA32_RTIT_ADDR2_A..IA32_RTIT_ADDR2_B] range defines a FilterEn range. FilterEn will only be set when the IP is
+   * within this range, though other FilterEn ranges can additionally be used.
+   * - 2: The [IA32_RTIT_ADDR2_A..IA32_RTIT_ADDR2_B] range defines a TraceStop range. TraceStop will be asserted if code
+   * branches into this range.
+   * - 3..15: Reserved (\#GP).
+   *
+   * @remarks If (CPUID.(EAX=07H, ECX=1):EAX[2:0] > 2) Reserved if CPUID.(EAX=14H, ECX=1):EBX.RANGECNT[2:0] < 3
+   * @see Vol3C[35.2.4.3(Filtering by IP)]
+   * @see Vol3C[35.4.2.10(Core:Bus Ratio (CBR) Packet)]
+   */
+  constexpr UINT64 addr2_cfg() const { return (Flags >> 40) & 0x0FULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_addr2_cfg(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0xF0000000000ULL) | ((value & 0x0FULL) << 40)); }
+
+  /**
+   * @brief ADDR3_CFG
+   *
+   * Configures the base/limit register pair IA32_RTIT_ADDR3_A/B based on the following encodings:
+   * - 0: ADDR3 range unused.
+   * - 1: The [IA32_RTIT_ADDR3_A..IA32_RTIT_ADDR3_B] range defines a FilterEn range. FilterEn will only be set when the IP is
+   * within this range, though other FilterEn ranges can additionally be used.
+   * - 2: The [IA32_RTIT_ADDR3_A..IA32_RTIT_ADDR3_B] range defines a TraceStop range. TraceStop will be asserted if code
+   * branches into this range.
+   * - 3..15: Reserved (\#GP).
+   *
+   * @remarks If (CPUID.(EAX=07H, ECX=1):EAX[2:0] > 3) Reserved if CPUID.(EAX=14H, ECX=1):EBX.RANGECNT[2:0] < 4
+   * @see Vol3C[35.2.4.3(Filtering by IP)]
+   * @see Vol3C[35.4.2.10(Core:Bus Ratio (CBR) Packet)]
+   */
+  constexpr UINT64 addr3_cfg() const { return (Flags >> 44) & 0x0FULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_addr3_cfg(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0xF00000000000ULL) | ((value & 0x0FULL) << 44)); }
+
+  /**
+   * @brief InjectPsbPmiOnEnable
+   *
+   * - 1: Enables use of IA32_RTIT_STATUS bits PendPSB[6] and PendTopaPMI[7].
+   * - 0: IA32_RTIT_STATUS bits 6 and 7 are ignored.
+   *
+   * @remarks Reserved if CPUID.(EAX=14H, ECX=0):EBX.INJECTPSBPMI[6] = 0
+   * @see Vol3C[35.2.7.4(IA32_RTIT_STATUS MSR)]
+   */
+  constexpr UINT64 inject_psb_pmi_on_enable() const { return (Flags >> 56) & 0x01ULL; }
+  constexpr IA32_RTIT_CTL_REGISTER with_inject_psb_pmi_on_enable(UINT64 value) const { return IA32_RTIT_CTL_REGISTER((Flags & ~0x100000000000000ULL) | ((value & 0x01ULL) << 56)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_RTIT_CTL_REGISTER) == 8, "Size of IA32_RTIT_CTL_REGISTER");
+
+class IA32_RTIT_STATUS_REGISTER
+{
+public:
+  constexpr IA32_RTIT_STATUS_REGISTER() = default;
+  constexpr explicit IA32_RTIT_STATUS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_RTIT_STATUS_REGISTER>
+  static constexpr IA32_RTIT_STATUS_REGISTER from(const T& raw) { return std::bit_cast<IA32_RTIT_STATUS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_RTIT_STATUS_REGISTER&, const IA32_RTIT_STATUS_REGISTER&) = default;
+
+  /**
+   * @brief FilterEn (writes ignored)
+   *
+   * This bit is written by the processor, and indicates that tracing is allowed for the current IP. Writes are ignored.
+   *
+   * @remarks If (CPUID.(EAX=07H, ECX=0):EBX[2] = 1)
+   * @see Vol3C[35.2.5.5(Filter Enable (FilterEn))]
+   */
+  constexpr UINT64 filter_enabled() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_RTIT_STATUS_REGISTER with_filter_enabled(UINT64 value) const { return IA32_RTIT_STATUS_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * @brief ContexEn (writes ignored)
+   *
+   * The processor sets this bit to indicate that tracing is allowed for the current context. Writes are ignored.
+   *
+   * @see Vol3C[35.2.5.3(Context Enable (ContextEn))]
+   */
+  constexpr UINT64 context_enabled() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_RTIT_STATUS_REGISTER with_context_enabled(UINT64 value) const { return IA32_RTIT_STATUS_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * @brief TriggerEn (writes ignored)
+   *
+   * The processor sets this bit to indicate that tracing is enabled. Writes are ignored.
+   *
+   * @see Vol3C[35.2.5.2(Trigger Enable (TriggerEn))]
+   */
+  constexpr UINT64 trigger_enabled() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_RTIT_STATUS_REGISTER with_trigger_enabled(UINT64 value) const { return IA32_RTIT_STATUS_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * @brief Error
+   *
+   * The processor sets this bit to indicate that an operational error has been encountered. When this bit is set, TriggerEn
+   * is cleared to 0 and packet generation is disabled.
+   * When TraceEn is cleared, software can write this bit. Once it is set, only software can clear it. It is not recommended
+   * that software ever set this bit, except in cases where it is restoring a prior saved state.
+   *
+   * @see Vol3C[35.2.6.2(Table of Physical Addresses (ToPA) | ToPA Errors)]
+   */
+  constexpr UINT64 error() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr IA32_RTIT_STATUS_REGISTER with_error(UINT64 value) const { return IA32_RTIT_STATUS_REGISTER((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * @brief Stopped
+   *
+   * The processor sets this bit to indicate that a ToPA Stop condition has been encountered. When this bit is set, TriggerEn
+   * is cleared to 0 and packet generation is disabled.
+   * When TraceEn is cleared, software can write this bit. Once it is set, only software can clear it. It is not recommended
+   * that software ever set this bit, except in cases where it is restoring a prior saved state.
+   *
+   * @see Vol3C[35.2.6.2(Table of Physical Addresses (ToPA) | ToPA STOP)]
+   */
+  constexpr UINT64 stopped() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr IA32_RTIT_STATUS_REGISTER with_stopped(UINT64 value) const { return IA32_RTIT_STATUS_REGISTER((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * @brief Pend PSB
+   *
+   * If IA32_RTIT_CTL.InjectPsbPmiOnEnable[56] = 1, the processor sets this bit when the threshold for a PSB+ to be inserted
+   * has been reached. The processor will clear this bit when the PSB+ has been inserted into the trace. If PendPSB = 1 and
+   * InjectPsbPmiOnEnable = 1 when IA32_RTIT_CTL.TraceEn[0] transitions from 0 to 1, a PSB+ will be inserted into the trace.
+   *
+   * @remarks If CPUID.(EAX=14H, ECX=0):EBX.INJECTPSBPMI[6] = 1
+   */
+  constexpr UINT64 pend_psb() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr IA32_RTIT_STATUS_REGISTER with_pend_psb(UINT64 value) const { return IA32_RTIT_STATUS_REGISTER((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * @brief Pend ToPA PMI
+   *
+   * If IA32_RTIT_CTL.InjectPsbPmiOnEnable[56] = 1, the processor sets this bit when the threshold for a ToPA PMI to be
+   * inserted has been reached. Software should clear this bit once the ToPA PMI has been handled. If PendTopaPMI = 1 and
+   * InjectPsbPmiOnEnable = 1 when IA32_RTIT_CTL.TraceEn[0] transitions from 0 to 1, a PMI will be pended.
+   *
+   * @remarks If CPUID.(EAX=14H, ECX=0):EBX.INJECTPSBPMI[6] = 1
+   * @see Vol3C[35.2.6.2(Table of Physical Addresses (ToPA) | ToPA PMI)]
+   */
+  constexpr UINT64 pend_topa_pmi() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr IA32_RTIT_STATUS_REGISTER with_pend_topa_pmi(UINT64 value) const { return IA32_RTIT_STATUS_REGISTER((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * @brief PacketByteCnt
+   *
+   * This field is written by the processor, and holds a count of packet bytes that have been sent out. The processor also
+   * uses this field to determine when the next PSB packet should be inserted. Note that the processor may clear or modify
+   * this field at any time while IA32_RTIT_CTL.TraceEn=1. It will have a stable value when IA32_RTIT_CTL.TraceEn=0.
+   *
+   * @remarks If (CPUID.(EAX=07H, ECX=0):EBX[1] > 3)
+   * @see Vol3C[35.4.2.17(Packet Stream Boundary (PSB) Packet)]
+   */
+  constexpr UINT64 packet_byte_count() const { return (Flags >> 32) & 0x1FFFFULL; }
+  constexpr IA32_RTIT_STATUS_REGISTER with_packet_byte_count(UINT64 value) const { return IA32_RTIT_STATUS_REGISTER((Flags & ~0x1FFFF00000000ULL) | ((value & 0x1FFFFULL) << 32)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_RTIT_STATUS_REGISTER) == 8, "Size of IA32_RTIT_STATUS_REGISTER");
+
+class IA32_RTIT_CR3_MATCH_REGISTER
+{
+public:
+  constexpr IA32_RTIT_CR3_MATCH_REGISTER() = default;
+  constexpr explicit IA32_RTIT_CR3_MATCH_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_RTIT_CR3_MATCH_REGISTER>
+  static constexpr IA32_RTIT_CR3_MATCH_REGISTER from(const T& raw) { return std::bit_cast<IA32_RTIT_CR3_MATCH_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_RTIT_CR3_MATCH_REGISTER&, const IA32_RTIT_CR3_MATCH_REGISTER&) = default;
+
+  /**
+   * CR3[63:5] value to match.
+   */
+  constexpr UINT64 cr3_value_to_match() const { return (Flags >> 5) & 0x7FFFFFFFFFFFFFFULL; }
+  constexpr IA32_RTIT_CR3_MATCH_REGISTER with_cr3_value_to_match(UINT64 value) const { return IA32_RTIT_CR3_MATCH_REGISTER((Flags & ~0xFFFFFFFFFFFFFFE0ULL) | ((value & 0x7FFFFFFFFFFFFFFULL) << 5)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_RTIT_CR3_MATCH_REGISTER) == 8, "Size of IA32_RTIT_CR3_MATCH_REGISTER");
+
+class IA32_RTIT_ADDR_REGISTER
+{
+public:
+  constexpr IA32_RTIT_ADDR_REGISTER() = default;
+  constexpr explicit IA32_RTIT_ADDR_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_RTIT_ADDR_REGISTER>
+  static constexpr IA32_RTIT_ADDR_REGISTER from(const T& raw) { return std::bit_cast<IA32_RTIT_ADDR_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_RTIT_ADDR_REGISTER&, const IA32_RTIT_ADDR_REGISTER&) = default;
+
+  /**
+   * Virtual Address.
+   */
+  constexpr UINT64 virtual_address() const { return (Flags >> 0) & 0xFFFFFFFFFFFFULL; }
+  constexpr IA32_RTIT_ADDR_REGISTER with_virtual_address(UINT64 value) const { return IA32_RTIT_ADDR_REGISTER((Flags & ~0xFFFFFFFFFFFFULL) | ((value & 0xFFFFFFFFFFFFULL) << 0)); }
+
+  /**
+   * SignExt_VA.
+   */
+  constexpr UINT64 sign_ext_va() const { return (Flags >> 48) & 0xFFFFULL; }
+  constexpr IA32_RTIT_ADDR_REGISTER with_sign_ext_va(UINT64 value) const { return IA32_RTIT_ADDR_REGISTER((Flags & ~0xFFFF000000000000ULL) | ((value & 0xFFFFULL) << 48)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_RTIT_ADDR_REGISTER) == 8, "Size of IA32_RTIT_ADDR_REGISTER");
+
+class IA32_PM_ENABLE_REGISTER
+{
+public:
+  constexpr IA32_PM_ENABLE_REGISTER() = default;
+  constexpr explicit IA32_PM_ENABLE_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PM_ENABLE_REGISTER>
+  static constexpr IA32_PM_ENABLE_REGISTER from(const T& raw) { return std::bit_cast<IA32_PM_ENABLE_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PM_ENABLE_REGISTER&, const IA32_PM_ENABLE_REGISTER&) = default;
+
+  /**
+   * HWP_ENABLE.
+   */
+  constexpr UINT64 hwp_enable() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_PM_ENABLE_REGISTER with_hwp_enable(UINT64 value) const { return IA32_PM_ENABLE_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PM_ENABLE_REGISTER) == 8, "Size of IA32_PM_ENABLE_REGISTER");
+
+class IA32_HWP_CAPABILITIES_REGISTER
+{
+public:
+  constexpr IA32_HWP_CAPABILITIES_REGISTER() = default;
+  constexpr explicit IA32_HWP_CAPABILITIES_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_HWP_CAPABILITIES_REGISTER>
+  static constexpr IA32_HWP_CAPABILITIES_REGISTER from(const T& raw) { return std::bit_cast<IA32_HWP_CAPABILITIES_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_HWP_CAPABILITIES_REGISTER&, const IA32_HWP_CAPABILITIES_REGISTER&) = default;
+
+  /**
+   * Highest_Performance.
+   */
+  constexpr UINT64 highest_performance() const { return (Flags >> 0) & 0xFFULL; }
+  constexpr IA32_HWP_CAPABILITIES_REGISTER with_highest_performance(UINT64 value) const { return IA32_HWP_CAPABILITIES_REGISTER((Flags & ~0xFFULL) | ((value & 0xFFULL) << 0)); }
+
+  /**
+   * Guaranteed_Performance.
+   */
+  constexpr UINT64 guaranteed_performance() const { return (Flags >> 8) & 0xFFULL; }
+  constexpr IA32_HWP_CAPABILITIES_REGISTER with_guaranteed_performance(UINT64 value) const { return IA32_HWP_CAPABILITIES_REGISTER((Flags & ~0xFF00ULL) | ((value & 0xFFULL) << 8)); }
+
+  /**
+   * Most_Efficient_Performance.
+   */
+  constexpr UINT64 most_efficient_performance() const { return (Flags >> 16) & 0xFFULL; }
+  constexpr IA32_HWP_CAPABILITIES_REGISTER with_most_efficient_performance(UINT64 value) const { return IA32_HWP_CAPABILITIES_REGISTER((Flags & ~0xFF0000ULL) | ((value & 0xFFULL) << 16)); }
+
+  /**
+   * Lowest_Performance.
+   */
+  constexpr UINT64 lowest_performance() const { return (Flags >> 24) & 0xFFULL; }
+  constexpr IA32_HWP_CAPABILITIES_REGISTER with_lowest_performance(UINT64 value) const { return IA32_HWP_CAPABILITIES_REGISTER((Flags & ~0xFF000000ULL) | ((value & 0xFFULL) << 24)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_HWP_CAPABILITIES_REGISTER) == 8, "Size of IA32_HWP_CAPABILITIES_REGISTER");
+
+class IA32_HWP_REQUEST_PKG_REGISTER
+{
+public:
+  constexpr IA32_HWP_REQUEST_PKG_REGISTER() = default;
+  constexpr explicit IA32_HWP_REQUEST_PKG_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_HWP_REQUEST_PKG_REGISTER>
+  static constexpr IA32_HWP_REQUEST_PKG_REGISTER from(const T& raw) { return std::bit_cast<IA32_HWP_REQUEST_PKG_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_HWP_REQUEST_PKG_REGISTER&, const IA32_HWP_REQUEST_PKG_REGISTER&) = default;
+
+  /**
+   * Minimum_Performance.
+   */
+  constexpr UINT64 minimum_performance() const { return (Flags >> 0) & 0xFFULL; }
+  constexpr IA32_HWP_REQUEST_PKG_REGISTER with_minimum_performance(UINT64 value) const { return IA32_HWP_REQUEST_PKG_REGISTER((Flags & ~0xFFULL) | ((value & 0xFFULL) << 0)); }
+
+  /**
+   * Maximum_Performance.
+   */
+  constexpr UINT64 maximum_performance() const { return (Flags >> 8) & 0xFFULL; }
+  constexpr IA32_HWP_REQUEST_PKG_REGISTER with_maximum_performance(UINT64 value) const { return IA32_HWP_REQUEST_PKG_REGISTER((Flags & ~0xFF00ULL) | ((value & 0xFFULL) << 8)); }
+
+  /**
+   * Desired_Performance.
+   */
+  constexpr UINT64 desired_performance() const { return (Flags >> 16) & 0xFFULL; }
+  constexpr IA32_HWP_REQUEST_PKG_REGISTER with_desired_performance(UINT64 value) const { return IA32_HWP_REQUEST_PKG_REGISTER((Flags & ~0xFF0000ULL) | ((value & 0xFFULL) << 16)); }
+
+  /**
+   * Energy_Performance_Preference.
+   */
+  constexpr UINT64 energy_performance_preference() const { return (Flags >> 24) & 0xFFULL; }
+  constexpr IA32_HWP_REQUEST_PKG_REGISTER with_energy_performance_preference(UINT64 value) const { return IA32_HWP_REQUEST_PKG_REGISTER((Flags & ~0xFF000000ULL) | ((value & 0xFFULL) << 24)); }
+
+  /**
+   * Activity_Window.
+   */
+  constexpr UINT64 activity_window() const { return (Flags >> 32) & 0x3FFULL; }
+  constexpr IA32_HWP_REQUEST_PKG_REGISTER with_activity_window(UINT64 value) const { return IA32_HWP_REQUEST_PKG_REGISTER((Flags & ~0x3FF00000000ULL) | ((value & 0x3FFULL) << 32)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_HWP_REQUEST_PKG_REGISTER) == 8, "Size of IA32_HWP_REQUEST_PKG_REGISTER");
+
+class IA32_HWP_INTERRUPT_REGISTER
+{
+public:
+  constexpr IA32_HWP_INTERRUPT_REGISTER() = default;
+  constexpr explicit IA32_HWP_INTERRUPT_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_HWP_INTERRUPT_REGISTER>
+  static constexpr IA32_HWP_INTERRUPT_REGISTER from(const T& raw) { return std::bit_cast<IA32_HWP_INTERRUPT_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_HWP_INTERRUPT_REGISTER&, const IA32_HWP_INTERRUPT_REGISTER&) = default;
+
+  /**
+   * EN_Guaranteed_Performance_Change.
+   */
+  constexpr UINT64 en_guaranteed_performance_change() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_HWP_INTERRUPT_REGISTER with_en_guaranteed_performance_change(UINT64 value) const { return IA32_HWP_INTERRUPT_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * EN_Excursion_Minimum.
+   */
+  constexpr UINT64 en_excursion_minimum() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_HWP_INTERRUPT_REGISTER with_en_excursion_minimum(UINT64 value) const { return IA32_HWP_INTERRUPT_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_HWP_INTERRUPT_REGISTER) == 8, "Size of IA32_HWP_INTERRUPT_REGISTER");
+
+class IA32_HWP_REQUEST_REGISTER
+{
+public:
+  constexpr IA32_HWP_REQUEST_REGISTER() = default;
+  constexpr explicit IA32_HWP_REQUEST_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_HWP_REQUEST_REGISTER>
+  static constexpr IA32_HWP_REQUEST_REGISTER from(const T& raw) { return std::bit_cast<IA32_HWP_REQUEST_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_HWP_REQUEST_REGISTER&, const IA32_HWP_REQUEST_REGISTER&) = default;
+
+  /**
+   * Minimum_Performance.
+   */
+  constexpr UINT64 minimum_performance() const { return (Flags >> 0) & 0xFFULL; }
+  constexpr IA32_HWP_REQUEST_REGISTER with_minimum_performance(UINT64 value) const { return IA32_HWP_REQUEST_REGISTER((Flags & ~0xFFULL) | ((value & 0xFFULL) << 0)); }
+
+  /**
+   * Maximum_Performance.
+   */
+  constexpr UINT64 maximum_performance() const { return (Flags >> 8) & 0xFFULL; }
+  constexpr IA32_HWP_REQUEST_REGISTER with_maximum_performance(UINT64 value) const { return IA32_HWP_REQUEST_REGISTER((Flags & ~0xFF00ULL) | ((value & 0xFFULL) << 8)); }
+
+  /**
+   * Desired_Performance.
+   */
+  constexpr UINT64 desired_performance() const { return (Flags >> 16) & 0xFFULL; }
+  constexpr IA32_HWP_REQUEST_REGISTER with_desired_performance(UINT64 value) const { return IA32_HWP_REQUEST_REGISTER((Flags & ~0xFF0000ULL) | ((value & 0xFFULL) << 16)); }
+
+  /**
+   * Energy_Performance_Preference.
+   */
+  constexpr UINT64 energy_performance_preference() const { return (Flags >> 24) & 0xFFULL; }
+  constexpr IA32_HWP_REQUEST_REGISTER with_energy_performance_preference(UINT64 value) const { return IA32_HWP_REQUEST_REGISTER((Flags & ~0xFF000000ULL) | ((value & 0xFFULL) << 24)); }
+
+  /**
+   * Activity_Window.
+   */
+  constexpr UINT64 activity_window() const { return (Flags >> 32) & 0x3FFULL; }
+  constexpr IA32_HWP_REQUEST_REGISTER with_activity_window(UINT64 value) const { return IA32_HWP_REQUEST_REGISTER((Flags & ~0x3FF00000000ULL) | ((value & 0x3FFULL) << 32)); }
+
+  /**
+   * Package_Control.
+   */
+  constexpr UINT64 package_control() const { return (Flags >> 42) & 0x01ULL; }
+  constexpr IA32_HWP_REQUEST_REGISTER with_package_control(UINT64 value) const { return IA32_HWP_REQUEST_REGISTER((Flags & ~0x40000000000ULL) | ((value & 0x01ULL) << 42)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_HWP_REQUEST_REGISTER) == 8, "Size of IA32_HWP_REQUEST_REGISTER");
+
+class IA32_HWP_STATUS_REGISTER
+{
+public:
+  constexpr IA32_HWP_STATUS_REGISTER() = default;
+  constexpr explicit IA32_HWP_STATUS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_HWP_STATUS_REGISTER>
+  static constexpr IA32_HWP_STATUS_REGISTER from(const T& raw) { return std::bit_cast<IA32_HWP_STATUS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_HWP_STATUS_REGISTER&, const IA32_HWP_STATUS_REGISTER&) = default;
+
+  /**
+   * Guaranteed_Performance_Change.
+   */
+  constexpr UINT64 guaranteed_performance_change() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_HWP_STATUS_REGISTER with_guaranteed_performance_change(UINT64 value) const { return IA32_HWP_STATUS_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Excursion_To_Minimum.
+   */
+  constexpr UINT64 excursion_to_minimum() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr IA32_HWP_STATUS_REGISTER with_excursion_to_minimum(UINT64 value) const { return IA32_HWP_STATUS_REGISTER((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_HWP_STATUS_REGISTER) == 8, "Size of IA32_HWP_STATUS_REGISTER");
+
+class IA32_DEBUG_INTERFACE_REGISTER
+{
+public:
+  constexpr IA32_DEBUG_INTERFACE_REGISTER() = default;
+  constexpr explicit IA32_DEBUG_INTERFACE_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_DEBUG_INTERFACE_REGISTER>
+  static constexpr IA32_DEBUG_INTERFACE_REGISTER from(const T& raw) { return std::bit_cast<IA32_DEBUG_INTERFACE_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_DEBUG_INTERFACE_REGISTER&, const IA32_DEBUG_INTERFACE_REGISTER&) = default;
+
+  /**
+   * @brief Enable <b>(R/W)</b>
+   *
+   * BIOS set 1 to enable Silicon debug features. Default is 0.
+   *
+   * @remarks If CPUID.01H:ECX.[11] = 1
+   */
+  constexpr UINT64 enable() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_DEBUG_INTERFACE_REGISTER with_enable(UINT64 value) const { return IA32_DEBUG_INTERFACE_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * @brief Lock <b>(R/W)</b>
+   *
+   * If 1, locks any further change to the MSR. The lock bit is set automatically on the first SMI assertion even if not
+   * explicitly set by BIOS. Default is 0.
+   *
+   * @remarks If CPUID.01H:ECX.[11] = 1
+   */
+  constexpr UINT64 lock() const { return (Flags >> 30) & 0x01ULL; }
+  constexpr IA32_DEBUG_INTERFACE_REGISTER with_lock(UINT64 value) const { return IA32_DEBUG_INTERFACE_REGISTER((Flags & ~0x40000000ULL) | ((value & 0x01ULL) << 30)); }
+
+  /**
+   * @brief Debug Occurred <b>(R/O)</b>
+   *
+   * This "sticky bit" is set by hardware to indicate the status of bit 0. Default is 0.
+   *
+   * @remarks If CPUID.01H:ECX.[11] = 1
+   */
+  constexpr UINT64 debug_occurred() const { return (Flags >> 31) & 0x01ULL; }
+  constexpr IA32_DEBUG_INTERFACE_REGISTER with_debug_occurred(UINT64 value) const { return IA32_DEBUG_INTERFACE_REGISTER((Flags & ~0x80000000ULL) | ((value & 0x01ULL) << 31)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_DEBUG_INTERFACE_REGISTER) == 8, "Size of IA32_DEBUG_INTERFACE_REGISTER");
+
+class IA32_L3_QOS_CFG_REGISTER
+{
+public:
+  constexpr IA32_L3_QOS_CFG_REGISTER() = default;
+  constexpr explicit IA32_L3_QOS_CFG_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_L3_QOS_CFG_REGISTER>
+  static constexpr IA32_L3_QOS_CFG_REGISTER from(const T& raw) { return std::bit_cast<IA32_L3_QOS_CFG_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_L3_QOS_CFG_REGISTER&, const IA32_L3_QOS_CFG_REGISTER&) = default;
+
+  /**
+   * @brief Enable <b>(R/W)</b>
+   *
+   * Set 1 to enable L3 CAT masks and COS to operate in Code and Data Prioritization (CDP) mode.
+   */
+  constexpr UINT64 enable() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_L3_QOS_CFG_REGISTER with_enable(UINT64 value) const { return IA32_L3_QOS_CFG_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_L3_QOS_CFG_REGISTER) == 8, "Size of IA32_L3_QOS_CFG_REGISTER");
+
+class IA32_L2_QOS_CFG_REGISTER
+{
+public:
+  constexpr IA32_L2_QOS_CFG_REGISTER() = default;
+  constexpr explicit IA32_L2_QOS_CFG_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_L2_QOS_CFG_REGISTER>
+  static constexpr IA32_L2_QOS_CFG_REGISTER from(const T& raw) { return std::bit_cast<IA32_L2_QOS_CFG_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_L2_QOS_CFG_REGISTER&, const IA32_L2_QOS_CFG_REGISTER&) = default;
+
+  /**
+   * @brief Enable <b>(R/W)</b>
+   *
+   * Set 1 to enable L2 CAT masks and COS to operate in Code and Data Prioritization (CDP) mode.
+   */
+  constexpr UINT64 enable() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_L2_QOS_CFG_REGISTER with_enable(UINT64 value) const { return IA32_L2_QOS_CFG_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_L2_QOS_CFG_REGISTER) == 8, "Size of IA32_L2_QOS_CFG_REGISTER");
+
+class IA32_QM_EVTSEL_REGISTER
+{
+public:
+  constexpr IA32_QM_EVTSEL_REGISTER() = default;
+  constexpr explicit IA32_QM_EVTSEL_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_QM_EVTSEL_REGISTER>
+  static constexpr IA32_QM_EVTSEL_REGISTER from(const T& raw) { return std::bit_cast<IA32_QM_EVTSEL_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_QM_EVTSEL_REGISTER&, const IA32_QM_EVTSEL_REGISTER&) = default;
+
+  /**
+   * @brief Event ID
+   *
+   * ID of a supported monitoring event to report via IA32_QM_CTR.
+   */
+  constexpr UINT64 event_id() const { return (Flags >> 0) & 0xFFULL; }
+  constexpr IA32_QM_EVTSEL_REGISTER with_event_id(UINT64 value) const { return IA32_QM_EVTSEL_REGISTER((Flags & ~0xFFULL) | ((value & 0xFFULL) << 0)); }
+
+  /**
+   * @brief Resource Monitoring ID
+   *
+   * ID for monitoring hardware to report monitored data via IA32_QM_CTR.
+   *
+   * @remarks Bits [N+31:32] N = Ceil (Log2 (CPUID.(EAX= 0FH,ECX=0H).EBX[31:0] + 1))
+   */
+  constexpr UINT64 resource_monitoring_id() const { return (Flags >> 32) & 0xFFFFFFFFULL; }
+  constexpr IA32_QM_EVTSEL_REGISTER with_resource_monitoring_id(UINT64 value) const { return IA32_QM_EVTSEL_REGISTER((Flags & ~0xFFFFFFFF00000000ULL) | ((value & 0xFFFFFFFFULL) << 32)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_QM_EVTSEL_REGISTER) == 8, "Size of IA32_QM_EVTSEL_REGISTER");
+
+class IA32_QM_CTR_REGISTER
+{
+public:
+  constexpr IA32_QM_CTR_REGISTER() = default;
+  constexpr explicit IA32_QM_CTR_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_QM_CTR_REGISTER>
+  static constexpr IA32_QM_CTR_REGISTER from(const T& raw) { return std::bit_cast<IA32_QM_CTR_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_QM_CTR_REGISTER&, const IA32_QM_CTR_REGISTER&) = default;
+
+  /**
+   * Resource Monitored Data.
+   */
+  constexpr UINT64 resource_monitored_data() const { return (Flags >> 0) & 0x3FFFFFFFFFFFFFFFULL; }
+  constexpr IA32_QM_CTR_REGISTER with_resource_monitored_data(UINT64 value) const { return IA32_QM_CTR_REGISTER((Flags & ~0x3FFFFFFFFFFFFFFFULL) | ((value & 0x3FFFFFFFFFFFFFFFULL) << 0)); }
+
+  /**
+   * @brief Unavailable
+   *
+   * If 1, indicates data for this RMID is not available or not monitored for this resource or RMID.
+   */
+  constexpr UINT64 unavailable() const { return (Flags >> 62) & 0x01ULL; }
+  constexpr IA32_QM_CTR_REGISTER with_unavailable(UINT64 value) const { return IA32_QM_CTR_REGISTER((Flags & ~0x4000000000000000ULL) | ((value & 0x01ULL) << 62)); }
+
+  /**
+   * @brief Error
+   *
+   * If 1, indicates an unsupported RMID or event type was written to IA32_PQR_QM_EVTSEL.
+   */
+  constexpr UINT64 error() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr IA32_QM_CTR_REGISTER with_error(UINT64 value) const { return IA32_QM_CTR_REGISTER((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_QM_CTR_REGISTER) == 8, "Size of IA32_QM_CTR_REGISTER");
+
+class IA32_PQR_ASSOC_REGISTER
+{
+public:
+  constexpr IA32_PQR_ASSOC_REGISTER() = default;
+  constexpr explicit IA32_PQR_ASSOC_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PQR_ASSOC_REGISTER>
+  static constexpr IA32_PQR_ASSOC_REGISTER from(const T& raw) { return std::bit_cast<IA32_PQR_ASSOC_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PQR_ASSOC_REGISTER&, const IA32_PQR_ASSOC_REGISTER&) = default;
+
+  /**
+   * @brief Resource Monitoring ID <b>(R/W)</b>
+   *
+   * ID for monitoring hardware to track internal operation, e.g., memory access.
+   *
+   * @remarks Bits [N-1:0] N = Ceil (Log2 (CPUID.(EAX= 0FH, ECX=0H).EBX[31:0] +1)) 31:N Reserved
+   */
+  constexpr UINT64 resource_monitoring_id() const { return (Flags >> 0) & 0xFFFFFFFFULL; }
+  constexpr IA32_PQR_ASSOC_REGISTER with_resource_monitoring_id(UINT64 value) const { return IA32_PQR_ASSOC_REGISTER((Flags & ~0xFFFFFFFFULL) | ((value & 0xFFFFFFFFULL) << 0)); }
+
+  /**
+   * @brief COS <b>(R/W)</b>
+   *
+   * The class of service (COS) to enforce (on writes); returns the current COS when read.
+   *
+   * @remarks If ( CPUID.(EAX=07H, ECX=0):EBX.[15] = 1 )
+   */
+  constexpr UINT64 cos() const { return (Flags >> 32) & 0xFFFFFFFFULL; }
+  constexpr IA32_PQR_ASSOC_REGISTER with_cos(UINT64 value) const { return IA32_PQR_ASSOC_REGISTER((Flags & ~0xFFFFFFFF00000000ULL) | ((value & 0xFFFFFFFFULL) << 32)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PQR_ASSOC_REGISTER) == 8, "Size of IA32_PQR_ASSOC_REGISTER");
+
+class IA32_BNDCFGS_REGISTER
+{
+public:
+  constexpr IA32_BNDCFGS_REGISTER() = default;
+  constexpr explicit IA32_BNDCFGS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_BNDCFGS_REGISTER>
+  static constexpr IA32_BNDCFGS_REGISTER from(const T& raw) { return std::bit_cast<IA32_BNDCFGS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_BNDCFGS_REGISTER&, const IA32_BNDCFGS_REGISTER&) = default;
+
+  /**
+   * Enable Intel MPX in supervisor mode.
+   */
+  constexpr UINT64 enable() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_BNDCFGS_REGISTER with_enable(UINT64 value) const { return IA32_BNDCFGS_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Preserve the bounds registers for near branch instructions in the absence of the BND prefix.
+   */
+  constexpr UINT64 bnd_preserve() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr IA32_BNDCFGS_REGISTER with_bnd_preserve(UINT64 value) const { return IA32_BNDCFGS_REGISTER((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * Base Address of Bound Directory.
+   */
+  constexpr UINT64 bound_directory_base_address() const { return (Flags >> 12) & 0xFFFFFFFFFFFFFULL; }
+  constexpr IA32_BNDCFGS_REGISTER with_bound_directory_base_address(UINT64 value) const { return IA32_BNDCFGS_REGISTER((Flags & ~0xFFFFFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFFFFFULL) << 12)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_BNDCFGS_REGISTER) == 8, "Size of IA32_BNDCFGS_REGISTER");
+
+class IA32_XSS_REGISTER
+{
+public:
+  constexpr IA32_XSS_REGISTER() = default;
+  constexpr explicit IA32_XSS_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_XSS_REGISTER>
+  static constexpr IA32_XSS_REGISTER from(const T& raw) { return std::bit_cast<IA32_XSS_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_XSS_REGISTER&, const IA32_XSS_REGISTER&) = default;
+
+  /**
+   * Trace Packet Configuration State.
+   */
+  constexpr UINT64 trace_packet_configuration_state() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr IA32_XSS_REGISTER with_trace_packet_configuration_state(UINT64 value) const { return IA32_XSS_REGISTER((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_XSS_REGISTER) == 8, "Size of IA32_XSS_REGISTER");
+
+class IA32_PKG_HDC_CTL_REGISTER
+{
+public:
+  constexpr IA32_PKG_HDC_CTL_REGISTER() = default;
+  constexpr explicit IA32_PKG_HDC_CTL_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PKG_HDC_CTL_REGISTER>
+  static constexpr IA32_PKG_HDC_CTL_REGISTER from(const T& raw) { return std::bit_cast<IA32_PKG_HDC_CTL_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PKG_HDC_CTL_REGISTER&, const IA32_PKG_HDC_CTL_REGISTER&) = default;
+
+  /**
+   * @brief HDC_Pkg_Enable <b>(R/W)</b>
+   *
+   * Force HDC idling or wake up HDC-idled logical processors in the package.
+   *
+   * @remarks If CPUID.06H:EAX.[13] = 1
+   * @see Vol3B[14.5.2(Package level Enabling HDC)]
+   */
+  constexpr UINT64 hdc_pkg_enable() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_PKG_HDC_CTL_REGISTER with_hdc_pkg_enable(UINT64 value) const { return IA32_PKG_HDC_CTL_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PKG_HDC_CTL_REGISTER) == 8, "Size of IA32_PKG_HDC_CTL_REGISTER");
+
+class IA32_PM_CTL1_REGISTER
+{
+public:
+  constexpr IA32_PM_CTL1_REGISTER() = default;
+  constexpr explicit IA32_PM_CTL1_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_PM_CTL1_REGISTER>
+  static constexpr IA32_PM_CTL1_REGISTER from(const T& raw) { return std::bit_cast<IA32_PM_CTL1_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_PM_CTL1_REGISTER&, const IA32_PM_CTL1_REGISTER&) = default;
+
+  /**
+   * @brief HDC_Allow_Block <b>(R/W)</b>
+   *
+   * Allow/Block this logical processor for package level HDC control.
+   *
+   * @remarks If CPUID.06H:EAX.[13] = 1
+   * @see Vol3B[14.5.3(Logical-Processor Level HDC Control)]
+   */
+  constexpr UINT64 hdc_allow_block() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_PM_CTL1_REGISTER with_hdc_allow_block(UINT64 value) const { return IA32_PM_CTL1_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_PM_CTL1_REGISTER) == 8, "Size of IA32_PM_CTL1_REGISTER");
+
+class IA32_EFER_REGISTER
+{
+public:
+  constexpr IA32_EFER_REGISTER() = default;
+  constexpr explicit IA32_EFER_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_EFER_REGISTER>
+  static constexpr IA32_EFER_REGISTER from(const T& raw) { return std::bit_cast<IA32_EFER_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_EFER_REGISTER&, const IA32_EFER_REGISTER&) = default;
+
+  /**
+   * @brief SYSCALL Enable <b>(R/W)</b>
+   *
+   * Enables SYSCALL/SYSRET instructions in 64-bit mode.
+   */
+  constexpr UINT64 syscall_enable() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr IA32_EFER_REGISTER with_syscall_enable(UINT64 value) const { return IA32_EFER_REGISTER((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * @brief IA-32e Mode Enable <b>(R/W)</b>
+   *
+   * Enables IA-32e mode operation.
+   */
+  constexpr UINT64 ia32e_mode_enable() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr IA32_EFER_REGISTER with_ia32e_mode_enable(UINT64 value) const { return IA32_EFER_REGISTER((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * @brief IA-32e Mode Active <b>(R)</b>
+   *
+   * Indicates IA-32e mode is active when set.
+   */
+  constexpr UINT64 ia32e_mode_active() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr IA32_EFER_REGISTER with_ia32e_mode_active(UINT64 value) const { return IA32_EFER_REGISTER((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * Execute Disable Bit Enable.
+   */
+  constexpr UINT64 execute_disable_bit_enable() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr IA32_EFER_REGISTER with_execute_disable_bit_enable(UINT64 value) const { return IA32_EFER_REGISTER((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_EFER_REGISTER) == 8, "Size of IA32_EFER_REGISTER");
+
+class IA32_TSC_AUX_REGISTER
+{
+public:
+  constexpr IA32_TSC_AUX_REGISTER() = default;
+  constexpr explicit IA32_TSC_AUX_REGISTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::IA32_TSC_AUX_REGISTER>
+  static constexpr IA32_TSC_AUX_REGISTER from(const T& raw) { return std::bit_cast<IA32_TSC_AUX_REGISTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const IA32_TSC_AUX_REGISTER&, const IA32_TSC_AUX_REGISTER&) = default;
+
+  /**
+   * AUX. Auxiliary signature of TSC.
+   */
+  constexpr UINT64 tsc_auxiliary_signature() const { return (Flags >> 0) & 0xFFFFFFFFULL; }
+  constexpr IA32_TSC_AUX_REGISTER with_tsc_auxiliary_signature(UINT64 value) const { return IA32_TSC_AUX_REGISTER((Flags & ~0xFFFFFFFFULL) | ((value & 0xFFFFFFFFULL) << 0)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(IA32_TSC_AUX_REGISTER) == 8, "Size of IA32_TSC_AUX_REGISTER");
+
+/**
+ * @brief Format of a 32-Bit Page-Directory Entry that Maps a 4-MByte Page
+ */
+class PDE_4MB_32
+{
+public:
+  constexpr PDE_4MB_32() = default;
+  constexpr explicit PDE_4MB_32(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, ::PDE_4MB_32>
+  static constexpr PDE_4MB_32 from(const T& raw) { return std::bit_cast<PDE_4MB_32>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const PDE_4MB_32&, const PDE_4MB_32&) = default;
+
+  /**
+   * Present; must be 1 to map a 4-MByte page.
+   */
+  constexpr UINT32 present() const { return (Flags >> 0) & 0x01U; }
+  constexpr PDE_4MB_32 with_present(UINT32 value) const { return PDE_4MB_32((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * Read/write; if 0, writes may not be allowed to the 4-MByte page referenced by this entry.
+   */
+  constexpr UINT32 write() const { return (Flags >> 1) & 0x01U; }
+  constexpr PDE_4MB_32 with_write(UINT32 value) const { return PDE_4MB_32((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * User/supervisor; if 0, user-mode accesses are not allowed to the 4-MByte page referenced by this entry.
+   */
+  constexpr UINT32 supervisor() const { return (Flags >> 2) & 0x01U; }
+  constexpr PDE_4MB_32 with_supervisor(UINT32 value) const { return PDE_4MB_32((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * Page-level write-through; indirectly determines the memory type used to access the 4-MByte page referenced by this
+   * entry.
+   */
+  constexpr UINT32 page_level_write_through() const { return (Flags >> 3) & 0x01U; }
+  constexpr PDE_4MB_32 with_page_level_write_through(UINT32 value) const { return PDE_4MB_32((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+  /**
+   * Page-level cache disable; indirectly determines the memory type used to access the 4-MByte page referenced by this
+   * entry.
+   */
+  constexpr UINT32 page_level_cache_disable() const { return (Flags >> 4) & 0x01U; }
+  constexpr PDE_4MB_32 with_page_level_cache_disable(UINT32 value) const { return PDE_4MB_32((Flags & ~0x10U) | ((value & 0x01U) << 4)); }
+
+  /**
+   * Accessed; indicates whether software has accessed the 4-MByte page referenced by this entry.
+   */
+  constexpr UINT32 accessed() const { return (Flags >> 5) & 0x01U; }
+  constexpr PDE_4MB_32 with_accessed(UINT32 value) const { return PDE_4MB_32((Flags & ~0x20U) | ((value & 0x01U) << 5)); }
+
+  /**
+   * Dirty; indicates whether software has written to the 4-MByte page referenced by this entry.
+   */
+  constexpr UINT32 dirty() const { return (Flags >> 6) & 0x01U; }
+  constexpr PDE_4MB_32 with_dirty(UINT32 value) const { return PDE_4MB_32((Flags & ~0x40U) | ((value & 0x01U) << 6)); }
+
+  /**
+   * Page size; must be 1 (otherwise, this entry references a page table).
+   */
+  constexpr UINT32 large_page() const { return (Flags >> 7) & 0x01U; }
+  constexpr PDE_4MB_32 with_large_page(UINT32 value) const { return PDE_4MB_32((Flags & ~0x80U) | ((value & 0x01U) << 7)); }
+
+  /**
+   * Global; if CR4.PGE = 1, determines whether the translation is global; ignored otherwise.
+   */
+  constexpr UINT32 global() const { return (Flags >> 8) & 0x01U; }
+  constexpr PDE_4MB_32 with_global(UINT32 value) const { return PDE_4MB_32((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT32 ignored_1() const { return (Flags >> 9) & 0x07U; }
+  constexpr PDE_4MB_32 with_ignored_1(UINT32 value) const { return PDE_4MB_32((Flags & ~0xE00U) | ((value & 0x07U) << 9)); }
+
+  /**
+   * Indirectly determines the memory type used to access the 4-MByte page referenced by this entry.
+   */
+  constexpr UINT32 pat() const { return (Flags >> 12) & 0x01U; }
+  constexpr PDE_4MB_32 with_pat(UINT32 value) const { return PDE_4MB_32((Flags & ~0x1000U) | ((value & 0x01U) << 12)); }
+
+  /**
+   * Bits (M-1):32 of physical address of the 4-MByte page referenced by this entry.
+   */
+  constexpr UINT32 page_frame_number_low() const { return (Flags >> 13) & 0xFFU; }
+  constexpr PDE_4MB_32 with_page_frame_number_low(UINT32 value) const { return PDE_4MB_32((Flags & ~0x1FE000U) | ((value & 0xFFU) << 13)); }
+
+  /**
+   * Bits 31:22 of physical address of the 4-MByte page referenced by this entry.
+   */
+  constexpr UINT32 page_frame_number_high() const { return (Flags >> 22) & 0x3FFU; }
+  constexpr PDE_4MB_32 with_page_frame_number_high(UINT32 value) const { return PDE_4MB_32((Flags & ~0xFFC00000U) | ((value & 0x3FFU) << 22)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(PDE_4MB_32) == 4, "Size of PDE_4MB_32");
+
+/**
+ * @brief Format of a 32-Bit Page-Directory Entry that References a Page Table
+ */
+class PDE_32
+{
+public:
+  constexpr PDE_32() = default;
+  constexpr explicit PDE_32(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, ::PDE_32>
+  static constexpr PDE_32 from(const T& raw) { return std::bit_cast<PDE_32>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const PDE_32&, const PDE_32&) = default;
+
+  /**
+   * Present; must be 1 to reference a page table.
+   */
+  constexpr UINT32 present() const { return (Flags >> 0) & 0x01U; }
+  constexpr PDE_32 with_present(UINT32 value) const { return PDE_32((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * Read/write; if 0, writes may not be allowed to the 4-MByte region controlled by this entry.
+   */
+  constexpr UINT32 write() const { return (Flags >> 1) & 0x01U; }
+  constexpr PDE_32 with_write(UINT32 value) const { return PDE_32((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * User/supervisor; if 0, user-mode accesses are not allowed to the 4-MByte region controlled by this entry.
+   */
+  constexpr UINT32 supervisor() const { return (Flags >> 2) & 0x01U; }
+  constexpr PDE_32 with_supervisor(UINT32 value) const { return PDE_32((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * Page-level write-through; indirectly determines the memory type used to access the page table referenced by this entry.
+   */
+  constexpr UINT32 page_level_write_through() const { return (Flags >> 3) & 0x01U; }
+  constexpr PDE_32 with_page_level_write_through(UINT32 value) const { return PDE_32((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+  /**
+   * Page-level cache disable; indirectly determines the memory type used to access the page table referenced by this entry.
+   */
+  constexpr UINT32 page_level_cache_disable() const { return (Flags >> 4) & 0x01U; }
+  constexpr PDE_32 with_page_level_cache_disable(UINT32 value) const { return PDE_32((Flags & ~0x10U) | ((value & 0x01U) << 4)); }
+
+  /**
+   * Accessed; indicates whether this entry has been used for linear-address translation.
+   */
+  constexpr UINT32 accessed() const { return (Flags >> 5) & 0x01U; }
+  constexpr PDE_32 with_accessed(UINT32 value) const { return PDE_32((Flags & ~0x20U) | ((value & 0x01U) << 5)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT32 ignored_1() const { return (Flags >> 6) & 0x01U; }
+  constexpr PDE_32 with_ignored_1(UINT32 value) const { return PDE_32((Flags & ~0x40U) | ((value & 0x01U) << 6)); }
+
+  /**
+   * If CR4.PSE = 1, must be 0 (otherwise, this entry maps a 4-MByte page); otherwise, ignored.
+   */
+  constexpr UINT32 large_page() const { return (Flags >> 7) & 0x01U; }
+  constexpr PDE_32 with_large_page(UINT32 value) const { return PDE_32((Flags & ~0x80U) | ((value & 0x01U) << 7)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT32 ignored_2() const { return (Flags >> 8) & 0x0FU; }
+  constexpr PDE_32 with_ignored_2(UINT32 value) const { return PDE_32((Flags & ~0xF00U) | ((value & 0x0FU) << 8)); }
+
+  /**
+   * Physical address of 4-KByte aligned page table referenced by this entry.
+   */
+  constexpr UINT32 page_frame_number() const { return (Flags >> 12) & 0xFFFFFU; }
+  constexpr PDE_32 with_page_frame_number(UINT32 value) const { return PDE_32((Flags & ~0xFFFFF000U) | ((value & 0xFFFFFU) << 12)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(PDE_32) == 4, "Size of PDE_32");
+
+/**
+ * @brief Format of a 32-Bit Page-Table Entry that Maps a 4-KByte Page
+ */
+class PTE_32
+{
+public:
+  constexpr PTE_32() = default;
+  constexpr explicit PTE_32(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, ::PTE_32>
+  static constexpr PTE_32 from(const T& raw) { return std::bit_cast<PTE_32>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const PTE_32&, const PTE_32&) = default;
+
+  /**
+   * Present; must be 1 to map a 4-KByte page.
+   */
+  constexpr UINT32 present() const { return (Flags >> 0) & 0x01U; }
+  constexpr PTE_32 with_present(UINT32 value) const { return PTE_32((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * Read/write; if 0, writes may not be allowed to the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT32 write() const { return (Flags >> 1) & 0x01U; }
+  constexpr PTE_32 with_write(UINT32 value) const { return PTE_32((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * User/supervisor; if 0, user-mode accesses are not allowed to the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT32 supervisor() const { return (Flags >> 2) & 0x01U; }
+  constexpr PTE_32 with_supervisor(UINT32 value) const { return PTE_32((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * Page-level write-through; indirectly determines the memory type used to access the 4-KByte page referenced by this
+   * entry.
+   */
+  constexpr UINT32 page_level_write_through() const { return (Flags >> 3) & 0x01U; }
+  constexpr PTE_32 with_page_level_write_through(UINT32 value) const { return PTE_32((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+  /**
+   * Page-level cache disable; indirectly determines the memory type used to access the 4-KByte page referenced by this
+   * entry.
+   */
+  constexpr UINT32 page_level_cache_disable() const { return (Flags >> 4) & 0x01U; }
+  constexpr PTE_32 with_page_level_cache_disable(UINT32 value) const { return PTE_32((Flags & ~0x10U) | ((value & 0x01U) << 4)); }
+
+  /**
+   * Accessed; indicates whether software has accessed the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT32 accessed() const { return (Flags >> 5) & 0x01U; }
+  constexpr PTE_32 with_accessed(UINT32 value) const { return PTE_32((Flags & ~0x20U) | ((value & 0x01U) << 5)); }
+
+  /**
+   * Dirty; indicates whether software has written to the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT32 dirty() const { return (Flags >> 6) & 0x01U; }
+  constexpr PTE_32 with_dirty(UINT32 value) const { return PTE_32((Flags & ~0x40U) | ((value & 0x01U) << 6)); }
+
+  /**
+   * Indirectly determines the memory type used to access the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT32 pat() const { return (Flags >> 7) & 0x01U; }
+  constexpr PTE_32 with_pat(UINT32 value) const { return PTE_32((Flags & ~0x80U) | ((value & 0x01U) << 7)); }
+
+  /**
+   * Global; if CR4.PGE = 1, determines whether the translation is global; ignored otherwise.
+   */
+  constexpr UINT32 global() const { return (Flags >> 8) & 0x01U; }
+  constexpr PTE_32 with_global(UINT32 value) const { return PTE_32((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT32 ignored_1() const { return (Flags >> 9) & 0x07U; }
+  constexpr PTE_32 with_ignored_1(UINT32 value) const { return PTE_32((Flags & ~0xE00U) | ((value & 0x07U) << 9)); }
+
+  /**
+   * Physical address of 4-KByte aligned page table referenced by this entry.
+   */
+  constexpr UINT32 page_frame_number() const { return (Flags >> 12) & 0xFFFFFU; }
+  constexpr PTE_32 with_page_frame_number(UINT32 value) const { return PTE_32((Flags & ~0xFFFFF000U) | ((value & 0xFFFFFU) << 12)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(PTE_32) == 4, "Size of PTE_32");
+
+/**
+ * @brief Format of a common Page-Table Entry
+ */
+class PT_ENTRY_32
+{
+public:
+  constexpr PT_ENTRY_32() = default;
+  constexpr explicit PT_ENTRY_32(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, ::PT_ENTRY_32>
+  static constexpr PT_ENTRY_32 from(const T& raw) { return std::bit_cast<PT_ENTRY_32>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const PT_ENTRY_32&, const PT_ENTRY_32&) = default;
+
+  constexpr UINT32 present() const { return (Flags >> 0) & 0x01U; }
+  constexpr PT_ENTRY_32 with_present(UINT32 value) const { return PT_ENTRY_32((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  constexpr UINT32 write() const { return (Flags >> 1) & 0x01U; }
+  constexpr PT_ENTRY_32 with_write(UINT32 value) const { return PT_ENTRY_32((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  constexpr UINT32 supervisor() const { return (Flags >> 2) & 0x01U; }
+  constexpr PT_ENTRY_32 with_supervisor(UINT32 value) const { return PT_ENTRY_32((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  constexpr UINT32 page_level_write_through() const { return (Flags >> 3) & 0x01U; }
+  constexpr PT_ENTRY_32 with_page_level_write_through(UINT32 value) const { return PT_ENTRY_32((Flags & ~0x08U) | ((value & 0x01U) << 3)); }
+
+  constexpr UINT32 page_level_cache_disable() const { return (Flags >> 4) & 0x01U; }
+  constexpr PT_ENTRY_32 with_page_level_cache_disable(UINT32 value) const { return PT_ENTRY_32((Flags & ~0x10U) | ((value & 0x01U) << 4)); }
+
+  constexpr UINT32 accessed() const { return (Flags >> 5) & 0x01U; }
+  constexpr PT_ENTRY_32 with_accessed(UINT32 value) const { return PT_ENTRY_32((Flags & ~0x20U) | ((value & 0x01U) << 5)); }
+
+  constexpr UINT32 dirty() const { return (Flags >> 6) & 0x01U; }
+  constexpr PT_ENTRY_32 with_dirty(UINT32 value) const { return PT_ENTRY_32((Flags & ~0x40U) | ((value & 0x01U) << 6)); }
+
+  constexpr UINT32 large_page() const { return (Flags >> 7) & 0x01U; }
+  constexpr PT_ENTRY_32 with_large_page(UINT32 value) const { return PT_ENTRY_32((Flags & ~0x80U) | ((value & 0x01U) << 7)); }
+
+  constexpr UINT32 global() const { return (Flags >> 8) & 0x01U; }
+  constexpr PT_ENTRY_32 with_global(UINT32 value) const { return PT_ENTRY_32((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT32 ignored_1() const { return (Flags >> 9) & 0x07U; }
+  constexpr PT_ENTRY_32 with_ignored_1(UINT32 value) const { return PT_ENTRY_32((Flags & ~0xE00U) | ((value & 0x07U) << 9)); }
+
+  /**
+   * Physical address of the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT32 page_frame_number() const { return (Flags >> 12) & 0xFFFFFU; }
+  constexpr PT_ENTRY_32 with_page_frame_number(UINT32 value) const { return PT_ENTRY_32((Flags & ~0xFFFFF000U) | ((value & 0xFFFFFU) << 12)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(PT_ENTRY_32) == 4, "Size of PT_ENTRY_32");
+
+/**
+ * @brief Format of a 4-Level PML4 Entry (PML4E) that References a Page-Directory-Pointer Table
+ */
+class PML4E
+{
+public:
+  constexpr PML4E() = default;
+  constexpr explicit PML4E(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::PML4E>
+  static constexpr PML4E from(const T& raw) { return std::bit_cast<PML4E>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const PML4E&, const PML4E&) = default;
+
+  /**
+   * Present; must be 1 to reference a page-directory-pointer table.
+   */
+  constexpr UINT64 present() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr PML4E with_present(UINT64 value) const { return PML4E((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Read/write; if 0, writes may not be allowed to the 512-GByte region controlled by this entry.
+   */
+  constexpr UINT64 write() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr PML4E with_write(UINT64 value) const { return PML4E((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * User/supervisor; if 0, user-mode accesses are not allowed to the 512-GByte region controlled by this entry.
+   */
+  constexpr UINT64 supervisor() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr PML4E with_supervisor(UINT64 value) const { return PML4E((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * Page-level write-through; indirectly determines the memory type used to access the page-directory-pointer table
+   * referenced by this entry.
+   */
+  constexpr UINT64 page_level_write_through() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr PML4E with_page_level_write_through(UINT64 value) const { return PML4E((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * Page-level cache disable; indirectly determines the memory type used to access the page-directory-pointer table
+   * referenced by this entry.
+   */
+  constexpr UINT64 page_level_cache_disable() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr PML4E with_page_level_cache_disable(UINT64 value) const { return PML4E((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * Accessed; indicates whether this entry has been used for linear-address translation.
+   */
+  constexpr UINT64 accessed() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr PML4E with_accessed(UINT64 value) const { return PML4E((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * Reserved (must be 0).
+   */
+  constexpr UINT64 must_be_zero() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr PML4E with_must_be_zero(UINT64 value) const { return PML4E((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_1() const { return (Flags >> 8) & 0x0FULL; }
+  constexpr PML4E with_ignored_1(UINT64 value) const { return PML4E((Flags & ~0xF00ULL) | ((value & 0x0FULL) << 8)); }
+
+  /**
+   * Physical address of 4-KByte aligned page-directory-pointer table referenced by this entry.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 12) & 0xFFFFFFFFFULL; }
+  constexpr PML4E with_page_frame_number(UINT64 value) const { return PML4E((Flags & ~0xFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFULL) << 12)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_2() const { return (Flags >> 52) & 0x7FFULL; }
+  constexpr PML4E with_ignored_2(UINT64 value) const { return PML4E((Flags & ~0x7FF0000000000000ULL) | ((value & 0x7FFULL) << 52)); }
+
+  /**
+   * If IA32_EFER.NXE = 1, execute-disable (if 1, instruction fetches are not allowed from the 512-GByte region controlled by
+   * this entry); otherwise, reserved (must be 0).
+   */
+  constexpr UINT64 execute_disable() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr PML4E with_execute_disable(UINT64 value) const { return PML4E((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(PML4E) == 8, "Size of PML4E");
+
+/**
+ * @brief Format of a 4-Level Page-Directory-Pointer-Table Entry (PDPTE) that Maps a 1-GByte Page
+ */
+class PDPTE_1GB
+{
+public:
+  constexpr PDPTE_1GB() = default;
+  constexpr explicit PDPTE_1GB(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::PDPTE_1GB>
+  static constexpr PDPTE_1GB from(const T& raw) { return std::bit_cast<PDPTE_1GB>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const PDPTE_1GB&, const PDPTE_1GB&) = default;
+
+  /**
+   * Present; must be 1 to map a 1-GByte page.
+   */
+  constexpr UINT64 present() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr PDPTE_1GB with_present(UINT64 value) const { return PDPTE_1GB((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Read/write; if 0, writes may not be allowed to the 1-GByte page referenced by this entry.
+   */
+  constexpr UINT64 write() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr PDPTE_1GB with_write(UINT64 value) const { return PDPTE_1GB((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * User/supervisor; if 0, user-mode accesses are not allowed to the 1-GByte page referenced by this entry.
+   */
+  constexpr UINT64 supervisor() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr PDPTE_1GB with_supervisor(UINT64 value) const { return PDPTE_1GB((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * Page-level write-through; indirectly determines the memory type used to access the 1-GByte page referenced by this
+   * entry.
+   */
+  constexpr UINT64 page_level_write_through() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr PDPTE_1GB with_page_level_write_through(UINT64 value) const { return PDPTE_1GB((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * Page-level cache disable; indirectly determines the memory type used to access the 1-GByte page referenced by this
+   * entry.
+   */
+  constexpr UINT64 page_level_cache_disable() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr PDPTE_1GB with_page_level_cache_disable(UINT64 value) const { return PDPTE_1GB((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * Accessed; indicates whether software has accessed the 1-GByte page referenced by this entry.
+   */
+  constexpr UINT64 accessed() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr PDPTE_1GB with_accessed(UINT64 value) const { return PDPTE_1GB((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * Dirty; indicates whether software has written to the 1-GByte page referenced by this entry.
+   */
+  constexpr UINT64 dirty() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr PDPTE_1GB with_dirty(UINT64 value) const { return PDPTE_1GB((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * Page size; must be 1 (otherwise, this entry references a page directory).
+   */
+  constexpr UINT64 large_page() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr PDPTE_1GB with_large_page(UINT64 value) const { return PDPTE_1GB((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * Global; if CR4.PGE = 1, determines whether the translation is global; ignored otherwise.
+   */
+  constexpr UINT64 global() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr PDPTE_1GB with_global(UINT64 value) const { return PDPTE_1GB((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_1() const { return (Flags >> 9) & 0x07ULL; }
+  constexpr PDPTE_1GB with_ignored_1(UINT64 value) const { return PDPTE_1GB((Flags & ~0xE00ULL) | ((value & 0x07ULL) << 9)); }
+
+  /**
+   * Indirectly determines the memory type used to access the 1-GByte page referenced by this entry.
+   */
+  constexpr UINT64 pat() const { return (Flags >> 12) & 0x01ULL; }
+  constexpr PDPTE_1GB with_pat(UINT64 value) const { return PDPTE_1GB((Flags & ~0x1000ULL) | ((value & 0x01ULL) << 12)); }
+
+  /**
+   * Physical address of the 1-GByte page referenced by this entry.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 30) & 0x3FFFFULL; }
+  constexpr PDPTE_1GB with_page_frame_number(UINT64 value) const { return PDPTE_1GB((Flags & ~0xFFFFC0000000ULL) | ((value & 0x3FFFFULL) << 30)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_2() const { return (Flags >> 52) & 0x7FULL; }
+  constexpr PDPTE_1GB with_ignored_2(UINT64 value) const { return PDPTE_1GB((Flags & ~0x7F0000000000000ULL) | ((value & 0x7FULL) << 52)); }
+
+  /**
+   * Protection key; if CR4.PKE = 1, determines the protection key of the page; ignored otherwise.
+   */
+  constexpr UINT64 protection_key() const { return (Flags >> 59) & 0x0FULL; }
+  constexpr PDPTE_1GB with_protection_key(UINT64 value) const { return PDPTE_1GB((Flags & ~0x7800000000000000ULL) | ((value & 0x0FULL) << 59)); }
+
+  /**
+   * If IA32_EFER.NXE = 1, execute-disable (if 1, instruction fetches are not allowed from the 1-GByte page controlled by
+   * this entry); otherwise, reserved (must be 0).
+   */
+  constexpr UINT64 execute_disable() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr PDPTE_1GB with_execute_disable(UINT64 value) const { return PDPTE_1GB((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(PDPTE_1GB) == 8, "Size of PDPTE_1GB");
+
+/**
+ * @brief Format of a 4-Level Page-Directory-Pointer-Table Entry (PDPTE) that References a Page Directory
+ */
+class PDPTE
+{
+public:
+  constexpr PDPTE() = default;
+  constexpr explicit PDPTE(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::PDPTE>
+  static constexpr PDPTE from(const T& raw) { return std::bit_cast<PDPTE>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const PDPTE&, const PDPTE&) = default;
+
+  /**
+   * Present; must be 1 to reference a page directory.
+   */
+  constexpr UINT64 present() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr PDPTE with_present(UINT64 value) const { return PDPTE((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Read/write; if 0, writes may not be allowed to the 1-GByte region controlled by this entry.
+   */
+  constexpr UINT64 write() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr PDPTE with_write(UINT64 value) const { return PDPTE((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * User/supervisor; if 0, user-mode accesses are not allowed to the 1-GByte region controlled by this entry.
+   */
+  constexpr UINT64 supervisor() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr PDPTE with_supervisor(UINT64 value) const { return PDPTE((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * Page-level write-through; indirectly determines the memory type used to access the page directory referenced by this
+   * entry.
+   */
+  constexpr UINT64 page_level_write_through() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr PDPTE with_page_level_write_through(UINT64 value) const { return PDPTE((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * Page-level cache disable; indirectly determines the memory type used to access the page directory referenced by this
+   * entry.
+   */
+  constexpr UINT64 page_level_cache_disable() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr PDPTE with_page_level_cache_disable(UINT64 value) const { return PDPTE((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * Accessed; indicates whether this entry has been used for linear-address translation.
+   */
+  constexpr UINT64 accessed() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr PDPTE with_accessed(UINT64 value) const { return PDPTE((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * Page size; must be 0 (otherwise, this entry maps a 1-GByte page).
+   */
+  constexpr UINT64 large_page() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr PDPTE with_large_page(UINT64 value) const { return PDPTE((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_1() const { return (Flags >> 8) & 0x0FULL; }
+  constexpr PDPTE with_ignored_1(UINT64 value) const { return PDPTE((Flags & ~0xF00ULL) | ((value & 0x0FULL) << 8)); }
+
+  /**
+   * Physical address of 4-KByte aligned page directory referenced by this entry.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 12) & 0xFFFFFFFFFULL; }
+  constexpr PDPTE with_page_frame_number(UINT64 value) const { return PDPTE((Flags & ~0xFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFULL) << 12)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_2() const { return (Flags >> 52) & 0x7FFULL; }
+  constexpr PDPTE with_ignored_2(UINT64 value) const { return PDPTE((Flags & ~0x7FF0000000000000ULL) | ((value & 0x7FFULL) << 52)); }
+
+  /**
+   * If IA32_EFER.NXE = 1, execute-disable (if 1, instruction fetches are not allowed from the 1-GByte region controlled by
+   * this entry); otherwise, reserved (must be 0).
+   */
+  constexpr UINT64 execute_disable() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr PDPTE with_execute_disable(UINT64 value) const { return PDPTE((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(PDPTE) == 8, "Size of PDPTE");
+
+/**
+ * @brief Format of a 4-Level Page-Directory Entry that Maps a 2-MByte Page
+ */
+class PDE_2MB
+{
+public:
+  constexpr PDE_2MB() = default;
+  constexpr explicit PDE_2MB(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::PDE_2MB>
+  static constexpr PDE_2MB from(const T& raw) { return std::bit_cast<PDE_2MB>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const PDE_2MB&, const PDE_2MB&) = default;
+
+  /**
+   * Present; must be 1 to map a 2-MByte page.
+   */
+  constexpr UINT64 present() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr PDE_2MB with_present(UINT64 value) const { return PDE_2MB((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Read/write; if 0, writes may not be allowed to the 2-MByte page referenced by this entry.
+   */
+  constexpr UINT64 write() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr PDE_2MB with_write(UINT64 value) const { return PDE_2MB((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * User/supervisor; if 0, user-mode accesses are not allowed to the 2-MByte page referenced by this entry.
+   */
+  constexpr UINT64 supervisor() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr PDE_2MB with_supervisor(UINT64 value) const { return PDE_2MB((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * Page-level write-through; indirectly determines the memory type used to access the 2-MByte page referenced by this
+   * entry.
+   */
+  constexpr UINT64 page_level_write_through() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr PDE_2MB with_page_level_write_through(UINT64 value) const { return PDE_2MB((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * Page-level cache disable; indirectly determines the memory type used to access the 2-MByte page referenced by this
+   * entry.
+   */
+  constexpr UINT64 page_level_cache_disable() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr PDE_2MB with_page_level_cache_disable(UINT64 value) const { return PDE_2MB((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * Accessed; indicates whether software has accessed the 2-MByte page referenced by this entry.
+   */
+  constexpr UINT64 accessed() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr PDE_2MB with_accessed(UINT64 value) const { return PDE_2MB((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * Dirty; indicates whether software has written to the 2-MByte page referenced by this entry.
+   */
+  constexpr UINT64 dirty() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr PDE_2MB with_dirty(UINT64 value) const { return PDE_2MB((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * Page size; must be 1 (otherwise, this entry references a page directory).
+   */
+  constexpr UINT64 large_page() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr PDE_2MB with_large_page(UINT64 value) const { return PDE_2MB((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * Global; if CR4.PGE = 1, determines whether the translation is global; ignored otherwise.
+   */
+  constexpr UINT64 global() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr PDE_2MB with_global(UINT64 value) const { return PDE_2MB((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_1() const { return (Flags >> 9) & 0x07ULL; }
+  constexpr PDE_2MB with_ignored_1(UINT64 value) const { return PDE_2MB((Flags & ~0xE00ULL) | ((value & 0x07ULL) << 9)); }
+
+  /**
+   * Indirectly determines the memory type used to access the 2-MByte page referenced by this entry.
+   */
+  constexpr UINT64 pat() const { return (Flags >> 12) & 0x01ULL; }
+  constexpr PDE_2MB with_pat(UINT64 value) const { return PDE_2MB((Flags & ~0x1000ULL) | ((value & 0x01ULL) << 12)); }
+
+  /**
+   * Physical address of the 1-GByte page referenced by this entry.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 30) & 0x3FFFFULL; }
+  constexpr PDE_2MB with_page_frame_number(UINT64 value) const { return PDE_2MB((Flags & ~0xFFFFC0000000ULL) | ((value & 0x3FFFFULL) << 30)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_2() const { return (Flags >> 52) & 0x7FULL; }
+  constexpr PDE_2MB with_ignored_2(UINT64 value) const { return PDE_2MB((Flags & ~0x7F0000000000000ULL) | ((value & 0x7FULL) << 52)); }
+
+  /**
+   * Protection key; if CR4.PKE = 1, determines the protection key of the page; ignored otherwise.
+   */
+  constexpr UINT64 protection_key() const { return (Flags >> 59) & 0x0FULL; }
+  constexpr PDE_2MB with_protection_key(UINT64 value) const { return PDE_2MB((Flags & ~0x7800000000000000ULL) | ((value & 0x0FULL) << 59)); }
+
+  /**
+   * If IA32_EFER.NXE = 1, execute-disable (if 1, instruction fetches are not allowed from the 1-GByte page controlled by
+   * this entry); otherwise, reserved (must be 0).
+   */
+  constexpr UINT64 execute_disable() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr PDE_2MB with_execute_disable(UINT64 value) const { return PDE_2MB((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(PDE_2MB) == 8, "Size of PDE_2MB");
+
+/**
+ * @brief Format of a 4-Level Page-Directory Entry that References a Page Table
+ */
+class PDE
+{
+public:
+  constexpr PDE() = default;
+  constexpr explicit PDE(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::PDE>
+  static constexpr PDE from(const T& raw) { return std::bit_cast<PDE>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const PDE&, const PDE&) = default;
+
+  /**
+   * Present; must be 1 to reference a page table.
+   */
+  constexpr UINT64 present() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr PDE with_present(UINT64 value) const { return PDE((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Read/write; if 0, writes may not be allowed to the 2-MByte region controlled by this entry.
+   */
+  constexpr UINT64 write() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr PDE with_write(UINT64 value) const { return PDE((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * User/supervisor; if 0, user-mode accesses are not allowed to the 2-MByte region controlled by this entry.
+   */
+  constexpr UINT64 supervisor() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr PDE with_supervisor(UINT64 value) const { return PDE((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * Page-level write-through; indirectly determines the memory type used to access the page table referenced by this entry.
+   */
+  constexpr UINT64 page_level_write_through() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr PDE with_page_level_write_through(UINT64 value) const { return PDE((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * Page-level cache disable; indirectly determines the memory type used to access the page table referenced by this entry.
+   */
+  constexpr UINT64 page_level_cache_disable() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr PDE with_page_level_cache_disable(UINT64 value) const { return PDE((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * Accessed; indicates whether this entry has been used for linear-address translation.
+   */
+  constexpr UINT64 accessed() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr PDE with_accessed(UINT64 value) const { return PDE((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * Page size; must be 0 (otherwise, this entry maps a 2-MByte page).
+   */
+  constexpr UINT64 large_page() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr PDE with_large_page(UINT64 value) const { return PDE((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_1() const { return (Flags >> 8) & 0x0FULL; }
+  constexpr PDE with_ignored_1(UINT64 value) const { return PDE((Flags & ~0xF00ULL) | ((value & 0x0FULL) << 8)); }
+
+  /**
+   * Physical address of 4-KByte aligned page table referenced by this entry.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 12) & 0xFFFFFFFFFULL; }
+  constexpr PDE with_page_frame_number(UINT64 value) const { return PDE((Flags & ~0xFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFULL) << 12)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_2() const { return (Flags >> 52) & 0x7FFULL; }
+  constexpr PDE with_ignored_2(UINT64 value) const { return PDE((Flags & ~0x7FF0000000000000ULL) | ((value & 0x7FFULL) << 52)); }
+
+  /**
+   * If IA32_EFER.NXE = 1, execute-disable (if 1, instruction fetches are not allowed from the 2-MByte region controlled by
+   * this entry); otherwise, reserved (must be 0).
+   */
+  constexpr UINT64 execute_disable() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr PDE with_execute_disable(UINT64 value) const { return PDE((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(PDE) == 8, "Size of PDE");
+
+/**
+ * @brief Format of a 4-Level Page-Table Entry that Maps a 4-KByte Page
+ */
+class PTE
+{
+public:
+  constexpr PTE() = default;
+  constexpr explicit PTE(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::PTE>
+  static constexpr PTE from(const T& raw) { return std::bit_cast<PTE>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const PTE&, const PTE&) = default;
+
+  /**
+   * Present; must be 1 to map a 4-KByte page.
+   */
+  constexpr UINT64 present() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr PTE with_present(UINT64 value) const { return PTE((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Read/write; if 0, writes may not be allowed to the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT64 write() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr PTE with_write(UINT64 value) const { return PTE((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * User/supervisor; if 0, user-mode accesses are not allowed to the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT64 supervisor() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr PTE with_supervisor(UINT64 value) const { return PTE((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * Page-level write-through; indirectly determines the memory type used to access the 4-KByte page referenced by this
+   * entry.
+   */
+  constexpr UINT64 page_level_write_through() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr PTE with_page_level_write_through(UINT64 value) const { return PTE((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * Page-level cache disable; indirectly determines the memory type used to access the 4-KByte page referenced by this
+   * entry.
+   */
+  constexpr UINT64 page_level_cache_disable() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr PTE with_page_level_cache_disable(UINT64 value) const { return PTE((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * Accessed; indicates whether software has accessed the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT64 accessed() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr PTE with_accessed(UINT64 value) const { return PTE((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * Dirty; indicates whether software has written to the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT64 dirty() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr PTE with_dirty(UINT64 value) const { return PTE((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * Indirectly determines the memory type used to access the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT64 pat() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr PTE with_pat(UINT64 value) const { return PTE((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * Global; if CR4.PGE = 1, determines whether the translation is global; ignored otherwise.
+   */
+  constexpr UINT64 global() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr PTE with_global(UINT64 value) const { return PTE((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_1() const { return (Flags >> 9) & 0x07ULL; }
+  constexpr PTE with_ignored_1(UINT64 value) const { return PTE((Flags & ~0xE00ULL) | ((value & 0x07ULL) << 9)); }
+
+  /**
+   * Physical address of the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 12) & 0xFFFFFFFFFULL; }
+  constexpr PTE with_page_frame_number(UINT64 value) const { return PTE((Flags & ~0xFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFULL) << 12)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_2() const { return (Flags >> 52) & 0x7FULL; }
+  constexpr PTE with_ignored_2(UINT64 value) const { return PTE((Flags & ~0x7F0000000000000ULL) | ((value & 0x7FULL) << 52)); }
+
+  /**
+   * Protection key; if CR4.PKE = 1, determines the protection key of the page; ignored otherwise.
+   */
+  constexpr UINT64 protection_key() const { return (Flags >> 59) & 0x0FULL; }
+  constexpr PTE with_protection_key(UINT64 value) const { return PTE((Flags & ~0x7800000000000000ULL) | ((value & 0x0FULL) << 59)); }
+
+  /**
+   * If IA32_EFER.NXE = 1, execute-disable (if 1, instruction fetches are not allowed from the 1-GByte page controlled by
+   * this entry); otherwise, reserved (must be 0).
+   */
+  constexpr UINT64 execute_disable() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr PTE with_execute_disable(UINT64 value) const { return PTE((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(PTE) == 8, "Size of PTE");
+
+/**
+ * @brief Format of a common Page-Table Entry
+ */
+class PT_ENTRY
+{
+public:
+  constexpr PT_ENTRY() = default;
+  constexpr explicit PT_ENTRY(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::PT_ENTRY>
+  static constexpr PT_ENTRY from(const T& raw) { return std::bit_cast<PT_ENTRY>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const PT_ENTRY&, const PT_ENTRY&) = default;
+
+  constexpr UINT64 present() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr PT_ENTRY with_present(UINT64 value) const { return PT_ENTRY((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  constexpr UINT64 write() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr PT_ENTRY with_write(UINT64 value) const { return PT_ENTRY((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  constexpr UINT64 supervisor() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr PT_ENTRY with_supervisor(UINT64 value) const { return PT_ENTRY((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  constexpr UINT64 page_level_write_through() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr PT_ENTRY with_page_level_write_through(UINT64 value) const { return PT_ENTRY((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  constexpr UINT64 page_level_cache_disable() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr PT_ENTRY with_page_level_cache_disable(UINT64 value) const { return PT_ENTRY((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  constexpr UINT64 accessed() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr PT_ENTRY with_accessed(UINT64 value) const { return PT_ENTRY((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  constexpr UINT64 dirty() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr PT_ENTRY with_dirty(UINT64 value) const { return PT_ENTRY((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  constexpr UINT64 large_page() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr PT_ENTRY with_large_page(UINT64 value) const { return PT_ENTRY((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  constexpr UINT64 global() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr PT_ENTRY with_global(UINT64 value) const { return PT_ENTRY((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_1() const { return (Flags >> 9) & 0x07ULL; }
+  constexpr PT_ENTRY with_ignored_1(UINT64 value) const { return PT_ENTRY((Flags & ~0xE00ULL) | ((value & 0x07ULL) << 9)); }
+
+  /**
+   * Physical address of the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 12) & 0xFFFFFFFFFULL; }
+  constexpr PT_ENTRY with_page_frame_number(UINT64 value) const { return PT_ENTRY((Flags & ~0xFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFULL) << 12)); }
+
+  /**
+   * Ignored.
+   */
+  constexpr UINT64 ignored_2() const { return (Flags >> 52) & 0x7FULL; }
+  constexpr PT_ENTRY with_ignored_2(UINT64 value) const { return PT_ENTRY((Flags & ~0x7F0000000000000ULL) | ((value & 0x7FULL) << 52)); }
+
+  constexpr UINT64 protection_key() const { return (Flags >> 59) & 0x0FULL; }
+  constexpr PT_ENTRY with_protection_key(UINT64 value) const { return PT_ENTRY((Flags & ~0x7800000000000000ULL) | ((value & 0x0FULL) << 59)); }
+
+  constexpr UINT64 execute_disable() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr PT_ENTRY with_execute_disable(UINT64 value) const { return PT_ENTRY((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(PT_ENTRY) == 8, "Size of PT_ENTRY");
+
+/**
+ * @brief Segment descriptor fields
+ */
+class SEGMENT_DESCRIPTOR_32_BITS
+{
+public:
+  constexpr SEGMENT_DESCRIPTOR_32_BITS() = default;
+  constexpr explicit SEGMENT_DESCRIPTOR_32_BITS(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::SEGMENT_DESCRIPTOR_32::Bits)>
+  static constexpr SEGMENT_DESCRIPTOR_32_BITS from(const T& raw) { return std::bit_cast<SEGMENT_DESCRIPTOR_32_BITS>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const SEGMENT_DESCRIPTOR_32_BITS&, const SEGMENT_DESCRIPTOR_32_BITS&) = default;
+
+  /**
+   * Base address field (23:16); see description of $BASE_LOW for more details.
+   */
+  constexpr UINT32 base_address_middle() const { return (Flags >> 0) & 0xFFU; }
+  constexpr SEGMENT_DESCRIPTOR_32_BITS with_base_address_middle(UINT32 value) const { return SEGMENT_DESCRIPTOR_32_BITS((Flags & ~0xFFU) | ((value & 0xFFU) << 0)); }
+
+  /**
+   * @brief Type field
+   *
+   * Indicates the segment or gate type and specifies the kinds of access that can be made to the segment and the direction
+   * of growth. The interpretation of this field depends on whether the descriptor type flag specifies an application (code
+   * or data) descriptor or a system descriptor. The encoding of the type field is different for code, data, and system
+   * descriptors.
+   *
+   * @see Vol3A[3.4.5.1(Code- and Data-Segment Descriptor Types)]
+   */
+  constexpr UINT32 type() const { return (Flags >> 8) & 0x0FU; }
+  constexpr SEGMENT_DESCRIPTOR_32_BITS with_type(UINT32 value) const { return SEGMENT_DESCRIPTOR_32_BITS((Flags & ~0xF00U) | ((value & 0x0FU) << 8)); }
+
+  /**
+   * @brief S (descriptor type) flag
+   *
+   * Specifies whether the segment descriptor is for a system segment (S flag is clear) or a code or data segment (S flag is
+   * set).
+   */
+  constexpr UINT32 descriptor_type() const { return (Flags >> 12) & 0x01U; }
+  constexpr SEGMENT_DESCRIPTOR_32_BITS with_descriptor_type(UINT32 value) const { return SEGMENT_DESCRIPTOR_32_BITS((Flags & ~0x1000U) | ((value & 0x01U) << 12)); }
+
+  /**
+   * @brief DPL (descriptor privilege level) field
+   *
+   * Specifies the privilege level of the segment. The privilege level can range from 0 to 3, with 0 being the most
+   * privileged level. The DPL is used to control access to the segment. See Section 5.5, "Privilege Levels", for a
+   * description of the relationship of the DPL to the CPL of the executing code segment and the RPL of a segment selector.
+   */
+  constexpr UINT32 descriptor_privilege_level() const { return (Flags >> 13) & 0x03U; }
+  constexpr SEGMENT_DESCRIPTOR_32_BITS with_descriptor_privilege_level(UINT32 value) const { return SEGMENT_DESCRIPTOR_32_BITS((Flags & ~0x6000U) | ((value & 0x03U) << 13)); }
+
+  /**
+   * @brief P (segment-present) flag
+   *
+   * Indicates whether the segment is present in memory (set) or not present (clear). If this flag is clear, the processor
+   * generates a segment-not-present exception (\#NP) when a segment selector that points to the segment descriptor is loaded
+   * into a segment register. Memory management software can use this flag to control which segments are actually loaded into
+   * physical memory at a given time. It offers a control in addition to paging for managing virtual memory.
+   */
+  constexpr UINT32 present() const { return (Flags >> 15) & 0x01U; }
+  constexpr SEGMENT_DESCRIPTOR_32_BITS with_present(UINT32 value) const { return SEGMENT_DESCRIPTOR_32_BITS((Flags & ~0x8000U) | ((value & 0x01U) << 15)); }
+
+  /**
+   * Segment limit field (19:16); see description of $LIMIT_LOW for more details.
+   */
+  constexpr UINT32 segment_limit_high() const { return (Flags >> 16) & 0x0FU; }
+  constexpr SEGMENT_DESCRIPTOR_32_BITS with_segment_limit_high(UINT32 value) const { return SEGMENT_DESCRIPTOR_32_BITS((Flags & ~0xF0000U) | ((value & 0x0FU) << 16)); }
+
+  /**
+   * @brief Available bit
+   *
+   * Bit 20 of the second doubleword of the segment descriptor is available for use by system software.
+   */
+  constexpr UINT32 system() const { return (Flags >> 20) & 0x01U; }
+  constexpr SEGMENT_DESCRIPTOR_32_BITS with_system(UINT32 value) const { return SEGMENT_DESCRIPTOR_32_BITS((Flags & ~0x100000U) | ((value & 0x01U) << 20)); }
+
+  /**
+   * @brief L (64-bit code segment) flag
+   *
+   * In IA-32e mode, bit 21 of the second doubleword of the segment descriptor indicates whether a code segment contains
+   * native 64-bit code. A value of 1 indicates instructions in this code segment are executed in 64-bit mode. A value of 0
+   * indicates the instructions in this code segment are executed in compatibility mode. If L-bit is set, then D-bit must be
+   * cleared. When not in IA-32e mode or for non-code segments, bit 21 is reserved and should always be set to 0.
+   */
+  constexpr UINT32 long_mode() const { return (Flags >> 21) & 0x01U; }
+  constexpr SEGMENT_DESCRIPTOR_32_BITS with_long_mode(UINT32 value) const { return SEGMENT_DESCRIPTOR_32_BITS((Flags & ~0x200000U) | ((value & 0x01U) << 21)); }
+
+  /**
+   * @brief D/B (default operation size/default stack pointer size and/or upper bound) flag
+   *
+   * Performs different functions depending on whether the segment descriptor is an executable code segment, an expand-down
+   * data segment, or a stack segment. (This flag should always be set to 1 for 32-bit code and data segments and to 0 for
+   * 16-bit code and data segments.)
+   * - Executable code segment. The flag is called the D flag and it indicates the default length for effective addresses and
+   * operands referenced by instructions in the segment. If the flag is set, 32-bit addresses and 32-bit or 8-bit operands
+   * are assumed; if it is clear, 16-bit addresses and 16-bit or 8-bit operands are assumed. The instruction prefix 66H can
+   * be used to select an operand size other than the default, and the prefix 67H can be used select an address size other
+   * than the default.
+   * - Stack segment (data segment pointed to by the SS register). The flag is called the B (big) flag and it specifies the
+   * size of the stack pointer used for implicit stack operations (such as pushes, pops, and calls). If the flag is set, a
+   * 32-bit stack pointer is used, which is stored in the 32-bit ESP register; if the flag is clear, a 16-bit stack pointer
+   * is used, which is stored in the 16- bit SP register. If the stack segment is set up to be an expand-down data segment
+   * (described in the next paragraph), the B flag also specifies the upper bound of the stack segment.
+   * - Expand-down data segment. The flag is called the B flag and it specifies the upper bound of the segment. If the flag
+   * is set, the upper bound is FFFFFFFFH (4 GBytes); if the flag is clear, the upper bound is FFFFH (64 KBytes).
+   */
+  constexpr UINT32 default_big() const { return (Flags >> 22) & 0x01U; }
+  constexpr SEGMENT_DESCRIPTOR_32_BITS with_default_big(UINT32 value) const { return SEGMENT_DESCRIPTOR_32_BITS((Flags & ~0x400000U) | ((value & 0x01U) << 22)); }
+
+  /**
+   * @brief G (granularity) flag
+   *
+   * Determines the scaling of the segment limit field. When the granularity flag is clear, the segment limit is interpreted
+   * in byte units; when flag is set, the segment limit is interpreted in 4-KByte units. (This flag does not affect the
+   * granularity of the base address; it is always byte granular.) When the granularity flag is set, the twelve least
+   * significant bits of an offset are not tested when checking the offset against the segment limit. For example, when the
+   * granularity flag is set, a limit of 0 results in valid offsets from 0 to 4095.
+   */
+  constexpr UINT32 granularity() const { return (Flags >> 23) & 0x01U; }
+  constexpr SEGMENT_DESCRIPTOR_32_BITS with_granularity(UINT32 value) const { return SEGMENT_DESCRIPTOR_32_BITS((Flags & ~0x800000U) | ((value & 0x01U) << 23)); }
+
+  /**
+   * Base address field (31:24); see description of $BASE_LOW for more details.
+   */
+  constexpr UINT32 base_address_high() const { return (Flags >> 24) & 0xFFU; }
+  constexpr SEGMENT_DESCRIPTOR_32_BITS with_base_address_high(UINT32 value) const { return SEGMENT_DESCRIPTOR_32_BITS((Flags & ~0xFF000000U) | ((value & 0xFFU) << 24)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(SEGMENT_DESCRIPTOR_32_BITS) == 4, "Size of SEGMENT_DESCRIPTOR_32_BITS");
+
+/**
+ * @brief Segment descriptor fields
+ */
+class SEGMENT_DESCRIPTOR_64_BITS
+{
+public:
+  constexpr SEGMENT_DESCRIPTOR_64_BITS() = default;
+  constexpr explicit SEGMENT_DESCRIPTOR_64_BITS(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, decltype(::SEGMENT_DESCRIPTOR_64::Bits)>
+  static constexpr SEGMENT_DESCRIPTOR_64_BITS from(const T& raw) { return std::bit_cast<SEGMENT_DESCRIPTOR_64_BITS>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const SEGMENT_DESCRIPTOR_64_BITS&, const SEGMENT_DESCRIPTOR_64_BITS&) = default;
+
+  /**
+   * Base address field (23:16); see description of $BASE_LOW for more details.
+   */
+  constexpr UINT32 base_address_middle() const { return (Flags >> 0) & 0xFFU; }
+  constexpr SEGMENT_DESCRIPTOR_64_BITS with_base_address_middle(UINT32 value) const { return SEGMENT_DESCRIPTOR_64_BITS((Flags & ~0xFFU) | ((value & 0xFFU) << 0)); }
+
+  /**
+   * @brief Type field
+   *
+   * Indicates the segment or gate type and specifies the kinds of access that can be made to the segment and the direction
+   * of growth. The interpretation of this field depends on whether the descriptor type flag specifies an application (code
+   * or data) descriptor or a system descriptor. The encoding of the type field is different for code, data, and system
+   * descriptors.
+   *
+   * @see Vol3A[3.4.5.1(Code- and Data-Segment Descriptor Types)]
+   */
+  constexpr UINT32 type() const { return (Flags >> 8) & 0x0FU; }
+  constexpr SEGMENT_DESCRIPTOR_64_BITS with_type(UINT32 value) const { return SEGMENT_DESCRIPTOR_64_BITS((Flags & ~0xF00U) | ((value & 0x0FU) << 8)); }
+
+  /**
+   * @brief S (descriptor type) flag
+   *
+   * Specifies whether the segment descriptor is for a system segment (S flag is clear) or a code or data segment (S flag is
+   * set).
+   */
+  constexpr UINT32 descriptor_type() const { return (Flags >> 12) & 0x01U; }
+  constexpr SEGMENT_DESCRIPTOR_64_BITS with_descriptor_type(UINT32 value) const { return SEGMENT_DESCRIPTOR_64_BITS((Flags & ~0x1000U) | ((value & 0x01U) << 12)); }
+
+  /**
+   * @brief DPL (descriptor privilege level) field
+   *
+   * Specifies the privilege level of the segment. The privilege level can range from 0 to 3, with 0 being the most
+   * privileged level. The DPL is used to control access to the segment. See Section 5.5, "Privilege Levels", for a
+   * description of the relationship of the DPL to the CPL of the executing code segment and the RPL of a segment selector.
+   */
+  constexpr UINT32 descriptor_privilege_level() const { return (Flags >> 13) & 0x03U; }
+  constexpr SEGMENT_DESCRIPTOR_64_BITS with_descriptor_privilege_level(UINT32 value) const { return SEGMENT_DESCRIPTOR_64_BITS((Flags & ~0x6000U) | ((value & 0x03U) << 13)); }
+
+  /**
+   * @brief P (segment-present) flag
+   *
+   * Indicates whether the segment is present in memory (set) or not present (clear). If this flag is clear, the processor
+   * generates a segment-not-present exception (\#NP) when a segment selector that points to the segment descriptor is loaded
+   * into a segment register. Memory management software can use this flag to control which segments are actually loaded into
+   * physical memory at a given time. It offers a control in addition to paging for managing virtual memory.
+   */
+  constexpr UINT32 present() const { return (Flags >> 15) & 0x01U; }
+  constexpr SEGMENT_DESCRIPTOR_64_BITS with_present(UINT32 value) const { return SEGMENT_DESCRIPTOR_64_BITS((Flags & ~0x8000U) | ((value & 0x01U) << 15)); }
+
+  /**
+   * Segment limit field (19:16); see description of $LIMIT_LOW for more details.
+   */
+  constexpr UINT32 segment_limit_high() const { return (Flags >> 16) & 0x0FU; }
+  constexpr SEGMENT_DESCRIPTOR_64_BITS with_segment_limit_high(UINT32 value) const { return SEGMENT_DESCRIPTOR_64_BITS((Flags & ~0xF0000U) | ((value & 0x0FU) << 16)); }
+
+  /**
+   * @brief Available bit
+   *
+   * Bit 20 of the second doubleword of the segment descriptor is available for use by system software.
+   */
+  constexpr UINT32 system() const { return (Flags >> 20) & 0x01U; }
+  constexpr SEGMENT_DESCRIPTOR_64_BITS with_system(UINT32 value) const { return SEGMENT_DESCRIPTOR_64_BITS((Flags & ~0x100000U) | ((value & 0x01U) << 20)); }
+
+  /**
+   * @brief L (64-bit code segment) flag
+   *
+   * In IA-32e mode, bit 21 of the second doubleword of the segment descriptor indicates whether a code segment contains
+   * native 64-bit code. A value of 1 indicates instructions in this code segment are executed in 64-bit mode. A value of 0
+   * indicates the instructions in this code segment are executed in compatibility mode. If L-bit is set, then D-bit must be
+   * cleared. When not in IA-32e mode or for non-code segments, bit 21 is reserved and should always be set to 0.
+   */
+  constexpr UINT32 long_mode() const { return (Flags >> 21) & 0x01U; }
+  constexpr SEGMENT_DESCRIPTOR_64_BITS with_long_mode(UINT32 value) const { return SEGMENT_DESCRIPTOR_64_BITS((Flags & ~0x200000U) | ((value & 0x01U) << 21)); }
+
+  /**
+   * @brief D/B (default operation size/default stack pointer size and/or upper bound) flag
+   *
+   * Performs different functions depending on whether the segment descriptor is an executable code segment, an expand-down
+   * data segment, or a stack segment. (This flag should always be set to 1 for 32-bit code and data segments and to 0 for
+   * 16-bit code and data segments.)
+   * - Executable code segment. The flag is called the D flag and it indicates the default length for effective addresses and
+   * operands referenced by instructions in the segment. If the flag is set, 32-bit addresses and 32-bit or 8-bit operands
+   * are assumed; if it is clear, 16-bit addresses and 16-bit or 8-bit operands are assumed. The instruction prefix 66H can
+   * be used to select an operand size other than the default, and the prefix 67H can be used select an address size other
+   * than the default.
+   * - Stack segment (data segment pointed to by the SS register). The flag is called the B (big) flag and it specifies the
+   * size of the stack pointer used for implicit stack operations (such as pushes, pops, and calls). If the flag is set, a
+   * 32-bit stack pointer is used, which is stored in the 32-bit ESP register; if the flag is clear, a 16-bit stack pointer
+   * is used, which is stored in the 16- bit SP register. If the stack segment is set up to be an expand-down data segment
+   * (described in the next paragraph), the B flag also specifies the upper bound of the stack segment.
+   * - Expand-down data segment. The flag is called the B flag and it specifies the upper bound of the segment. If the flag
+   * is set, the upper bound is FFFFFFFFH (4 GBytes); if the flag is clear, the upper bound is FFFFH (64 KBytes).
+   */
+  constexpr UINT32 default_big() const { return (Flags >> 22) & 0x01U; }
+  constexpr SEGMENT_DESCRIPTOR_64_BITS with_default_big(UINT32 value) const { return SEGMENT_DESCRIPTOR_64_BITS((Flags & ~0x400000U) | ((value & 0x01U) << 22)); }
+
+  /**
+   * @brief G (granularity) flag
+   *
+   * Determines the scaling of the segment limit field. When the granularity flag is clear, the segment limit is interpreted
+   * in byte units; when flag is set, the segment limit is interpreted in 4-KByte units. (This flag does not affect the
+   * granularity of the base address; it is always byte granular.) When the granularity flag is set, the twelve least
+   * significant bits of an offset are not tested when checking the offset against the segment limit. For example, when the
+   * granularity flag is set, a limit of 0 results in valid offsets from 0 to 4095.
+   */
+  constexpr UINT32 granularity() const { return (Flags >> 23) & 0x01U; }
+  constexpr SEGMENT_DESCRIPTOR_64_BITS with_granularity(UINT32 value) const { return SEGMENT_DESCRIPTOR_64_BITS((Flags & ~0x800000U) | ((value & 0x01U) << 23)); }
+
+  /**
+   * Base address field (31:24); see description of $BASE_LOW for more details.
+   */
+  constexpr UINT32 base_address_high() const { return (Flags >> 24) & 0xFFU; }
+  constexpr SEGMENT_DESCRIPTOR_64_BITS with_base_address_high(UINT32 value) const { return SEGMENT_DESCRIPTOR_64_BITS((Flags & ~0xFF000000U) | ((value & 0xFFU) << 24)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(SEGMENT_DESCRIPTOR_64_BITS) == 4, "Size of SEGMENT_DESCRIPTOR_64_BITS");
+
+/**
+ * @brief A segment selector is a 16-bit identifier for a segment. It does not point directly to the segment, but instead
+ *        points to the segment descriptor that defines the segment
+ */
+class SELECTOR
+{
+public:
+  constexpr SELECTOR() = default;
+  constexpr explicit SELECTOR(UINT16 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT16)) || std::same_as<T, ::SELECTOR>
+  static constexpr SELECTOR from(const T& raw) { return std::bit_cast<SELECTOR>(raw); }
+
+  constexpr UINT16 flags() const { return Flags; }
+  friend constexpr bool operator==(const SELECTOR&, const SELECTOR&) = default;
+
+  /**
+   * Specifies the privilege level of the selector. The privilege level can range from 0 to 3, with 0 being the most
+   * privileged level.
+   */
+  constexpr UINT16 request_privilege_level() const { return (Flags >> 0) & 0x03U; }
+  constexpr SELECTOR with_request_privilege_level(UINT16 value) const { return SELECTOR((Flags & ~0x03U) | ((value & 0x03U) << 0)); }
+
+  /**
+   * Specifies the descriptor table to use: clearing this flag selects the GDT; setting this flag selects the current LDT.
+   */
+  constexpr UINT16 table() const { return (Flags >> 2) & 0x01U; }
+  constexpr SELECTOR with_table(UINT16 value) const { return SELECTOR((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * Selects one of 8192 descriptors in the GDT or LDT. The processor multiplies the index value by 8 (the number of bytes in
+   * a segment descriptor) and adds the result to the base address of the GDT or LDT (from the GDTR or LDTR register,
+   * respectively).
+   */
+  constexpr UINT16 index() const { return (Flags >> 3) & 0x1FFFU; }
+  constexpr SELECTOR with_index(UINT16 value) const { return SELECTOR((Flags & ~0xFFF8U) | ((value & 0x1FFFU) << 3)); }
+
+private:
+  UINT16 Flags = 0;
+};
+static_assert(sizeof(SELECTOR) == 2, "Size of SELECTOR");
+
+/**
+ * @brief Exit Qualification for Debug Exceptions
+ */
+class VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION
+{
+public:
+  constexpr VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION() = default;
+  constexpr explicit VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION>
+  static constexpr VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION from(const T& raw) { return std::bit_cast<VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION&, const VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION&) = default;
+
+  /**
+   * @brief B3 - B0
+   *
+   * When set, each of these bits indicates that the corresponding breakpoint condition was met. Any of these bits may be set
+   * even if its corresponding enabling bit in DR7 is not set.
+   */
+  constexpr UINT64 breakpoint_condition() const { return (Flags >> 0) & 0x0FULL; }
+  constexpr VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION with_breakpoint_condition(UINT64 value) const { return VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION((Flags & ~0x0FULL) | ((value & 0x0FULL) << 0)); }
+
+  /**
+   * @brief BD
+   *
+   * When set, this bit indicates that the cause of the debug exception is "debug register access detected."
+   */
+  constexpr UINT64 debug_register_access_detected() const { return (Flags >> 13) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION with_debug_register_access_detected(UINT64 value) const { return VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION((Flags & ~0x2000ULL) | ((value & 0x01ULL) << 13)); }
+
+  /**
+   * @brief BS
+   *
+   * When set, this bit indicates that the cause of the debug exception is either the execution of a single instruction (if
+   * RFLAGS.TF = 1 and IA32_DEBUGCTL.BTF = 0) or a taken branch (if RFLAGS.TF = DEBUGCTL.BTF = 1).
+   */
+  constexpr UINT64 single_instruction() const { return (Flags >> 14) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION with_single_instruction(UINT64 value) const { return VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION((Flags & ~0x4000ULL) | ((value & 0x01ULL) << 14)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION) == 8, "Size of VMX_EXIT_QUALIFICATION_DEBUG_EXCEPTION");
+
+/**
+ * @brief Exit Qualification for Task Switch
+ */
+class VMX_EXIT_QUALIFICATION_TASK_SWITCH
+{
+public:
+  constexpr VMX_EXIT_QUALIFICATION_TASK_SWITCH() = default;
+  constexpr explicit VMX_EXIT_QUALIFICATION_TASK_SWITCH(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::VMX_EXIT_QUALIFICATION_TASK_SWITCH>
+  static constexpr VMX_EXIT_QUALIFICATION_TASK_SWITCH from(const T& raw) { return std::bit_cast<VMX_EXIT_QUALIFICATION_TASK_SWITCH>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const VMX_EXIT_QUALIFICATION_TASK_SWITCH&, const VMX_EXIT_QUALIFICATION_TASK_SWITCH&) = default;
+
+  /**
+   * Selector of task-state segment (TSS) to which the guest attempted to switch.
+   */
+  constexpr UINT64 selector() const { return (Flags >> 0) & 0xFFFFULL; }
+  constexpr VMX_EXIT_QUALIFICATION_TASK_SWITCH with_selector(UINT64 value) const { return VMX_EXIT_QUALIFICATION_TASK_SWITCH((Flags & ~0xFFFFULL) | ((value & 0xFFFFULL) << 0)); }
+
+  /**
+   * Source of task switch initiation.
+   */
+  constexpr UINT64 source() const { return (Flags >> 30) & 0x03ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_TASK_SWITCH with_source(UINT64 value) const { return VMX_EXIT_QUALIFICATION_TASK_SWITCH((Flags & ~0xC0000000ULL) | ((value & 0x03ULL) << 30)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(VMX_EXIT_QUALIFICATION_TASK_SWITCH) == 8, "Size of VMX_EXIT_QUALIFICATION_TASK_SWITCH");
+
+/**
+ * @brief Exit Qualification for Control-Register Accesses
+ */
+class VMX_EXIT_QUALIFICATION_MOV_CR
+{
+public:
+  constexpr VMX_EXIT_QUALIFICATION_MOV_CR() = default;
+  constexpr explicit VMX_EXIT_QUALIFICATION_MOV_CR(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::VMX_EXIT_QUALIFICATION_MOV_CR>
+  static constexpr VMX_EXIT_QUALIFICATION_MOV_CR from(const T& raw) { return std::bit_cast<VMX_EXIT_QUALIFICATION_MOV_CR>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const VMX_EXIT_QUALIFICATION_MOV_CR&, const VMX_EXIT_QUALIFICATION_MOV_CR&) = default;
+
+  /**
+   * Number of control register (0 for CLTS and LMSW). Bit 3 is always 0 on processors that do not support Intel 64
+   * architecture as they do not support CR8.
+   */
+  constexpr UINT64 control_register() const { return (Flags >> 0) & 0x0FULL; }
+  constexpr VMX_EXIT_QUALIFICATION_MOV_CR with_control_register(UINT64 value) const { return VMX_EXIT_QUALIFICATION_MOV_CR((Flags & ~0x0FULL) | ((value & 0x0FULL) << 0)); }
+
+  /**
+   * Access type.
+   */
+  constexpr UINT64 access_type() const { return (Flags >> 4) & 0x03ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_MOV_CR with_access_type(UINT64 value) const { return VMX_EXIT_QUALIFICATION_MOV_CR((Flags & ~0x30ULL) | ((value & 0x03ULL) << 4)); }
+
+  /**
+   * LMSW operand type. For CLTS and MOV CR, cleared to 0.
+   */
+  constexpr UINT64 lmsw_operand_type() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_MOV_CR with_lmsw_operand_type(UINT64 value) const { return VMX_EXIT_QUALIFICATION_MOV_CR((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * For MOV CR, the general-purpose register.
+   */
+  constexpr UINT64 general_purpose_register() const { return (Flags >> 8) & 0x0FULL; }
+  constexpr VMX_EXIT_QUALIFICATION_MOV_CR with_general_purpose_register(UINT64 value) const { return VMX_EXIT_QUALIFICATION_MOV_CR((Flags & ~0xF00ULL) | ((value & 0x0FULL) << 8)); }
+
+  /**
+   * For LMSW, the LMSW source data. For CLTS and MOV CR, cleared to 0.
+   */
+  constexpr UINT64 lmsw_source_data() const { return (Flags >> 16) & 0xFFFFULL; }
+  constexpr VMX_EXIT_QUALIFICATION_MOV_CR with_lmsw_source_data(UINT64 value) const { return VMX_EXIT_QUALIFICATION_MOV_CR((Flags & ~0xFFFF0000ULL) | ((value & 0xFFFFULL) << 16)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(VMX_EXIT_QUALIFICATION_MOV_CR) == 8, "Size of VMX_EXIT_QUALIFICATION_MOV_CR");
+
+/**
+ * @brief Exit Qualification for MOV DR
+ */
+class VMX_EXIT_QUALIFICATION_MOV_DR
+{
+public:
+  constexpr VMX_EXIT_QUALIFICATION_MOV_DR() = default;
+  constexpr explicit VMX_EXIT_QUALIFICATION_MOV_DR(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::VMX_EXIT_QUALIFICATION_MOV_DR>
+  static constexpr VMX_EXIT_QUALIFICATION_MOV_DR from(const T& raw) { return std::bit_cast<VMX_EXIT_QUALIFICATION_MOV_DR>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const VMX_EXIT_QUALIFICATION_MOV_DR&, const VMX_EXIT_QUALIFICATION_MOV_DR&) = default;
+
+  /**
+   * Number of debug register.
+   */
+  constexpr UINT64 debug_register() const { return (Flags >> 0) & 0x07ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_MOV_DR with_debug_register(UINT64 value) const { return VMX_EXIT_QUALIFICATION_MOV_DR((Flags & ~0x07ULL) | ((value & 0x07ULL) << 0)); }
+
+  /**
+   * Direction of access (0 = MOV to DR; 1 = MOV from DR).
+   */
+  constexpr UINT64 direction_of_access() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_MOV_DR with_direction_of_access(UINT64 value) const { return VMX_EXIT_QUALIFICATION_MOV_DR((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * General-purpose register.
+   */
+  constexpr UINT64 general_purpose_register() const { return (Flags >> 8) & 0x0FULL; }
+  constexpr VMX_EXIT_QUALIFICATION_MOV_DR with_general_purpose_register(UINT64 value) const { return VMX_EXIT_QUALIFICATION_MOV_DR((Flags & ~0xF00ULL) | ((value & 0x0FULL) << 8)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(VMX_EXIT_QUALIFICATION_MOV_DR) == 8, "Size of VMX_EXIT_QUALIFICATION_MOV_DR");
+
+/**
+ * @brief Exit Qualification for I/O Instructions
+ */
+class VMX_EXIT_QUALIFICATION_IO_INSTRUCTION
+{
+public:
+  constexpr VMX_EXIT_QUALIFICATION_IO_INSTRUCTION() = default;
+  constexpr explicit VMX_EXIT_QUALIFICATION_IO_INSTRUCTION(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::VMX_EXIT_QUALIFICATION_IO_INSTRUCTION>
+  static constexpr VMX_EXIT_QUALIFICATION_IO_INSTRUCTION from(const T& raw) { return std::bit_cast<VMX_EXIT_QUALIFICATION_IO_INSTRUCTION>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const VMX_EXIT_QUALIFICATION_IO_INSTRUCTION&, const VMX_EXIT_QUALIFICATION_IO_INSTRUCTION&) = default;
+
+  /**
+   * Size of access.
+   */
+  constexpr UINT64 size_of_access() const { return (Flags >> 0) & 0x07ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_IO_INSTRUCTION with_size_of_access(UINT64 value) const { return VMX_EXIT_QUALIFICATION_IO_INSTRUCTION((Flags & ~0x07ULL) | ((value & 0x07ULL) << 0)); }
+
+  /**
+   * Direction of the attempted access (0 = OUT, 1 = IN).
+   */
+  constexpr UINT64 direction_of_access() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_IO_INSTRUCTION with_direction_of_access(UINT64 value) const { return VMX_EXIT_QUALIFICATION_IO_INSTRUCTION((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * String instruction (0 = not string; 1 = string).
+   */
+  constexpr UINT64 string_instruction() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_IO_INSTRUCTION with_string_instruction(UINT64 value) const { return VMX_EXIT_QUALIFICATION_IO_INSTRUCTION((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * REP prefixed (0 = not REP; 1 = REP).
+   */
+  constexpr UINT64 rep_prefixed() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_IO_INSTRUCTION with_rep_prefixed(UINT64 value) const { return VMX_EXIT_QUALIFICATION_IO_INSTRUCTION((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * Operand encoding (0 = DX, 1 = immediate).
+   */
+  constexpr UINT64 operand_encoding() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_IO_INSTRUCTION with_operand_encoding(UINT64 value) const { return VMX_EXIT_QUALIFICATION_IO_INSTRUCTION((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * Port number (as specified in DX or in an immediate operand).
+   */
+  constexpr UINT64 port_number() const { return (Flags >> 16) & 0xFFFFULL; }
+  constexpr VMX_EXIT_QUALIFICATION_IO_INSTRUCTION with_port_number(UINT64 value) const { return VMX_EXIT_QUALIFICATION_IO_INSTRUCTION((Flags & ~0xFFFF0000ULL) | ((value & 0xFFFFULL) << 16)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(VMX_EXIT_QUALIFICATION_IO_INSTRUCTION) == 8, "Size of VMX_EXIT_QUALIFICATION_IO_INSTRUCTION");
+
+/**
+ * @brief Exit Qualification for APIC-Access VM Exits from Linear Accesses and Guest-Physical Accesses
+ */
+class VMX_EXIT_QUALIFICATION_APIC_ACCESS
+{
+public:
+  constexpr VMX_EXIT_QUALIFICATION_APIC_ACCESS() = default;
+  constexpr explicit VMX_EXIT_QUALIFICATION_APIC_ACCESS(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::VMX_EXIT_QUALIFICATION_APIC_ACCESS>
+  static constexpr VMX_EXIT_QUALIFICATION_APIC_ACCESS from(const T& raw) { return std::bit_cast<VMX_EXIT_QUALIFICATION_APIC_ACCESS>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const VMX_EXIT_QUALIFICATION_APIC_ACCESS&, const VMX_EXIT_QUALIFICATION_APIC_ACCESS&) = default;
+
+  /**
+   * - If the APIC-access VM exit is due to a linear access, the offset of access within the APIC page.
+   * - Undefined if the APIC-access VM exit is due a guest-physical access.
+   */
+  constexpr UINT64 page_offset() const { return (Flags >> 0) & 0xFFFULL; }
+  constexpr VMX_EXIT_QUALIFICATION_APIC_ACCESS with_page_offset(UINT64 value) const { return VMX_EXIT_QUALIFICATION_APIC_ACCESS((Flags & ~0xFFFULL) | ((value & 0xFFFULL) << 0)); }
+
+  /**
+   * Access type.
+   */
+  constexpr UINT64 access_type() const { return (Flags >> 12) & 0x0FULL; }
+  constexpr VMX_EXIT_QUALIFICATION_APIC_ACCESS with_access_type(UINT64 value) const { return VMX_EXIT_QUALIFICATION_APIC_ACCESS((Flags & ~0xF000ULL) | ((value & 0x0FULL) << 12)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(VMX_EXIT_QUALIFICATION_APIC_ACCESS) == 8, "Size of VMX_EXIT_QUALIFICATION_APIC_ACCESS");
+
+/**
+ * @brief Exit Qualification for EPT Violations
+ */
+class VMX_EXIT_QUALIFICATION_EPT_VIOLATION
+{
+public:
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION() = default;
+  constexpr explicit VMX_EXIT_QUALIFICATION_EPT_VIOLATION(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::VMX_EXIT_QUALIFICATION_EPT_VIOLATION>
+  static constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION from(const T& raw) { return std::bit_cast<VMX_EXIT_QUALIFICATION_EPT_VIOLATION>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const VMX_EXIT_QUALIFICATION_EPT_VIOLATION&, const VMX_EXIT_QUALIFICATION_EPT_VIOLATION&) = default;
+
+  /**
+   * Set if the access causing the EPT violation was a data read.
+   */
+  constexpr UINT64 read_access() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION with_read_access(UINT64 value) const { return VMX_EXIT_QUALIFICATION_EPT_VIOLATION((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Set if the access causing the EPT violation was a data write.
+   */
+  constexpr UINT64 write_access() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION with_write_access(UINT64 value) const { return VMX_EXIT_QUALIFICATION_EPT_VIOLATION((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * Set if the access causing the EPT violation was an instruction fetch.
+   */
+  constexpr UINT64 execute_access() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION with_execute_access(UINT64 value) const { return VMX_EXIT_QUALIFICATION_EPT_VIOLATION((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * The logical-AND of bit 0 in the EPT paging-structure entries used to translate the guest-physical address of the access
+   * causing the EPT violation (indicates whether the guest-physical address was readable).
+   */
+  constexpr UINT64 ept_readable() const { return (Flags >> 3) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION with_ept_readable(UINT64 value) const { return VMX_EXIT_QUALIFICATION_EPT_VIOLATION((Flags & ~0x08ULL) | ((value & 0x01ULL) << 3)); }
+
+  /**
+   * The logical-AND of bit 1 in the EPT paging-structure entries used to translate the guest-physical address of the access
+   * causing the EPT violation (indicates whether the guest-physical address was writeable).
+   */
+  constexpr UINT64 ept_writeable() const { return (Flags >> 4) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION with_ept_writeable(UINT64 value) const { return VMX_EXIT_QUALIFICATION_EPT_VIOLATION((Flags & ~0x10ULL) | ((value & 0x01ULL) << 4)); }
+
+  /**
+   * The logical-AND of bit 2 in the EPT paging-structure entries used to translate the guest-physical address of the access
+   * causing the EPT violation.
+   * If the "mode-based execute control for EPT" VM-execution control is 0, this indicates whether the guest-physical address
+   * was executable. If that control is 1, this indicates whether the guest-physical address was executable for
+   * supervisor-mode linear addresses.
+   */
+  constexpr UINT64 ept_executable() const { return (Flags >> 5) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION with_ept_executable(UINT64 value) const { return VMX_EXIT_QUALIFICATION_EPT_VIOLATION((Flags & ~0x20ULL) | ((value & 0x01ULL) << 5)); }
+
+  /**
+   * If the "mode-based execute control" VM-execution control is 0, the value of this bit is undefined. If that control is 1,
+   * this bit is the logical-AND of bit 10 in the EPT paging-structures entries used to translate the guest-physical address
+   * of the access causing the EPT violation. In this case, it indicates whether the guest-physical address was executable
+   * for user-mode linear addresses.
+   */
+  constexpr UINT64 ept_executable_for_user_mode() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION with_ept_executable_for_user_mode(UINT64 value) const { return VMX_EXIT_QUALIFICATION_EPT_VIOLATION((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * Set if the guest linear-address field is valid. The guest linear-address field is valid for all EPT violations except
+   * those resulting from an attempt to load the guest PDPTEs as part of the execution of the MOV CR instruction.
+   */
+  constexpr UINT64 valid_guest_linear_address() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION with_valid_guest_linear_address(UINT64 value) const { return VMX_EXIT_QUALIFICATION_EPT_VIOLATION((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * If bit 7 is 1:
+   * - Set if the access causing the EPT violation is to a guest-physical address that is the translation of a linear
+   * address.
+   * - Clear if the access causing the EPT violation is to a paging-structure entry as part of a page walk or the update of
+   * an accessed or dirty bit.
+   * Reserved if bit 7 is 0 (cleared to 0).
+   */
+  constexpr UINT64 caused_by_translation() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION with_caused_by_translation(UINT64 value) const { return VMX_EXIT_QUALIFICATION_EPT_VIOLATION((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * This bit is 0 if the linear address is a supervisor-mode linear address and 1 if it is a user-mode linear address.
+   * Otherwise, this bit is undefined.
+   */
+  constexpr UINT64 user_mode_linear_address() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION with_user_mode_linear_address(UINT64 value) const { return VMX_EXIT_QUALIFICATION_EPT_VIOLATION((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * This bit is 0 if paging translates the linear address to a read-only page and 1 if it translates to a read/write page.
+   * Otherwise, this bit is undefined
+   */
+  constexpr UINT64 readable_writable_page() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION with_readable_writable_page(UINT64 value) const { return VMX_EXIT_QUALIFICATION_EPT_VIOLATION((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * This bit is 0 if paging translates the linear address to an executable page and 1 if it translates to an execute-disable
+   * page. Otherwise, this bit is undefined.
+   */
+  constexpr UINT64 execute_disable_page() const { return (Flags >> 11) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION with_execute_disable_page(UINT64 value) const { return VMX_EXIT_QUALIFICATION_EPT_VIOLATION((Flags & ~0x800ULL) | ((value & 0x01ULL) << 11)); }
+
+  /**
+   * NMI unblocking due to IRET.
+   */
+  constexpr UINT64 nmi_unblocking() const { return (Flags >> 12) & 0x01ULL; }
+  constexpr VMX_EXIT_QUALIFICATION_EPT_VIOLATION with_nmi_unblocking(UINT64 value) const { return VMX_EXIT_QUALIFICATION_EPT_VIOLATION((Flags & ~0x1000ULL) | ((value & 0x01ULL) << 12)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(VMX_EXIT_QUALIFICATION_EPT_VIOLATION) == 8, "Size of VMX_EXIT_QUALIFICATION_EPT_VIOLATION");
+
+/**
+ * @brief Extended-Page-Table Pointer (EPTP)
+ *
+ * The extended-page-table pointer (EPTP) contains the address of the base of EPT PML4 table, as well as other EPT
+ * configuration information.
+ */
+class EPT_POINTER
+{
+public:
+  constexpr EPT_POINTER() = default;
+  constexpr explicit EPT_POINTER(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::EPT_POINTER>
+  static constexpr EPT_POINTER from(const T& raw) { return std::bit_cast<EPT_POINTER>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const EPT_POINTER&, const EPT_POINTER&) = default;
+
+  /**
+   * EPT paging-structure memory type:
+   * - 0 = Uncacheable (UC)
+   * - 6 = Write-back (WB)
+   * Other values are reserved.
+   */
+  constexpr UINT64 memory_type() const { return (Flags >> 0) & 0x07ULL; }
+  constexpr EPT_POINTER with_memory_type(UINT64 value) const { return EPT_POINTER((Flags & ~0x07ULL) | ((value & 0x07ULL) << 0)); }
+
+  /**
+   * This value is 1 less than the EPT page-walk length.
+   */
+  constexpr UINT64 page_walk_length() const { return (Flags >> 3) & 0x07ULL; }
+  constexpr EPT_POINTER with_page_walk_length(UINT64 value) const { return EPT_POINTER((Flags & ~0x38ULL) | ((value & 0x07ULL) << 3)); }
+
+  /**
+   * Setting this control to 1 enables accessed and dirty flags for EPT.
+   */
+  constexpr UINT64 enable_access_and_dirty_flags() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr EPT_POINTER with_enable_access_and_dirty_flags(UINT64 value) const { return EPT_POINTER((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * Bits N-1:12 of the physical address of the 4-KByte aligned EPT PML4 table.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 12) & 0xFFFFFFFFFULL; }
+  constexpr EPT_POINTER with_page_frame_number(UINT64 value) const { return EPT_POINTER((Flags & ~0xFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFULL) << 12)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(EPT_POINTER) == 8, "Size of EPT_POINTER");
+
+/**
+ * @brief Format of an EPT PML4 Entry (PML4E) that References an EPT Page-Directory-Pointer Table
+ *
+ * A 4-KByte naturally aligned EPT PML4 table is located at the physical address specified in bits 51:12 of the
+ * extended-page-table pointer (EPTP), a VM-execution control field. An EPT PML4 table comprises 512 64-bit entries (EPT
+ * PML4Es). An EPT PML4E is selected using the physical address defined as follows:
+ * - Bits 63:52 are all 0.
+ * - Bits 51:12 are from the EPTP.
+ * - Bits 11:3 are bits 47:39 of the guest-physical address.
+ * - Bits 2:0 are all 0.
+ * Because an EPT PML4E is identified using bits 47:39 of the guest-physical address, it controls access to a 512- GByte
+ * region of the guest-physical-address space.
+ */
+class EPT_PML4
+{
+public:
+  constexpr EPT_PML4() = default;
+  constexpr explicit EPT_PML4(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::EPT_PML4>
+  static constexpr EPT_PML4 from(const T& raw) { return std::bit_cast<EPT_PML4>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const EPT_PML4&, const EPT_PML4&) = default;
+
+  /**
+   * Read access; indicates whether reads are allowed from the 512-GByte region controlled by this entry.
+   */
+  constexpr UINT64 read_access() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr EPT_PML4 with_read_access(UINT64 value) const { return EPT_PML4((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Write access; indicates whether writes are allowed from the 512-GByte region controlled by this entry.
+   */
+  constexpr UINT64 write_access() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr EPT_PML4 with_write_access(UINT64 value) const { return EPT_PML4((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * If the "mode-based execute control for EPT" VM-execution control is 0, execute access; indicates whether instruction
+   * fetches are allowed from the 512-GByte region controlled by this entry.
+   * If that control is 1, execute access for supervisor-mode linear addresses; indicates whether instruction fetches are
+   * allowed from supervisor-mode linear addresses in the 512-GByte region controlled by this entry.
+   */
+  constexpr UINT64 execute_access() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr EPT_PML4 with_execute_access(UINT64 value) const { return EPT_PML4((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * If bit 6 of EPTP is 1, accessed flag for EPT; indicates whether software has accessed the 512-GByte region controlled by
+   * this entry. Ignored if bit 6 of EPTP is 0.
+   */
+  constexpr UINT64 accessed() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr EPT_PML4 with_accessed(UINT64 value) const { return EPT_PML4((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * Execute access for user-mode linear addresses. If the "mode-based execute control for EPT" VM-execution control is 1,
+   * indicates whether instruction fetches are allowed from user-mode linear addresses in the 512-GByte region controlled by
+   * this entry. If that control is 0, this bit is ignored.
+   */
+  constexpr UINT64 user_mode_execute() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr EPT_PML4 with_user_mode_execute(UINT64 value) const { return EPT_PML4((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * Physical address of 4-KByte aligned EPT page-directory-pointer table referenced by this entry.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 12) & 0xFFFFFFFFFULL; }
+  constexpr EPT_PML4 with_page_frame_number(UINT64 value) const { return EPT_PML4((Flags & ~0xFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFULL) << 12)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(EPT_PML4) == 8, "Size of EPT_PML4");
+
+/**
+ * @brief Format of an EPT Page-Directory-Pointer-Table Entry (PDPTE) that Maps a 1-GByte Page
+ */
+class EPDPTE_1GB
+{
+public:
+  constexpr EPDPTE_1GB() = default;
+  constexpr explicit EPDPTE_1GB(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::EPDPTE_1GB>
+  static constexpr EPDPTE_1GB from(const T& raw) { return std::bit_cast<EPDPTE_1GB>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const EPDPTE_1GB&, const EPDPTE_1GB&) = default;
+
+  /**
+   * Read access; indicates whether reads are allowed from the 1-GByte page referenced by this entry.
+   */
+  constexpr UINT64 read_access() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr EPDPTE_1GB with_read_access(UINT64 value) const { return EPDPTE_1GB((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Write access; indicates whether writes are allowed from the 1-GByte page referenced by this entry.
+   */
+  constexpr UINT64 write_access() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr EPDPTE_1GB with_write_access(UINT64 value) const { return EPDPTE_1GB((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * If the "mode-based execute control for EPT" VM-execution control is 0, execute access; indicates whether instruction
+   * fetches are allowed from the 1-GByte page controlled by this entry.
+   * If that control is 1, execute access for supervisor-mode linear addresses; indicates whether instruction fetches are
+   * allowed from supervisor-mode linear addresses in the 1-GByte page controlled by this entry.
+   */
+  constexpr UINT64 execute_access() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr EPDPTE_1GB with_execute_access(UINT64 value) const { return EPDPTE_1GB((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * EPT memory type for this 1-GByte page.
+   */
+  constexpr UINT64 memory_type() const { return (Flags >> 3) & 0x07ULL; }
+  constexpr EPDPTE_1GB with_memory_type(UINT64 value) const { return EPDPTE_1GB((Flags & ~0x38ULL) | ((value & 0x07ULL) << 3)); }
+
+  /**
+   * Ignore PAT memory type for this 1-GByte page.
+   */
+  constexpr UINT64 ignore_pat() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr EPDPTE_1GB with_ignore_pat(UINT64 value) const { return EPDPTE_1GB((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * Must be 1 (otherwise, this entry references an EPT page directory).
+   */
+  constexpr UINT64 large_page() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr EPDPTE_1GB with_large_page(UINT64 value) const { return EPDPTE_1GB((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * If bit 6 of EPTP is 1, accessed flag for EPT; indicates whether software has accessed the 1-GByte page referenced by
+   * this entry. Ignored if bit 6 of EPTP is 0.
+   */
+  constexpr UINT64 accessed() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr EPDPTE_1GB with_accessed(UINT64 value) const { return EPDPTE_1GB((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * If bit 6 of EPTP is 1, dirty flag for EPT; indicates whether software has written to the 1-GByte page referenced by this
+   * entry. Ignored if bit 6 of EPTP is 0.
+   */
+  constexpr UINT64 dirty() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr EPDPTE_1GB with_dirty(UINT64 value) const { return EPDPTE_1GB((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * Execute access for user-mode linear addresses. If the "mode-based execute control for EPT" VM-execution control is 1,
+   * indicates whether instruction fetches are allowed from user-mode linear addresses in the 1-GByte page controlled by this
+   * entry. If that control is 0, this bit is ignored.
+   */
+  constexpr UINT64 user_mode_execute() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr EPDPTE_1GB with_user_mode_execute(UINT64 value) const { return EPDPTE_1GB((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * Physical address of 4-KByte aligned EPT page-directory-pointer table referenced by this entry.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 30) & 0x3FFFFULL; }
+  constexpr EPDPTE_1GB with_page_frame_number(UINT64 value) const { return EPDPTE_1GB((Flags & ~0xFFFFC0000000ULL) | ((value & 0x3FFFFULL) << 30)); }
+
+  /**
+   * Suppress \#VE. If the "EPT-violation \#VE" VM-execution control is 1, EPT violations caused by accesses to this page are
+   * convertible to virtualization exceptions only if this bit is 0. If "EPT-violation \#VE" VMexecution control is 0, this
+   * bit is ignored.
+   */
+  constexpr UINT64 suppress_ve() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr EPDPTE_1GB with_suppress_ve(UINT64 value) const { return EPDPTE_1GB((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(EPDPTE_1GB) == 8, "Size of EPDPTE_1GB");
+
+/**
+ * @brief Format of an EPT Page-Directory-Pointer-Table Entry (PDPTE) that References an EPT Page Directory
+ */
+class EPDPTE
+{
+public:
+  constexpr EPDPTE() = default;
+  constexpr explicit EPDPTE(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::EPDPTE>
+  static constexpr EPDPTE from(const T& raw) { return std::bit_cast<EPDPTE>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const EPDPTE&, const EPDPTE&) = default;
+
+  /**
+   * Read access; indicates whether reads are allowed from the 1-GByte region controlled by this entry.
+   */
+  constexpr UINT64 read_access() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr EPDPTE with_read_access(UINT64 value) const { return EPDPTE((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Write access; indicates whether writes are allowed from the 1-GByte region controlled by this entry.
+   */
+  constexpr UINT64 write_access() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr EPDPTE with_write_access(UINT64 value) const { return EPDPTE((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * If the "mode-based execute control for EPT" VM-execution control is 0, execute access; indicates whether instruction
+   * fetches are allowed from the 1-GByte region controlled by this entry.
+   * If that control is 1, execute access for supervisor-mode linear addresses; indicates whether instruction fetches are
+   * allowed from supervisor-mode linear addresses in the 1-GByte region controlled by this entry.
+   */
+  constexpr UINT64 execute_access() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr EPDPTE with_execute_access(UINT64 value) const { return EPDPTE((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * If bit 6 of EPTP is 1, accessed flag for EPT; indicates whether software has accessed the 1-GByte region controlled by
+   * this entry. Ignored if bit 6 of EPTP is 0.
+   */
+  constexpr UINT64 accessed() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr EPDPTE with_accessed(UINT64 value) const { return EPDPTE((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * Execute access for user-mode linear addresses. If the "mode-based execute control for EPT" VM-execution control is 1,
+   * indicates whether instruction fetches are allowed from user-mode linear addresses in the 1-GByte region controlled by
+   * this entry. If that control is 0, this bit is ignored.
+   */
+  constexpr UINT64 user_mode_execute() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr EPDPTE with_user_mode_execute(UINT64 value) const { return EPDPTE((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * Physical address of 4-KByte aligned EPT page-directory-pointer table referenced by this entry.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 12) & 0xFFFFFFFFFULL; }
+  constexpr EPDPTE with_page_frame_number(UINT64 value) const { return EPDPTE((Flags & ~0xFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFULL) << 12)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(EPDPTE) == 8, "Size of EPDPTE");
+
+/**
+ * @brief Format of an EPT Page-Directory Entry (PDE) that Maps a 2-MByte Page
+ */
+class EPDE_2MB
+{
+public:
+  constexpr EPDE_2MB() = default;
+  constexpr explicit EPDE_2MB(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::EPDE_2MB>
+  static constexpr EPDE_2MB from(const T& raw) { return std::bit_cast<EPDE_2MB>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const EPDE_2MB&, const EPDE_2MB&) = default;
+
+  /**
+   * Read access; indicates whether reads are allowed from the 2-MByte page referenced by this entry.
+   */
+  constexpr UINT64 read_access() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr EPDE_2MB with_read_access(UINT64 value) const { return EPDE_2MB((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Write access; indicates whether writes are allowed from the 2-MByte page referenced by this entry.
+   */
+  constexpr UINT64 write_access() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr EPDE_2MB with_write_access(UINT64 value) const { return EPDE_2MB((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * If the "mode-based execute control for EPT" VM-execution control is 0, execute access; indicates whether instruction
+   * fetches are allowed from the 2-MByte page controlled by this entry.
+   * If that control is 1, execute access for supervisor-mode linear addresses; indicates whether instruction fetches are
+   * allowed from supervisor-mode linear addresses in the 2-MByte page controlled by this entry.
+   */
+  constexpr UINT64 execute_access() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr EPDE_2MB with_execute_access(UINT64 value) const { return EPDE_2MB((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * EPT memory type for this 2-MByte page.
+   */
+  constexpr UINT64 memory_type() const { return (Flags >> 3) & 0x07ULL; }
+  constexpr EPDE_2MB with_memory_type(UINT64 value) const { return EPDE_2MB((Flags & ~0x38ULL) | ((value & 0x07ULL) << 3)); }
+
+  /**
+   * Ignore PAT memory type for this 2-MByte page.
+   */
+  constexpr UINT64 ignore_pat() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr EPDE_2MB with_ignore_pat(UINT64 value) const { return EPDE_2MB((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * Must be 1 (otherwise, this entry references an EPT page table).
+   */
+  constexpr UINT64 large_page() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr EPDE_2MB with_large_page(UINT64 value) const { return EPDE_2MB((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  /**
+   * If bit 6 of EPTP is 1, accessed flag for EPT; indicates whether software has accessed the 2-MByte page referenced by
+   * this entry. Ignored if bit 6 of EPTP is 0.
+   */
+  constexpr UINT64 accessed() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr EPDE_2MB with_accessed(UINT64 value) const { return EPDE_2MB((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * If bit 6 of EPTP is 1, dirty flag for EPT; indicates whether software has written to the 2-MByte page referenced by this
+   * entry. Ignored if bit 6 of EPTP is 0.
+   */
+  constexpr UINT64 dirty() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr EPDE_2MB with_dirty(UINT64 value) const { return EPDE_2MB((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * Execute access for user-mode linear addresses. If the "mode-based execute control for EPT" VM-execution control is 1,
+   * indicates whether instruction fetches are allowed from user-mode linear addresses in the 2-MByte page controlled by this
+   * entry. If that control is 0, this bit is ignored.
+   */
+  constexpr UINT64 user_mode_execute() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr EPDE_2MB with_user_mode_execute(UINT64 value) const { return EPDE_2MB((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * Physical address of 4-KByte aligned EPT page-directory-pointer table referenced by this entry.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 21) & 0x7FFFFFFULL; }
+  constexpr EPDE_2MB with_page_frame_number(UINT64 value) const { return EPDE_2MB((Flags & ~0xFFFFFFE00000ULL) | ((value & 0x7FFFFFFULL) << 21)); }
+
+  /**
+   * Suppress \#VE. If the "EPT-violation \#VE" VM-execution control is 1, EPT violations caused by accesses to this page are
+   * convertible to virtualization exceptions only if this bit is 0. If "EPT-violation \#VE" VMexecution control is 0, this
+   * bit is ignored.
+   */
+  constexpr UINT64 suppress_ve() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr EPDE_2MB with_suppress_ve(UINT64 value) const { return EPDE_2MB((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(EPDE_2MB) == 8, "Size of EPDE_2MB");
+
+/**
+ * @brief Format of an EPT Page-Directory Entry (PDE) that References an EPT Page Table
+ */
+class EPDE
+{
+public:
+  constexpr EPDE() = default;
+  constexpr explicit EPDE(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::EPDE>
+  static constexpr EPDE from(const T& raw) { return std::bit_cast<EPDE>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const EPDE&, const EPDE&) = default;
+
+  /**
+   * Read access; indicates whether reads are allowed from the 2-MByte region controlled by this entry.
+   */
+  constexpr UINT64 read_access() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr EPDE with_read_access(UINT64 value) const { return EPDE((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Write access; indicates whether writes are allowed from the 2-MByte region controlled by this entry.
+   */
+  constexpr UINT64 write_access() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr EPDE with_write_access(UINT64 value) const { return EPDE((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * If the "mode-based execute control for EPT" VM-execution control is 0, execute access; indicates whether instruction
+   * fetches are allowed from the 2-MByte region controlled by this entry.
+   * If that control is 1, execute access for supervisor-mode linear addresses; indicates whether instruction fetches are
+   * allowed from supervisor-mode linear addresses in the 2-MByte region controlled by this entry.
+   */
+  constexpr UINT64 execute_access() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr EPDE with_execute_access(UINT64 value) const { return EPDE((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * If bit 6 of EPTP is 1, accessed flag for EPT; indicates whether software has accessed the 2-MByte region controlled by
+   * this entry. Ignored if bit 6 of EPTP is 0.
+   */
+  constexpr UINT64 accessed() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr EPDE with_accessed(UINT64 value) const { return EPDE((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * Execute access for user-mode linear addresses. If the "mode-based execute control for EPT" VM-execution control is 1,
+   * indicates whether instruction fetches are allowed from user-mode linear addresses in the 2-MByte region controlled by
+   * this entry. If that control is 0, this bit is ignored.
+   */
+  constexpr UINT64 user_mode_execute() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr EPDE with_user_mode_execute(UINT64 value) const { return EPDE((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * Physical address of 4-KByte aligned EPT page table referenced by this entry.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 12) & 0xFFFFFFFFFULL; }
+  constexpr EPDE with_page_frame_number(UINT64 value) const { return EPDE((Flags & ~0xFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFULL) << 12)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(EPDE) == 8, "Size of EPDE");
+
+/**
+ * @brief Format of an EPT Page-Table Entry that Maps a 4-KByte Page
+ */
+class EPTE
+{
+public:
+  constexpr EPTE() = default;
+  constexpr explicit EPTE(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::EPTE>
+  static constexpr EPTE from(const T& raw) { return std::bit_cast<EPTE>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const EPTE&, const EPTE&) = default;
+
+  /**
+   * Read access; indicates whether reads are allowed from the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT64 read_access() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr EPTE with_read_access(UINT64 value) const { return EPTE((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  /**
+   * Write access; indicates whether writes are allowed from the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT64 write_access() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr EPTE with_write_access(UINT64 value) const { return EPTE((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  /**
+   * If the "mode-based execute control for EPT" VM-execution control is 0, execute access; indicates whether instruction
+   * fetches are allowed from the 4-KByte page controlled by this entry.
+   * If that control is 1, execute access for supervisor-mode linear addresses; indicates whether instruction fetches are
+   * allowed from supervisor-mode linear addresses in the 4-KByte page controlled by this entry.
+   */
+  constexpr UINT64 execute_access() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr EPTE with_execute_access(UINT64 value) const { return EPTE((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  /**
+   * EPT memory type for this 4-KByte page.
+   */
+  constexpr UINT64 memory_type() const { return (Flags >> 3) & 0x07ULL; }
+  constexpr EPTE with_memory_type(UINT64 value) const { return EPTE((Flags & ~0x38ULL) | ((value & 0x07ULL) << 3)); }
+
+  /**
+   * Ignore PAT memory type for this 4-KByte page.
+   */
+  constexpr UINT64 ignore_pat() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr EPTE with_ignore_pat(UINT64 value) const { return EPTE((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  /**
+   * If bit 6 of EPTP is 1, accessed flag for EPT; indicates whether software has accessed the 4-KByte page referenced by
+   * this entry. Ignored if bit 6 of EPTP is 0.
+   */
+  constexpr UINT64 accessed() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr EPTE with_accessed(UINT64 value) const { return EPTE((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  /**
+   * If bit 6 of EPTP is 1, dirty flag for EPT; indicates whether software has written to the 4-KByte page referenced by this
+   * entry. Ignored if bit 6 of EPTP is 0.
+   */
+  constexpr UINT64 dirty() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr EPTE with_dirty(UINT64 value) const { return EPTE((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  /**
+   * Execute access for user-mode linear addresses. If the "mode-based execute control for EPT" VM-execution control is 1,
+   * indicates whether instruction fetches are allowed from user-mode linear addresses in the 4-KByte page controlled by this
+   * entry. If that control is 0, this bit is ignored.
+   */
+  constexpr UINT64 user_mode_execute() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr EPTE with_user_mode_execute(UINT64 value) const { return EPTE((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  /**
+   * Physical address of the 4-KByte page referenced by this entry.
+   */
+  constexpr UINT64 page_frame_number() const { return (Flags >> 12) & 0xFFFFFFFFFULL; }
+  constexpr EPTE with_page_frame_number(UINT64 value) const { return EPTE((Flags & ~0xFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFULL) << 12)); }
+
+  /**
+   * Suppress \#VE. If the "EPT-violation \#VE" VM-execution control is 1, EPT violations caused by accesses to this page are
+   * convertible to virtualization exceptions only if this bit is 0. If "EPT-violation \#VE" VMexecution control is 0, this
+   * bit is ignored.
+   */
+  constexpr UINT64 suppress_ve() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr EPTE with_suppress_ve(UINT64 value) const { return EPTE((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(EPTE) == 8, "Size of EPTE");
+
+/**
+ * @brief Format of a common EPT Entry
+ */
+class EPT_ENTRY
+{
+public:
+  constexpr EPT_ENTRY() = default;
+  constexpr explicit EPT_ENTRY(UINT64 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT64)) || std::same_as<T, ::EPT_ENTRY>
+  static constexpr EPT_ENTRY from(const T& raw) { return std::bit_cast<EPT_ENTRY>(raw); }
+
+  constexpr UINT64 flags() const { return Flags; }
+  friend constexpr bool operator==(const EPT_ENTRY&, const EPT_ENTRY&) = default;
+
+  constexpr UINT64 read_access() const { return (Flags >> 0) & 0x01ULL; }
+  constexpr EPT_ENTRY with_read_access(UINT64 value) const { return EPT_ENTRY((Flags & ~0x01ULL) | ((value & 0x01ULL) << 0)); }
+
+  constexpr UINT64 write_access() const { return (Flags >> 1) & 0x01ULL; }
+  constexpr EPT_ENTRY with_write_access(UINT64 value) const { return EPT_ENTRY((Flags & ~0x02ULL) | ((value & 0x01ULL) << 1)); }
+
+  constexpr UINT64 execute_access() const { return (Flags >> 2) & 0x01ULL; }
+  constexpr EPT_ENTRY with_execute_access(UINT64 value) const { return EPT_ENTRY((Flags & ~0x04ULL) | ((value & 0x01ULL) << 2)); }
+
+  constexpr UINT64 memory_type() const { return (Flags >> 3) & 0x07ULL; }
+  constexpr EPT_ENTRY with_memory_type(UINT64 value) const { return EPT_ENTRY((Flags & ~0x38ULL) | ((value & 0x07ULL) << 3)); }
+
+  constexpr UINT64 ignore_pat() const { return (Flags >> 6) & 0x01ULL; }
+  constexpr EPT_ENTRY with_ignore_pat(UINT64 value) const { return EPT_ENTRY((Flags & ~0x40ULL) | ((value & 0x01ULL) << 6)); }
+
+  constexpr UINT64 large_page() const { return (Flags >> 7) & 0x01ULL; }
+  constexpr EPT_ENTRY with_large_page(UINT64 value) const { return EPT_ENTRY((Flags & ~0x80ULL) | ((value & 0x01ULL) << 7)); }
+
+  constexpr UINT64 accessed() const { return (Flags >> 8) & 0x01ULL; }
+  constexpr EPT_ENTRY with_accessed(UINT64 value) const { return EPT_ENTRY((Flags & ~0x100ULL) | ((value & 0x01ULL) << 8)); }
+
+  constexpr UINT64 dirty() const { return (Flags >> 9) & 0x01ULL; }
+  constexpr EPT_ENTRY with_dirty(UINT64 value) const { return EPT_ENTRY((Flags & ~0x200ULL) | ((value & 0x01ULL) << 9)); }
+
+  constexpr UINT64 user_mode_execute() const { return (Flags >> 10) & 0x01ULL; }
+  constexpr EPT_ENTRY with_user_mode_execute(UINT64 value) const { return EPT_ENTRY((Flags & ~0x400ULL) | ((value & 0x01ULL) << 10)); }
+
+  constexpr UINT64 page_frame_number() const { return (Flags >> 12) & 0xFFFFFFFFFULL; }
+  constexpr EPT_ENTRY with_page_frame_number(UINT64 value) const { return EPT_ENTRY((Flags & ~0xFFFFFFFFF000ULL) | ((value & 0xFFFFFFFFFULL) << 12)); }
+
+  constexpr UINT64 suppress_ve() const { return (Flags >> 63) & 0x01ULL; }
+  constexpr EPT_ENTRY with_suppress_ve(UINT64 value) const { return EPT_ENTRY((Flags & ~0x8000000000000000ULL) | ((value & 0x01ULL) << 63)); }
+
+private:
+  UINT64 Flags = 0;
+};
+static_assert(sizeof(EPT_ENTRY) == 8, "Size of EPT_ENTRY");
+
+class VMCS_COMPONENT_ENCODING
+{
+public:
+  constexpr VMCS_COMPONENT_ENCODING() = default;
+  constexpr explicit VMCS_COMPONENT_ENCODING(UINT16 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT16)) || std::same_as<T, ::VMCS_COMPONENT_ENCODING>
+  static constexpr VMCS_COMPONENT_ENCODING from(const T& raw) { return std::bit_cast<VMCS_COMPONENT_ENCODING>(raw); }
+
+  constexpr UINT16 flags() const { return Flags; }
+  friend constexpr bool operator==(const VMCS_COMPONENT_ENCODING&, const VMCS_COMPONENT_ENCODING&) = default;
+
+  /**
+   * Access type (0 = full; 1 = high); must be full for 16-bit, 32-bit, and natural-width fields.
+   */
+  constexpr UINT16 access_type() const { return (Flags >> 0) & 0x01U; }
+  constexpr VMCS_COMPONENT_ENCODING with_access_type(UINT16 value) const { return VMCS_COMPONENT_ENCODING((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * Index.
+   */
+  constexpr UINT16 index() const { return (Flags >> 1) & 0x1FFU; }
+  constexpr VMCS_COMPONENT_ENCODING with_index(UINT16 value) const { return VMCS_COMPONENT_ENCODING((Flags & ~0x3FEU) | ((value & 0x1FFU) << 1)); }
+
+  /**
+   * Type:
+   * 0: control
+   * 1: VM-exit information
+   * 2: guest state
+   * 3: host state
+   */
+  constexpr UINT16 type() const { return (Flags >> 10) & 0x03U; }
+  constexpr VMCS_COMPONENT_ENCODING with_type(UINT16 value) const { return VMCS_COMPONENT_ENCODING((Flags & ~0xC00U) | ((value & 0x03U) << 10)); }
+
+  /**
+   * Reserved (must be 0).
+   */
+  constexpr UINT16 must_be_zero() const { return (Flags >> 12) & 0x01U; }
+  constexpr VMCS_COMPONENT_ENCODING with_must_be_zero(UINT16 value) const { return VMCS_COMPONENT_ENCODING((Flags & ~0x1000U) | ((value & 0x01U) << 12)); }
+
+  /**
+   * Width:
+   * 0: 16-bit
+   * 1: 64-bit
+   * 2: 32-bit
+   * 3: natural-width
+   */
+  constexpr UINT16 width() const { return (Flags >> 13) & 0x03U; }
+  constexpr VMCS_COMPONENT_ENCODING with_width(UINT16 value) const { return VMCS_COMPONENT_ENCODING((Flags & ~0x6000U) | ((value & 0x03U) << 13)); }
+
+private:
+  UINT16 Flags = 0;
+};
+static_assert(sizeof(VMCS_COMPONENT_ENCODING) == 2, "Size of VMCS_COMPONENT_ENCODING");
+
+class EFLAGS
+{
+public:
+  constexpr EFLAGS() = default;
+  constexpr explicit EFLAGS(UINT32 flags) : Flags(flags) { }
+
+  template <typename T> requires (std::unsigned_integral<T> && sizeof(T) == sizeof(UINT32)) || std::same_as<T, ::EFLAGS>
+  static constexpr EFLAGS from(const T& raw) { return std::bit_cast<EFLAGS>(raw); }
+
+  constexpr UINT32 flags() const { return Flags; }
+  friend constexpr bool operator==(const EFLAGS&, const EFLAGS&) = default;
+
+  /**
+   * @brief Carry flag
+   *
+   * Set if an arithmetic operation generates a carry or a borrow out of the mostsignificant bit of the result; cleared
+   * otherwise. This flag indicates an overflow condition for unsigned-integer arithmetic. It is also used in
+   * multiple-precision arithmetic.
+   */
+  constexpr UINT32 carry_flag() const { return (Flags >> 0) & 0x01U; }
+  constexpr EFLAGS with_carry_flag(UINT32 value) const { return EFLAGS((Flags & ~0x01U) | ((value & 0x01U) << 0)); }
+
+  /**
+   * Reserved - always 1
+   */
+  constexpr UINT32 read_as_1() const { return (Flags >> 1) & 0x01U; }
+  constexpr EFLAGS with_read_as_1(UINT32 value) const { return EFLAGS((Flags & ~0x02U) | ((value & 0x01U) << 1)); }
+
+  /**
+   * @brief Parity flag
+   *
+   * Set if the least-significant byte of the result contains an even number of 1 bits; cleared otherwise.
+   */
+  constexpr UINT32 parity_flag() const { return (Flags >> 2) & 0x01U; }
+  constexpr EFLAGS with_parity_flag(UINT32 value) const { return EFLAGS((Flags & ~0x04U) | ((value & 0x01U) << 2)); }
+
+  /**
+   * @brief Auxiliary Carry flag
+   *
+   * Set if an arithmetic operation generates a carry or a borrow out of bit 3 of the result; cleared otherwise. This flag is
+   * used in binary-coded decimal (BCD) arithmetic.
+   */
+  constexpr UINT32 auxiliary_carry_flag() const { return (Flags >> 4) & 0x01U; }
+  constexpr EFLAGS with_auxiliary_carry_flag(UINT32 value) const { return EFLAGS((Flags & ~0x10U) | ((value & 0x01U) << 4)); }
+
+  /**
+   * @brief Zero flag
+   *
+   * Set if the result is zero; cleared otherwise.
+   */
+  constexpr UINT32 zero_flag() const { return (Flags >> 6) & 0x01U; }
+  constexpr EFLAGS with_zero_flag(UINT32 value) const { return EFLAGS((Flags & ~0x40U) | ((value & 0x01U) << 6)); }
+
+  /**
+   * @brief Sign flag
+   *
+   * Set equal to the most-significant bit of the result, which is the sign bit of a signed integer. (0 indicates a positive
+   * value and 1 indicates a negative value.)
+   */
+  constexpr UINT32 sign_flag() const { return (Flags >> 7) & 0x01U; }
+  constexpr EFLAGS with_sign_flag(UINT32 value) const { return EFLAGS((Flags & ~0x80U) | ((value & 0x01U) << 7)); }
+
+  /**
+   * @brief Trap flag
+   *
+   * Set to enable single-step mode for debugging; clear to disable single-step mode.
+   */
+  constexpr UINT32 trap_flag() const { return (Flags >> 8) & 0x01U; }
+  constexpr EFLAGS with_trap_flag(UINT32 value) const { return EFLAGS((Flags & ~0x100U) | ((value & 0x01U) << 8)); }
+
+  /**
+   * @brief Interrupt enable flag
+   *
+   * Controls the response of the processor to maskable interrupt requests. Set to respond to maskable interrupts; cleared to
+   * inhibit maskable interrupts.
+   */
+  constexpr UINT32 interrupt_enable_flag() const { return (Flags >> 9) & 0x01U; }
+  constexpr EFLAGS with_interrupt_enable_flag(UINT32 value) const { return EFLAGS((Flags & ~0x200U) | ((value & 0x01U) << 9)); }
+
+  /**
+   * @brief Direction flag
+   *
+   * Controls string instructions (MOVS, CMPS, SCAS, LODS, and STOS). Setting the DF flag causes the string instructions to
+   * auto-decrement (to process strings from high addresses to low addresses). Clearing the DF flag causes the string
+   * instructions to auto-increment (process strings from low addresses to high addresses).
+   */
+  constexpr UINT32 direction_flag() const { return (Flags >> 10) & 0x01U; }
+  constexpr EFLAGS with_direction_flag(UINT32 value) const { return EFLAGS((Flags & ~0x400U) | ((value & 0x01U) << 10)); }
+
+  /**
+   * @brief Overflow flag
+   *
+   * Set if the integer result is too large a positive number or too small a negative number (excluding the sign-bit) to fit
+   * in the destination operand; cleared otherwise. This flag indicates an overflow condition for signed-integer (two's
+   * complement) arithmetic.
+   */
+  constexpr UINT32 overflow_flag() const { return (Flags >> 11) & 0x01U; }
+  constexpr EFLAGS with_overflow_flag(UINT32 value) const { return EFLAGS((Flags & ~0x800U) | ((value & 0x01U) << 11)); }
+
+  /**
+   * @brief I/O privilege level field
+   *
+   * Indicates the I/O privilege level of the currently running program or task. The current privilege level (CPL) of the
+   * currently running program or task must be less than or equal to the I/O privilege level to access the I/O address space.
+   * The POPF and IRET instructions can modify this field only when operating at a CPL of 0.
+   */
+  constexpr UINT32 io_privilege_level() const { return (Flags >> 12) & 0x03U; }
+  constexpr EFLAGS with_io_privilege_level(UINT32 value) const { return EFLAGS((Flags & ~0x3000U) | ((value & 0x03U) << 12)); }
+
+  /**
+   * @brief Nested task flag
+   *
+   * Controls the chaining of interrupted and called tasks. Set when the current task is linked to the previously executed
+   * task; cleared when the current task is not linked to another task.
+   */
+  constexpr UINT32 nested_task_flag() const { return (Flags >> 14) & 0x01U; }
+  constexpr EFLAGS with_nested_task_flag(UINT32 value) const { return EFLAGS((Flags & ~0x4000U) | ((value & 0x01U) << 14)); }
+
+  /**
+   * @brief Resume flag
+   *
+   * Controls the processor's response to debug exceptions.
+   */
+  constexpr UINT32 resume_flag() const { return (Flags >> 16) & 0x01U; }
+  constexpr EFLAGS with_resume_flag(UINT32 value) const { return EFLAGS((Flags & ~0x10000U) | ((value & 0x01U) << 16)); }
+
+  /**
+   * @brief Virtual-8086 mode flag
+   *
+   * Set to enable virtual-8086 mode; clear to return to protected mode without virtual-8086 mode semantics.
+   */
+  constexpr UINT32 virtual_8086_mode_flag() const { return (Flags >> 17) & 0x01U; }
+  constexpr EFLAGS with_virtual_8086_mode_flag(UINT32 value) const { return EFLAGS((Flags & ~0x20000U) | ((value & 0x01U) << 17)); }
+
+  /**
+   * @brief Alignment check (or access control) flag
+   *
+   * If the AM bit is set in the CR0 register, alignment checking of user-mode data accesses is enabled if and only if this
+   * flag is 1. If the SMAP bit is set in the CR4 register, explicit supervisor-mode data accesses to user-mode pages are
+   * allowed if and only if this bit is 1.
+   *
+   * @see Vol3A[4.6(ACCESS RIGHTS)]
+   */
+  constexpr UINT32 alignment_check_flag() const { return (Flags >> 18) & 0x01U; }
+  constexpr EFLAGS with_alignment_check_flag(UINT32 value) const { return EFLAGS((Flags & ~0x40000U) | ((value & 0x01U) << 18)); }
+
+  /**
+   * @brief Virtual interrupt flag
+   *
+   * Virtual image of the IF flag. Used in conjunction with the VIP flag. (To use this flag and the VIP flag the virtual mode
+   * extensions are enabled by setting the VME flag in control register CR4.)
+   */
+  constexpr UINT32 virtual_interrupt_flag() const { return (Flags >> 19) & 0x01U; }
+  constexpr EFLAGS with_virtual_interrupt_flag(UINT32 value) const { return EFLAGS((Flags & ~0x80000U) | ((value & 0x01U) << 19)); }
+
+  /**
+   * @brief Virtual interrupt pending flag
+   *
+   * Set to indicate that an interrupt is pending; clear when no interrupt is pending. (Software sets and clears this flag;
+   * the processor only reads it.) Used in conjunction with the VIF flag.
+   */
+  constexpr UINT32 virtual_interrupt_pending_flag() const { return (Flags >> 20) & 0x01U; }
+  constexpr EFLAGS with_virtual_interrupt_pending_flag(UINT32 value) const { return EFLAGS((Flags & ~0x100000U) | ((value & 0x01U) << 20)); }
+
+  /**
+   * @brief Identification flag
+   *
+   * The ability of a program to set or clear this flag indicates support for the CPUID instruction.
+   */
+  constexpr UINT32 identification_flag() const { return (Flags >> 21) & 0x01U; }
+  constexpr EFLAGS with_identification_flag(UINT32 value) const { return EFLAGS((Flags & ~0x200000U) | ((value & 0x01U) << 21)); }
+
+private:
+  UINT32 Flags = 0;
+};
+static_assert(sizeof(EFLAGS) == 4, "Size of EFLAGS");
+
+enum class Msr : UINT32
+{
+  Ia32P5McAddr                                               = 0x00000000,
+  Ia32P5McType                                               = 0x00000001,
+  Ia32MonitorFilterLineSize                                  = 0x00000006,
+  Ia32TimeStampCounter                                       = 0x00000010,
+  Ia32PlatformId                                             = 0x00000017,
+  Ia32ApicBase                                               = 0x0000001B,
+  Ia32FeatureControl                                         = 0x0000003A,
+  Ia32TscAdjust                                              = 0x0000003B,
+  Ia32BiosUpdateTrigger                                      = 0x00000079,
+  Ia32BiosUpdateSignature                                    = 0x0000008B,
+  Ia32Sgxlepubkeyhash0                                       = 0x0000008C,
+  Ia32Sgxlepubkeyhash1                                       = 0x0000008D,
+  Ia32Sgxlepubkeyhash2                                       = 0x0000008E,
+  Ia32Sgxlepubkeyhash3                                       = 0x0000008F,
+  Ia32SmmMonitorCtl                                          = 0x0000009B,
+  Ia32Smbase                                                 = 0x0000009E,
+  Ia32Pmc0                                                   = 0x000000C1,
+  Ia32Pmc1                                                   = 0x000000C2,
+  Ia32Pmc2                                                   = 0x000000C3,
+  Ia32Pmc3                                                   = 0x000000C4,
+  Ia32Pmc4                                                   = 0x000000C5,
+  Ia32Pmc5                                                   = 0x000000C6,
+  Ia32Pmc6                                                   = 0x000000C7,
+  Ia32Pmc7                                                   = 0x000000C8,
+  Ia32Mperf                                                  = 0x000000E7,
+  Ia32Aperf                                                  = 0x000000E8,
+  Ia32MtrrCapabilities                                       = 0x000000FE,
+  Ia32SysenterCs                                             = 0x00000174,
+  Ia32SysenterEsp                                            = 0x00000175,
+  Ia32SysenterEip                                            = 0x00000176,
+  Ia32McgCap                                                 = 0x00000179,
+  Ia32McgStatus                                              = 0x0000017A,
+  Ia32McgCtl                                                 = 0x0000017B,
+  Ia32Perfevtsel0                                            = 0x00000186,
+  Ia32Perfevtsel1                                            = 0x00000187,
+  Ia32Perfevtsel2                                            = 0x00000188,
+  Ia32Perfevtsel3                                            = 0x00000189,
+  Ia32PerfStatus                                             = 0x00000198,
+  Ia32PerfCtl                                                = 0x00000199,
+  Ia32ClockModulation                                        = 0x0000019A,
+  Ia32ThermInterrupt                                         = 0x0000019B,
+  Ia32ThermStatus                                            = 0x0000019C,
+  Ia32MiscEnable                                             = 0x000001A0,
+  Ia32EnergyPerfBias                                         = 0x000001B0,
+  Ia32PackageThermStatus                                     = 0x000001B1,
+  Ia32PackageThermInterrupt                                  = 0x000001B2,
+  Ia32Debugctl                                               = 0x000001D9,
+  Ia32SmrrPhysbase                                           = 0x000001F2,
+  Ia32SmrrPhysmask                                           = 0x000001F3,
+  Ia32PlatformDcaCap                                         = 0x000001F8,
+  Ia32CpuDcaCap                                              = 0x000001F9,
+  Ia32Dca0Cap                                                = 0x000001FA,
+  Ia32MtrrPhysbase0                                          = 0x00000200,
+  Ia32MtrrPhysbase1                                          = 0x00000202,
+  Ia32MtrrPhysbase2                                          = 0x00000204,
+  Ia32MtrrPhysbase3                                          = 0x00000206,
+  Ia32MtrrPhysbase4                                          = 0x00000208,
+  Ia32MtrrPhysbase5                                          = 0x0000020A,
+  Ia32MtrrPhysbase6                                          = 0x0000020C,
+  Ia32MtrrPhysbase7                                          = 0x0000020E,
+  Ia32MtrrPhysbase8                                          = 0x00000210,
+  Ia32MtrrPhysbase9                                          = 0x00000212,
+  Ia32MtrrPhysmask0                                          = 0x00000201,
+  Ia32MtrrPhysmask1                                          = 0x00000203,
+  Ia32MtrrPhysmask2                                          = 0x00000205,
+  Ia32MtrrPhysmask3                                          = 0x00000207,
+  Ia32MtrrPhysmask4                                          = 0x00000209,
+  Ia32MtrrPhysmask5                                          = 0x0000020B,
+  Ia32MtrrPhysmask6                                          = 0x0000020D,
+  Ia32MtrrPhysmask7                                          = 0x0000020F,
+  Ia32MtrrPhysmask8                                          = 0x00000211,
+  Ia32MtrrPhysmask9                                          = 0x00000213,
+  Ia32MtrrFix64KBase                                         = 0x00000000,
+  Ia32MtrrFix64KSize                                         = 0x00010000,
+  Ia32MtrrFix64K00000                                        = 0x00000250,
+  Ia32MtrrFix16KBase                                         = 0x00080000,
+  Ia32MtrrFix16KSize                                         = 0x00004000,
+  Ia32MtrrFix16K80000                                        = 0x00000258,
+  Ia32MtrrFix16KA0000                                        = 0x00000259,
+  Ia32MtrrFix4KBase                                          = 0x000C0000,
+  Ia32MtrrFix4KSize                                          = 0x00001000,
+  Ia32MtrrFix4KC0000                                         = 0x00000268,
+  Ia32MtrrFix4KC8000                                         = 0x00000269,
+  Ia32MtrrFix4KD0000                                         = 0x0000026A,
+  Ia32MtrrFix4KD8000                                         = 0x0000026B,
+  Ia32MtrrFix4KE0000                                         = 0x0000026C,
+  Ia32MtrrFix4KE8000                                         = 0x0000026D,
+  Ia32MtrrFix4KF0000                                         = 0x0000026E,
+  Ia32MtrrFix4KF8000                                         = 0x0000026F,
+  Ia32MtrrVariableCount                                      = 0x000000FF,
+  Ia32Pat                                                    = 0x00000277,
+  Ia32Mc0Ctl2                                                = 0x00000280,
+  Ia32Mc1Ctl2                                                = 0x00000281,
+  Ia32Mc2Ctl2                                                = 0x00000282,
+  Ia32Mc3Ctl2                                                = 0x00000283,
+  Ia32Mc4Ctl2                                                = 0x00000284,
+  Ia32Mc5Ctl2                                                = 0x00000285,
+  Ia32Mc6Ctl2                                                = 0x00000286,
+  Ia32Mc7Ctl2                                                = 0x00000287,
+  Ia32Mc8Ctl2                                                = 0x00000288,
+  Ia32Mc9Ctl2                                                = 0x00000289,
+  Ia32Mc10Ctl2                                               = 0x0000028A,
+  Ia32Mc11Ctl2                                               = 0x0000028B,
+  Ia32Mc12Ctl2                                               = 0x0000028C,
+  Ia32Mc13Ctl2                                               = 0x0000028D,
+  Ia32Mc14Ctl2                                               = 0x0000028E,
+  Ia32Mc15Ctl2                                               = 0x0000028F,
+  Ia32Mc16Ctl2                                               = 0x00000290,
+  Ia32Mc17Ctl2                                               = 0x00000291,
+  Ia32Mc18Ctl2                                               = 0x00000292,
+  Ia32Mc19Ctl2                                               = 0x00000293,
+  Ia32Mc20Ctl2                                               = 0x00000294,
+  Ia32Mc21Ctl2                                               = 0x00000295,
+  Ia32Mc22Ctl2                                               = 0x00000296,
+  Ia32Mc23Ctl2                                               = 0x00000297,
+  Ia32Mc24Ctl2                                               = 0x00000298,
+  Ia32Mc25Ctl2                                               = 0x00000299,
+  Ia32Mc26Ctl2                                               = 0x0000029A,
+  Ia32Mc27Ctl2                                               = 0x0000029B,
+  Ia32Mc28Ctl2                                               = 0x0000029C,
+  Ia32Mc29Ctl2                                               = 0x0000029D,
+  Ia32Mc30Ctl2                                               = 0x0000029E,
+  Ia32Mc31Ctl2                                               = 0x0000029F,
+  Ia32MtrrDefType                                            = 0x000002FF,
+  Ia32FixedCtr0                                              = 0x00000309,
+  Ia32FixedCtr1                                              = 0x0000030A,
+  Ia32FixedCtr2                                              = 0x0000030B,
+  Ia32PerfCapabilities                                       = 0x00000345,
+  Ia32FixedCtrCtrl                                           = 0x0000038D,
+  Ia32PerfGlobalStatus                                       = 0x0000038E,
+  Ia32PerfGlobalCtrl                                         = 0x0000038F,
+  Ia32PerfGlobalStatusReset                                  = 0x00000390,
+  Ia32PerfGlobalStatusSet                                    = 0x00000391,
+  Ia32PerfGlobalInuse                                        = 0x00000392,
+  Ia32PebsEnable                                             = 0x000003F1,
+  Ia32Mc0Ctl                                                 = 0x00000400,
+  Ia32Mc1Ctl                                                 = 0x00000404,
+  Ia32Mc2Ctl                                                 = 0x00000408,
+  Ia32Mc3Ctl                                                 = 0x0000040C,
+  Ia32Mc4Ctl                                                 = 0x00000410,
+  Ia32Mc5Ctl                                                 = 0x00000414,
+  Ia32Mc6Ctl                                                 = 0x00000418,
+  Ia32Mc7Ctl                                                 = 0x0000041C,
+  Ia32Mc8Ctl                                                 = 0x00000420,
+  Ia32Mc9Ctl                                                 = 0x00000424,
+  Ia32Mc10Ctl                                                = 0x00000428,
+  Ia32Mc11Ctl                                                = 0x0000042C,
+  Ia32Mc12Ctl                                                = 0x00000430,
+  Ia32Mc13Ctl                                                = 0x00000434,
+  Ia32Mc14Ctl                                                = 0x00000438,
+  Ia32Mc15Ctl                                                = 0x0000043C,
+  Ia32Mc16Ctl                                                = 0x00000440,
+  Ia32Mc17Ctl                                                = 0x00000444,
+  Ia32Mc18Ctl                                                = 0x00000448,
+  Ia32Mc19Ctl                                                = 0x0000044C,
+  Ia32Mc20Ctl                                                = 0x00000450,
+  Ia32Mc21Ctl                                                = 0x00000454,
+  Ia32Mc22Ctl                                                = 0x00000458,
+  Ia32Mc23Ctl                                                = 0x0000045C,
+  Ia32Mc24Ctl                                                = 0x00000460,
+  Ia32Mc25Ctl                                                = 0x00000464,
+  Ia32Mc26Ctl                                                = 0x00000468,
+  Ia32Mc27Ctl                                                = 0x0000046C,
+  Ia32Mc28Ctl                                                = 0x00000470,
+  Ia32Mc0Status                                              = 0x00000401,
+  Ia32Mc1Status                                              = 0x00000405,
+  Ia32Mc2Status                                              = 0x00000409,
+  Ia32Mc3Status                                              = 0x0000040D,
+  Ia32Mc4Status                                              = 0x00000411,
+  Ia32Mc5Status                                              = 0x00000415,
+  Ia32Mc6Status                                              = 0x00000419,
+  Ia32Mc7Status                                              = 0x0000041D,
+  Ia32Mc8Status                                              = 0x00000421,
+  Ia32Mc9Status                                              = 0x00000425,
+  Ia32Mc10Status                                             = 0x00000429,
+  Ia32Mc11Status                                             = 0x0000042D,
+  Ia32Mc12Status                                             = 0x00000431,
+  Ia32Mc13Status                                             = 0x00000435,
+  Ia32Mc14Status                                             = 0x00000439,
+  Ia32Mc15Status                                             = 0x0000043D,
+  Ia32Mc16Status                                             = 0x00000441,
+  Ia32Mc17Status                                             = 0x00000445,
+  Ia32Mc18Status                                             = 0x00000449,
+  Ia32Mc19Status                                             = 0x0000044D,
+  Ia32Mc20Status                                             = 0x00000451,
+  Ia32Mc21Status                                             = 0x00000455,
+  Ia32Mc22Status                                             = 0x00000459,
+  Ia32Mc23Status                                             = 0x0000045D,
+  Ia32Mc24Status                                             = 0x00000461,
+  Ia32Mc25Status                                             = 0x00000465,
+  Ia32Mc26Status                                             = 0x00000469,
+  Ia32Mc27Status                                             = 0x0000046D,
+  Ia32Mc28Status                                             = 0x00000471,
+  Ia32Mc0Addr                                                = 0x00000402,
+  Ia32Mc1Addr                                                = 0x00000406,
+  Ia32Mc2Addr                                                = 0x0000040A,
+  Ia32Mc3Addr                                                = 0x0000040E,
+  Ia32Mc4Addr                                                = 0x00000412,
+  Ia32Mc5Addr                                                = 0x00000416,
+  Ia32Mc6Addr                                                = 0x0000041A,
+  Ia32Mc7Addr                                                = 0x0000041E,
+  Ia32Mc8Addr                                                = 0x00000422,
+  Ia32Mc9Addr                                                = 0x00000426,
+  Ia32Mc10Addr                                               = 0x0000042A,
+  Ia32Mc11Addr                                               = 0x0000042E,
+  Ia32Mc12Addr                                               = 0x00000432,
+  Ia32Mc13Addr                                               = 0x00000436,
+  Ia32Mc14Addr                                               = 0x0000043A,
+  Ia32Mc15Addr                                               = 0x0000043E,
+  Ia32Mc16Addr                                               = 0x00000442,
+  Ia32Mc17Addr                                               = 0x00000446,
+  Ia32Mc18Addr                                               = 0x0000044A,
+  Ia32Mc19Addr                                               = 0x0000044E,
+  Ia32Mc20Addr                                               = 0x00000452,
+  Ia32Mc21Addr                                               = 0x00000456,
+  Ia32Mc22Addr                                               = 0x0000045A,
+  Ia32Mc23Addr                                               = 0x0000045E,
+  Ia32Mc24Addr                                               = 0x00000462,
+  Ia32Mc25Addr                                               = 0x00000466,
+  Ia32Mc26Addr                                               = 0x0000046A,
+  Ia32Mc27Addr                                               = 0x0000046E,
+  Ia32Mc28Addr                                               = 0x00000472,
+  Ia32Mc0Misc                                                = 0x00000403,
+  Ia32Mc1Misc                                                = 0x00000407,
+  Ia32Mc2Misc                                                = 0x0000040B,
+  Ia32Mc3Misc                                                = 0x0000040F,
+  Ia32Mc4Misc                                                = 0x00000413,
+  Ia32Mc5Misc                                                = 0x00000417,
+  Ia32Mc6Misc                                                = 0x0000041B,
+  Ia32Mc7Misc                                                = 0x0000041F,
+  Ia32Mc8Misc                                                = 0x00000423,
+  Ia32Mc9Misc                                                = 0x00000427,
+  Ia32Mc10Misc                                               = 0x0000042B,
+  Ia32Mc11Misc                                               = 0x0000042F,
+  Ia32Mc12Misc                                               = 0x00000433,
+  Ia32Mc13Misc                                               = 0x00000437,
+  Ia32Mc14Misc                                               = 0x0000043B,
+  Ia32Mc15Misc                                               = 0x0000043F,
+  Ia32Mc16Misc                                               = 0x00000443,
+  Ia32Mc17Misc                                               = 0x00000447,
+  Ia32Mc18Misc                                               = 0x0000044B,
+  Ia32Mc19Misc                                               = 0x0000044F,
+  Ia32Mc20Misc                                               = 0x00000453,
+  Ia32Mc21Misc                                               = 0x00000457,
+  Ia32Mc22Misc                                               = 0x0000045B,
+  Ia32Mc23Misc                                               = 0x0000045F,
+  Ia32Mc24Misc                                               = 0x00000463,
+  Ia32Mc25Misc                                               = 0x00000467,
+  Ia32Mc26Misc                                               = 0x0000046B,
+  Ia32Mc27Misc                                               = 0x0000046F,
+  Ia32Mc28Misc                                               = 0x00000473,
+  Ia32VmxBasic                                               = 0x00000480,
+  Ia32VmxPinbasedCtls                                        = 0x00000481,
+  Ia32VmxProcbasedCtls                                       = 0x00000482,
+  Ia32VmxExitCtls                                            = 0x00000483,
+  Ia32VmxEntryCtls                                           = 0x00000484,
+  Ia32VmxMisc                                                = 0x00000485,
+  Ia32VmxCr0Fixed0                                           = 0x00000486,
+  Ia32VmxCr0Fixed1                                           = 0x00000487,
+  Ia32VmxCr4Fixed0                                           = 0x00000488,
+  Ia32VmxCr4Fixed1                                           = 0x00000489,
+  Ia32VmxVmcsEnum                                            = 0x0000048A,
+  Ia32VmxProcbasedCtls2                                      = 0x0000048B,
+  Ia32VmxEptVpidCap                                          = 0x0000048C,
+  Ia32VmxTruePinbasedCtls                                    = 0x0000048D,
+  Ia32VmxTrueProcbasedCtls                                   = 0x0000048E,
+  Ia32VmxTrueExitCtls                                        = 0x0000048F,
+  Ia32VmxTrueEntryCtls                                       = 0x00000490,
+  Ia32VmxVmfunc                                              = 0x00000491,
+  Ia32APmc0                                                  = 0x000004C1,
+  Ia32APmc1                                                  = 0x000004C2,
+  Ia32APmc2                                                  = 0x000004C3,
+  Ia32APmc3                                                  = 0x000004C4,
+  Ia32APmc4                                                  = 0x000004C5,
+  Ia32APmc5                                                  = 0x000004C6,
+  Ia32APmc6                                                  = 0x000004C7,
+  Ia32APmc7                                                  = 0x000004C8,
+  Ia32McgExtCtl                                              = 0x000004D0,
+  Ia32SgxSvnStatus                                           = 0x00000500,
+  Ia32RtitOutputBase                                         = 0x00000560,
+  Ia32RtitOutputMaskPtrs                                     = 0x00000561,
+  Ia32RtitCtl                                                = 0x00000570,
+  Ia32RtitStatus                                             = 0x00000571,
+  Ia32RtitCr3Match                                           = 0x00000572,
+  Ia32RtitAddr0A                                             = 0x00000580,
+  Ia32RtitAddr1A                                             = 0x00000582,
+  Ia32RtitAddr2A                                             = 0x00000584,
+  Ia32RtitAddr3A                                             = 0x00000586,
+  Ia32RtitAddr0B                                             = 0x00000581,
+  Ia32RtitAddr1B                                             = 0x00000583,
+  Ia32RtitAddr2B                                             = 0x00000585,
+  Ia32RtitAddr3B                                             = 0x00000587,
+  Ia32DsArea                                                 = 0x00000600,
+  Ia32TscDeadline                                            = 0x000006E0,
+  Ia32PmEnable                                               = 0x00000770,
+  Ia32HwpCapabilities                                        = 0x00000771,
+  Ia32HwpRequestPkg                                          = 0x00000772,
+  Ia32HwpInterrupt                                           = 0x00000773,
+  Ia32HwpRequest                                             = 0x00000774,
+  Ia32HwpStatus                                              = 0x00000777,
+  Ia32X2ApicApicid                                           = 0x00000802,
+  Ia32X2ApicVersion                                          = 0x00000803,
+  Ia32X2ApicTpr                                              = 0x00000808,
+  Ia32X2ApicPpr                                              = 0x0000080A,
+  Ia32X2ApicEoi                                              = 0x0000080B,
+  Ia32X2ApicLdr                                              = 0x0000080D,
+  Ia32X2ApicSivr                                             = 0x0000080F,
+  Ia32X2ApicIsr0                                             = 0x00000810,
+  Ia32X2ApicIsr1                                             = 0x00000811,
+  Ia32X2ApicIsr2                                             = 0x00000812,
+  Ia32X2ApicIsr3                                             = 0x00000813,
+  Ia32X2ApicIsr4                                             = 0x00000814,
+  Ia32X2ApicIsr5                                             = 0x00000815,
+  Ia32X2ApicIsr6                                             = 0x00000816,
+  Ia32X2ApicIsr7                                             = 0x00000817,
+  Ia32X2ApicTmr0                                             = 0x00000818,
+  Ia32X2ApicTmr1                                             = 0x00000819,
+  Ia32X2ApicTmr2                                             = 0x0000081A,
+  Ia32X2ApicTmr3                                             = 0x0000081B,
+  Ia32X2ApicTmr4                                             = 0x0000081C,
+  Ia32X2ApicTmr5                                             = 0x0000081D,
+  Ia32X2ApicTmr6                                             = 0x0000081E,
+  Ia32X2ApicTmr7                                             = 0x0000081F,
+  Ia32X2ApicIrr0                                             = 0x00000820,
+  Ia32X2ApicIrr1                                             = 0x00000821,
+  Ia32X2ApicIrr2                                             = 0x00000822,
+  Ia32X2ApicIrr3                                             = 0x00000823,
+  Ia32X2ApicIrr4                                             = 0x00000824,
+  Ia32X2ApicIrr5                                             = 0x00000825,
+  Ia32X2ApicIrr6                                             = 0x00000826,
+  Ia32X2ApicIrr7                                             = 0x00000827,
+  Ia32X2ApicEsr                                              = 0x00000828,
+  Ia32X2ApicLvtCmci                                          = 0x0000082F,
+  Ia32X2ApicIcr                                              = 0x00000830,
+  Ia32X2ApicLvtTimer                                         = 0x00000832,
+  Ia32X2ApicLvtThermal                                       = 0x00000833,
+  Ia32X2ApicLvtPmi                                           = 0x00000834,
+  Ia32X2ApicLvtLint0                                         = 0x00000835,
+  Ia32X2ApicLvtLint1                                         = 0x00000836,
+  Ia32X2ApicLvtError                                         = 0x00000837,
+  Ia32X2ApicInitCount                                        = 0x00000838,
+  Ia32X2ApicCurCount                                         = 0x00000839,
+  Ia32X2ApicDivConf                                          = 0x0000083E,
+  Ia32X2ApicSelfIpi                                          = 0x0000083F,
+  Ia32DebugInterface                                         = 0x00000C80,
+  Ia32L3QosCfg                                               = 0x00000C81,
+  Ia32L2QosCfg                                               = 0x00000C82,
+  Ia32QmEvtsel                                               = 0x00000C8D,
+  Ia32QmCtr                                                  = 0x00000C8E,
+  Ia32PqrAssoc                                               = 0x00000C8F,
+  Ia32Bndcfgs                                                = 0x00000D90,
+  Ia32Xss                                                    = 0x00000DA0,
+  Ia32PkgHdcCtl                                              = 0x00000DB0,
+  Ia32PmCtl1                                                 = 0x00000DB1,
+  Ia32ThreadStall                                            = 0x00000DB2,
+  Ia32Efer                                                   = 0xC0000080,
+  Ia32Star                                                   = 0xC0000081,
+  Ia32Lstar                                                  = 0xC0000082,
+  Ia32Cstar                                                  = 0xC0000083,
+  Ia32Fmask                                                  = 0xC0000084,
+  Ia32FsBase                                                 = 0xC0000100,
+  Ia32GsBase                                                 = 0xC0000101,
+  Ia32KernelGsBase                                           = 0xC0000102,
+  Ia32TscAux                                                 = 0xC0000103,
+};
+
+enum class VmcsField : UINT32
+{
+  VmcsCtrlVirtualProcessorIdentifier                         = 0x00000000,
+  VmcsCtrlPostedInterruptNotificationVector                  = 0x00000002,
+  VmcsCtrlEptpIndex                                          = 0x00000004,
+  VmcsGuestEsSelector                                        = 0x00000800,
+  VmcsGuestCsSelector                                        = 0x00000802,
+  VmcsGuestSsSelector                                        = 0x00000804,
+  VmcsGuestDsSelector                                        = 0x00000806,
+  VmcsGuestFsSelector                                        = 0x00000808,
+  VmcsGuestGsSelector                                        = 0x0000080A,
+  VmcsGuestLdtrSelector                                      = 0x0000080C,
+  VmcsGuestTrSelector                                        = 0x0000080E,
+  VmcsGuestInterruptStatus                                   = 0x00000810,
+  VmcsGuestPmlIndex                                          = 0x00000812,
+  VmcsHostEsSelector                                         = 0x00000C00,
+  VmcsHostCsSelector                                         = 0x00000C02,
+  VmcsHostSsSelector                                         = 0x00000C04,
+  VmcsHostDsSelector                                         = 0x00000C06,
+  VmcsHostFsSelector                                         = 0x00000C08,
+  VmcsHostGsSelector                                         = 0x00000C0A,
+  VmcsHostTrSelector                                         = 0x00000C0C,
+  VmcsCtrlIoBitmapAAddress                                   = 0x00002000,
+  VmcsCtrlIoBitmapBAddress                                   = 0x00002002,
+  VmcsCtrlMsrBitmapAddress                                   = 0x00002004,
+  VmcsCtrlVmexitMsrStoreAddress                              = 0x00002006,
+  VmcsCtrlVmexitMsrLoadAddress                               = 0x00002008,
+  VmcsCtrlVmentryMsrLoadAddress                              = 0x0000200A,
+  VmcsCtrlExecutiveVmcsPointer                               = 0x0000200C,
+  VmcsCtrlPmlAddress                                         = 0x0000200E,
+  VmcsCtrlTscOffset                                          = 0x00002010,
+  VmcsCtrlVirtualApicAddress                                 = 0x00002012,
+  VmcsCtrlApicAccessAddress                                  = 0x00002014,
+  VmcsCtrlPostedInterruptDescriptorAddress                   = 0x00002016,
+  VmcsCtrlVmfuncControls                                     = 0x00002018,
+  VmcsCtrlEptPointer                                         = 0x0000201A,
+  VmcsCtrlEoiExitBitmap0                                     = 0x0000201C,
+  VmcsCtrlEoiExitBitmap1                                     = 0x0000201E,
+  VmcsCtrlEoiExitBitmap2                                     = 0x00002020,
+  VmcsCtrlEoiExitBitmap3                                     = 0x00002022,
+  VmcsCtrlEptPointerListAddress                              = 0x00002024,
+  VmcsCtrlVmreadBitmapAddress                                = 0x00002026,
+  VmcsCtrlVmwriteBitmapAddress                               = 0x00002028,
+  VmcsCtrlVirtualizationExceptionInformationAddress          = 0x0000202A,
+  VmcsCtrlXssExitingBitmap                                   = 0x0000202C,
+  VmcsCtrlEnclsExitingBitmap                                 = 0x0000202E,
+  VmcsCtrlTscMultiplier                                      = 0x00002032,
+  VmcsGuestPhysicalAddress                                   = 0x00002400,
+  VmcsGuestVmcsLinkPointer                                   = 0x00002800,
+  VmcsGuestDebugctl                                          = 0x00002802,
+  VmcsGuestPat                                               = 0x00002804,
+  VmcsGuestEfer                                              = 0x00002806,
+  VmcsGuestPerfGlobalCtrl                                    = 0x00002808,
+  VmcsGuestPdpte0                                            = 0x0000280A,
+  VmcsGuestPdpte1                                            = 0x0000280C,
+  VmcsGuestPdpte2                                            = 0x0000280E,
+  VmcsGuestPdpte3                                            = 0x00002810,
+  VmcsHostPat                                                = 0x00002C00,
+  VmcsHostEfer                                               = 0x00002C02,
+  VmcsHostPerfGlobalCtrl                                     = 0x00002C04,
+  VmcsCtrlPinBasedVmExecutionControls                        = 0x00004000,
+  VmcsCtrlProcessorBasedVmExecutionControls                  = 0x00004002,
+  VmcsCtrlExceptionBitmap                                    = 0x00004004,
+  VmcsCtrlPagefaultErrorCodeMask                             = 0x00004006,
+  VmcsCtrlPagefaultErrorCodeMatch                            = 0x00004008,
+  VmcsCtrlCr3TargetCount                                     = 0x0000400A,
+  VmcsCtrlVmexitControls                                     = 0x0000400C,
+  VmcsCtrlVmexitMsrStoreCount                                = 0x0000400E,
+  VmcsCtrlVmexitMsrLoadCount                                 = 0x00004010,
+  VmcsCtrlVmentryControls                                    = 0x00004012,
+  VmcsCtrlVmentryMsrLoadCount                                = 0x00004014,
+  VmcsCtrlVmentryInterruptionInformationField                = 0x00004016,
+  VmcsCtrlVmentryExceptionErrorCode                          = 0x00004018,
+  VmcsCtrlVmentryInstructionLength                           = 0x0000401A,
+  VmcsCtrlTprThreshold                                       = 0x0000401C,
+  VmcsCtrlSecondaryProcessorBasedVmExecutionControls         = 0x0000401E,
+  VmcsCtrlPleGap                                             = 0x00004020,
+  VmcsCtrlPleWindow                                          = 0x00004022,
+  VmcsVmInstructionError                                     = 0x00004400,
+  VmcsExitReason                                             = 0x00004402,
+  VmcsVmexitInterruptionInformation                          = 0x00004404,
+  VmcsVmexitInterruptionErrorCode                            = 0x00004406,
+  VmcsIdtVectoringInformation                                = 0x00004408,
+  VmcsIdtVectoringErrorCode                                  = 0x0000440A,
+  VmcsVmexitInstructionLength                                = 0x0000440C,
+  VmcsVmexitInstructionInfo                                  = 0x0000440E,
+  VmcsGuestEsLimit                                           = 0x00004800,
+  VmcsGuestCsLimit                                           = 0x00004802,
+  VmcsGuestSsLimit                                           = 0x00004804,
+  VmcsGuestDsLimit                                           = 0x00004806,
+  VmcsGuestFsLimit                                           = 0x00004808,
+  VmcsGuestGsLimit                                           = 0x0000480A,
+  VmcsGuestLdtrLimit                                         = 0x0000480C,
+  VmcsGuestTrLimit                                           = 0x0000480E,
+  VmcsGuestGdtrLimit                                         = 0x00004810,
+  VmcsGuestIdtrLimit                                         = 0x00004812,
+  VmcsGuestEsAccessRights                                    = 0x00004814,
+  VmcsGuestCsAccessRights                                    = 0x00004816,
+  VmcsGuestSsAccessRights                                    = 0x00004818,
+  VmcsGuestDsAccessRights                                    = 0x0000481A,
+  VmcsGuestFsAccessRights                                    = 0x0000481C,
+  VmcsGuestGsAccessRights                                    = 0x0000481E,
+  VmcsGuestLdtrAccessRights                                  = 0x00004820,
+  VmcsGuestTrAccessRights                                    = 0x00004822,
+  VmcsGuestInterruptibilityState                             = 0x00004824,
+  VmcsGuestActivityState                                     = 0x00004826,
+  VmcsGuestSmbase                                            = 0x00004828,
+  VmcsGuestSysenterCs                                        = 0x0000482A,
+  VmcsGuestVmxPreemptionTimerValue                           = 0x0000482E,
+  VmcsSysenterCs                                             = 0x00004C00,
+  VmcsCtrlCr0GuestHostMask                                   = 0x00006000,
+  VmcsCtrlCr4GuestHostMask                                   = 0x00006002,
+  VmcsCtrlCr0ReadShadow                                      = 0x00006004,
+  VmcsCtrlCr4ReadShadow                                      = 0x00006006,
+  VmcsCtrlCr3TargetValue0                                    = 0x00006008,
+  VmcsCtrlCr3TargetValue1                                    = 0x0000600A,
+  VmcsCtrlCr3TargetValue2                                    = 0x0000600C,
+  VmcsCtrlCr3TargetValue3                                    = 0x0000600E,
+  VmcsExitQualification                                      = 0x00006400,
+  VmcsIoRcx                                                  = 0x00006402,
+  VmcsIoRsx                                                  = 0x00006404,
+  VmcsIoRdi                                                  = 0x00006406,
+  VmcsIoRip                                                  = 0x00006408,
+  VmcsExitGuestLinearAddress                                 = 0x0000640A,
+  VmcsGuestCr0                                               = 0x00006800,
+  VmcsGuestCr3                                               = 0x00006802,
+  VmcsGuestCr4                                               = 0x00006804,
+  VmcsGuestEsBase                                            = 0x00006806,
+  VmcsGuestCsBase                                            = 0x00006808,
+  VmcsGuestSsBase                                            = 0x0000680A,
+  VmcsGuestDsBase                                            = 0x0000680C,
+  VmcsGuestFsBase                                            = 0x0000680E,
+  VmcsGuestGsBase                                            = 0x00006810,
+  VmcsGuestLdtrBase                                          = 0x00006812,
+  VmcsGuestTrBase                                            = 0x00006814,
+  VmcsGuestGdtrBase                                          = 0x00006816,
+  VmcsGuestIdtrBase                                          = 0x00006818,
+  VmcsGuestDr7                                               = 0x0000681A,
+  VmcsGuestRsp                                               = 0x0000681C,
+  VmcsGuestRip                                               = 0x0000681E,
+  VmcsGuestRflags                                            = 0x00006820,
+  VmcsGuestPendingDebugExceptions                            = 0x00006822,
+  VmcsGuestSysenterEsp                                       = 0x00006824,
+  VmcsGuestSysenterEip                                       = 0x00006826,
+  VmcsHostCr0                                                = 0x00006C00,
+  VmcsHostCr3                                                = 0x00006C02,
+  VmcsHostCr4                                                = 0x00006C04,
+  VmcsHostFsBase                                             = 0x00006C06,
+  VmcsHostGsBase                                             = 0x00006C08,
+  VmcsHostTrBase                                             = 0x00006C0A,
+  VmcsHostGdtrBase                                           = 0x00006C0C,
+  VmcsHostIdtrBase                                           = 0x00006C0E,
+  VmcsHostSysenterEsp                                        = 0x00006C10,
+  VmcsHostSysenterEip                                        = 0x00006C12,
+  VmcsHostRsp                                                = 0x00006C14,
+  VmcsHostRip                                                = 0x00006C16,
+};
+
+/**
+ * @brief Type of the MSR - class of its register, when its layout is described.
+ */
+template <Msr Register>
+struct MsrTraits { using Type = UINT64; };
+
+template <> struct MsrTraits<Msr::Ia32PlatformId> { using Type = IA32_PLATFORM_ID_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32ApicBase> { using Type = IA32_APIC_BASE_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32FeatureControl> { using Type = IA32_FEATURE_CONTROL_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32SmmMonitorCtl> { using Type = IA32_SMM_MONITOR_CTL_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32MtrrCapabilities> { using Type = IA32_MTRR_CAPABILITIES_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32McgCap> { using Type = IA32_MCG_CAP_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32McgStatus> { using Type = IA32_MCG_STATUS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32PerfCtl> { using Type = IA32_PERF_CTL_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32ClockModulation> { using Type = IA32_CLOCK_MODULATION_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32ThermInterrupt> { using Type = IA32_THERM_INTERRUPT_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32ThermStatus> { using Type = IA32_THERM_STATUS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32MiscEnable> { using Type = IA32_MISC_ENABLE_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32EnergyPerfBias> { using Type = IA32_ENERGY_PERF_BIAS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32PackageThermStatus> { using Type = IA32_PACKAGE_THERM_STATUS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32PackageThermInterrupt> { using Type = IA32_PACKAGE_THERM_INTERRUPT_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32Debugctl> { using Type = IA32_DEBUGCTL_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32SmrrPhysbase> { using Type = IA32_SMRR_PHYSBASE_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32SmrrPhysmask> { using Type = IA32_SMRR_PHYSMASK_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32Dca0Cap> { using Type = IA32_DCA_0_CAP_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32Pat> { using Type = IA32_PAT_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32MtrrDefType> { using Type = IA32_MTRR_DEF_TYPE_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32PerfCapabilities> { using Type = IA32_PERF_CAPABILITIES_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32FixedCtrCtrl> { using Type = IA32_FIXED_CTR_CTRL_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32PerfGlobalStatus> { using Type = IA32_PERF_GLOBAL_STATUS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32PerfGlobalStatusReset> { using Type = IA32_PERF_GLOBAL_STATUS_RESET_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32PerfGlobalStatusSet> { using Type = IA32_PERF_GLOBAL_STATUS_SET_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32PerfGlobalInuse> { using Type = IA32_PERF_GLOBAL_INUSE_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32PebsEnable> { using Type = IA32_PEBS_ENABLE_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32VmxBasic> { using Type = IA32_VMX_BASIC_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32VmxPinbasedCtls> { using Type = IA32_VMX_PINBASED_CTLS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32VmxProcbasedCtls> { using Type = IA32_VMX_PROCBASED_CTLS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32VmxExitCtls> { using Type = IA32_VMX_EXIT_CTLS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32VmxEntryCtls> { using Type = IA32_VMX_ENTRY_CTLS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32VmxMisc> { using Type = IA32_VMX_MISC_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32VmxVmcsEnum> { using Type = IA32_VMX_VMCS_ENUM_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32VmxProcbasedCtls2> { using Type = IA32_VMX_PROCBASED_CTLS2_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32VmxEptVpidCap> { using Type = IA32_VMX_EPT_VPID_CAP_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32VmxVmfunc> { using Type = IA32_VMX_VMFUNC_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32McgExtCtl> { using Type = IA32_MCG_EXT_CTL_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32SgxSvnStatus> { using Type = IA32_SGX_SVN_STATUS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32RtitOutputBase> { using Type = IA32_RTIT_OUTPUT_BASE_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32RtitOutputMaskPtrs> { using Type = IA32_RTIT_OUTPUT_MASK_PTRS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32RtitCtl> { using Type = IA32_RTIT_CTL_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32RtitStatus> { using Type = IA32_RTIT_STATUS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32RtitCr3Match> { using Type = IA32_RTIT_CR3_MATCH_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32PmEnable> { using Type = IA32_PM_ENABLE_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32HwpCapabilities> { using Type = IA32_HWP_CAPABILITIES_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32HwpRequestPkg> { using Type = IA32_HWP_REQUEST_PKG_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32HwpInterrupt> { using Type = IA32_HWP_INTERRUPT_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32HwpRequest> { using Type = IA32_HWP_REQUEST_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32HwpStatus> { using Type = IA32_HWP_STATUS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32DebugInterface> { using Type = IA32_DEBUG_INTERFACE_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32L3QosCfg> { using Type = IA32_L3_QOS_CFG_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32L2QosCfg> { using Type = IA32_L2_QOS_CFG_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32QmEvtsel> { using Type = IA32_QM_EVTSEL_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32QmCtr> { using Type = IA32_QM_CTR_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32PqrAssoc> { using Type = IA32_PQR_ASSOC_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32Bndcfgs> { using Type = IA32_BNDCFGS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32Xss> { using Type = IA32_XSS_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32PkgHdcCtl> { using Type = IA32_PKG_HDC_CTL_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32PmCtl1> { using Type = IA32_PM_CTL1_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32Efer> { using Type = IA32_EFER_REGISTER; };
+template <> struct MsrTraits<Msr::Ia32TscAux> { using Type = IA32_TSC_AUX_REGISTER; };
+
+template <Msr Register>
+using MsrType = typename MsrTraits<Register>::Type;
+
+/**
+ * @brief Type of the VMCS field - by its width (bits 13-14 of the encoding: 16-bit, 64-bit,
+ *        32-bit or natural-width).
+ */
+template <VmcsField Field>
+using VmcsFieldType =
+  std::conditional_t<((static_cast<UINT32>(Field) >> 13) & 3) == 0, UINT16,
+  std::conditional_t<((static_cast<UINT32>(Field) >> 13) & 3) == 2, UINT32, UINT64>>;
+
+}
@@ -0,0 +1,586 @@
+/** @file */
+#pragma once
+#include "ia32.h"
+
+#define IA32_DECODE_ENTRY_COUNT                                      512
+#define IA32_DECODE_BITMAP_SIZE                                      (512 / 64)
+
+#define IA32_DECODE_SCALAR                                           0
+#define IA32_DECODE_AVX2                                             1
+#define IA32_DECODE_AVX512                                           2
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#  define IA32_DECODE_X86
+#  include <immintrin.h>
+#  if defined(_MSC_VER) && !defined(__clang__)
+#    include <intrin.h>
+#    define IA32_DECODE_TARGET(name)
+#  else
+#    define IA32_DECODE_TARGET(name) __attribute__((target(name)))
+#  endif
+#endif
+
+/**
+ * @brief Returns the widest decoder supported by the CPU and the OS (IA32_DECODE_*).
+ *
+ * @remarks Threads racing the first call detect the same value - the cached level is read and
+ *          written atomically (relaxed __atomic builtins, aligned volatile long on MSVC).
+ */
+static inline int ia32_decode_level(void)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  static volatile long level = -1;
+  int result = (int)level;
+#else
+  static int level = -1;
+  int result = __atomic_load_n(&level, __ATOMIC_RELAXED);
+#endif
+
+  if (result < 0)
+  {
+#if defined(IA32_DECODE_X86) && defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    UINT64 xcr0 = 0;
+
+    __cpuid(info, 1);
+
+    if ((info[2] & (1 << 27)) && (info[2] & (1 << 28)))
+    {
+      xcr0 = _xgetbv(0);
+    }
+
+    __cpuidex(info, 7, 0);
+
+    if ((xcr0 & 0xE6) == 0xE6 && (info[1] & (1 << 16)))
+      result = IA32_DECODE_AVX512;
+    else if ((xcr0 & 0x06) == 0x06 && (info[1] & (1 << 5)))
+      result = IA32_DECODE_AVX2;
+    else
+      result = IA32_DECODE_SCALAR;
+#elif defined(IA32_DECODE_X86)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f"))
+      result = IA32_DECODE_AVX512;
+    else if (__builtin_cpu_supports("avx2"))
+      result = IA32_DECODE_AVX2;
+    else
+      result = IA32_DECODE_SCALAR;
+#else
+    result = IA32_DECODE_SCALAR;
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    level = result;
+#else
+    __atomic_store_n(&level, result, __ATOMIC_RELAXED);
+#endif
+  }
+
+  return result;
+}
+
+/**
+ * @brief Columns of the decoded PML4E table.
+ */
+typedef struct
+{
+  UINT64 Present[IA32_DECODE_BITMAP_SIZE];
+  UINT64 Write[IA32_DECODE_BITMAP_SIZE];
+  UINT64 PageFrameNumber[IA32_DECODE_ENTRY_COUNT];
+  UINT64 ExecuteDisable[IA32_DECODE_BITMAP_SIZE];
+} PML4E_COLUMNS;
+
+static inline void ia32_decode_pml4e_scalar(const UINT64* entries, PML4E_COLUMNS* columns)
+{
+  UINT32 i;
+  UINT32 j;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i += 64)
+  {
+    UINT64 present = 0;
+    UINT64 write = 0;
+    UINT64 execute_disable = 0;
+
+    for (j = 0; j < 64; j += 1)
+    {
+      UINT64 entry = entries[i + j];
+
+      present |= ((entry >> 0) & 0x01) << j;
+      write |= ((entry >> 1) & 0x01) << j;
+      columns->PageFrameNumber[i + j] = (entry >> 12) & 0xFFFFFFFFFULL;
+      execute_disable |= ((entry >> 63) & 0x01) << j;
+    }
+
+    columns->Present[i / 64] = present;
+    columns->Write[i / 64] = write;
+    columns->ExecuteDisable[i / 64] = execute_disable;
+  }
+}
+
+#ifdef IA32_DECODE_X86
+
+IA32_DECODE_TARGET("avx2")
+static inline void ia32_decode_pml4e_avx2(const UINT64* entries, PML4E_COLUMNS* columns)
+{
+  UINT32 i;
+  UINT32 j;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i += 64)
+  {
+    UINT64 present = 0;
+    UINT64 write = 0;
+    UINT64 execute_disable = 0;
+
+    for (j = 0; j < 64; j += 4)
+    {
+      __m256i entry = _mm256_loadu_si256((const __m256i*)(entries + i + j));
+
+      present |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_slli_epi64(entry, 63))) << j;
+      write |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_slli_epi64(entry, 62))) << j;
+      _mm256_storeu_si256((__m256i*)(columns->PageFrameNumber + i + j),
+                          _mm256_and_si256(_mm256_srli_epi64(entry, 12), _mm256_set1_epi64x((long long)0xFFFFFFFFFULL)));
+      execute_disable |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(entry)) << j;
+    }
+
+    columns->Present[i / 64] = present;
+    columns->Write[i / 64] = write;
+    columns->ExecuteDisable[i / 64] = execute_disable;
+  }
+}
+
+IA32_DECODE_TARGET("avx512f")
+static inline void ia32_decode_pml4e_avx512(const UINT64* entries, PML4E_COLUMNS* columns)
+{
+  UINT32 i;
+  UINT32 j;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i += 64)
+  {
+    UINT64 present = 0;
+    UINT64 write = 0;
+    UINT64 execute_disable = 0;
+
+    for (j = 0; j < 64; j += 8)
+    {
+      __m512i entry = _mm512_loadu_si512((const void*)(entries + i + j));
+
+      present |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x01ULL)) << j;
+      write |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x02ULL)) << j;
+      _mm512_storeu_si512((void*)(columns->PageFrameNumber + i + j),
+                          _mm512_and_si512(_mm512_maskz_srli_epi64(0xFF, entry, 12), _mm512_set1_epi64((long long)0xFFFFFFFFFULL)));
+      execute_disable |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x8000000000000000ULL)) << j;
+    }
+
+    columns->Present[i / 64] = present;
+    columns->Write[i / 64] = write;
+    columns->ExecuteDisable[i / 64] = execute_disable;
+  }
+}
+
+#endif
+
+/**
+ * @brief Decodes 512 entries of PML4E table into columns - by the widest decoder supported by the CPU.
+ */
+static inline void ia32_decode_pml4e(const UINT64* entries, PML4E_COLUMNS* columns)
+{
+#ifdef IA32_DECODE_X86
+  switch (ia32_decode_level())
+  {
+    case IA32_DECODE_AVX512:
+      ia32_decode_pml4e_avx512(entries, columns);
+      return;
+
+    case IA32_DECODE_AVX2:
+      ia32_decode_pml4e_avx2(entries, columns);
+      return;
+  }
+#endif
+
+  ia32_decode_pml4e_scalar(entries, columns);
+}
+
+/**
+ * @brief Columns of the decoded PDPTE table.
+ */
+typedef struct
+{
+  UINT64 Present[IA32_DECODE_BITMAP_SIZE];
+  UINT64 Write[IA32_DECODE_BITMAP_SIZE];
+  UINT64 LargePage[IA32_DECODE_BITMAP_SIZE];
+  UINT64 PageFrameNumber[IA32_DECODE_ENTRY_COUNT];
+  UINT64 ExecuteDisable[IA32_DECODE_BITMAP_SIZE];
+} PDPTE_COLUMNS;
+
+static inline void ia32_decode_pdpte_scalar(const UINT64* entries, PDPTE_COLUMNS* columns)
+{
+  UINT32 i;
+  UINT32 j;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i += 64)
+  {
+    UINT64 present = 0;
+    UINT64 write = 0;
+    UINT64 large_page = 0;
+    UINT64 execute_disable = 0;
+
+    for (j = 0; j < 64; j += 1)
+    {
+      UINT64 entry = entries[i + j];
+
+      present |= ((entry >> 0) & 0x01) << j;
+      write |= ((entry >> 1) & 0x01) << j;
+      large_page |= ((entry >> 7) & 0x01) << j;
+      columns->PageFrameNumber[i + j] = (entry >> 12) & 0xFFFFFFFFFULL;
+      execute_disable |= ((entry >> 63) & 0x01) << j;
+    }
+
+    columns->Present[i / 64] = present;
+    columns->Write[i / 64] = write;
+    columns->LargePage[i / 64] = large_page;
+    columns->ExecuteDisable[i / 64] = execute_disable;
+  }
+}
+
+#ifdef IA32_DECODE_X86
+
+IA32_DECODE_TARGET("avx2")
+static inline void ia32_decode_pdpte_avx2(const UINT64* entries, PDPTE_COLUMNS* columns)
+{
+  UINT32 i;
+  UINT32 j;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i += 64)
+  {
+    UINT64 present = 0;
+    UINT64 write = 0;
+    UINT64 large_page = 0;
+    UINT64 execute_disable = 0;
+
+    for (j = 0; j < 64; j += 4)
+    {
+      __m256i entry = _mm256_loadu_si256((const __m256i*)(entries + i + j));
+
+      present |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_slli_epi64(entry, 63))) << j;
+      write |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_slli_epi64(entry, 62))) << j;
+      large_page |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_slli_epi64(entry, 56))) << j;
+      _mm256_storeu_si256((__m256i*)(columns->PageFrameNumber + i + j),
+                          _mm256_and_si256(_mm256_srli_epi64(entry, 12), _mm256_set1_epi64x((long long)0xFFFFFFFFFULL)));
+      execute_disable |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(entry)) << j;
+    }
+
+    columns->Present[i / 64] = present;
+    columns->Write[i / 64] = write;
+    columns->LargePage[i / 64] = large_page;
+    columns->ExecuteDisable[i / 64] = execute_disable;
+  }
+}
+
+IA32_DECODE_TARGET("avx512f")
+static inline void ia32_decode_pdpte_avx512(const UINT64* entries, PDPTE_COLUMNS* columns)
+{
+  UINT32 i;
+  UINT32 j;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i += 64)
+  {
+    UINT64 present = 0;
+    UINT64 write = 0;
+    UINT64 large_page = 0;
+    UINT64 execute_disable = 0;
+
+    for (j = 0; j < 64; j += 8)
+    {
+      __m512i entry = _mm512_loadu_si512((const void*)(entries + i + j));
+
+      present |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x01ULL)) << j;
+      write |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x02ULL)) << j;
+      large_page |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x80ULL)) << j;
+      _mm512_storeu_si512((void*)(columns->PageFrameNumber + i + j),
+                          _mm512_and_si512(_mm512_maskz_srli_epi64(0xFF, entry, 12), _mm512_set1_epi64((long long)0xFFFFFFFFFULL)));
+      execute_disable |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x8000000000000000ULL)) << j;
+    }
+
+    columns->Present[i / 64] = present;
+    columns->Write[i / 64] = write;
+    columns->LargePage[i / 64] = large_page;
+    columns->ExecuteDisable[i / 64] = execute_disable;
+  }
+}
+
+#endif
+
+/**
+ * @brief Decodes 512 entries of PDPTE table into columns - by the widest decoder supported by the CPU.
+ */
+static inline void ia32_decode_pdpte(const UINT64* entries, PDPTE_COLUMNS* columns)
+{
+#ifdef IA32_DECODE_X86
+  switch (ia32_decode_level())
+  {
+    case IA32_DECODE_AVX512:
+      ia32_decode_pdpte_avx512(entries, columns);
+      return;
+
+    case IA32_DECODE_AVX2:
+      ia32_decode_pdpte_avx2(entries, columns);
+      return;
+  }
+#endif
+
+  ia32_decode_pdpte_scalar(entries, columns);
+}
+
+/**
+ * @brief Columns of the decoded PDE table.
+ */
+typedef struct
+{
+  UINT64 Present[IA32_DECODE_BITMAP_SIZE];
+  UINT64 Write[IA32_DECODE_BITMAP_SIZE];
+  UINT64 LargePage[IA32_DECODE_BITMAP_SIZE];
+  UINT64 PageFrameNumber[IA32_DECODE_ENTRY_COUNT];
+  UINT64 ExecuteDisable[IA32_DECODE_BITMAP_SIZE];
+} PDE_COLUMNS;
+
+static inline void ia32_decode_pde_scalar(const UINT64* entries, PDE_COLUMNS* columns)
+{
+  UINT32 i;
+  UINT32 j;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i += 64)
+  {
+    UINT64 present = 0;
+    UINT64 write = 0;
+    UINT64 large_page = 0;
+    UINT64 execute_disable = 0;
+
+    for (j = 0; j < 64; j += 1)
+    {
+      UINT64 entry = entries[i + j];
+
+      present |= ((entry >> 0) & 0x01) << j;
+      write |= ((entry >> 1) & 0x01) << j;
+      large_page |= ((entry >> 7) & 0x01) << j;
+      columns->PageFrameNumber[i + j] = (entry >> 12) & 0xFFFFFFFFFULL;
+      execute_disable |= ((entry >> 63) & 0x01) << j;
+    }
+
+    columns->Present[i / 64] = present;
+    columns->Write[i / 64] = write;
+    columns->LargePage[i / 64] = large_page;
+    columns->ExecuteDisable[i / 64] = execute_disable;
+  }
+}
+
+#ifdef IA32_DECODE_X86
+
+IA32_DECODE_TARGET("avx2")
+static inline void ia32_decode_pde_avx2(const UINT64* entries, PDE_COLUMNS* columns)
+{
+  UINT32 i;
+  UINT32 j;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i += 64)
+  {
+    UINT64 present = 0;
+    UINT64 write = 0;
+    UINT64 large_page = 0;
+    UINT64 execute_disable = 0;
+
+    for (j = 0; j < 64; j += 4)
+    {
+      __m256i entry = _mm256_loadu_si256((const __m256i*)(entries + i + j));
+
+      present |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_slli_epi64(entry, 63))) << j;
+      write |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_slli_epi64(entry, 62))) << j;
+      large_page |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_slli_epi64(entry, 56))) << j;
+      _mm256_storeu_si256((__m256i*)(columns->PageFrameNumber + i + j),
+                          _mm256_and_si256(_mm256_srli_epi64(entry, 12), _mm256_set1_epi64x((long long)0xFFFFFFFFFULL)));
+      execute_disable |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(entry)) << j;
+    }
+
+    columns->Present[i / 64] = present;
+    columns->Write[i / 64] = write;
+    columns->LargePage[i / 64] = large_page;
+    columns->ExecuteDisable[i / 64] = execute_disable;
+  }
+}
+
+IA32_DECODE_TARGET("avx512f")
+static inline void ia32_decode_pde_avx512(const UINT64* entries, PDE_COLUMNS* columns)
+{
+  UINT32 i;
+  UINT32 j;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i += 64)
+  {
+    UINT64 present = 0;
+    UINT64 write = 0;
+    UINT64 large_page = 0;
+    UINT64 execute_disable = 0;
+
+    for (j = 0; j < 64; j += 8)
+    {
+      __m512i entry = _mm512_loadu_si512((const void*)(entries + i + j));
+
+      present |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x01ULL)) << j;
+      write |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x02ULL)) << j;
+      large_page |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x80ULL)) << j;
+      _mm512_storeu_si512((void*)(columns->PageFrameNumber + i + j),
+                          _mm512_and_si512(_mm512_maskz_srli_epi64(0xFF, entry, 12), _mm512_set1_epi64((long long)0xFFFFFFFFFULL)));
+      execute_disable |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x8000000000000000ULL)) << j;
+    }
+
+    columns->Present[i / 64] = present;
+    columns->Write[i / 64] = write;
+    columns->LargePage[i / 64] = large_page;
+    columns->ExecuteDisable[i / 64] = execute_disable;
+  }
+}
+
+#endif
+
+/**
+ * @brief Decodes 512 entries of PDE table into columns - by the widest decoder supported by the CPU.
+ */
+static inline void ia32_decode_pde(const UINT64* entries, PDE_COLUMNS* columns)
+{
+#ifdef IA32_DECODE_X86
+  switch (ia32_decode_level())
+  {
+    case IA32_DECODE_AVX512:
+      ia32_decode_pde_avx512(entries, columns);
+      return;
+
+    case IA32_DECODE_AVX2:
+      ia32_decode_pde_avx2(entries, columns);
+      return;
+  }
+#endif
+
+  ia32_decode_pde_scalar(entries, columns);
+}
+
+/**
+ * @brief Columns of the decoded PTE table.
+ */
+typedef struct
+{
+  UINT64 Present[IA32_DECODE_BITMAP_SIZE];
+  UINT64 Write[IA32_DECODE_BITMAP_SIZE];
+  UINT64 PageFrameNumber[IA32_DECODE_ENTRY_COUNT];
+  UINT64 ExecuteDisable[IA32_DECODE_BITMAP_SIZE];
+} PTE_COLUMNS;
+
+static inline void ia32_decode_pte_scalar(const UINT64* entries, PTE_COLUMNS* columns)
+{
+  UINT32 i;
+  UINT32 j;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i += 64)
+  {
+    UINT64 present = 0;
+    UINT64 write = 0;
+    UINT64 execute_disable = 0;
+
+    for (j = 0; j < 64; j += 1)
+    {
+      UINT64 entry = entries[i + j];
+
+      present |= ((entry >> 0) & 0x01) << j;
+      write |= ((entry >> 1) & 0x01) << j;
+      columns->PageFrameNumber[i + j] = (entry >> 12) & 0xFFFFFFFFFULL;
+      execute_disable |= ((entry >> 63) & 0x01) << j;
+    }
+
+    columns->Present[i / 64] = present;
+    columns->Write[i / 64] = write;
+    columns->ExecuteDisable[i / 64] = execute_disable;
+  }
+}
+
+#ifdef IA32_DECODE_X86
+
+IA32_DECODE_TARGET("avx2")
+static inline void ia32_decode_pte_avx2(const UINT64* entries, PTE_COLUMNS* columns)
+{
+  UINT32 i;
+  UINT32 j;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i += 64)
+  {
+    UINT64 present = 0;
+    UINT64 write = 0;
+    UINT64 execute_disable = 0;
+
+    for (j = 0; j < 64; j += 4)
+    {
+      __m256i entry = _mm256_loadu_si256((const __m256i*)(entries + i + j));
+
+      present |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_slli_epi64(entry, 63))) << j;
+      write |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_slli_epi64(entry, 62))) << j;
+      _mm256_storeu_si256((__m256i*)(columns->PageFrameNumber + i + j),
+                          _mm256_and_si256(_mm256_srli_epi64(entry, 12), _mm256_set1_epi64x((long long)0xFFFFFFFFFULL)));
+      execute_disable |= (UINT64)_mm256_movemask_pd(_mm256_castsi256_pd(entry)) << j;
+    }
+
+    columns->Present[i / 64] = present;
+    columns->Write[i / 64] = write;
+    columns->ExecuteDisable[i / 64] = execute_disable;
+  }
+}
+
+IA32_DECODE_TARGET("avx512f")
+static inline void ia32_decode_pte_avx512(const UINT64* entries, PTE_COLUMNS* columns)
+{
+  UINT32 i;
+  UINT32 j;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i += 64)
+  {
+    UINT64 present = 0;
+    UINT64 write = 0;
+    UINT64 execute_disable = 0;
+
+    for (j = 0; j < 64; j += 8)
+    {
+      __m512i entry = _mm512_loadu_si512((const void*)(entries + i + j));
+
+      present |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x01ULL)) << j;
+      write |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x02ULL)) << j;
+      _mm512_storeu_si512((void*)(columns->PageFrameNumber + i + j),
+                          _mm512_and_si512(_mm512_maskz_srli_epi64(0xFF, entry, 12), _mm512_set1_epi64((long long)0xFFFFFFFFFULL)));
+      execute_disable |= (UINT64)_mm512_test_epi64_mask(entry, _mm512_set1_epi64((long long)0x8000000000000000ULL)) << j;
+    }
+
+    columns->Present[i / 64] = present;
+    columns->Write[i / 64] = write;
+    columns->ExecuteDisable[i / 64] = execute_disable;
+  }
+}
+
+#endif
+
+/**
+ * @brief Decodes 512 entries of PTE table into columns - by the widest decoder supported by the CPU.
+ */
+static inline void ia32_decode_pte(const UINT64* entries, PTE_COLUMNS* columns)
+{
+#ifdef IA32_DECODE_X86
+  switch (ia32_decode_level())
+  {
+    case IA32_DECODE_AVX512:
+      ia32_decode_pte_avx512(entries, columns);
+      return;
+
+    case IA32_DECODE_AVX2:
+      ia32_decode_pte_avx2(entries, columns);
+      return;
+  }
+#endif
+
+  ia32_decode_pte_scalar(entries, columns);
+}
+
@@ -0,0 +1,57 @@
+/*
+ * Functions of codegen.cpp written with bitfields of the C header - the
+ * accessors must not need more instructions than these.
+ */
+#include "ia32.h"
+
+UINT64 pte_get_page_frame_number_bitfield(const PTE* pte)
+{
+  return pte->PageFrameNumber;
+}
+
+void pte_set_page_frame_number_bitfield(PTE* pte, UINT64 pfn)
+{
+  pte->PageFrameNumber = pfn;
+}
+
+void pte_update_bitfield(volatile PTE* entry)
+{
+  entry->Write = 0;
+  entry->ExecuteDisable = 1;
+}
+
+UINT64 ept_entry_get_memory_type_bitfield(const EPT_ENTRY* ept_entry)
+{
+  return ept_entry->MemoryType;
+}
+
+void ept_entry_set_write_access_bitfield(EPT_ENTRY* ept_entry, UINT64 value)
+{
+  ept_entry->WriteAccess = value;
+}
+
+UINT64 cr4_get_vmx_enable_bitfield(const CR4* cr4)
+{
+  return cr4->VmxEnable;
+}
+
+void cr4_set_vmx_enable_bitfield(CR4* cr4, UINT64 value)
+{
+  cr4->VmxEnable = value;
+}
+
+UINT64 epte_build_bitfield(UINT64 pfn)
+{
+  EPTE epte = { 0 };
+  epte.ReadAccess = 1;
+  epte.WriteAccess = 1;
+  epte.MemoryType = MEMORY_TYPE_WRITE_BACK;
+  epte.PageFrameNumber = pfn;
+  return epte.Flags;
+}
+
+void epte_update_bitfield(EPTE* epte)
+{
+  epte->WriteAccess = 0;
+  epte->SuppressVe = 1;
+}
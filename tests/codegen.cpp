@@ -0,0 +1,59 @@
+/*
+ * Accessors of --accessors header compiled at -O2 - instructions of every
+ * function are counted by codegen.py (see codegen.c for the same functions
+ * written with bitfields).
+ */
+#include "ia32_accessors.hpp"
+
+extern "C" {
+
+UINT64 pte_get_page_frame_number(const PTE* pte)
+{
+  return pte->get_page_frame_number();
+}
+
+void pte_set_page_frame_number(PTE* pte, UINT64 pfn)
+{
+  pte->set_page_frame_number(pfn);
+}
+
+void pte_update(volatile UINT64* entry)
+{
+  PTE pte = { *entry };
+  pte.set_write(0);
+  pte.set_execute_disable(1);
+  *entry = pte.Flags;
+}
+
+UINT64 ept_entry_get_memory_type(const EPT_ENTRY* ept_entry)
+{
+  return ept_entry->get_memory_type();
+}
+
+void ept_entry_set_write_access(EPT_ENTRY* ept_entry, UINT64 value)
+{
+  ept_entry->set_write_access(value);
+}
+
+UINT64 cr4_get_vmx_enable(const CR4* cr4)
+{
+  return cr4->get_vmx_enable();
+}
+
+void cr4_set_vmx_enable(CR4* cr4, UINT64 value)
+{
+  cr4->set_vmx_enable(value);
+}
+
+UINT64 epte_build(UINT64 pfn)
+{
+  EPTE epte = EPTE::with().read_access(1).write_access(1).memory_type(MEMORY_TYPE_WRITE_BACK).page_frame_number(pfn);
+  return epte.Flags;
+}
+
+void epte_update(EPTE* epte)
+{
+  epte->apply(EPTE::with().write_access(0).suppress_ve(1));
+}
+
+}
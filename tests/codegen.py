@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+'''
+Counts instructions of the functions of codegen.cpp (accessors) and codegen.c
+(bitfields) in the disassembly of the library holding both and fails when
+an accessor needs more instructions than its bitfield counterpart - or than
+its budget, with --budgets.
+
+Budgets are the counts of x86-64 GCC 12 at -O2, other compilers (and their
+versions) are compared only to the bitfields. endbr64 and padding after
+the final ret are not counted.
+'''
+
+from typing import Dict, List
+
+import argparse
+import re
+import subprocess
+import sys
+
+CODEGEN_BUDGETS = {
+    'pte_get_page_frame_number': 4,
+    'pte_set_page_frame_number': 8,
+    'pte_update': 6,                    # volatile - one load, one store
+    'ept_entry_get_memory_type': 4,
+    'ept_entry_set_write_access': 7,
+    'cr4_get_vmx_enable': 4,
+    'cr4_set_vmx_enable': 7,
+    'epte_build': 6,
+    'epte_update': 5,
+}
+
+CODEGEN_BITFIELD_SUFFIX = '_bitfield'
+
+
+def count_instructions(objdump: str, path: str) -> Dict[str, int]:
+    output = subprocess.run([ objdump, '-d', '--no-show-raw-insn', path ],
+                            check=True, stdout=subprocess.PIPE, universal_newlines=True).stdout
+
+    mnemonic_map: Dict[str, List[str]] = { }
+    name = None
+
+    for line in output.splitlines():
+        match = re.match(r'^[0-9a-f]+ <(\w+)>:$', line)
+
+        if match:
+            name = match.group(1)
+            mnemonic_map[name] = [ ]
+            continue
+
+        match = re.match(r'^\s+[0-9a-f]+:\s+(\S+)', line)
+
+        if match and name is not None and match.group(1) != 'endbr64':
+            mnemonic_map[name].append(match.group(1))
+
+    #
+    # Every instruction up to the next symbol counts (jumps within the
+    # function included), except of the alignment padding after the
+    # final ret.
+    #
+    result = { }
+
+    for name, mnemonic_list in mnemonic_map.items():
+        ret_list = [ index for index, mnemonic in enumerate(mnemonic_list) if mnemonic.startswith('ret') ]
+        result[name] = ret_list[-1] + 1 if ret_list else len(mnemonic_list)
+
+    return result
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description='Compares instruction counts of the accessors and the bitfields.')
+    parser.add_argument('--budgets', action='store_true', help='check also budgets (x86-64 GCC 12 counts)')
+    parser.add_argument('objdump')
+    parser.add_argument('library')
+    args = parser.parse_args()
+
+    count = count_instructions(args.objdump, args.library)
+    result = 0
+
+    print(f'{"function":<32} {"accessor":>8} {"bitfield":>8} {"budget":>8}')
+
+    for name, budget in CODEGEN_BUDGETS.items():
+        if name not in count:
+            print(f'{name}: not found')
+            result = 1
+            continue
+
+        bitfield_count = count.get(name + CODEGEN_BITFIELD_SUFFIX)
+        print(f'{name:<32} {count[name]:>8} {bitfield_count if bitfield_count is not None else "-":>8} {budget:>8}')
+
+        if args.budgets and count[name] > budget:
+            print(f'{name}: {count[name]} instructions, budget is {budget}')
+            result = 1
+
+        if bitfield_count is not None and count[name] > bitfield_count:
+            print(f'{name}: {count[name]} instructions, bitfields need {bitfield_count}')
+            result = 1
+
+    return result
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,166 @@
+/*
+ * Decoders of ia32_decode.h on random entries - columns of every variant
+ * supported by the CPU must match the scalar variant, and the scalar
+ * variant must match the bitfields of the C header.
+ */
+#include "ia32_decode.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define ROUND_COUNT 64
+
+static int failure_count;
+
+static void check(int condition, const char* table, const char* variant, const char* message)
+{
+  if (!condition)
+  {
+    printf("%s (%s): %s\n", table, variant, message);
+    failure_count += 1;
+  }
+}
+
+static UINT64 random_state = 0x9E3779B97F4A7C15;
+
+static UINT64 random_entry(void)
+{
+  /*
+   * xorshift64 - every bit of the entry is random.
+   */
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 7;
+  random_state ^= random_state << 17;
+
+  return random_state;
+}
+
+static UINT64 bitmap_bit(const UINT64* bitmap, int index)
+{
+  return (bitmap[index / 64] >> (index % 64)) & 1;
+}
+
+static void check_fields_pml4e(const UINT64* entries, const PML4E_COLUMNS* columns)
+{
+  int i;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i++)
+  {
+    PML4E entry;
+    entry.Flags = entries[i];
+
+    check(bitmap_bit(columns->Present, i) == entry.Present &&
+          bitmap_bit(columns->Write, i) == entry.Write &&
+          bitmap_bit(columns->ExecuteDisable, i) == entry.ExecuteDisable &&
+          columns->PageFrameNumber[i] == entry.PageFrameNumber, "PML4E", "scalar", "differs from bitfields");
+  }
+}
+
+static void check_fields_pdpte(const UINT64* entries, const PDPTE_COLUMNS* columns)
+{
+  int i;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i++)
+  {
+    PDPTE entry;
+    entry.Flags = entries[i];
+
+    check(bitmap_bit(columns->Present, i) == entry.Present &&
+          bitmap_bit(columns->Write, i) == entry.Write &&
+          bitmap_bit(columns->LargePage, i) == entry.LargePage &&
+          bitmap_bit(columns->ExecuteDisable, i) == entry.ExecuteDisable &&
+          columns->PageFrameNumber[i] == entry.PageFrameNumber, "PDPTE", "scalar", "differs from bitfields");
+  }
+}
+
+static void check_fields_pde(const UINT64* entries, const PDE_COLUMNS* columns)
+{
+  int i;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i++)
+  {
+    PDE entry;
+    entry.Flags = entries[i];
+
+    check(bitmap_bit(columns->Present, i) == entry.Present &&
+          bitmap_bit(columns->Write, i) == entry.Write &&
+          bitmap_bit(columns->LargePage, i) == entry.LargePage &&
+          bitmap_bit(columns->ExecuteDisable, i) == entry.ExecuteDisable &&
+          columns->PageFrameNumber[i] == entry.PageFrameNumber, "PDE", "scalar", "differs from bitfields");
+  }
+}
+
+static void check_fields_pte(const UINT64* entries, const PTE_COLUMNS* columns)
+{
+  int i;
+
+  for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i++)
+  {
+    PTE entry;
+    entry.Flags = entries[i];
+
+    check(bitmap_bit(columns->Present, i) == entry.Present &&
+          bitmap_bit(columns->Write, i) == entry.Write &&
+          bitmap_bit(columns->ExecuteDisable, i) == entry.ExecuteDisable &&
+          columns->PageFrameNumber[i] == entry.PageFrameNumber, "PTE", "scalar", "differs from bitfields");
+  }
+}
+
+#ifdef IA32_DECODE_X86
+#  define CHECK_VECTOR_VARIANTS(NAME, name, entries, scalar, vector)                                     \
+    if (ia32_decode_level() >= IA32_DECODE_AVX2)                                                        \
+    {                                                                                                   \
+      memset(&vector, 0xCC, sizeof(vector));                                                            \
+      ia32_decode_##name##_avx2(entries, &vector);                                                      \
+      check(memcmp(&scalar, &vector, sizeof(vector)) == 0, #NAME, "avx2", "differs from scalar");       \
+    }                                                                                                   \
+                                                                                                        \
+    if (ia32_decode_level() >= IA32_DECODE_AVX512)                                                      \
+    {                                                                                                   \
+      memset(&vector, 0xCC, sizeof(vector));                                                            \
+      ia32_decode_##name##_avx512(entries, &vector);                                                    \
+      check(memcmp(&scalar, &vector, sizeof(vector)) == 0, #NAME, "avx512", "differs from scalar");     \
+    }
+#else
+#  define CHECK_VECTOR_VARIANTS(NAME, name, entries, scalar, vector)
+#endif
+
+#define CHECK_TABLE(NAME, name, entries)                                                                \
+  {                                                                                                     \
+    NAME##_COLUMNS scalar;                                                                              \
+    NAME##_COLUMNS vector;                                                                              \
+                                                                                                        \
+    memset(&scalar, 0xCC, sizeof(scalar));                                                              \
+    ia32_decode_##name##_scalar(entries, &scalar);                                                      \
+    check_fields_##name(entries, &scalar);                                                              \
+                                                                                                        \
+    CHECK_VECTOR_VARIANTS(NAME, name, entries, scalar, vector)                                          \
+                                                                                                        \
+    memset(&vector, 0xCC, sizeof(vector));                                                              \
+    ia32_decode_##name(entries, &vector);                                                               \
+    check(memcmp(&scalar, &vector, sizeof(vector)) == 0, #NAME, "dispatcher", "differs from scalar");   \
+  }
+
+int main(void)
+{
+  static UINT64 entries[IA32_DECODE_ENTRY_COUNT];
+  int round;
+  int i;
+
+  printf("decoder level: %d\n", ia32_decode_level());
+
+  for (round = 0; round < ROUND_COUNT; round++)
+  {
+    for (i = 0; i < IA32_DECODE_ENTRY_COUNT; i++)
+    {
+      entries[i] = random_entry();
+    }
+
+    CHECK_TABLE(PML4E, pml4e, entries)
+    CHECK_TABLE(PDPTE, pdpte, entries)
+    CHECK_TABLE(PDE, pde, entries)
+    CHECK_TABLE(PTE, pte, entries)
+  }
+
+  return failure_count != 0;
+}
@@ -0,0 +1,47 @@
+/*
+ * _SET and _CLEAR of fields at the topmost bit of 32-bit and 64-bit
+ * registers - run with -fsanitize=undefined when available (shifts into
+ * the sign bit are undefined).
+ */
+#include "ia32.h"
+
+#include <stdio.h>
+
+static int failure_count;
+
+static void check(int condition, const char* message)
+{
+  if (!condition)
+  {
+    printf("%s\n", message);
+    failure_count += 1;
+  }
+}
+
+int main(void)
+{
+  /*
+   * Values are volatile - the helpers must not be folded at compile time.
+   * The value is a plain int, as in _SET(flags, 1).
+   */
+  volatile int value = 1;
+  volatile UINT32 flags32 = 0xFFFFFFFF;
+  volatile UINT64 flags64 = 0xFFFFFFFFFFFFFFFF;
+
+  check(CPUID_EAX_07_EBX_AVX512VL_SET((UINT32)0, value) == 0x80000000, "CPUID_EAX_07_EBX_AVX512VL_SET");
+  check(CPUID_EAX_07_EBX_AVX512VL_SET(flags32, 0) == 0x7FFFFFFF, "CPUID_EAX_07_EBX_AVX512VL_SET (0)");
+  check(CPUID_EAX_07_EBX_AVX512VL_CLEAR(flags32) == 0x7FFFFFFF, "CPUID_EAX_07_EBX_AVX512VL_CLEAR");
+  check(CPUID_EAX_07_EBX_AVX512VL((UINT32)0x80000000) == 1, "CPUID_EAX_07_EBX_AVX512VL");
+
+  check(CR0_PAGING_ENABLE_SET((UINT64)0, value) == 0x80000000, "CR0_PAGING_ENABLE_SET");
+  check(CR0_PAGING_ENABLE_CLEAR(flags64) == 0xFFFFFFFF7FFFFFFF, "CR0_PAGING_ENABLE_CLEAR");
+
+  check(PTE_EXECUTE_DISABLE_SET((UINT64)0, value) == 0x8000000000000000, "PTE_EXECUTE_DISABLE_SET");
+  check(PTE_EXECUTE_DISABLE_SET(flags64, 0) == 0x7FFFFFFFFFFFFFFF, "PTE_EXECUTE_DISABLE_SET (0)");
+  check(PTE_EXECUTE_DISABLE_CLEAR(flags64) == 0x7FFFFFFFFFFFFFFF, "PTE_EXECUTE_DISABLE_CLEAR");
+  check(PTE_EXECUTE_DISABLE(flags64) == 1, "PTE_EXECUTE_DISABLE");
+
+  check(PTE_PAGE_FRAME_NUMBER_SET(flags64, 0) == 0xFFFF000000000FFF, "PTE_PAGE_FRAME_NUMBER_SET (0)");
+
+  return failure_count != 0;
+}
@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+'''
+Generates C test of the layout of every union in the C header - every
+bitfield member is set to its _MASK, then the union must hold exactly its
+_FLAG and every other member of the union must read 0.
+
+Members (and their ReservedN fills) are laid out by the generator, while
+_FLAG is taken from the YAML as it is - a field shifted by a wrong fill
+fails the test.
+'''
+
+from typing import Dict, List
+
+import argparse
+import os
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+
+from ia32doc.doc import Doc, DocBase, DocBitfield, DocBitfieldField
+from ia32doc.output import DocOutputBuffer
+from ia32doc.processor import DocProcessor
+
+
+class DocLayoutTest(DocProcessor):
+    '''
+    Emits one check function per top-level typedef holding any bitfield
+    (nested bitfields are checked through the members of their typedef).
+    '''
+
+    def generate(self, doc_list: List[DocBase], include: str, output_path: str) -> None:
+        typedef_map: Dict[str, List[DocBitfield]] = { }
+
+        for root in doc_list:
+            for doc in root.walk():
+                if isinstance(doc, DocBitfield) and any(isinstance(field, DocBitfieldField) for field in doc.fields):
+                    typedef_map.setdefault(self._make_long_name(self._make_member_path(doc)[0]), []).append(doc)
+
+        self.output = DocOutputBuffer()
+        self._print_prologue(include)
+
+        for name, bitfield_list in typedef_map.items():
+            self._print_check(name, bitfield_list)
+
+        self.print(f'int main(void)')
+        self.print(f'{{')
+
+        with self.indent:
+            for name in typedef_map:
+                self.print(f'check_{name}();')
+
+            self.print(f'')
+            self.print(f'return failure_count != 0;')
+
+        self.print(f'}}')
+
+        with open(output_path, 'w', encoding='utf-8') as f:
+            f.write(self.output.getvalue())
+
+    #
+    # Private methods.
+    # ================
+    #
+
+    def _print_prologue(self, include: str) -> None:
+        self.print(f'/*')
+        self.print(f' * Generated by tests/layout.py - do not edit.')
+        self.print(f' */')
+        self.print(f'#include "{include}"')
+        self.print(f'')
+        self.print(f'#include <stdio.h>')
+        self.print(f'#include <string.h>')
+        self.print(f'')
+        self.print(f'static int failure_count;')
+        self.print(f'')
+        self.print(f'static void check(int condition, const char* message)')
+        self.print(f'{{')
+
+        with self.indent:
+            self.print(f'if (!condition)')
+            self.print(f'{{')
+
+            with self.indent:
+                self.print(f'printf("%s\\n", message);')
+                self.print(f'failure_count += 1;')
+
+            self.print(f'}}')
+
+        self.print(f'}}')
+        self.print(f'')
+
+    def _print_check(self, name: str, bitfield_list: List[DocBitfield]) -> None:
+        self.print(f'static void check_{name}(void)')
+        self.print(f'{{')
+
+        with self.indent:
+            self.print(f'{name} value;')
+
+            for doc in bitfield_list:
+                member = self._make_member_access(doc)
+                flags = f'Flags{doc.size_max}' if doc.size_min != doc.size_max else 'Flags'
+                field_list = [ field for field in doc.fields if isinstance(field, DocBitfieldField) ]
+
+                for field in field_list:
+                    definition_prefix = f'{self._make_long_name(doc)}_{self._make_long_name(field)}'
+                    field_name = self._fix_case(self._make_long_name(field))
+                    message = f'{name}{member}.{field_name}'
+                    other_list = [
+                        f'value{member}.{self._fix_case(self._make_long_name(other))} == 0'
+                        for other in field_list if other is not field
+                    ]
+
+                    self.print(f'')
+                    self.print(f'memset(&value, 0, sizeof(value));')
+                    self.print(f'value{member}.{field_name} = {definition_prefix}_MASK;')
+                    self.print(f'check(value{member}.{flags} == {definition_prefix}_FLAG, "{message}: not at {definition_prefix}_FLAG");')
+
+                    if other_list:
+                        self.print(f'check({" && ".join(other_list)}, "{message}: overlaps other fields");')
+
+        self.print(f'}}')
+        self.print(f'')
+
+    def _make_member_access(self, doc: DocBase) -> str:
+        '''
+        Returns access to the nested typedef from its top-level typedef
+        (eg. ".CpuidVersionInformation"), empty for the top-level typedef.
+        '''
+        return ''.join(f'.{member}' for member in self._make_member_path(doc)[1])
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description='Generates layout test of the C header.')
+    parser.add_argument('-i', '--input', default=os.path.join('yaml', 'Intel', 'index.yml'))
+    parser.add_argument('--include', default='ia32.h')
+    parser.add_argument('-o', '--output', required=True)
+    args = parser.parse_args()
+
+    DocLayoutTest().generate(Doc.parse(args.input), args.include, args.output)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
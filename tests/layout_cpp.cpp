@@ -0,0 +1,9 @@
+/*
+ * Size of every struct and union of --cpp header (C++11).
+ */
+#include "ia32_cpp.h"
+
+int main()
+{
+  return 0;
+}
@@ -0,0 +1,30 @@
+/*
+ * Size of every class of the typed C++20 header (it includes the C header)
+ * and types its classes are converted from.
+ */
+#include "ia32.hpp"
+
+#include <cstdint>
+
+template <typename Register, typename T>
+concept convertible_from = requires(const T& raw) { Register::from(raw); };
+
+static_assert(convertible_from<ia32::CR4, UINT64>);
+static_assert(convertible_from<ia32::CR4, std::uint64_t>);
+static_assert(convertible_from<ia32::CR4, ::CR4>);
+static_assert(convertible_from<ia32::CPUID_VERSION_INFORMATION, decltype(::CPUID_EAX_01::CpuidVersionInformation)>);
+
+//
+// Other registers, signed and floating-point types and integers of other
+// widths are rejected.
+//
+static_assert(!convertible_from<ia32::CR4, ia32::PTE>);
+static_assert(!convertible_from<ia32::CR4, ::PTE>);
+static_assert(!convertible_from<ia32::CR4, double>);
+static_assert(!convertible_from<ia32::CR4, std::int64_t>);
+static_assert(!convertible_from<ia32::CR4, UINT32>);
+
+int main()
+{
+  return ia32::CR4::from(UINT64(0x2000)).vmx_enable() == 1 ? 0 : 1;
+}
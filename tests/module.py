@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+'''
+Compiles partitions of the --module output in the order listed by its
+build_order.txt, then builds and runs a consumer which imports the module.
+Module interfaces (gcm.cache) and objects are written to the current
+directory.
+'''
+
+from typing import List
+
+import os
+import subprocess
+import sys
+
+MODULE_FLAGS = [ '-std=c++20', '-fmodules-ts', '-Wall', '-Wextra', '-Werror' ]
+
+
+def compile_source(compiler: str, path: str, args: List[str]) -> str:
+    object_path = os.path.splitext(os.path.basename(path))[0] + '.o'
+    print(f'Compiling "{path}"...')
+    subprocess.run([ compiler ] + MODULE_FLAGS + args + [ '-c', path, '-o', object_path ], check=True)
+
+    return object_path
+
+
+def main() -> int:
+    if len(sys.argv) != 4:
+        print(f'usage: {sys.argv[0]} COMPILER BUILD_ORDER CONSUMER')
+        return 2
+
+    compiler, build_order_path, consumer_path = sys.argv[1:]
+
+    #
+    # Paths in build_order.txt are relative to the primary interface,
+    # which is in the parent of the directory holding the list.
+    #
+    module_directory = os.path.dirname(os.path.dirname(os.path.abspath(build_order_path)))
+
+    with open(build_order_path, encoding='utf-8') as f:
+        path_list = [ os.path.join(module_directory, line.strip()) for line in f if line.strip() ]
+
+    try:
+        object_list = [ compile_source(compiler, path, [ '-x', 'c++' ]) for path in path_list ]
+        object_list.append(compile_source(compiler, consumer_path, [ ]))
+
+        subprocess.run([ compiler ] + object_list + [ '-o', 'module_consumer' ], check=True)
+        subprocess.run([ os.path.abspath('module_consumer') ], check=True)
+    except subprocess.CalledProcessError as e:
+        print(f'"{" ".join(e.cmd)}" failed')
+        return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
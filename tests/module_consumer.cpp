@@ -0,0 +1,16 @@
+/*
+ * Consumer of the --module output - typedefs, constants and functions of
+ * the partitions are visible through the primary interface.
+ */
+import ia32;
+
+int main()
+{
+  PTE pte;
+  pte.Flags = 0;
+  pte.ExecuteDisable = 1;
+
+  static_assert(PTE_EXECUTE_DISABLE_FLAG == 0x8000000000000000ULL, "PTE_EXECUTE_DISABLE_FLAG");
+
+  return pte.Flags == PTE_EXECUTE_DISABLE_FLAG && PTE_EXECUTE_DISABLE(pte.Flags) == 1 ? 0 : 1;
+}